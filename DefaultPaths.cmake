@@ -25,6 +25,9 @@ if(APPLE)
 
 	set(XML2_INC /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/include/libxml2)
 	set(XML2_LIBS /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/lib/libxml2.tbd)
+
+	set(ZLIB_INC /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/include)
+	set(ZLIB_LIBS /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/lib/libz.tbd)
 else()
 	# Searching for PostgreSQL headers/libraries
 	# This command attempts to find the library, REQUIRED argument is optional
@@ -37,6 +40,11 @@ else()
 	find_package(LibXml2 REQUIRED)
 	set(XML2_INC ${LIBXML2_INCLUDE_DIR})
 	set(XML2_LIBS ${LIBXML2_LIBRARY})
+
+	# Searching for zlib headers/libraries (used by the streamed PNG export)
+	find_package(ZLIB REQUIRED)
+	set(ZLIB_INC ${ZLIB_INCLUDE_DIRS})
+	set(ZLIB_LIBS ${ZLIB_LIBRARIES})
 endif()
 
 # Subproject variables
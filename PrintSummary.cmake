@@ -19,6 +19,8 @@ function(print_build_summary)
     message("* PostgreSQL library = ${PGSQL_LIBS}")
     message("* LibXml2 headers    = ${XML2_INC}")
     message("* LibXml2 library    = ${XML2_LIBS}")
+    message("* Zlib headers       = ${ZLIB_INC}")
+    message("* Zlib library       = ${ZLIB_LIBS}")
     message("* Clang-tidy binary  = ${CLANG_TIDY_EXE}")
 
     message("\n[ Extra build options / Info ]")
@@ -32,6 +34,7 @@ function(print_build_summary)
 	message("* BUILD_PRIV_CODE    = ${BUILD_PRIV_CODE}")
 	message("* BUILD_PRIV_ASSETS  = ${BUILD_PRIV_ASSETS}")
     message("* BUILD_TESTS        = ${BUILD_TESTS}")
+    message("* BUILD_BENCHMARKS   = ${BUILD_BENCHMARKS}")
     message("* USE_CLANG_TIDY     = ${USE_CLANG_TIDY}")
     message("* USE_ADDR_SANITIZER = ${USE_ADDR_SANITIZER}")
 	message("* CMAKE_BUILD_TYPE   = ${CMAKE_BUILD_TYPE}\n")
@@ -0,0 +1,136 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QSysInfo>
+#include <QTemporaryDir>
+#include <QXmlStreamReader>
+#include <QDebug>
+#include "globalattributes.h"
+
+/* Reads the QtTest XML report of a benchmark executable appending
+ * each measurement (one per data tag) to the results array */
+static bool readBenchmarkResults(const QString &bench_name, const QString &report_file, QJsonArray &results)
+{
+	QFile file(report_file);
+	QXmlStreamReader xml;
+	QString func_name;
+	QJsonObject result;
+
+	if(!file.open(QFile::ReadOnly))
+		return false;
+
+	xml.setDevice(&file);
+
+	while(!xml.atEnd())
+	{
+		if(xml.readNext() != QXmlStreamReader::StartElement)
+			continue;
+
+		if(xml.name() == QString("TestFunction"))
+			func_name = xml.attributes().value("name").toString();
+		else if(xml.name() == QString("BenchmarkResult"))
+		{
+			result = QJsonObject();
+			result["benchmark"] = bench_name;
+			result["function"] = func_name;
+			result["tag"] = xml.attributes().value("tag").toString();
+			result["metric"] = xml.attributes().value("metric").toString();
+			result["value"] = xml.attributes().value("value").toDouble();
+			result["iterations"] = xml.attributes().value("iterations").toInt();
+			results.append(result);
+		}
+	}
+
+	return !xml.hasError();
+}
+
+/* Runs all the benchmark executables found in BINDIR/benchmarks writing the
+ * collected measurements into a JSON file (default: benchmarks.json in the
+ * working directory). The extra arguments are forwarded to each executable */
+int main(int argc, char **argv)
+{
+	QCoreApplication app(argc, argv);
+	QStringList args = app.arguments(), benchs, bench_args;
+	QString bench_dir = QString("%1/%2").arg(BINDIR).arg("benchmarks"),
+			output = "benchmarks.json", report_file;
+	QTemporaryDir tmp_dir;
+	QJsonObject root;
+	QJsonArray results;
+	QFile file;
+	int result = 0;
+
+	args.removeFirst();
+
+	if(!args.isEmpty() && !args.front().startsWith('-'))
+		output = args.takeFirst();
+
+	bench_args = args;
+	benchs = QDir(bench_dir).entryList(QDir::Files | QDir::NoDotAndDotDot | QDir::Executable);
+
+	//Removing the runbenchmarks from the list of available benchmarks
+	benchs.removeOne(QFileInfo(app.applicationFilePath()).fileName());
+
+	for(auto &bench : benchs)
+	{
+		report_file = tmp_dir.filePath(bench + ".xml");
+		result = QProcess::execute(bench_dir + "/" + bench,
+															 QStringList { "-o", report_file + ",xml", "-o", "-,txt" } + bench_args);
+
+		if(result == -2)
+			qDebug().noquote() << "** Could not start benchmark executable:" << bench;
+		else if(result == -1)
+			qDebug().noquote() << "** The benchmark " << bench << " crashed when running.";
+		else if(!readBenchmarkResults(bench, report_file, results))
+			qDebug().noquote() << "** Could not read the results of the benchmark " << bench;
+
+		if(result != 0) break;
+	}
+
+	root["pgmodeler-version"] = GlobalAttributes::PgModelerVersion;
+	root["build-number"] = GlobalAttributes::PgModelerBuildNumber;
+	root["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+	root["host"] = QSysInfo::machineHostName();
+	root["cpu-arch"] = QSysInfo::currentCpuArchitecture();
+	root["os"] = QSysInfo::prettyProductName();
+	root["results"] = results;
+
+	file.setFileName(output);
+
+	if(!file.open(QFile::WriteOnly | QFile::Truncate))
+	{
+		qDebug().noquote() << "** Could not write the results file:" << output;
+		return 1;
+	}
+
+	file.write(QJsonDocument(root).toJson());
+	file.close();
+	qDebug().noquote() << "** Benchmark results saved to:" << QFileInfo(output).absoluteFilePath();
+
+	return result;
+}
@@ -0,0 +1,304 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "pgmodelerunittest.h"
+#include "modelgenerator.h"
+#include "codecache.h"
+#include "pgsqlversions.h"
+#include "tools/modelsdiffhelper.h"
+#include "tools/modelvalidationhelper.h"
+
+class ModelBenchmark: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	private:
+		QTemporaryDir tmp_dir;
+
+		//! \brief Returns the path to the generated model file of the provided preset
+		QString getModelFile(const QString &preset);
+
+		void loadGeneratedModel(DatabaseModel &model, const QString &preset);
+
+		void addPresetsData();
+
+	public:
+		ModelBenchmark() : PgModelerUnitTest(SCHEMASDIR) {}
+
+	private slots:
+		void initTestCase();
+		void loadModel_data();
+		void loadModel();
+		void saveModel_data();
+		void saveModel();
+		void exportSql_data();
+		void exportSql();
+		void validateModel_data();
+		void validateModel();
+		void revalidateRelationships_data();
+		void revalidateRelationships();
+		void diffModels_data();
+		void diffModels();
+};
+
+QString ModelBenchmark::getModelFile(const QString &preset)
+{
+	return tmp_dir.filePath(preset + ".dbm");
+}
+
+void ModelBenchmark::loadGeneratedModel(DatabaseModel &model, const QString &preset)
+{
+	model.createSystemObjects(false);
+	model.loadModel(getModelFile(preset));
+}
+
+void ModelBenchmark::addPresetsData()
+{
+	QTest::addColumn<QString>("preset");
+
+	for(auto &preset : ModelGenerator::getSelectedPresets())
+		QTest::newRow(preset.toStdString().c_str()) << preset;
+}
+
+void ModelBenchmark::initTestCase()
+{
+	QVERIFY(tmp_dir.isValid());
+
+	try
+	{
+		// The models are generated only once and saved so all benchmarks start from the same files
+		for(auto &preset : ModelGenerator::getSelectedPresets())
+		{
+			DatabaseModel model;
+			ModelGenerator generator(ModelGenerator::getPreset(preset));
+
+			generator.generate(&model);
+			model.saveModel(getModelFile(preset), SchemaParser::XmlCode);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::loadModel_data()
+{
+	addPresetsData();
+}
+
+void ModelBenchmark::loadModel()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		QBENCHMARK
+		{
+			DatabaseModel model;
+			loadGeneratedModel(model, preset);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::saveModel_data()
+{
+	addPresetsData();
+}
+
+void ModelBenchmark::saveModel()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		QString output = tmp_dir.filePath(preset + "_saved.dbm");
+
+		loadGeneratedModel(model, preset);
+
+		// Clearing the code cache forces the XML of each object to be generated again
+		QBENCHMARK
+		{
+			CodeCache::clear();
+			model.saveModel(output, SchemaParser::XmlCode);
+		}
+
+		QVERIFY(QFileInfo(output).size() > 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::exportSql_data()
+{
+	addPresetsData();
+}
+
+void ModelBenchmark::exportSql()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		QString sql;
+
+		loadGeneratedModel(model, preset);
+
+		QBENCHMARK
+		{
+			CodeCache::clear();
+			sql = model.getSourceCode(SchemaParser::SqlCode);
+		}
+
+		QVERIFY(!sql.isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::validateModel_data()
+{
+	addPresetsData();
+}
+
+void ModelBenchmark::validateModel()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		ModelValidationHelper validation_hlp;
+		unsigned error_count = 0;
+
+		loadGeneratedModel(model, preset);
+		validation_hlp.setValidationParams(&model, nullptr, PgSqlVersions::DefaulVersion);
+
+		QBENCHMARK
+		{
+			validation_hlp.validateModel();
+		}
+
+		error_count = validation_hlp.getErrorCount();
+		QVERIFY2(error_count == 0, QString("%1 validation error(s) found in the generated model").arg(error_count).toStdString().c_str());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::revalidateRelationships_data()
+{
+	addPresetsData();
+}
+
+void ModelBenchmark::revalidateRelationships()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		std::vector<BaseObject *> *rels = nullptr;
+		Table *src_table = nullptr;
+		Column *pk_col = nullptr;
+
+		loadGeneratedModel(model, preset);
+		rels = model.getObjectList(ObjectType::Relationship);
+
+		if(rels->empty())
+			QSKIP("The generated model has no relationships to be revalidated.");
+
+		/* Notifying a change in the primary key column of a relationship's source table
+		 * makes the model disconnect and validate all relationships again */
+		src_table = dynamic_cast<Table *>(dynamic_cast<Relationship *>(rels->front())->getTable(BaseRelationship::SrcTable));
+		pk_col = src_table->getColumn("id");
+
+		QBENCHMARK
+		{
+			model.validateRelationships(pk_col, src_table);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::diffModels_data()
+{
+	addPresetsData();
+}
+
+void ModelBenchmark::diffModels()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel src_model, imp_model;
+		ModelsDiffHelper diff_hlp;
+		QString diff_error;
+
+		loadGeneratedModel(src_model, preset);
+		loadGeneratedModel(imp_model, preset);
+		ModelGenerator::changeModel(&src_model, 0.1);
+
+		connect(&diff_hlp, &ModelsDiffHelper::s_diffAborted, this, [&diff_error](Exception e){
+			diff_error = e.getExceptionsText();
+		});
+
+		diff_hlp.setModels(&src_model, &imp_model);
+		diff_hlp.setPgSQLVersion(PgSqlVersions::DefaulVersion);
+		diff_hlp.setDiffOption(ModelsDiffHelper::OptKeepClusterObjs, true);
+		diff_hlp.setDiffOption(ModelsDiffHelper::OptCascadeMode, true);
+		diff_hlp.setDiffOption(ModelsDiffHelper::OptKeepObjectPerms, true);
+		diff_hlp.setDiffOption(ModelsDiffHelper::OptReuseSequences, true);
+		diff_hlp.setDiffOption(ModelsDiffHelper::OptPreserveDbName, true);
+
+		QBENCHMARK
+		{
+			diff_hlp.diffModels();
+		}
+
+		QVERIFY2(diff_error.isEmpty(), diff_error.toStdString().c_str());
+		QVERIFY(!diff_hlp.getDiffDefinition().isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelBenchmark)
+#include "modelbenchmark.moc"
@@ -0,0 +1,400 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <cmath>
+#include "modelgenerator.h"
+#include "defaultlanguages.h"
+#include "relationship.h"
+
+const QString ModelGenerator::PresetsEnvVar {"PGMODELER_BENCH_PRESETS"};
+
+ModelGenerator::ModelGenerator(const Settings &settings)
+{
+	this->settings = settings;
+	rand_gen.seed(settings.seed);
+}
+
+bool ModelGenerator::randomChance(double probability)
+{
+	return rand_gen.generateDouble() < probability;
+}
+
+void ModelGenerator::generate(DatabaseModel *model)
+{
+	if(!model)
+		throw Exception(ErrorCode::OprNotAllocatedObject, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	try
+	{
+		std::vector<Schema *> schemas;
+		std::vector<Table *> tables;
+
+		rand_gen.seed(settings.seed);
+		model->setName("bench_db");
+		model->createSystemObjects(true);
+
+		createSchemas(model, schemas);
+		createTables(model, schemas, tables);
+		createForeignKeys(model, tables);
+		createRelationships(model, tables);
+		createViews(model, schemas);
+		createFunctions(model, schemas);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void ModelGenerator::createSchemas(DatabaseModel *model, std::vector<Schema *> &schemas)
+{
+	Schema *schema = nullptr;
+
+	for(unsigned sch_id = 0; sch_id < settings.schemas; sch_id++)
+	{
+		schema = new Schema;
+		schema->setName(QString("schema_%1").arg(sch_id));
+		schema->setRectVisible(true);
+		schema->setFillColor(QColor::fromHsv((sch_id * 47) % 360, 60, 230));
+		model->addSchema(schema);
+		schemas.push_back(schema);
+	}
+}
+
+void ModelGenerator::createTables(DatabaseModel *model, const std::vector<Schema *> &schemas, std::vector<Table *> &tables)
+{
+	static const QStringList types {
+		"integer", "bigint", "smallint", "text", "varchar", "boolean",
+		"date", "timestamp", "numeric", "double precision", "uuid", "jsonb"
+	};
+
+	Table *table = nullptr;
+	Column *col = nullptr;
+	Constraint *pk = nullptr;
+	PgSqlType type;
+	unsigned tab_id = 0, grid_cols = 0;
+	double sch_y = 0;
+
+	// Tables are laid out in a grid per schema so the scene benchmarks handle realistic positions
+	grid_cols = qMax<unsigned>(1, static_cast<unsigned>(std::ceil(std::sqrt(settings.tables_per_schema))));
+
+	for(auto &schema : schemas)
+	{
+		for(unsigned idx = 0; idx < settings.tables_per_schema; idx++, tab_id++)
+		{
+			table = new Table;
+			table->setName(QString("table_%1").arg(tab_id));
+			table->setSchema(schema);
+			table->setPosition(QPointF((idx % grid_cols) * 300, sch_y + (idx / grid_cols) * 350));
+
+			col = new Column;
+			col->setName("id");
+			col->setType(PgSqlType("bigint"));
+			col->setNotNull(true);
+			table->addColumn(col);
+
+			for(unsigned col_id = 0; col_id < settings.columns_per_table; col_id++)
+			{
+				type = PgSqlType(types.at(rand_gen.bounded(types.size())));
+
+				if(type == "varchar")
+					type.setLength(32 + rand_gen.bounded(224));
+
+				col = new Column;
+				col->setName(QString("col_%1").arg(col_id));
+				col->setType(type);
+				col->setNotNull(randomChance(0.3));
+				table->addColumn(col);
+			}
+
+			pk = new Constraint;
+			pk->setName(QString("%1_pk").arg(table->getName()));
+			pk->setConstraintType(ConstraintType::PrimaryKey);
+			pk->addColumn(table->getColumn("id"), Constraint::SourceCols);
+			table->addConstraint(pk);
+
+			model->addTable(table);
+			tables.push_back(table);
+		}
+
+		sch_y += ((settings.tables_per_schema / grid_cols) + 2) * 350;
+	}
+}
+
+void ModelGenerator::createForeignKeys(DatabaseModel *model, const std::vector<Table *> &tables)
+{
+	Table *table = nullptr, *ref_table = nullptr;
+	Column *col = nullptr;
+	Constraint *fk = nullptr;
+	unsigned fk_count = 0, base_count = static_cast<unsigned>(settings.fk_density);
+	double extra_prob = settings.fk_density - base_count;
+
+	// Each table only references previously created ones so the FK graph is acyclic
+	for(unsigned tab_id = 1; tab_id < tables.size(); tab_id++)
+	{
+		table = tables[tab_id];
+		fk_count = base_count + (randomChance(extra_prob) ? 1 : 0);
+
+		for(unsigned fk_id = 0; fk_id < fk_count; fk_id++)
+		{
+			ref_table = tables[rand_gen.bounded(tab_id)];
+
+			col = new Column;
+			col->setName(QString("%1_id_%2").arg(ref_table->getName()).arg(fk_id));
+			col->setType(PgSqlType("bigint"));
+			table->addColumn(col);
+
+			fk = new Constraint;
+			fk->setName(QString("%1_fk_%2").arg(table->getName()).arg(fk_id));
+			fk->setConstraintType(ConstraintType::ForeignKey);
+			fk->setReferencedTable(ref_table);
+			fk->setActionType(ActionType::Cascade, Constraint::DeleteAction);
+			fk->addColumn(col, Constraint::SourceCols);
+			fk->addColumn(ref_table->getColumn("id"), Constraint::ReferencedCols);
+			table->addConstraint(fk);
+		}
+	}
+
+	model->updateTablesFKRelationships();
+}
+
+void ModelGenerator::createRelationships(DatabaseModel *model, const std::vector<Table *> &tables)
+{
+	Relationship *rel = nullptr;
+	Table *src_table = nullptr;
+
+	for(unsigned tab_id = 1; tab_id < tables.size(); tab_id++)
+	{
+		if(!randomChance(settings.rel_density))
+			continue;
+
+		src_table = tables[rand_gen.bounded(tab_id)];
+		rel = new Relationship(BaseRelationship::Relationship1n, src_table, tables[tab_id]);
+		rel->setName(QString("rel_%1_%2").arg(src_table->getName(), tables[tab_id]->getName()));
+
+		/* The default foreign key name ({st}_fk) would clash when the same table is the source of
+		 * many relationships, so the destination table name is prepended */
+		rel->setNamePattern(Relationship::SrcFkPattern, Relationship::DstTabToken + Relationship::SuffixSeparator +
+												Relationship::SrcTabToken + Relationship::SuffixSeparator + "fk");
+		model->addRelationship(rel);
+	}
+}
+
+void ModelGenerator::createViews(DatabaseModel *model, const std::vector<Schema *> &schemas)
+{
+	std::vector<BaseObject *> sch_tables;
+	std::vector<Reference> refs;
+	Table *table = nullptr, *join_table = nullptr;
+	View *view = nullptr;
+	unsigned view_id = 0;
+
+	for(auto &schema : schemas)
+	{
+		sch_tables = model->getObjects(ObjectType::Table, schema);
+
+		if(sch_tables.empty())
+			continue;
+
+		for(unsigned idx = 0; idx < settings.views_per_schema; idx++, view_id++)
+		{
+			table = dynamic_cast<Table *>(sch_tables[rand_gen.bounded(static_cast<quint32>(sch_tables.size()))]);
+			join_table = dynamic_cast<Table *>(sch_tables[rand_gen.bounded(static_cast<quint32>(sch_tables.size()))]);
+
+			refs.clear();
+			refs.push_back(Reference(table, "t0", "_t0", false, true, true));
+			refs.push_back(Reference(join_table, "t1", "_t1", false, true, false));
+
+			view = new View;
+			view->setName(QString("view_%1").arg(view_id));
+			view->setSchema(schema);
+			view->setPosition(QPointF(-400, idx * 250));
+			view->setReferences(refs);
+			view->setSqlDefinition("SELECT @{t0}.*, @{t1}.id AS joined_id\nFROM {t0} AS @{t0}\n\tJOIN {t1} AS @{t1} ON @{t0}.id = @{t1}.id");
+			model->addView(view);
+		}
+	}
+}
+
+void ModelGenerator::createFunctions(DatabaseModel *model, const std::vector<Schema *> &schemas)
+{
+	Function *func = nullptr;
+	Language *lang = model->getLanguage(DefaultLanguages::Sql);
+	unsigned func_id = 0;
+
+	for(auto &schema : schemas)
+	{
+		for(unsigned idx = 0; idx < settings.functions_per_schema; idx++, func_id++)
+		{
+			func = new Function;
+			func->setName(QString("func_%1").arg(func_id));
+			func->setSchema(schema);
+			func->setLanguage(lang);
+			func->setReturnType(PgSqlType("bigint"));
+			func->addParameter(Parameter("p_value", PgSqlType("bigint"), true));
+			func->setFunctionSource(QString("SELECT p_value * %1;").arg(func_id + 1));
+			model->addFunction(func);
+		}
+	}
+}
+
+void ModelGenerator::changeModel(DatabaseModel *model, double change_ratio)
+{
+	if(!model)
+		throw Exception(ErrorCode::OprNotAllocatedObject, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	try
+	{
+		std::vector<BaseObject *> tables = *model->getObjectList(ObjectType::Table),
+				views = *model->getObjectList(ObjectType::View);
+		unsigned step = change_ratio > 0 ? qMax<unsigned>(1, static_cast<unsigned>(std::round(1.0 / change_ratio))) : 0;
+		Table *table = nullptr;
+		Column *col = nullptr;
+
+		if(step == 0)
+			return;
+
+		for(unsigned idx = 0; idx < tables.size(); idx += step)
+		{
+			table = dynamic_cast<Table *>(tables[idx]);
+
+			col = new Column;
+			col->setName("bench_extra");
+			col->setType(PgSqlType("text"));
+			table->addColumn(col);
+
+			col = table->getColumn("col_0");
+
+			if(col)
+				col->setType(PgSqlType("text"));
+		}
+
+		for(unsigned idx = 0; idx < views.size(); idx += step)
+		{
+			model->removeView(dynamic_cast<View *>(views[idx]));
+			delete views[idx];
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+QString ModelGenerator::generateCsv(unsigned rows, unsigned columns, unsigned seed)
+{
+	QRandomGenerator rand_gen(seed);
+	QStringList values;
+	QString buffer;
+
+	for(unsigned col = 0; col < columns; col++)
+		values.append(QString("column_%1").arg(col));
+
+	buffer += values.join(';') + "\n";
+
+	for(unsigned row = 0; row < rows; row++)
+	{
+		values.clear();
+
+		for(unsigned col = 0; col < columns; col++)
+		{
+			switch(rand_gen.bounded(4))
+			{
+				case 0:
+					values.append(QString::number(rand_gen.bounded(100000)));
+				break;
+
+				case 1:
+					values.append(QString("\"text; with \"\"quotes\"\" %1\"").arg(row));
+				break;
+
+				case 2:
+					values.append(QString("value_%1_%2").arg(row).arg(col));
+				break;
+
+				default:
+					values.append("");
+				break;
+			}
+		}
+
+		buffer += values.join(';') + "\n";
+	}
+
+	return buffer;
+}
+
+ModelGenerator::Settings ModelGenerator::getPreset(const QString &name)
+{
+	Settings settings;
+
+	if(name == "small")
+	{
+		settings.schemas = 2;
+		settings.tables_per_schema = 10;
+	}
+	else if(name == "medium")
+	{
+		settings.schemas = 5;
+		settings.tables_per_schema = 40;
+		settings.views_per_schema = 5;
+		settings.functions_per_schema = 5;
+	}
+	else if(name == "large")
+	{
+		settings.schemas = 10;
+		settings.tables_per_schema = 100;
+		settings.columns_per_table = 12;
+		settings.views_per_schema = 10;
+		settings.functions_per_schema = 10;
+		settings.fk_density = 1.5;
+	}
+	else if(name == "huge")
+	{
+		settings.schemas = 20;
+		settings.tables_per_schema = 250;
+		settings.columns_per_table = 16;
+		settings.views_per_schema = 20;
+		settings.functions_per_schema = 20;
+		settings.fk_density = 2.0;
+		settings.rel_density = 0.1;
+	}
+
+	return settings;
+}
+
+QStringList ModelGenerator::getPresetNames()
+{
+	return { "small", "medium", "large", "huge" };
+}
+
+QStringList ModelGenerator::getSelectedPresets()
+{
+	QStringList presets = qEnvironmentVariable(PresetsEnvVar.toStdString().c_str(), "small,medium").split(',', Qt::SkipEmptyParts);
+
+	for(auto &preset : presets)
+		preset = preset.trimmed();
+
+	presets.removeIf([](const QString &preset){
+		return !getPresetNames().contains(preset);
+	});
+
+	return presets;
+}
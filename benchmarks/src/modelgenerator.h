@@ -0,0 +1,117 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup benchmarks
+\class ModelGenerator
+\brief Synthesizes database models of arbitrary size to feed the benchmark suite.
+The generated models are fully deterministic (the same settings always produce the same model)
+so the measurements of different runs/revisions can be compared against each other.
+*/
+
+#ifndef MODEL_GENERATOR_H
+#define MODEL_GENERATOR_H
+
+#include <QRandomGenerator>
+#include "databasemodel.h"
+
+class ModelGenerator {
+	public:
+		struct Settings {
+			//! \brief Amount of schemas created in the model
+			unsigned schemas = 2,
+
+			//! \brief Amount of tables created in each schema
+			tables_per_schema = 10,
+
+			//! \brief Amount of columns (besides the primary key) created in each table
+			columns_per_table = 8,
+
+			//! \brief Amount of views created in each schema, each one referencing tables of the same schema
+			views_per_schema = 2,
+
+			//! \brief Amount of functions created in each schema
+			functions_per_schema = 2,
+
+			//! \brief Seed of the random generator used to pick column types and referenced tables
+			seed = 1;
+
+			/*! \brief Average amount of foreign keys per table. The fractional part is the
+			 *  probability of a table having one extra foreign key */
+			double fk_density = 1.0,
+
+			/*! \brief Fraction of the tables that receive a one-to-many relationship (column propagation)
+			 *  from a previously created table */
+			rel_density = 0.2;
+		};
+
+	private:
+		Settings settings;
+
+		QRandomGenerator rand_gen;
+
+		//! \brief Returns true in a probability equal to the provided value (0 to 1)
+		bool randomChance(double probability);
+
+		void createSchemas(DatabaseModel *model, std::vector<Schema *> &schemas);
+
+		void createTables(DatabaseModel *model, const std::vector<Schema *> &schemas, std::vector<Table *> &tables);
+
+		void createForeignKeys(DatabaseModel *model, const std::vector<Table *> &tables);
+
+		void createRelationships(DatabaseModel *model, const std::vector<Table *> &tables);
+
+		void createViews(DatabaseModel *model, const std::vector<Schema *> &schemas);
+
+		void createFunctions(DatabaseModel *model, const std::vector<Schema *> &schemas);
+
+	public:
+		/*! \brief Environment variable holding the comma separated names of the presets used by the
+		 *  benchmarks (default: small,medium) */
+		static const QString PresetsEnvVar;
+
+		ModelGenerator(const Settings &settings);
+
+		/*! \brief Populates the provided model with the objects described by the settings.
+		 *  The model must be empty (no system objects created) */
+		void generate(DatabaseModel *model);
+
+		/*! \brief Applies a deterministic set of changes in a model created by generate() so it
+		 *  can be diffed against a pristine copy. The changes consist in new columns, changed column
+		 *  types and removed views. The fraction of touched objects is controlled by change_ratio (0 to 1) */
+		static void changeModel(DatabaseModel *model, double change_ratio);
+
+		/*! \brief Generates a CSV buffer with the amount of rows/columns provided mixing quoted,
+		 *  unquoted and empty values. The first row holds the column names */
+		static QString generateCsv(unsigned rows, unsigned columns, unsigned seed = 1);
+
+		/*! \brief Returns one of the predefined settings: small, medium, large or huge.
+		 *  Unknown names return the default settings */
+		static Settings getPreset(const QString &name);
+
+		//! \brief Returns the names of the predefined settings in ascending order of size
+		static QStringList getPresetNames();
+
+		//! \brief Returns the valid preset names listed in PresetsEnvVar
+		static QStringList getSelectedPresets();
+};
+
+#endif
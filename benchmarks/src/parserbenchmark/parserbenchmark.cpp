@@ -0,0 +1,290 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "pgmodelerunittest.h"
+#include "modelgenerator.h"
+#include "codecache.h"
+#include "csvparser.h"
+#include "xmlparser.h"
+#include "utils/syntaxhighlighter.h"
+#include <QPlainTextEdit>
+
+class ParserBenchmark: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	private:
+		QTemporaryDir tmp_dir;
+
+		//! \brief Visits all the elements under the current one reading their attributes. Returns the amount of elements visited
+		unsigned walkElements(XmlParser &xmlparser);
+
+		void addPresetsData();
+
+	public:
+		ParserBenchmark() : PgModelerUnitTest(SCHEMASDIR) {}
+
+	private slots:
+		void initTestCase();
+		void renderObjectsCode_data();
+		void renderObjectsCode();
+		void loadXmlFile_data();
+		void loadXmlFile();
+		void parseCsvBuffer_data();
+		void parseCsvBuffer();
+		void parseCsvData_data();
+		void parseCsvData();
+		void highlightSqlScript_data();
+		void highlightSqlScript();
+};
+
+unsigned ParserBenchmark::walkElements(XmlParser &xmlparser)
+{
+	attribs_map attribs;
+	unsigned count = 0;
+
+	do
+	{
+		if(xmlparser.getElementType() != XML_ELEMENT_NODE)
+			continue;
+
+		xmlparser.getElementAttributes(attribs);
+		count++;
+
+		if(xmlparser.hasElement(XmlParser::ChildElement, XML_ELEMENT_NODE))
+		{
+			xmlparser.savePosition();
+			xmlparser.accessElement(XmlParser::ChildElement);
+			count += walkElements(xmlparser);
+			xmlparser.restorePosition();
+		}
+	}
+	while(xmlparser.accessElement(XmlParser::NextElement));
+
+	return count;
+}
+
+void ParserBenchmark::addPresetsData()
+{
+	QTest::addColumn<QString>("preset");
+
+	for(auto &preset : ModelGenerator::getSelectedPresets())
+		QTest::newRow(preset.toStdString().c_str()) << preset;
+}
+
+void ParserBenchmark::initTestCase()
+{
+	QVERIFY(tmp_dir.isValid());
+
+	try
+	{
+		for(auto &preset : ModelGenerator::getSelectedPresets())
+		{
+			DatabaseModel model;
+			ModelGenerator generator(ModelGenerator::getPreset(preset));
+
+			generator.generate(&model);
+			model.saveModel(tmp_dir.filePath(preset + ".dbm"), SchemaParser::XmlCode);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ParserBenchmark::renderObjectsCode_data()
+{
+	addPresetsData();
+}
+
+void ParserBenchmark::renderObjectsCode()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		ModelGenerator generator(ModelGenerator::getPreset(preset));
+		std::vector<BaseObject *> *tables = nullptr;
+		qsizetype code_len = 0;
+
+		generator.generate(&model);
+		tables = model.getObjectList(ObjectType::Table);
+
+		/* The tables' code includes the code of their columns and constraints, so
+		 * this renders the schema files of the most frequent objects in a model */
+		QBENCHMARK
+		{
+			CodeCache::clear();
+			code_len = 0;
+
+			for(auto &table : *tables)
+			{
+				code_len += table->getSourceCode(SchemaParser::SqlCode).size();
+				code_len += table->getSourceCode(SchemaParser::XmlCode).size();
+			}
+		}
+
+		QVERIFY(code_len > 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ParserBenchmark::loadXmlFile_data()
+{
+	addPresetsData();
+}
+
+void ParserBenchmark::loadXmlFile()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		XmlParser xmlparser;
+		QString dtd_file = GlobalAttributes::getSchemasRootPath() + GlobalAttributes::DirSeparator +
+											 GlobalAttributes::XMLSchemaDir + GlobalAttributes::DirSeparator +
+											 GlobalAttributes::ObjectDTDDir + GlobalAttributes::DirSeparator +
+											 GlobalAttributes::RootDTD + GlobalAttributes::ObjectDTDExt;
+		unsigned elem_count = 0;
+
+		QBENCHMARK
+		{
+			xmlparser.restartParser();
+			xmlparser.setDTDFile(dtd_file, GlobalAttributes::RootDTD);
+			xmlparser.loadXMLFile(tmp_dir.filePath(preset + ".dbm"));
+			elem_count = walkElements(xmlparser);
+		}
+
+		QVERIFY(elem_count > 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ParserBenchmark::parseCsvBuffer_data()
+{
+	QTest::addColumn<unsigned>("rows");
+
+	QTest::newRow("1k rows") << 1000u;
+	QTest::newRow("10k rows") << 10000u;
+	QTest::newRow("100k rows") << 100000u;
+}
+
+void ParserBenchmark::parseCsvBuffer()
+{
+	QFETCH(unsigned, rows);
+
+	try
+	{
+		CsvParser csvparser;
+		CsvDocument csvdoc;
+		QString buffer = ModelGenerator::generateCsv(rows, 10);
+
+		csvparser.setColumnInFirstRow(true);
+
+		QBENCHMARK
+		{
+			csvdoc = csvparser.parseBuffer(buffer);
+		}
+
+		QVERIFY(csvdoc.getRowCount() == static_cast<int>(rows));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ParserBenchmark::parseCsvData_data()
+{
+	parseCsvBuffer_data();
+}
+
+void ParserBenchmark::parseCsvData()
+{
+	QFETCH(unsigned, rows);
+
+	try
+	{
+		CsvParser csvparser;
+		QByteArray data = ModelGenerator::generateCsv(rows, 10).toUtf8();
+		int row_cnt = 0;
+		auto row_handler = [](int, const QStringList &) { return true; };
+
+		csvparser.setColumnInFirstRow(true);
+
+		QBENCHMARK
+		{
+			row_cnt = csvparser.parseData(data.constData(), data.size(), row_handler);
+		}
+
+		QVERIFY(row_cnt == static_cast<int>(rows));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ParserBenchmark::highlightSqlScript_data()
+{
+	QTest::addColumn<int>("lines");
+
+	QTest::newRow("5k lines") << 5000;
+	QTest::newRow("50k lines") << 50000;
+}
+
+void ParserBenchmark::highlightSqlScript()
+{
+	QFETCH(int, lines);
+
+	QPlainTextEdit edt;
+	SyntaxHighlighter sql_hl(&edt, false);
+	QStringList script;
+
+	sql_hl.loadConfiguration(GlobalAttributes::getSQLHighlightConfPath());
+
+	for(int i = 0; i < lines; i++)
+	{
+		script.append(QString("SELECT t%1.id, t%1.name::varchar, count(*) FROM public.table_%1 AS t%1 "
+													"WHERE t%1.created_at < now() AND t%1.value IS NOT NULL; -- line %1").arg(i));
+	}
+
+	edt.setPlainText(script.join('\n'));
+
+	QBENCHMARK
+	{
+		sql_hl.rehighlight();
+	}
+
+	QVERIFY(edt.document()->blockCount() == lines);
+}
+
+QTEST_MAIN(ParserBenchmark)
+#include "parserbenchmark.moc"
@@ -0,0 +1,150 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QPainter>
+#include "pgmodelerunittest.h"
+#include "modelgenerator.h"
+#include "objectsscene.h"
+#include "tableview.h"
+#include "graphicalview.h"
+#include "relationshipview.h"
+#include "schemaview.h"
+
+class SceneBenchmark: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	private:
+		/*! \brief Creates the graphical items of all objects in the model adding them to the scene.
+		 *  This mimics what happens when a model file is loaded in the GUI or in the CLI */
+		void populateScene(DatabaseModel &model, ObjectsScene &scene);
+
+		void addPresetsData();
+
+	public:
+		SceneBenchmark() : PgModelerUnitTest(SCHEMASDIR) {}
+
+	private slots:
+		void constructScene_data();
+		void constructScene();
+		void renderScene_data();
+		void renderScene();
+};
+
+void SceneBenchmark::populateScene(DatabaseModel &model, ObjectsScene &scene)
+{
+	scene.blockSignals(true);
+
+	for(auto &obj : *model.getObjectList(ObjectType::Table))
+		scene.addItem(new TableView(dynamic_cast<Table *>(obj)));
+
+	for(auto &obj : *model.getObjectList(ObjectType::View))
+		scene.addItem(new GraphicalView(dynamic_cast<View *>(obj)));
+
+	for(auto &type : { ObjectType::Relationship, ObjectType::BaseRelationship })
+	{
+		for(auto &obj : *model.getObjectList(type))
+			scene.addItem(new RelationshipView(dynamic_cast<BaseRelationship *>(obj)));
+	}
+
+	for(auto &obj : *model.getObjectList(ObjectType::Schema))
+		scene.addItem(new SchemaView(dynamic_cast<Schema *>(obj)));
+
+	scene.adjustSceneRect(true);
+	model.setObjectsModified({ ObjectType::Schema });
+	scene.blockSignals(false);
+}
+
+void SceneBenchmark::addPresetsData()
+{
+	QTest::addColumn<QString>("preset");
+
+	for(auto &preset : ModelGenerator::getSelectedPresets())
+		QTest::newRow(preset.toStdString().c_str()) << preset;
+}
+
+void SceneBenchmark::constructScene_data()
+{
+	addPresetsData();
+}
+
+void SceneBenchmark::constructScene()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		ModelGenerator generator(ModelGenerator::getPreset(preset));
+		int item_count = 0;
+
+		generator.generate(&model);
+
+		QBENCHMARK
+		{
+			ObjectsScene scene;
+			populateScene(model, scene);
+			item_count = scene.items().size();
+		}
+
+		QVERIFY(item_count > 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SceneBenchmark::renderScene_data()
+{
+	addPresetsData();
+}
+
+void SceneBenchmark::renderScene()
+{
+	QFETCH(QString, preset);
+
+	try
+	{
+		DatabaseModel model;
+		ModelGenerator generator(ModelGenerator::getPreset(preset));
+		ObjectsScene scene;
+		QImage image(1920, 1080, QImage::Format_ARGB32_Premultiplied);
+
+		generator.generate(&model);
+		populateScene(model, scene);
+
+		// The whole scene is scaled down into a full HD image so all items get painted
+		QBENCHMARK
+		{
+			QPainter painter(&image);
+			image.fill(Qt::white);
+			scene.render(&painter, QRectF(image.rect()), scene.itemsBoundingRect(), Qt::KeepAspectRatio);
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(SceneBenchmark)
+#include "scenebenchmark.moc"
@@ -0,0 +1,652 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "forcedirectedlayout.h"
+#include "exception.h"
+#include <QThread>
+#include <QSet>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+
+ForceDirectedLayout::ForceDirectedLayout(QObject *parent) : QObject(parent)
+{
+	iterations = DefaultIterations;
+	update_interval = DefaultUpdateInterval;
+	spacing = DefaultSpacing;
+	theta = DefaultTheta;
+	origin = QPointF(50, 50);
+	canceled = false;
+	thread_pool.setMaxThreadCount(QThread::idealThreadCount());
+}
+
+int ForceDirectedLayout::addNode(const QSizeF &size, const QPointF &pos, int group)
+{
+	Body node;
+
+	node.size = size;
+	node.pos = pos + QPointF(size.width() / 2, size.height() / 2);
+	node.radius = std::sqrt(size.width() * size.width() + size.height() * size.height()) / 2;
+	node.group = group;
+	nodes.push_back(node);
+
+	return nodes.size() - 1;
+}
+
+void ForceDirectedLayout::addEdge(int src_idx, int dst_idx, double weight)
+{
+	if(src_idx < 0 || dst_idx < 0 ||
+		 src_idx >= static_cast<int>(nodes.size()) ||
+		 dst_idx >= static_cast<int>(nodes.size()))
+		throw Exception(ErrorCode::RefElementInvalidIndex, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	// Self-loops have no effect on the layout
+	if(src_idx == dst_idx)
+		return;
+
+	edges.push_back({ src_idx, dst_idx, weight > 0 ? weight : 1 });
+}
+
+void ForceDirectedLayout::clear()
+{
+	nodes.clear();
+	edges.clear();
+	canceled = false;
+}
+
+void ForceDirectedLayout::setIterations(unsigned iter)
+{
+	iterations = iter > 0 ? iter : 1;
+}
+
+void ForceDirectedLayout::setUpdateInterval(unsigned interval)
+{
+	update_interval = interval;
+}
+
+void ForceDirectedLayout::setSpacing(double space)
+{
+	spacing = space >= 0 ? space : 0;
+}
+
+void ForceDirectedLayout::setTheta(double value)
+{
+	theta = value >= 0 ? value : 0;
+}
+
+void ForceDirectedLayout::setOrigin(const QPointF &pos)
+{
+	origin = pos;
+}
+
+unsigned ForceDirectedLayout::getNodeCount()
+{
+	return nodes.size();
+}
+
+unsigned ForceDirectedLayout::getEdgeCount()
+{
+	return edges.size();
+}
+
+QList<QPointF> ForceDirectedLayout::getPositions()
+{
+	QList<QPointF> positions;
+
+	positions.reserve(nodes.size());
+
+	for(auto &node : nodes)
+		positions.append(node.pos - QPointF(node.size.width() / 2, node.size.height() / 2));
+
+	return positions;
+}
+
+QRectF ForceDirectedLayout::getGroupRect(int group)
+{
+	QRectF rect;
+
+	for(auto &node : nodes)
+	{
+		if(node.group != group)
+			continue;
+
+		rect = rect.united(QRectF(node.pos - QPointF(node.size.width() / 2, node.size.height() / 2), node.size));
+	}
+
+	return rect;
+}
+
+bool ForceDirectedLayout::isCanceled()
+{
+	return canceled;
+}
+
+void ForceDirectedLayout::cancel()
+{
+	canceled = true;
+}
+
+void ForceDirectedLayout::buildQuadTree(const std::vector<Body> &bodies, const std::vector<double> &masses, std::vector<QuadCell> &cells)
+{
+	/* Limits the depth of the tree so bodies placed at (almost) the same position
+	 * don't cause an endless subdivision. Bodies reaching that depth are merged in the same cell */
+	static constexpr int MaxDepth = 32;
+	double min_x = bodies[0].pos.x(), max_x = min_x,
+			min_y = bodies[0].pos.y(), max_y = min_y;
+	QuadCell root;
+
+	for(auto &body : bodies)
+	{
+		min_x = std::min(min_x, body.pos.x());
+		max_x = std::max(max_x, body.pos.x());
+		min_y = std::min(min_y, body.pos.y());
+		max_y = std::max(max_y, body.pos.y());
+	}
+
+	cells.clear();
+	cells.reserve(bodies.size() * 2);
+
+	root.cx = (min_x + max_x) / 2;
+	root.cy = (min_y + max_y) / 2;
+	root.half = std::max(max_x - min_x, max_y - min_y) / 2 + 1;
+	cells.push_back(root);
+
+	auto get_quadrant = [&cells](int cell_idx, const QPointF &pos) {
+		return (pos.x() >= cells[cell_idx].cx ? 1 : 0) + (pos.y() >= cells[cell_idx].cy ? 2 : 0);
+	};
+
+	for(int body_idx = 0; body_idx < static_cast<int>(bodies.size()); body_idx++)
+	{
+		const QPointF &pos = bodies[body_idx].pos;
+		double mass = masses[body_idx];
+		int cell_idx = 0, depth = 0;
+
+		while(true)
+		{
+			/* Cells are referenced by index since the vector can be reallocated
+			 * when new children are created */
+			cells[cell_idx].mass += mass;
+			cells[cell_idx].mx += pos.x() * mass;
+			cells[cell_idx].my += pos.y() * mass;
+
+			if(cells[cell_idx].child < 0)
+			{
+				// Empty leaf, the body is placed in it
+				if(cells[cell_idx].body < 0 && cells[cell_idx].mass == mass)
+				{
+					cells[cell_idx].body = body_idx;
+					break;
+				}
+
+				// Maximum depth reached, the body is merged in the current leaf
+				if(depth >= MaxDepth)
+					break;
+
+				// Occupied leaf: the cell is subdivided and the previous body moved to one of the children
+				int prev_body = cells[cell_idx].body, first_child = cells.size();
+				double half = cells[cell_idx].half / 2;
+
+				for(int quad = 0; quad < 4; quad++)
+				{
+					QuadCell child;
+
+					child.half = half;
+					child.cx = cells[cell_idx].cx + ((quad & 1) ? half : -half);
+					child.cy = cells[cell_idx].cy + ((quad & 2) ? half : -half);
+					cells.push_back(child);
+				}
+
+				cells[cell_idx].child = first_child;
+				cells[cell_idx].body = -1;
+
+				if(prev_body >= 0)
+				{
+					QuadCell &prev_cell = cells[first_child + get_quadrant(cell_idx, bodies[prev_body].pos)];
+
+					prev_cell.body = prev_body;
+					prev_cell.mass = masses[prev_body];
+					prev_cell.mx = bodies[prev_body].pos.x() * masses[prev_body];
+					prev_cell.my = bodies[prev_body].pos.y() * masses[prev_body];
+				}
+			}
+
+			cell_idx = cells[cell_idx].child + get_quadrant(cell_idx, pos);
+			depth++;
+		}
+	}
+
+	// Converting the weighted sums into the centers of mass
+	for(auto &cell : cells)
+	{
+		if(cell.mass > 0)
+		{
+			cell.mx /= cell.mass;
+			cell.my /= cell.mass;
+		}
+	}
+}
+
+QPointF ForceDirectedLayout::computeRepulsion(const std::vector<QuadCell> &cells, const std::vector<Body> &bodies,
+																							const std::vector<double> &masses, int body_idx, double rep_const)
+{
+	QPointF force;
+	const QPointF &pos = bodies[body_idx].pos;
+	std::vector<int> stack = { 0 };
+	double dx = 0, dy = 0, dist = 0;
+
+	while(!stack.empty())
+	{
+		const QuadCell &cell = cells[stack.back()];
+		stack.pop_back();
+
+		if(cell.mass <= 0 || cell.body == body_idx)
+			continue;
+
+		dx = pos.x() - cell.mx;
+		dy = pos.y() - cell.my;
+		dist = std::sqrt(dx * dx + dy * dy);
+
+		/* Far enough cells (or leaves) are treated as a single body placed at their center of mass,
+		 * otherwise the children are visited */
+		if(cell.child >= 0 && (cell.half * 2) >= theta * dist)
+		{
+			for(int quad = 0; quad < 4; quad++)
+				stack.push_back(cell.child + quad);
+
+			continue;
+		}
+
+		/* Bodies at the same position are pushed away in a direction derived from
+		 * their index so the result is deterministic */
+		if(dist < 0.01)
+		{
+			dx = std::cos(body_idx);
+			dy = std::sin(body_idx);
+			dist = 0.01;
+		}
+		else
+		{
+			dx /= dist;
+			dy /= dist;
+		}
+
+		double f = rep_const * masses[body_idx] * cell.mass / dist;
+		force += QPointF(dx * f, dy * f);
+	}
+
+	return force;
+}
+
+bool ForceDirectedLayout::simulate(std::vector<Body> &bodies, const std::vector<Edge> &sim_edges, const std::function<void(unsigned)> &on_step)
+{
+	// Gravity constant that keeps disconnected bodies close to the center of the layout
+	static constexpr double Gravity = 3;
+	unsigned count = bodies.size();
+
+	if(count < 2)
+	{
+		if(on_step)
+			on_step(iterations);
+
+		return !canceled;
+	}
+
+	std::vector<double> masses(count);
+	std::vector<QPointF> forces(count);
+	std::vector<QuadCell> cells;
+	double avg_radius = 0, ideal_len = 0, rep_const = 0, temp = 0, init_temp = 0;
+	unsigned num_chunks = 1, chunk_size = count;
+
+	for(auto &body : bodies)
+		avg_radius += body.radius;
+
+	avg_radius = std::max(avg_radius / count, 1.0);
+	ideal_len = 2 * avg_radius + spacing;
+	rep_const = ideal_len * ideal_len;
+	init_temp = ideal_len * std::sqrt(static_cast<double>(count)) / 2;
+
+	// Bigger bodies repel the others with more strength
+	for(unsigned idx = 0; idx < count; idx++)
+		masses[idx] = std::max(bodies[idx].radius / avg_radius, 0.1);
+
+	/* Bodies sharing the same position (e.g. objects created by the import which weren't positioned yet)
+	 * are spread around their original position so the simulation can separate them */
+	std::mt19937 rand_engine(count);
+	std::uniform_real_distribution<double> rand_offset(-ideal_len, ideal_len);
+	QSet<QPair<qint64, qint64>> used_pos;
+
+	for(auto &body : bodies)
+	{
+		QPair<qint64, qint64> key(std::llround(body.pos.x()), std::llround(body.pos.y()));
+
+		if(used_pos.contains(key))
+			body.pos += QPointF(rand_offset(rand_engine), rand_offset(rand_engine));
+		else
+			used_pos.insert(key);
+	}
+
+	if(count >= ParallelThreshold)
+	{
+		num_chunks = std::max(thread_pool.maxThreadCount(), 1);
+		chunk_size = (count + num_chunks - 1) / num_chunks;
+	}
+
+	for(unsigned iter = 0; iter < iterations; iter++)
+	{
+		if(canceled)
+			return false;
+
+		QPointF center;
+
+		for(auto &body : bodies)
+			center += body.pos;
+
+		center /= count;
+		buildQuadTree(bodies, masses, cells);
+
+		auto compute_forces = [&](unsigned start, unsigned end) {
+			for(unsigned idx = start; idx < end; idx++)
+			{
+				forces[idx] = computeRepulsion(cells, bodies, masses, idx, rep_const) +
+											((center - bodies[idx].pos) * Gravity * masses[idx]);
+			}
+		};
+
+		// Repulsion forces are computed in parallel for large sets of bodies
+		if(num_chunks > 1)
+		{
+			for(unsigned chunk = 0; chunk < num_chunks; chunk++)
+			{
+				unsigned start = chunk * chunk_size,
+						end = std::min(start + chunk_size, count);
+
+				if(start < end)
+					thread_pool.start([&compute_forces, start, end](){ compute_forces(start, end); });
+			}
+
+			thread_pool.waitForDone();
+		}
+		else
+			compute_forces(0, count);
+
+		// Attraction forces between connected bodies
+		for(auto &edge : sim_edges)
+		{
+			QPointF delta = bodies[edge.src].pos - bodies[edge.dst].pos;
+			double dist = std::sqrt(QPointF::dotProduct(delta, delta)),
+					ideal_edge_len = bodies[edge.src].radius + bodies[edge.dst].radius + spacing;
+
+			if(dist < 0.01)
+				continue;
+
+			QPointF force = (delta / dist) * (edge.weight * dist * dist / ideal_edge_len);
+			forces[edge.src] -= force;
+			forces[edge.dst] += force;
+		}
+
+		// The maximum displacement is limited by the temperature which decreases linearly
+		temp = init_temp * (1.0 - static_cast<double>(iter) / iterations) + 1.0;
+
+		for(unsigned idx = 0; idx < count; idx++)
+		{
+			double len = std::sqrt(QPointF::dotProduct(forces[idx], forces[idx]));
+
+			if(len > 0)
+				bodies[idx].pos += (forces[idx] / len) * std::min(len, temp);
+		}
+
+		if(on_step && update_interval > 0 && (iter + 1) % update_interval == 0)
+			on_step(iter + 1);
+	}
+
+	return !canceled;
+}
+
+void ForceDirectedLayout::removeOverlaps(std::vector<Body> &bodies, double min_space)
+{
+	static constexpr unsigned MaxPasses = 200;
+	std::vector<int> sorted(bodies.size()), active;
+	std::vector<QRectF> rects(bodies.size());
+	bool moved = true;
+
+	auto get_rect = [&bodies, min_space](int idx) {
+		const Body &body = bodies[idx];
+		return QRectF(body.pos.x() - (body.size.width() + min_space) / 2,
+									body.pos.y() - (body.size.height() + min_space) / 2,
+									body.size.width() + min_space, body.size.height() + min_space);
+	};
+
+	for(unsigned pass = 0; pass < MaxPasses && moved && !canceled; pass++)
+	{
+		moved = false;
+		active.clear();
+
+		for(int idx = 0; idx < static_cast<int>(bodies.size()); idx++)
+		{
+			sorted[idx] = idx;
+			rects[idx] = get_rect(idx);
+		}
+
+		std::sort(sorted.begin(), sorted.end(), [&rects](int a, int b) {
+			return rects[a].left() < rects[b].left();
+		});
+
+		/* Sweep line: only the rectangles whose horizontal interval contains the
+		 * left side of the current rectangle are tested for overlapping */
+		for(int idx : sorted)
+		{
+			active.erase(std::remove_if(active.begin(), active.end(), [&](int other) {
+				return rects[other].right() <= rects[idx].left();
+			}), active.end());
+
+			for(int other : active)
+			{
+				QRectF inter = rects[idx].intersected(rects[other]);
+
+				if(inter.width() <= 0 || inter.height() <= 0)
+					continue;
+
+				// The bodies are moved apart in the axis that requires the smaller displacement
+				QPointF delta;
+
+				if(inter.width() < inter.height())
+					delta.setX((bodies[idx].pos.x() >= bodies[other].pos.x() ? 1 : -1) * inter.width() / 2);
+				else
+					delta.setY((bodies[idx].pos.y() >= bodies[other].pos.y() ? 1 : -1) * inter.height() / 2);
+
+				bodies[idx].pos += delta;
+				bodies[other].pos -= delta;
+				rects[idx] = get_rect(idx);
+				rects[other] = get_rect(other);
+				moved = true;
+			}
+
+			active.push_back(idx);
+		}
+	}
+}
+
+void ForceDirectedLayout::run()
+{
+	std::map<int, unsigned> group_ids;
+	std::vector<std::vector<int>> groups;
+	std::vector<unsigned> node_groups(nodes.size());
+	std::vector<QPointF> group_offsets;
+	unsigned laid_nodes = 0;
+
+	canceled = false;
+
+	if(nodes.empty())
+	{
+		emit s_progressUpdated(100);
+		emit s_layoutFinished(false);
+		return;
+	}
+
+	/* Grouping the nodes. Each ungrouped node is handled as a group of its own
+	 * so it is placed by the groups layout */
+	for(unsigned idx = 0; idx < nodes.size(); idx++)
+	{
+		int group = nodes[idx].group;
+
+		if(group < 0 || group_ids.count(group) == 0)
+		{
+			if(group >= 0)
+				group_ids[group] = groups.size();
+
+			node_groups[idx] = groups.size();
+			groups.push_back({});
+		}
+		else
+			node_groups[idx] = group_ids[group];
+
+		groups[node_groups[idx]].push_back(idx);
+	}
+
+	group_offsets.resize(groups.size());
+
+	auto emit_positions = [this, &node_groups, &group_offsets]() {
+		QList<QPointF> positions = getPositions();
+
+		for(unsigned idx = 0; idx < nodes.size(); idx++)
+			positions[idx] += group_offsets[node_groups[idx]];
+
+		emit s_positionsUpdated(positions);
+	};
+
+	auto finish = [this, &emit_positions]() {
+		emit_positions();
+		emit s_layoutFinished(canceled);
+	};
+
+	// Phase 1: each group is laid out separately (70% of the progress)
+	for(auto &group : groups)
+	{
+		std::vector<Body> bodies;
+		std::vector<Edge> group_edges;
+		std::map<int, int> local_idx;
+
+		for(int node_idx : group)
+		{
+			local_idx[node_idx] = bodies.size();
+			bodies.push_back(nodes[node_idx]);
+		}
+
+		for(auto &edge : edges)
+		{
+			if(node_groups[edge.src] == node_groups[edge.dst] && local_idx.count(edge.src))
+				group_edges.push_back({ local_idx[edge.src], local_idx[edge.dst], edge.weight });
+		}
+
+		auto write_back = [&]() {
+			for(unsigned idx = 0; idx < group.size(); idx++)
+				nodes[group[idx]].pos = bodies[idx].pos;
+		};
+
+		bool finished = simulate(bodies, group_edges, [&](unsigned iter) {
+			write_back();
+			emit s_progressUpdated(((laid_nodes + (group.size() * iter / iterations)) * 70) / nodes.size());
+			emit_positions();
+		});
+
+		removeOverlaps(bodies, spacing);
+		write_back();
+
+		if(!finished || canceled)
+		{
+			finish();
+			return;
+		}
+
+		laid_nodes += group.size();
+		emit s_progressUpdated((laid_nodes * 70) / nodes.size());
+	}
+
+	// Phase 2: the groups are laid out as super-nodes (30% of the progress)
+	std::vector<Body> group_bodies(groups.size());
+	std::vector<QPointF> group_centers(groups.size());
+	std::vector<Edge> group_edges;
+	std::map<std::pair<int, int>, double> group_links;
+
+	for(unsigned grp_idx = 0; grp_idx < groups.size(); grp_idx++)
+	{
+		QRectF rect;
+
+		for(int node_idx : groups[grp_idx])
+			rect = rect.united(QRectF(nodes[node_idx].pos - QPointF(nodes[node_idx].size.width() / 2, nodes[node_idx].size.height() / 2),
+																nodes[node_idx].size));
+
+		// Groups receive a margin so the rectangles drawn around them (e.g. schemas) don't overlap
+		rect.adjust(-spacing, -spacing, spacing, spacing);
+		group_bodies[grp_idx].pos = group_centers[grp_idx] = rect.center();
+		group_bodies[grp_idx].size = rect.size();
+		group_bodies[grp_idx].radius = std::sqrt(rect.width() * rect.width() + rect.height() * rect.height()) / 2;
+	}
+
+	// Edges between nodes of different groups are aggregated into weighted edges between the groups
+	for(auto &edge : edges)
+	{
+		int src_grp = node_groups[edge.src], dst_grp = node_groups[edge.dst];
+
+		if(src_grp != dst_grp)
+			group_links[{ std::min(src_grp, dst_grp), std::max(src_grp, dst_grp) }] += edge.weight;
+	}
+
+	for(auto &itr : group_links)
+		group_edges.push_back({ itr.first.first, itr.first.second, itr.second });
+
+	auto update_offsets = [&]() {
+		for(unsigned grp_idx = 0; grp_idx < groups.size(); grp_idx++)
+			group_offsets[grp_idx] = group_bodies[grp_idx].pos - group_centers[grp_idx];
+	};
+
+	bool finished = simulate(group_bodies, group_edges, [&](unsigned iter) {
+		update_offsets();
+		emit s_progressUpdated(70 + (iter * 30) / iterations);
+		emit_positions();
+	});
+
+	removeOverlaps(group_bodies, spacing);
+	update_offsets();
+
+	// Applying the groups displacement to their nodes
+	for(unsigned idx = 0; idx < nodes.size(); idx++)
+		nodes[idx].pos += group_offsets[node_groups[idx]];
+
+	std::fill(group_offsets.begin(), group_offsets.end(), QPointF());
+
+	if(finished && !canceled)
+	{
+		// Moving the whole layout so its bounding rect starts at the origin
+		QRectF rect;
+
+		for(auto &node : nodes)
+			rect = rect.united(QRectF(node.pos - QPointF(node.size.width() / 2, node.size.height() / 2), node.size));
+
+		for(auto &node : nodes)
+			node.pos += origin - rect.topLeft();
+
+		emit s_progressUpdated(100);
+	}
+
+	finish();
+}
@@ -0,0 +1,194 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcanvas
+\class ForceDirectedLayout
+\brief Implements a force-directed layout engine used to rearrange graphical objects on the canvas.
+The repulsion between nodes is approximated using a Barnes–Hut quadtree so each iteration costs
+O(n log n) instead of O(n²), and the forces of large graphs are computed in parallel. Nodes can be
+grouped (e.g. tables of the same schema) so each group is laid out separately and the groups are then
+laid out as super-nodes, keeping the nodes of a group constrained to the rectangle of the group.
+*/
+
+#ifndef FORCE_DIRECTED_LAYOUT_H
+#define FORCE_DIRECTED_LAYOUT_H
+
+#include "canvasglobal.h"
+#include <QObject>
+#include <QPointF>
+#include <QSizeF>
+#include <QRectF>
+#include <QThreadPool>
+#include <atomic>
+#include <functional>
+#include <vector>
+
+class __libcanvas ForceDirectedLayout: public QObject {
+	Q_OBJECT
+
+	private:
+		//! \brief Stores the data of a node (or a group of nodes) being positioned
+		struct Body {
+			//! \brief The center of the body
+			QPointF pos;
+
+			//! \brief The size of the rectangle of the body
+			QSizeF size;
+
+			//! \brief The radius of the circle that encloses the body rectangle
+			double radius = 0;
+
+			//! \brief The group in which the body is placed
+			int group = -1;
+		};
+
+		//! \brief Stores the data of an edge connecting two bodies
+		struct Edge {
+			int src = -1, dst = -1;
+			double weight = 1;
+		};
+
+		//! \brief Stores the data of a cell of the Barnes–Hut quadtree
+		struct QuadCell {
+			//! \brief The center and the half of the side of the cell square
+			double cx = 0, cy = 0, half = 0;
+
+			//! \brief The total mass of the cell and its center of mass
+			double mass = 0, mx = 0, my = 0;
+
+			//! \brief The index of the first of the four children cells (-1 for leaves)
+			int child = -1;
+
+			//! \brief The index of the body stored in a leaf cell (-1 if the cell is empty or is a branch)
+			int body = -1;
+		};
+
+		//! \brief The nodes to be positioned
+		std::vector<Body> nodes;
+
+		//! \brief The edges between nodes
+		std::vector<Edge> edges;
+
+		//! \brief The amount of iterations performed on each simulation
+		unsigned iterations;
+
+		//! \brief The amount of iterations between two emissions of s_positionsUpdated
+		unsigned update_interval;
+
+		//! \brief The minimum space between two nodes and between two groups
+		double spacing;
+
+		//! \brief The Barnes–Hut opening criterion
+		double theta;
+
+		//! \brief The top-left position of the bounding rect of the resulting layout
+		QPointF origin;
+
+		//! \brief Indicates that the layout was canceled by the user
+		std::atomic<bool> canceled;
+
+		//! \brief The thread pool used to compute the forces in parallel
+		QThreadPool thread_pool;
+
+		//! \brief Builds the Barnes–Hut quadtree of the provided bodies
+		void buildQuadTree(const std::vector<Body> &bodies, const std::vector<double> &masses, std::vector<QuadCell> &cells);
+
+		//! \brief Computes the repulsion force applied to the body in the index body_idx using the quadtree
+		QPointF computeRepulsion(const std::vector<QuadCell> &cells, const std::vector<Body> &bodies,
+														 const std::vector<double> &masses, int body_idx, double rep_const);
+
+		/*! \brief Runs the force-directed simulation over the provided bodies and edges.
+		 * The functor on_step is called at each update interval so the caller can report the intermediate positions.
+		 * Returns false if the simulation was canceled */
+		bool simulate(std::vector<Body> &bodies, const std::vector<Edge> &sim_edges, const std::function<void(unsigned)> &on_step);
+
+		/*! \brief Moves the bodies apart until no body rectangle overlaps other one (considering the spacing).
+		 * The overlaps are detected using a sweep line over the x axis of the bodies */
+		void removeOverlaps(std::vector<Body> &bodies, double min_space);
+
+	public:
+		//! \brief The default amount of iterations of each simulation
+		static constexpr unsigned DefaultIterations = 300;
+
+		//! \brief The default amount of iterations between intermediate position updates
+		static constexpr unsigned DefaultUpdateInterval = 25;
+
+		//! \brief The default spacing between nodes
+		static constexpr double DefaultSpacing = 50;
+
+		//! \brief The default Barnes–Hut opening criterion (0 means exact repulsion computation)
+		static constexpr double DefaultTheta = 0.8;
+
+		/*! \brief The minimum amount of bodies in a simulation to compute the forces in parallel.
+		 * Below that the overhead of dispatching the work to other threads is greater than the gain */
+		static constexpr unsigned ParallelThreshold = 256;
+
+		ForceDirectedLayout(QObject *parent = nullptr);
+
+		/*! \brief Adds a node to the layout returning its index. The pos is the current top-left position of the node
+		 * which is used as the starting point of the simulation. Nodes with the same group (>= 0) are kept together */
+		int addNode(const QSizeF &size, const QPointF &pos, int group = -1);
+
+		/*! \brief Adds an edge between two nodes. Edges with higher weights place the nodes closer to each other.
+		 * Raises an error if one of the indexes is invalid */
+		void addEdge(int src_idx, int dst_idx, double weight = 1);
+
+		//! \brief Removes all nodes and edges
+		void clear();
+
+		void setIterations(unsigned iter);
+		void setUpdateInterval(unsigned interval);
+		void setSpacing(double space);
+		void setTheta(double value);
+		void setOrigin(const QPointF &pos);
+
+		unsigned getNodeCount();
+		unsigned getEdgeCount();
+
+		//! \brief Returns the top-left positions of the nodes in the same order they were added
+		QList<QPointF> getPositions();
+
+		//! \brief Returns the rectangle of the provided group (considering the current position of its nodes)
+		QRectF getGroupRect(int group);
+
+		//! \brief Returns if the last run was canceled
+		bool isCanceled();
+
+	public slots:
+		//! \brief Performs the layout. This method can be executed in a separated thread
+		void run();
+
+		//! \brief Requests the interruption of the layout. The current positions are kept
+		void cancel();
+
+	signals:
+		//! \brief Signal emitted with the intermediate (and final) top-left positions of all nodes
+		void s_positionsUpdated(QList<QPointF> positions);
+
+		//! \brief Signal emitted with the progress of the layout (0 to 100)
+		void s_progressUpdated(int progress);
+
+		//! \brief Signal emitted when the layout finishes or is canceled
+		void s_layoutFinished(bool canceled);
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "relationshipview.h"
 #include "styledtextboxview.h"
 #include "graphicalview.h"
+#include "tracer.h"
 #include "tableview.h"
 #include "schemaview.h"
 #include "databasemodel.h"
@@ -735,6 +736,7 @@ QRectF ObjectsScene::itemsBoundingRect(bool seek_only_db_objs, bool selected_onl
 
 void ObjectsScene::drawBackground(QPainter *painter, const QRectF &rect)
 {
+	PGM_TRACE_SCOPE("canvas", "ObjectsScene::drawBackground");
 	double page_w = 0, page_h = 0,
 			delim_factor = 1/delimiter_scale,
 			pen_width = BaseObjectView::ObjectBorderWidth *
@@ -23,6 +23,7 @@
 #include "relationship.h"
 #include "tableview.h"
 #include "utilsns.h"
+#include "tracer.h"
 
 bool RelationshipView::hide_name_label {false};
 bool RelationshipView::use_curved_lines {true};
@@ -2105,6 +2106,7 @@ void RelationshipView::configureBoundingRect()
 
 void RelationshipView::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
+	PGM_TRACE_SCOPE("canvas", "RelationshipView::paint");
 	/* Workaround: For some unknown reason, an artifact rectangle is being draw
 	 * around the relationship everytime it is selected. To avoid that we force
 	 * the painter to have no pen and the clipping area to be the exposed area
@@ -23,6 +23,7 @@
 #include "rule.h"
 #include "index.h"
 #include "trigger.h"
+#include "tracer.h"
 #include "constraint.h"
 #include "policy.h"
 #include "physicaltable.h"
@@ -667,6 +668,7 @@ void TableObjectView::configureObjectSelection()
 
 void TableObjectView::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+	PGM_TRACE_SCOPE("canvas", "TableObjectView::paint");
 	painter->save();
 	painter->translate(descriptor->pos());
 	descriptor->paint(painter, option, widget);
@@ -23,6 +23,7 @@
 #include "schema.h"
 #include "tag.h"
 #include "physicaltable.h"
+#include "tracer.h"
 
 TableTitleView::TableTitleView() : BaseObjectView(nullptr)
 {
@@ -159,6 +160,7 @@ void TableTitleView::resizeTitle(double width, double height)
 
 void TableTitleView::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+	PGM_TRACE_SCOPE("canvas", "TableTitleView::paint");
 	box->paint(painter, option, widget);
 
 	painter->setFont(schema_name->font());
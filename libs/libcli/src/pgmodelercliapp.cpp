@@ -29,9 +29,15 @@
 #include "styledtextboxview.h"
 #include "relationshipview.h"
 #include "pgsqlversions.h"
+#include "tracer.h"
 #include "compat/compatns.h"
 #include <QSettings>
 #include <QPluginLoader>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QElapsedTimer>
+#include <QThreadPool>
 
 #ifdef PRIV_CODE_SYMBOLS
 	#include "privcoreinit.h"
@@ -56,6 +62,7 @@ const QString PgModelerCliApp::ImportDb {"--import-db"};
 const QString PgModelerCliApp::NoIndex {"--no-index"};
 const QString PgModelerCliApp::Split {"--split"};
 const QString PgModelerCliApp::Markdown {"--markdown"};
+const QString PgModelerCliApp::Incremental {"--incremental"};
 const QString PgModelerCliApp::DependenciesSql {"--dependencies"};
 const QString PgModelerCliApp::ChildrenSql {"--children"};
 const QString PgModelerCliApp::GroupByType {"--group-by-type"};
@@ -70,6 +77,9 @@ const QString PgModelerCliApp::Version {"--version"};
 const QString PgModelerCliApp::ShowGrid {"--show-grid"};
 const QString PgModelerCliApp::ShowDelimiters {"--show-delimiters"};
 const QString PgModelerCliApp::PageByPage {"--page-by-page"};
+const QString PgModelerCliApp::TiledPng {"--tiled"};
+const QString PgModelerCliApp::TilePyramid {"--tile-pyramid"};
+const QString PgModelerCliApp::TileSize {"--tile-size"};
 const QString PgModelerCliApp::OverrideBgColor {"--override-bg-color"};
 const QString PgModelerCliApp::IgnoreDuplicates {"--ignore-duplicates"};
 const QString PgModelerCliApp::IgnoreErrorCodes {"--ignore-error-codes"};
@@ -80,6 +90,7 @@ const QString PgModelerCliApp::User {"--user"};
 const QString PgModelerCliApp::Passwd {"--passwd"};
 const QString PgModelerCliApp::InitialDb {"--initial-db"};
 const QString PgModelerCliApp::Silent {"--silent"};
+const QString PgModelerCliApp::Trace {"--trace"};
 const QString PgModelerCliApp::ListConns {"--list-conns"};
 const QString PgModelerCliApp::Simulate {"--simulate"};
 const QString PgModelerCliApp::FixModel {"--fix-model"};
@@ -99,6 +110,9 @@ const QString PgModelerCliApp::MatchByName {"--match-by-name"};
 const QString PgModelerCliApp::ForceChildren {"--force-children"};
 const QString PgModelerCliApp::OnlyMatching {"--only-matching"};
 const QString PgModelerCliApp::CommentsAsAliases {"--comments-as-aliases"};
+const QString PgModelerCliApp::ForceLayout {"--force-layout"};
+const QString PgModelerCliApp::Batch {"--batch"};
+const QString PgModelerCliApp::JobFile {"--job-file"};
 const QString PgModelerCliApp::PartialDiff {"--partial"};
 const QString PgModelerCliApp::Force {"--force"};
 const QString PgModelerCliApp::StartDate {"--start-date"};
@@ -163,7 +177,10 @@ std::map<QString, bool> PgModelerCliApp::long_opts {
 	{ CreateConfigs, false }, { Force, false }, { MissingOnly, false },
 	{ DependenciesSql, false }, { ChildrenSql, false }, { GenDropScript, false },
 	{ GroupByType, false }, { CommentsAsAliases, false }, { IgnoreFaultyPlugins, false },
-	{ ListPlugins, false }, { Markdown, false }, { NonTransactional, false }
+	{ ListPlugins, false }, { Markdown, false }, { NonTransactional, false },
+	{ TiledPng, false }, { TilePyramid, false }, { TileSize, true },
+	{ Incremental, false }, { ForceLayout, false }, { Batch, false },
+	{ JobFile, true }, { Trace, true }
 };
 
 attribs_map PgModelerCliApp::short_opts {
@@ -192,15 +209,18 @@ attribs_map PgModelerCliApp::short_opts {
 	{ MissingOnly, "-mo" }, { DependenciesSql, "-ds" }, { ChildrenSql, "-cs" },
 	{ GroupByType, "-gt" },	{ GenDropScript, "-gd" }, { CommentsAsAliases, "-cl" },
 	{ IgnoreFaultyPlugins, "-ip" }, { ListPlugins, "-lp" }, { Markdown, "-md" },
-	{ NonTransactional, "-nt" }
+	{ NonTransactional, "-nt" }, { TiledPng, "-tl" }, { TilePyramid, "-ty" },
+	{ TileSize, "-ts" }, { Incremental, "-in" }, { ForceLayout, "-fl" },
+	{ Batch, "-bt" }, { JobFile, "-jf" }, { Trace, "-tr" }
 };
 
 std::map<QString, QStringList> PgModelerCliApp::accepted_opts {
 	{{ ConnOptions }, { ConnAlias, Host, Port, User, Passwd, InitialDb }},
 	{{ ExportToFile }, { Input, Output, PgSqlVer, Split, DependenciesSql, ChildrenSql, GroupByType, GenDropScript }},
-	{{ ExportToPng },  { Input, Output, ShowGrid, ShowDelimiters, PageByPage, ZoomFactor, OverrideBgColor }},
+	{{ ExportToPng },  { Input, Output, ShowGrid, ShowDelimiters, PageByPage, ZoomFactor, OverrideBgColor,
+											 TiledPng, TilePyramid, TileSize }},
 	{{ ExportToSvg },  { Input, Output, ShowGrid, ShowDelimiters }},
-	{{ ExportToDict }, { Input, Output, Split, NoIndex, Markdown }},
+	{{ ExportToDict }, { Input, Output, Split, NoIndex, Markdown, Incremental }},
 
 	{{ ExportToDbms }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes,
 												DropDatabase, DropObjects, Simulate, UseTmpNames, Force,
@@ -208,7 +228,7 @@ std::map<QString, QStringList> PgModelerCliApp::accepted_opts {
 
 	{{ ImportDb }, { InputDb, Output, IgnoreImportErrors, ImportSystemObjs, ImportExtensionObjs,
 										FilterObjects, OnlyMatching, MatchByName, ForceChildren, DebugMode, ConnAlias,
-										Host, Port, User, Passwd, InitialDb, CommentsAsAliases }},
+										Host, Port, User, Passwd, InitialDb, CommentsAsAliases, ForceLayout, Incremental }},
 
 	{{ Diff }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes, CompareDb, CompareFile,
 							 PartialDiff, Force, StartDate, EndDate, SaveDiff, ApplyDiff, NoDiffPreview,
@@ -220,15 +240,14 @@ std::map<QString, QStringList> PgModelerCliApp::accepted_opts {
 	{{ FixModel },	{ Input, Output, FixTries }},
 	{{ ListConns }, { }},
 	{{ CreateConfigs }, { MissingOnly, Force }},
-	{{ ListPlugins }, { IgnoreFaultyPlugins }}
+	{{ ListPlugins }, { IgnoreFaultyPlugins }},
+	{{ Batch }, { JobFile, Output }}
 };
 
 PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv)
 {
 	try
 	{
-		QString op, value, orig_op;
-		bool accepts_val = false;
 		attribs_map opts;
 		QStringList args = arguments();
 
@@ -243,7 +262,9 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 		fix_model = upd_mime = import_db = false;
 		diff = create_configs = list_conns = false;
 		list_plugins = plugin_op = false;
-		export_op = false;
+		export_op = batch_mode = false;
+		appearance_loaded = false;
+		cache_tick = 0;
 
 		export_hlp = nullptr;
 		import_hlp = nullptr;
@@ -256,109 +277,172 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 
 		// We extract the options values only if the help option is not present
 		if(args.size() > 1 && !args.contains(Help) && !args.contains(short_opts[Help]))
-		{	
-			for(int i=1; i < argc; i++)
-			{
-				op = orig_op = argv[i];
+		{
+			QStringList cli_args;
 
-				//If the retrieved option starts with - it will be treated as a command option
-				if(op[0]=='-')
-				{
-					value.clear();
+			for(int i = 1; i < argc; i++)
+				cli_args.append(argv[i]);
 
-					if(i < argc-1 && argv[i+1][0]!='-')
-					{
-						//If the next option does not starts with '-', is considered a value
-						value=argv[++i];
-					}
+			opts = extractOptions(cli_args);
+		}
 
-					//Raises an error if the option is not recognized
-					if(!isOptionRecognized(op, accepts_val))
-						throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+		//Validates and executes the options
+		parseOptions(opts);
+		silent_mode = (parsed_opts.count(Silent));
 
-					//Raises an error if the value is empty and the option accepts a value
-					if(accepts_val && value.isEmpty())
-						throw Exception(tr("No value specified for option `%1'.").arg(orig_op), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+		/* When the trace option is present the hot paths timings are recorded
+		 * and saved to the provided file once the application finishes */
+		if(parsed_opts.count(Trace))
+			Tracer::start(QFileInfo(parsed_opts[Trace]).absoluteFilePath());
 
-					if(!accepts_val && !value.isEmpty())
-						throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+		/* Recording/replaying the connections' commands is configured via environment variables
+		 * so import, diff and export operations can be reproduced offline (see ConnectionRecorder) */
+		ConnectionRecorder::startFromEnvironment();
 
-					/* If we find a filter object parameter we append its parameter index so
-					 * its value is not replaced by the next filter parameter found */
-					if(op == FilterObjects)
-						opts[QString("%1%2").arg(op).arg(i)] = value;
+		// In batch mode the operations are configured for each job (see runBatch())
+		if(!parsed_opts.empty() && !batch_mode)
+			configureOperation();
+	}
+	catch(Exception &e)
+	{
+		throw e;
+	}
+}
 
-					opts[op] = value;
-				}
-			}
-		}
+attribs_map PgModelerCliApp::extractOptions(const QStringList &args)
+{
+	QString op, value, orig_op;
+	bool accepts_val = false;
+	attribs_map opts;
 
-		//Validates and executes the options
-		parseOptions(opts);
+	for(int i = 0; i < args.size(); i++)
+	{
+		op = orig_op = args[i];
 
-		if(!parsed_opts.empty())
+		//If the retrieved option starts with - it will be treated as a command option
+		if(op.startsWith('-'))
 		{
-			input_model=new DatabaseModel;
-			xmlparser=input_model->getXMLParser();
-			silent_mode=(parsed_opts.count(Silent));
+			value.clear();
 
-			//If the export is to png or svg loads additional configurations
-			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
+			if(i < args.size() - 1 && !args[i + 1].startsWith('-'))
 			{
-				connect(input_model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
-				connect(input_model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
+				//If the next option does not starts with '-', is considered a value
+				value = args[++i];
+			}
 
-				//Load the appearance settings including grid and delimiter options
-				AppearanceConfigWidget appearance_wgt;
-				appearance_wgt.loadConfiguration();
+			//Raises an error if the option is not recognized
+			if(!isOptionRecognized(op, accepts_val))
+				throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-				scene=new ObjectsScene;
-				scene->setParent(this);
-			}
+			//Raises an error if the value is empty and the option accepts a value
+			if(accepts_val && value.isEmpty())
+				throw Exception(tr("No value specified for option `%1'.").arg(orig_op), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-			if(parsed_opts.count(ExportToDbms) || parsed_opts.count(ImportDb) || parsed_opts.count(Diff))
-			{
-				configureConnection(false);
+			if(!accepts_val && !value.isEmpty())
+				throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-				//Replacing the initial db parameter for the input database when reverse engineering
-				if((parsed_opts.count(ImportDb) || parsed_opts.count(Diff)) && !parsed_opts[InputDb].isEmpty())
-					connection.setConnectionParam(Connection::ParamDbName, parsed_opts[InputDb]);
-			}
+			/* If we find a filter object parameter we append its parameter index so
+			 * its value is not replaced by the next filter parameter found */
+			if(op == FilterObjects)
+				opts[QString("%1%2").arg(op).arg(i)] = value;
 
-			if(parsed_opts.count(Diff) && parsed_opts.count(CompareDb))
-			{
-				configureConnection(true);
+			opts[op] = value;
+		}
+	}
 
-				if(!extra_connection.isConfigured())
-					extra_connection = connection;
+	return opts;
+}
 
-				extra_connection.setConnectionParam(Connection::ParamDbName, parsed_opts[CompareDb]);
-			}
+void PgModelerCliApp::configureOperation()
+{
+	input_model = new DatabaseModel;
+	xmlparser = input_model->getXMLParser();
 
-			if(!silent_mode && export_hlp && import_hlp && diff_hlp)
-			{
-				connect(export_hlp, &ModelExportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
-				connect(export_hlp, &ModelExportHelper::s_errorIgnored, this,  &PgModelerCliApp::printIgnoredError);
-				connect(import_hlp, &DatabaseImportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
-				connect(diff_hlp, &ModelsDiffHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
-			}
+	//If the export is to png or svg loads additional configurations
+	if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
+	{
+		connect(input_model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
+		connect(input_model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
+
+		//Load the appearance settings including grid and delimiter options
+		if(!appearance_loaded)
+		{
+			AppearanceConfigWidget appearance_wgt;
+			appearance_wgt.loadConfiguration();
+			appearance_loaded = true;
 		}
+
+		scene = new ObjectsScene;
+		scene->setParent(this);
 	}
-	catch(Exception &e)
+
+	if(parsed_opts.count(ExportToDbms) || parsed_opts.count(ImportDb) || parsed_opts.count(Diff))
 	{
-		throw e;
+		configureConnection(false);
+
+		//Replacing the initial db parameter for the input database when reverse engineering
+		if((parsed_opts.count(ImportDb) || parsed_opts.count(Diff)) && !parsed_opts[InputDb].isEmpty())
+			connection.setConnectionParam(Connection::ParamDbName, parsed_opts[InputDb]);
+	}
+
+	if(parsed_opts.count(Diff) && parsed_opts.count(CompareDb))
+	{
+		configureConnection(true);
+
+		if(!extra_connection.isConfigured())
+			extra_connection = connection;
+
+		extra_connection.setConnectionParam(Connection::ParamDbName, parsed_opts[CompareDb]);
+	}
+
+	// Unique connections avoid duplicating the signals when the operation is configured by several jobs (batch mode)
+	if(!silent_mode && export_hlp && import_hlp && diff_hlp)
+	{
+		connect(export_hlp, &ModelExportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress, Qt::UniqueConnection);
+		connect(export_hlp, &ModelExportHelper::s_errorIgnored, this,  &PgModelerCliApp::printIgnoredError, Qt::UniqueConnection);
+		connect(import_hlp, &DatabaseImportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress, Qt::UniqueConnection);
+		connect(diff_hlp, &ModelsDiffHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress, Qt::UniqueConnection);
 	}
 }
 
 PgModelerCliApp::~PgModelerCliApp()
 {
-	bool show_flush_msg = input_model && input_model->getObjectCount() > 0;
+	bool show_flush_msg = (input_model && input_model->getObjectCount() > 0) || !models_cache.empty();
+
+	if(ConnectionRecorder::getMode() != ConnectionRecorder::Disabled)
+	{
+		printMessage(ConnectionRecorder::getStatisticsSummary());
+
+		try
+		{
+			ConnectionRecorder::stop();
+		}
+		catch(Exception &e)
+		{
+			printText(e.getExceptionsText());
+		}
+	}
 
 	if(show_flush_msg)
 		printMessage(tr("Flushing used memory..."));
 
-	delete scene;
-	delete input_model;
+	releaseInputModel();
+
+	for(auto &itr : models_cache)
+	{
+		delete itr.second.scene;
+		delete itr.second.model;
+	}
+
+	models_cache.clear();
+
+	for(auto &itr : catalogs_pool)
+	{
+		itr.second->closeConnection();
+		delete itr.second;
+	}
+
+	catalogs_pool.clear();
 	delete export_hlp;
 	delete import_hlp;
 	delete diff_hlp;
@@ -645,6 +729,7 @@ void PgModelerCliApp::showMenu()
 	menu_items.append(MenuItem(Diff, "", tr("Compares a model and a database or two databases. Generates an SQL script to synchronize the latter with the former.")));
 	menu_items.append(MenuItem(FixModel, "", tr("Tries to fix the structure of the input model file to make it loadable again.")));
 	menu_items.append(MenuItem(CreateConfigs, "", tr("Creates pgModeler's configuration folder and files. Stored in the user's local storage.")));
+	menu_items.append(MenuItem(Batch, "", tr("Runs several jobs in a single process keeping configurations and models loaded between them. Jobs are read from the standard input or a job file.")));
 	
 	#ifndef Q_OS_MACOS
 		menu_items.append(MenuItem(DbmMimeType, "[ACTION]", tr("Handles the DBM file association to pgModeler binaries. Available actions: [%1 | %2].").arg(Install, Uninstall)));
@@ -661,6 +746,7 @@ void PgModelerCliApp::showMenu()
 	menu_items.append(MenuItem(Output, "[FILE|DIRECTORY]", tr("Output file or directory. Required for model fix or export to SQL, HTML, PNG, SVG.")));
 	menu_items.append(MenuItem(PgSqlVer, "", tr("Forces PostgreSQL syntax to the specified version when generating SQL code. Version format: [major].[minor], e.g., %1.").arg(PgSqlVersions::DefaulVersion)));
 	menu_items.append(MenuItem(Silent, "", tr("Silent execution. Only critical messages and errors are displayed.")));
+	menu_items.append(MenuItem(Trace, "[FILE]", tr("Records the timings of the main internal routines in a trace file (Chrome trace event format) that can be opened in chrome://tracing or ui.perfetto.dev.")));
 	menu_items.append(MenuItem());
 	
 	// SQL file export options
@@ -679,6 +765,9 @@ void PgModelerCliApp::showMenu()
 	menu_items.append(MenuItem(PageByPage, "", tr("Each page will be exported as a separate image. Only for PNG images.")));
 	menu_items.append(MenuItem(OverrideBgColor, "", tr("Overrides the original canvas color using a white background. PNG images only.")));
 	menu_items.append(MenuItem(ZoomFactor, "[FACTOR]", tr("Applies zoom before exporting to an image. Accepted range: %1 to %2 (PNG only).").arg(ModelWidget::MinimumZoom).arg(ModelWidget::MaximumZoom)));
+	menu_items.append(MenuItem(TiledPng, "", tr("Renders the image in tiles streamed to the output file. Used to export huge models without exhausting memory.")));
+	menu_items.append(MenuItem(TilePyramid, "", tr("Exports a deep-zoom tile pyramid (z/x/y PNG tiles) to the output directory. Used to browse the model in static web viewers.")));
+	menu_items.append(MenuItem(TileSize, "[SIZE]", tr("Size of the tiles in pixels used by tiled export modes. Accepted range: %1 to %2. Default: %3.").arg(ModelExportHelper::MinimumTileSize).arg(ModelExportHelper::MaximumTileSize).arg(ModelExportHelper::DefaultTileSize)));
 	menu_items.append(MenuItem());
 	
 	// Data dictionary export options
@@ -686,6 +775,7 @@ void PgModelerCliApp::showMenu()
 	menu_items.append(MenuItem(Split, "", tr("Data dictionaries are generated in separate files. Placed inside the specified output directory.")));
 	menu_items.append(MenuItem(NoIndex, "", tr("Avoids generating the navigation index. Used to navigate through the data dictionary.")));
 	menu_items.append(MenuItem(Markdown, "", tr("Generates a data dictionary in Markdown format (.md) instead of HTML format.")));
+	menu_items.append(MenuItem(Incremental, "", tr("Writes only the files of the tables changed since the last generation in the output directory. Split mode only.")));
 	menu_items.append(MenuItem());
 	
 	// DBMS export options
@@ -716,6 +806,8 @@ void PgModelerCliApp::showMenu()
 	menu_items.append(MenuItem(ImportSystemObjs, "", tr("Imports built-in system objects. May increase model size due to unnecessary objects.")));
 	menu_items.append(MenuItem(ImportExtensionObjs, "", tr("Imports extension objects. May increase model size due to unnecessary objects.")));
 	menu_items.append(MenuItem(CommentsAsAliases, "", tr("Uses objects' comments as aliases. Affects objects graphically represented in the model.")));
+	menu_items.append(MenuItem(ForceLayout, "", tr("Arranges the imported tables using a force-directed layout instead of a grid. Related tables are placed close to each other.")));
+	menu_items.append(MenuItem(Incremental, "", tr("Refreshes an output model created by a previous import. Only objects changed in the database since then are imported again.")));
 	menu_items.append(MenuItem(FilterObjects, "[FILTER]", tr("Imports only objects matching the filter(s). FILTER format: type:pattern:mode.")));
 	menu_items.append(MenuItem(OnlyMatching, "", tr("Imports only objects matching the provided filter(s). Non-matching objects are discarded.")));
 	menu_items.append(MenuItem(MatchByName, "", tr("Performs object matching based on names. Does not use signatures ([schema].[name]).")));
@@ -765,6 +857,12 @@ void PgModelerCliApp::showMenu()
 	menu_items.append(MenuItem(Force, "", tr("Forces recreation of all configuration files and backs up current settings.")));
 	menu_items.append(MenuItem());
 	
+	// Batch mode options
+	menu_items.append(MenuItem(tr("Batch mode options")));
+	menu_items.append(MenuItem(JobFile, "[FILE]", tr("File containing the jobs to be executed. When omitted the jobs are read from the standard input.")));
+	menu_items.append(MenuItem(Output, "[FILE]", tr("Report file. Receives one JSON line per job with its id, status, elapsed time and errors.")));
+	menu_items.append(MenuItem());
+	
 	// Plugins options
 	menu_items.append(MenuItem(tr("Plugins options")));
 	menu_items.append(MenuItem(ListPlugins, "", tr("Lists available plugins.")));
@@ -865,6 +963,10 @@ void PgModelerCliApp::showMenu()
 	printText(tr("   To specify a second connection, append `1' to any connection parameter listed above."));
 	printText(tr("   This associates the connection exclusively with %1.").arg(CompareDb));
 	printText();
+	printText(tr("** In batch mode each job is a line holding a JSON object with an optional `id' and the `args' array containing"));
+	printText(tr("   the same options used in a single execution, e.g.: {\"id\": \"sql\", \"args\": [\"%1\", \"%2\", \"model.dbm\", \"%3\", \"model.sql\"]}.").arg(ExportToFile, Input, Output));
+	printText(tr("   Empty lines and lines starting with `#' are ignored. Models loaded by a job are reused by the next ones while the file is unchanged."));
+	printText();
 
 	if(!plugin_load_errors.isEmpty())
 	{
@@ -909,15 +1011,42 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 		return;
 	}
 
+	/* The batch mode only validates its own options here since
+	 * the options of each job are parsed when the job runs */
+	if(opts.count(Batch))
+	{
+		for(auto &itr : opts)
+		{
+			if(itr.first != Batch && itr.first != Silent && itr.first != Trace &&
+				 !accepted_opts[Batch].contains(itr.first))
+			{
+				throw Exception(tr("The option `%1' is not accepted by the operation mode `%2'!").arg(itr.first, Batch),
+												ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+			}
+		}
+
+		if(opts.count(JobFile))
+			opts[JobFile] = QFileInfo(opts[JobFile]).absoluteFilePath();
+
+		if(opts.count(Output))
+			opts[Output] = QFileInfo(opts[Output]).absoluteFilePath();
+
+		batch_mode = true;
+		parsed_opts = opts;
+		return;
+	}
+
+	/* Configurations and helpers are created only once, so in batch mode
+	 * they are shared by all jobs that need them */
 	//Loading connections
-	if(opts.count(ListConns) || opts.count(ExportToDbms) || opts.count(ImportDb) || opts.count(Diff))
+	if(!conn_conf && (opts.count(ListConns) || opts.count(ExportToDbms) || opts.count(ImportDb) || opts.count(Diff)))
 	{
 		conn_conf = new ConnectionsConfigWidget;
 		conn_conf->loadConfiguration();
 		conn_conf->getConnections(connections, false);
 	}
 	//Loading general and relationship settings when exporting to image formats
-	else if(opts.count(ExportToPng) || opts.count(ExportToSvg))
+	else if(!general_conf && (opts.count(ExportToPng) || opts.count(ExportToSvg)))
 	{
 		general_conf = new GeneralConfigWidget;
 		rel_conf = new RelationshipConfigWidget;
@@ -927,10 +1056,11 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 	}
 
 	//Creating the export/import/diff helpers when one of the operations are specified
-	if(opts.count(ExportToDbms) || opts.count(ExportToFile) ||
-		 opts.count(ExportToPng) || opts.count(ExportToSvg) ||
-		 opts.count(ExportToDict) || opts.count(ImportDb) ||
-		 opts.count(Diff))
+	if(!export_hlp &&
+		 (opts.count(ExportToDbms) || opts.count(ExportToFile) ||
+			opts.count(ExportToPng) || opts.count(ExportToSvg) ||
+			opts.count(ExportToDict) || opts.count(ImportDb) ||
+			opts.count(Diff)))
 	{
 		export_hlp = new ModelExportHelper;
 		import_hlp = new DatabaseImportHelper;
@@ -1023,6 +1153,19 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 	if(opts.count(ExportToPng) && (zoom < ModelWidget::MinimumZoom || zoom > ModelWidget::MaximumZoom))
 		throw Exception(tr("Invalid zoom factor specified!"), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
 
+	if(opts.count(ExportToPng) && opts.count(PageByPage) && (opts.count(TiledPng) || opts.count(TilePyramid)))
+		throw Exception(tr("The option `%1' cannot be used together with `%2' or `%3'!").arg(PageByPage, TiledPng, TilePyramid), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	if(opts.count(ExportToPng) && opts.count(TiledPng) && opts.count(TilePyramid))
+		throw Exception(tr("The options `%1' and `%2' cannot be used together!").arg(TiledPng, TilePyramid), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	if(opts.count(TileSize) &&
+		 (opts[TileSize].toInt() < ModelExportHelper::MinimumTileSize || opts[TileSize].toInt() > ModelExportHelper::MaximumTileSize))
+		throw Exception(tr("Invalid tile size specified!"), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	if(opts.count(ExportToDict) && opts.count(Incremental) && !opts.count(Split))
+		throw Exception(tr("The option `%1' must be used together with the split mode option `%2'!").arg(Incremental, Split), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
+
 	if(upd_mime && opts[DbmMimeType] != Install && opts[DbmMimeType] != Uninstall)
 		throw Exception(tr("Invalid action specified for MIME type update option!"), ErrorCode::Custom,PGM_FUNC,PGM_FILE,PGM_LINE);
 
@@ -1151,7 +1294,7 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 	{
 		long_opt = itr.first;
 
-		if(long_opt == curr_op_mode || long_opt == Silent)
+		if(long_opt == curr_op_mode || long_opt == Silent || long_opt == Trace)
 			continue;
 
 		/* Before validating the option we need to remove any appended number to the option name
@@ -1180,38 +1323,263 @@ int PgModelerCliApp::exec()
 			listConnections();
 		else if(list_plugins)
 			listPlugins();
+		else if(batch_mode)
+			return runBatch();
 		else if(!parsed_opts.count(Version))
+			runOperation();
+
+		return 0;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+	}
+}
+
+void PgModelerCliApp::runOperation()
+{
+	#ifdef PRIV_CODE_SYMBOLS
+		__pgm_plus_cli_init
+	#endif
+
+	/* Listing connections and plugins are handled here too because
+	 * in batch mode they are executed as regular jobs (see runBatch()) */
+	if(list_conns)
+	{
+		listConnections();
+		return;
+	}
+
+	if(list_plugins)
+	{
+		listPlugins();
+		return;
+	}
+
+	runPluginsPreOperations();
+
+	if(fix_model)
+		fixModel();
+	else if(upd_mime)
+		updateMimeType();
+	else if(create_configs)
+		createConfigurations();
+	else if(import_db)
+		importDatabase();
+	else if(diff)
+		diffModels();
+	else if(export_op)
+		exportModel();
+	else
+		runPluginsOperations();
+
+	runPluginsPostOperations();
+}
+
+void PgModelerCliApp::resetOperation()
+{
+	releaseInputModel();
+
+	parsed_opts.clear();
+	obj_filters.clear();
+	objs_xml.clear();
+	member_roles.clear();
+	plug_exec_order.clear();
+	changelog.clear();
+	model_version.clear();
+	start_date = end_date = QDateTime();
+	connection = extra_connection = Connection();
+	has_fix_log = false;
+	buffer_size = 0;
+	zoom = 1;
+
+	if(export_hlp)
+		export_hlp->setIgnoredErrors({});
+}
+
+void PgModelerCliApp::releaseInputModel()
+{
+	bool is_cached = false;
+
+	for(auto &itr : models_cache)
+	{
+		if(itr.second.model == input_model)
 		{
-			#ifdef PRIV_CODE_SYMBOLS
-				__pgm_plus_cli_init
-			#endif
+			is_cached = true;
+			break;
+		}
+	}
 
-			runPluginsPreOperations();
-
-			if(fix_model)
-				fixModel();
-			else if(upd_mime)
-				updateMimeType();
-			else if(create_configs)
-				createConfigurations();
-			else if(import_db)
-				importDatabase();
-			else if(diff)
-				diffModels();
-			else if(export_op)
-				exportModel();
-			else
-				runPluginsOperations();
+	// Models kept in the cache are destroyed only when the application finishes
+	if(!is_cached)
+	{
+		delete scene;
+		delete input_model;
+	}
 
-			runPluginsPostOperations();
+	scene = nullptr;
+	input_model = nullptr;
+	xmlparser = nullptr;
+}
+
+int PgModelerCliApp::runBatch()
+{
+	QFile job_file, report_file;
+	QTextStream in;
+	QString line, job_id, error_msg;
+	QStringList args;
+	QElapsedTimer timer, total_timer;
+	attribs_map opts;
+	bool batch_silent = silent_mode, is_job = false;
+	unsigned line_num = 0, job_count = 0, failed_count = 0;
+	qint64 elapsed = 0;
+
+	if(parsed_opts.count(JobFile))
+	{
+		job_file.setFileName(parsed_opts[JobFile]);
+
+		if(!job_file.open(QFile::ReadOnly | QFile::Text))
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(parsed_opts[JobFile]),
+											ErrorCode::FileDirectoryNotAccessed, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, job_file.errorString());
 		}
+	}
+	// Jobs are read from the standard input when no job file is provided
+	else if(!job_file.open(stdin, QFile::ReadOnly | QFile::Text))
+	{
+		throw Exception(tr("Failed to read the jobs from the standard input!"),
+										ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, job_file.errorString());
+	}
 
-		return 0;
+	if(parsed_opts.count(Output))
+	{
+		report_file.setFileName(parsed_opts[Output]);
+
+		if(!report_file.open(QFile::WriteOnly | QFile::Truncate))
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(parsed_opts[Output]),
+											ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, report_file.errorString());
+		}
 	}
-	catch(Exception &e)
+
+	printMessage(tr("Starting batch mode. Reading jobs from: %1").arg(parsed_opts.count(JobFile) ? parsed_opts[JobFile] : tr("standard input")));
+	in.setDevice(&job_file);
+	total_timer.start();
+
+	/* The jobs are read one at a time so the jobs can be fed to the
+	 * standard input while the previous ones are running */
+	while(in.readLineInto(&line))
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+		line_num++;
+		is_job = false;
+		job_id = QString("job-%1").arg(job_count + 1);
+		error_msg.clear();
+		timer.start();
+
+		try
+		{
+			// Empty lines and lines starting with # are ignored
+			if(!parseBatchJob(line, line_num, job_id, args))
+				continue;
+
+			is_job = true;
+			job_count++;
+			resetOperation();
+			opts = extractOptions(args);
+
+			if(opts.count(Batch) || opts.count(Help) || opts.count(Version))
+				throw Exception(tr("The options `%1', `%2' and `%3' can't be used in a batch job!").arg(Batch, Help, Version), ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+			/* Since the jobs are read from the standard input the diff preview,
+			 * which waits for the user input, can't be used in batch mode */
+			if(opts.count(Diff) && opts.count(ApplyDiff) && !opts.count(NoDiffPreview))
+				throw Exception(tr("The option `%1' must be used when applying a diff in batch mode!").arg(NoDiffPreview), ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+			printMessage(tr("\n** Running job `%1'...").arg(job_id));
+			silent_mode = batch_silent || opts.count(Silent);
+			parseOptions(opts);
+			configureOperation();
+			runOperation();
+		}
+		catch(Exception &e)
+		{
+			// An invalid job definition is also accounted as a (failed) job
+			if(!is_job)
+				job_count++;
+
+			error_msg = e.getExceptionsText();
+			failed_count++;
+		}
+
+		elapsed = timer.elapsed();
+		silent_mode = batch_silent;
+		releaseInputModel();
+
+		if(error_msg.isEmpty())
+			printMessage(tr("** Job `%1' finished in %2 ms.").arg(job_id).arg(elapsed));
+		else
+		{
+			printText(tr("** Job `%1' failed in %2 ms!").arg(job_id).arg(elapsed));
+			printText(error_msg);
+		}
+
+		// Each job produces a JSON line in the report file
+		if(report_file.isOpen())
+		{
+			QJsonObject report;
+
+			report["id"] = job_id;
+			report["status"] = error_msg.isEmpty() ? "ok" : "failed";
+			report["elapsed_ms"] = elapsed;
+
+			if(!error_msg.isEmpty())
+				report["error"] = error_msg;
+
+			report_file.write(QJsonDocument(report).toJson(QJsonDocument::Compact) + "\n");
+			report_file.flush();
+		}
 	}
+
+	printMessage(tr("\nBatch finished: %1 job(s) executed, %2 failed, %3 ms elapsed.\n")
+							 .arg(job_count).arg(failed_count).arg(total_timer.elapsed()));
+
+	return failed_count > 0 ? 1 : 0;
+}
+
+bool PgModelerCliApp::parseBatchJob(const QString &line, unsigned line_num, QString &job_id, QStringList &args)
+{
+	QString job_line = line.trimmed();
+	QJsonParseError parse_error;
+	QJsonDocument job_doc;
+
+	if(job_line.isEmpty() || job_line.startsWith('#'))
+		return false;
+
+	job_doc = QJsonDocument::fromJson(job_line.toUtf8(), &parse_error);
+
+	if(parse_error.error != QJsonParseError::NoError || !job_doc.isObject())
+	{
+		throw Exception(tr("Invalid job definition at line %1: %2").arg(line_num).arg(parse_error.error != QJsonParseError::NoError ? parse_error.errorString() : tr("a JSON object was expected.")),
+										ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	if(job_doc.object().contains("id"))
+		job_id = job_doc.object().value("id").toVariant().toString();
+
+	args.clear();
+
+	for(auto arg : job_doc.object().value("args").toArray())
+	{
+		if(!arg.isString())
+			throw Exception(tr("The arguments of the job at line %1 must be strings!").arg(line_num), ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+		args.append(arg.toString());
+	}
+
+	if(args.isEmpty())
+		throw Exception(tr("No arguments were specified for the job at line %1!").arg(line_num), ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	return true;
 }
 
 void PgModelerCliApp::updateProgress(int progress, QString msg, ObjectType)
@@ -2185,6 +2553,40 @@ void PgModelerCliApp::fixModel()
 
 void PgModelerCliApp::loadModel()
 {
+	QFileInfo fi(parsed_opts[Input]);
+	QString cache_key;
+
+	/* In batch mode the loaded models are kept in memory so the next jobs using the same
+	 * model file can reuse them. Models with graphical objects (scene) are cached apart */
+	if(batch_mode)
+	{
+		cache_key = fi.absoluteFilePath() + (scene ? "#scene" : "");
+		auto itr = models_cache.find(cache_key);
+
+		if(itr != models_cache.end())
+		{
+			CachedModel cached = itr->second;
+			models_cache.erase(itr);
+
+			if(cached.last_modified == fi.lastModified() && cached.size == fi.size())
+			{
+				releaseInputModel();
+				input_model = cached.model;
+				scene = cached.scene;
+				xmlparser = input_model->getXMLParser();
+				cached.last_use = ++cache_tick;
+				models_cache[cache_key] = cached;
+
+				printMessage(tr("Reusing the model loaded by a previous job."));
+				return;
+			}
+
+			// The file changed since it was cached so the outdated model is discarded
+			delete cached.scene;
+			delete cached.model;
+		}
+	}
+
 	//Create the systems objects on model before loading it
 	input_model->createSystemObjects(false);
 
@@ -2209,6 +2611,23 @@ void PgModelerCliApp::loadModel()
 
 		scene->blockSignals(false);
 	}
+
+	if(batch_mode)
+	{
+		// Discarding the least recently used model when the cache is full
+		if(models_cache.size() >= MaxCachedModels)
+		{
+			auto lru_itr = std::min_element(models_cache.begin(), models_cache.end(), [](auto &a, auto &b){
+				return a.second.last_use < b.second.last_use;
+			});
+
+			delete lru_itr->second.scene;
+			delete lru_itr->second.model;
+			models_cache.erase(lru_itr);
+		}
+
+		models_cache[cache_key] = CachedModel { input_model, scene, fi.lastModified(), fi.size(), ++cache_tick };
+	}
 }
 
 void PgModelerCliApp::exportModel()
@@ -2221,13 +2640,38 @@ void PgModelerCliApp::exportModel()
 	//Export to PNG
 	if(parsed_opts.count(ExportToPng))
 	{
-		printMessage(tr("Exporting to PNG image: %1").arg(parsed_opts[Output]));
+		int tile_size = parsed_opts.count(TileSize) ? parsed_opts[TileSize].toInt() : ModelExportHelper::DefaultTileSize;
+
+		if(parsed_opts.count(TilePyramid))
+		{
+			printMessage(tr("Exporting to PNG tile pyramid: %1").arg(parsed_opts[Output]));
+
+			export_hlp->exportToPNGTilePyramid(scene, parsed_opts[Output], zoom,
+																				 parsed_opts.count(ShowGrid) > 0,
+																				 parsed_opts.count(ShowDelimiters) > 0,
+																				 parsed_opts.count(OverrideBgColor) > 0,
+																				 tile_size);
+		}
+		else if(parsed_opts.count(TiledPng))
+		{
+			printMessage(tr("Exporting to PNG image (tiled): %1").arg(parsed_opts[Output]));
+
+			export_hlp->exportToTiledPNG(scene, parsed_opts[Output], zoom,
+																	 parsed_opts.count(ShowGrid) > 0,
+																	 parsed_opts.count(ShowDelimiters) > 0,
+																	 parsed_opts.count(OverrideBgColor) > 0,
+																	 tile_size);
+		}
+		else
+		{
+			printMessage(tr("Exporting to PNG image: %1").arg(parsed_opts[Output]));
 
-		export_hlp->exportToPNG(scene, parsed_opts[Output], zoom,
-								 parsed_opts.count(ShowGrid) > 0,
-								 parsed_opts.count(ShowDelimiters) > 0,
-								 parsed_opts.count(PageByPage) > 0,
-								 parsed_opts.count(OverrideBgColor) > 0);
+			export_hlp->exportToPNG(scene, parsed_opts[Output], zoom,
+															parsed_opts.count(ShowGrid) > 0,
+															parsed_opts.count(ShowDelimiters) > 0,
+															parsed_opts.count(PageByPage) > 0,
+															parsed_opts.count(OverrideBgColor) > 0);
+		}
 	}
 	//Export to SVG
 	else if(parsed_opts.count(ExportToSvg))
@@ -2267,7 +2711,8 @@ void PgModelerCliApp::exportModel()
 		export_hlp->exportToDataDict(input_model, parsed_opts[Output],
 																 parsed_opts.count(NoIndex) == 0,
 																 parsed_opts.count(Split) > 0,
-																 parsed_opts.count(Markdown) > 0);
+																 parsed_opts.count(Markdown) > 0,
+																 parsed_opts.count(Incremental) > 0);
 	}
 	//Export to DBMS
 	else
@@ -2296,9 +2741,30 @@ void PgModelerCliApp::importDatabase()
 	printMessage(tr("Source database: %1").arg(connection.getConnectionId(true, true)));
 
 	ModelWidget *model_wgt = new ModelWidget;
+	bool refresh_model = parsed_opts.count(Incremental) && QFileInfo::exists(parsed_opts[Output]);
+
+	/* In incremental mode the model generated by a previous import is refreshed
+	 * so only the objects changed in the database since then are imported again */
+	if(refresh_model)
+	{
+		printMessage(tr("Loading the model to be refreshed: %1").arg(parsed_opts[Output]));
+		model_wgt->getDatabaseModel()->createSystemObjects(false);
+		model_wgt->loadModel(parsed_opts[Output]);
+	}
 
-	importDatabase(model_wgt->getDatabaseModel(), connection);
-	model_wgt->rearrangeSchemasInGrid();
+	importDatabase(model_wgt->getDatabaseModel(), connection, refresh_model);
+
+	// The objects positions of a refreshed model are preserved
+	if(!refresh_model)
+	{
+		if(parsed_opts.count(ForceLayout))
+		{
+			printMessage(tr("Arranging the imported objects..."));
+			model_wgt->rearrangeTablesForceDirected(false);
+		}
+		else
+			model_wgt->rearrangeSchemasInGrid();
+	}
 
 	printMessage(tr("Saving imported database to file..."));
 
@@ -2309,17 +2775,54 @@ void PgModelerCliApp::importDatabase()
 	delete model_wgt;
 }
 
-void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
+Catalog *PgModelerCliApp::getPooledCatalog(Connection &conn)
+{
+	QString conn_id = conn.getConnectionString();
+	Catalog *catalog = nullptr;
+
+	if(catalogs_pool.count(conn_id))
+		return catalogs_pool.at(conn_id);
+
+	try
+	{
+		catalog = new Catalog;
+		catalog->setConnection(conn);
+		catalogs_pool[conn_id] = catalog;
+		return catalog;
+	}
+	catch(Exception &e)
+	{
+		delete catalog;
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn, bool refresh_model)
+{
+	try
+	{
+		configureImport(import_hlp, model, conn, refresh_model);
+		import_hlp->importDatabase();
+		import_hlp->closeConnection();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void PgModelerCliApp::configureImport(DatabaseImportHelper *imp_hlp, DatabaseModel *model, Connection conn, bool refresh_model, bool use_pool)
 {
 	try
 	{
 		std::map<ObjectType, std::vector<unsigned>> obj_oids;
 		std::map<unsigned, std::vector<unsigned>> col_oids;
-		Catalog catalog;
+		Catalog local_catalog, *catalog = nullptr;
 		QString db_oid;
 		QStringList force_tab_objs;
 		bool imp_sys_objs = (parsed_opts.count(ImportSystemObjs) > 0),
-				imp_ext_objs = (parsed_opts.count(ImportExtensionObjs) > 0);
+				imp_ext_objs = (parsed_opts.count(ImportExtensionObjs) > 0),
+				incremental = (parsed_opts.count(ImportDb) && parsed_opts.count(Incremental));
 
 		if(parsed_opts[ForceChildren] == AllChildren)
 		{
@@ -2336,39 +2839,117 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 
 		Connection::setPrintSQL(parsed_opts.count(DebugMode) > 0);
 
-		catalog.setConnection(conn);
+		if(use_pool)
+			catalog = getPooledCatalog(conn);
+		else
+		{
+			catalog = &local_catalog;
+			catalog->setConnection(conn);
+		}
 
-		catalog.setQueryFilter(Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes |
-													 Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs);
+		catalog->setQueryFilter(Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes |
+														Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs);
 
-		catalog.setObjectFilters(obj_filters, parsed_opts.count(OnlyMatching) > 0,
-														 parsed_opts.count(MatchByName) == 0, force_tab_objs);
+		catalog->setObjectFilters(obj_filters, parsed_opts.count(OnlyMatching) > 0,
+															parsed_opts.count(MatchByName) == 0, force_tab_objs);
 
-		catalog.getObjectsOIDs(obj_oids, col_oids, {{Attributes::FilterTableTypes, Attributes::True}});
+		catalog->getObjectsOIDs(obj_oids, col_oids, {{Attributes::FilterTableTypes, Attributes::True}});
 
-		db_oid = catalog.getObjectOID(conn.getConnectionParam(Connection::ParamDbName), ObjectType::Database);
+		db_oid = catalog->getObjectOID(conn.getConnectionParam(Connection::ParamDbName), ObjectType::Database);
 		obj_oids[ObjectType::Database].push_back(db_oid.toUInt());
-		catalog.closeConnection();
-
-		import_hlp->setConnection(conn);
-		import_hlp->setImportOptions(imp_sys_objs,
-																 imp_ext_objs,
-																 true,
-																 parsed_opts.count(IgnoreImportErrors) > 0,
-																 parsed_opts.count(DebugMode) > 0,
-																 !parsed_opts.count(Diff),
-																 !parsed_opts.count(Diff),
-																 parsed_opts.count(CommentsAsAliases) > 0);
-
-		model->createSystemObjects(true);
-		import_hlp->setSelectedOIDs(model, obj_oids, col_oids);
+
+		/* The pooled catalog is handed to the import helper so its object filters are
+		 * cleared otherwise they would restrict the queries executed during the import */
+		catalog->clearObjectFilters();
+
+		if(!use_pool)
+			catalog->closeConnection();
+
+		imp_hlp->setCatalog(use_pool ? catalog : nullptr);
+		imp_hlp->setConnection(conn);
+		imp_hlp->setImportOptions(imp_sys_objs,
+															imp_ext_objs,
+															true,
+															parsed_opts.count(IgnoreImportErrors) > 0,
+															parsed_opts.count(DebugMode) > 0,
+															!parsed_opts.count(Diff),
+															!parsed_opts.count(Diff),
+															parsed_opts.count(CommentsAsAliases) > 0,
+															/* Only a model being refreshed is a working one, importing to a new model
+															 * as a working one would retrieve the columns of each table separately */
+															incremental && refresh_model);
+		imp_hlp->setIncrementalImport(incremental);
+
+		// A model being refreshed (see importDatabase()) already has the system objects
+		if(model->getObjectIndex("pg_catalog", ObjectType::Schema) < 0)
+			model->createSystemObjects(true);
+
+		imp_hlp->setSelectedOIDs(model, obj_oids, col_oids);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void PgModelerCliApp::importDatabases(DatabaseModel *src_model, DatabaseModel *cmp_model, qint64 &src_time, qint64 &cmp_time)
+{
+	DatabaseImportHelper cmp_import_hlp;
+	QThreadPool thread_pool;
+	QElapsedTimer timer;
+	Exception cmp_error;
+	bool cmp_failed = false;
+
+	/* Both helpers are configured (and their models populated with system objects)
+	 * in the main thread, so only the import itself runs concurrently */
+	configureImport(import_hlp, src_model, connection);
+
+	/* When both databases are reached through the same connection the compared one can't
+	 * use the same pooled catalog since both imports run at the same time */
+	configureImport(&cmp_import_hlp, cmp_model, extra_connection, false,
+									connection.getConnectionString() != extra_connection.getConnectionString());
+
+	/* The compared database is imported in a worker thread while the source one is
+	 * imported in the main thread. The catalog retrieval of both databases happens in
+	 * parallel and the model building steps are serialized by the helpers themselves.
+	 * The progress of the compared import is not printed to avoid mixing the output of both */
+	thread_pool.setMaxThreadCount(1);
+	thread_pool.start([&cmp_import_hlp, &cmp_error, &cmp_failed, &cmp_time](){
+		QElapsedTimer cmp_timer;
+
+		cmp_timer.start();
+
+		try
+		{
+			cmp_import_hlp.importDatabase();
+		}
+		catch(Exception &e)
+		{
+			cmp_error = Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+			cmp_failed = true;
+		}
+
+		cmp_import_hlp.closeConnection();
+		cmp_time = cmp_timer.elapsed();
+	});
+
+	try
+	{
+		timer.start();
 		import_hlp->importDatabase();
 		import_hlp->closeConnection();
+		src_time = timer.elapsed();
 	}
 	catch(Exception &e)
 	{
+		thread_pool.waitForDone();
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
 	}
+
+	thread_pool.waitForDone();
+
+	if(cmp_failed)
+		throw Exception(cmp_error.getErrorMessage(), cmp_error.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &cmp_error);
 }
 
 void PgModelerCliApp::diffModels()
@@ -2377,6 +2958,8 @@ void PgModelerCliApp::diffModels()
 	QString dbname;
 	std::vector<BaseObject *> filtered_objs;
 	bool is_compare_db = parsed_opts.count(CompareDb);
+	QElapsedTimer timer;
+	qint64 src_time = -1, cmp_time = -1;
 
 	try
 	{
@@ -2398,7 +2981,9 @@ void PgModelerCliApp::diffModels()
 		if(!parsed_opts[Input].isEmpty())
 		{
 			printMessage(tr("Loading source model..."));
+			timer.start();
 			loadModel();
+			src_time = timer.elapsed();
 
 			if(parsed_opts.count(PartialDiff))
 			{
@@ -2438,24 +3023,36 @@ void PgModelerCliApp::diffModels()
 				}
 			}
 		}
+		// Comparing two databases: both are imported at the same time
+		else if(is_compare_db)
+		{
+			printMessage(tr("Importing databases `%1' and `%2' concurrently...").arg(connection.getConnectionId(true, true), dbname));
+			importDatabases(input_model, compared_model, src_time, cmp_time);
+		}
 		else
 		{
 			printMessage(tr("Importing database `%1'...").arg(connection.getConnectionId(true, true)));
+			timer.start();
 			importDatabase(input_model, connection);
+			src_time = timer.elapsed();
 		}
 
-		// Importing the compared database
-		if(parsed_opts.count(CompareDb))
+		// Importing the compared database (when not yet imported along with the source one)
+		if(is_compare_db && cmp_time < 0)
 		{
 			printMessage(tr("Importing database `%1'...").arg(dbname));
+			timer.start();
 			importDatabase(compared_model, extra_connection);
+			cmp_time = timer.elapsed();
 		}
 		// Otherwise we load the model from file (param CompareFile)
-		else
+		else if(!is_compare_db)
 		{
 			printMessage(tr("Loading target model..."));
+			timer.start();
 			compared_model->createSystemObjects(false);
 			compared_model->loadModel(parsed_opts[CompareFile]);
+			cmp_time = timer.elapsed();
 		}
 
 		diff_hlp->setModels(input_model, compared_model);
@@ -2476,14 +3073,16 @@ void PgModelerCliApp::diffModels()
 			diff_hlp->setPgSQLVersion(parsed_opts[PgSqlVer]);
 		else if(is_compare_db)
 		{
-			extra_connection.connect();
-			diff_hlp->setPgSQLVersion(extra_connection.getPgSQLVersion(true));
-			extra_connection.close();
+			diff_hlp->setPgSQLVersion(getPooledCatalog(extra_connection)->getServerVersion(true));
 		}
 
 		printMessage(tr("Comparing the models..."));
 		diff_hlp->diffModels();
 
+		printMessage(tr("Phase timings: source %1 ms, target %2 ms, diff %3 ms, SQL generation %4 ms.")
+								 .arg(src_time).arg(cmp_time)
+								 .arg(diff_hlp->getCompareTime()).arg(diff_hlp->getCodeGenerationTime()));
+
 		if(diff_hlp->getDiffDefinition().isEmpty())
 			printMessage(tr("No differences detected."));
 		else
@@ -151,9 +151,63 @@ class __libcli PgModelerCliApp: public Application {
 
 		static const QString PasswordPlaceholder;
 
+		//! \brief Stores a model loaded by a job in batch mode so the next jobs can reuse it
+		struct CachedModel {
+			DatabaseModel *model {nullptr};
+
+			//! \brief The scene holding the graphical objects of the model (only for graphical exports)
+			ObjectsScene *scene {nullptr};
+
+			//! \brief The modification date and size of the model file used to detect changes on it
+			QDateTime last_modified;
+			qint64 size {0};
+
+			//! \brief The value of cache_tick when the model was last used (used to discard the least recently used model)
+			unsigned last_use {0};
+		};
+
+		//! \brief The maximum number of models kept in memory in batch mode
+		static constexpr unsigned MaxCachedModels = 5;
+
+		//! \brief Indicates that the jobs are read from a file or from the standard input (see runBatch())
+		bool batch_mode,
+
+		//! \brief Indicates that the appearance settings were already loaded by a previous operation
+		appearance_loaded;
+
+		//! \brief The models loaded in batch mode indexed by the absolute path of their files
+		std::map<QString, CachedModel> models_cache;
+
+		/*! \brief The catalogs connected to the databases used by the operations indexed by their connection strings.
+		 *  The catalogs are handed to the import and diff helpers and kept opened between the jobs
+		 *  in batch mode so the jobs using the same connection don't connect to the server again */
+		std::map<QString, Catalog *> catalogs_pool;
+
+		//! \brief Counter incremented each time a cached model is used
+		unsigned cache_tick;
+
 		//! \brief Parsers the options and executes the action specified by them
 		void parseOptions(attribs_map &parsed_opts);
 
+		//! \brief Extracts the options and their values from the provided arguments list
+		attribs_map extractOptions(const QStringList &args);
+
+		//! \brief Creates the input model, the scene and the connections used by the operation in the parsed options
+		void configureOperation();
+
+		//! \brief Executes the operation in the parsed options
+		void runOperation();
+
+		//! \brief Resets the state of the previous operation so the next job in batch mode can be executed
+		void resetOperation();
+
+		//! \brief Destroys the input model and its scene, unless the model is in the cache of the batch mode
+		void releaseInputModel();
+
+		/*! \brief Executes the jobs (one JSON object per line) read from the job file or from the standard input
+		 *  printing the time spent by each one. Returns 0 if all jobs succeeded or 1 otherwise */
+		int runBatch();
+
 		//! \brief Returns if the specified options exists on short options map
 		bool isOptionRecognized(QString &op, bool &accepts_val);
 
@@ -187,7 +241,21 @@ class __libcli PgModelerCliApp: public Application {
 		void fixOpClassesFamiliesReferences(QString &obj_xml);
 
 		void configureConnection(bool extra_conn);
-		void importDatabase(DatabaseModel *model, Connection conn);
+		void importDatabase(DatabaseModel *model, Connection conn, bool refresh_model = false);
+
+		/*! \brief Configures the provided import helper to import the database pointed by conn into model.
+		 * The catalog is queried to determine the objects to be imported based upon the filtering options.
+		 * The refresh_model flag indicates that model was loaded from a previous import and is being updated,
+		 * in that case the model is treated as a working one so its existing objects are reused.
+		 * The use_pool flag makes the helper use the pooled catalog of the connection (see getPooledCatalog()) */
+		void configureImport(DatabaseImportHelper *imp_hlp, DatabaseModel *model, Connection conn, bool refresh_model = false, bool use_pool = true);
+
+		//! \brief Returns the pooled catalog connected through the provided connection creating it if needed (see catalogs_pool)
+		Catalog *getPooledCatalog(Connection &conn);
+
+		/*! \brief Imports the source and compared databases of a diff at the same time, each one in its own
+		 * connection. The time spent (in ms) by each import is returned in src_time and cmp_time */
+		void importDatabases(DatabaseModel *src_model, DatabaseModel *cmp_model, qint64 &src_time, qint64 &cmp_time);
 
 		void handleLinuxMimeDatabase(bool uninstall, bool system_wide, bool force);
 		void handleWindowsMimeDatabase(bool uninstall, bool system_wide, bool force);
@@ -226,6 +294,7 @@ class __libcli PgModelerCliApp: public Application {
 		NoIndex,
 		Split,
 		Markdown,
+		Incremental,
 		DependenciesSql,
 		ChildrenSql,
 		GroupByType,
@@ -240,6 +309,9 @@ class __libcli PgModelerCliApp: public Application {
 		ShowGrid,
 		ShowDelimiters,
 		PageByPage,
+		TiledPng,
+		TilePyramid,
+		TileSize,
 		OverrideBgColor,
 		IgnoreDuplicates,
 		IgnoreErrorCodes,
@@ -250,6 +322,7 @@ class __libcli PgModelerCliApp: public Application {
 		Passwd,
 		InitialDb,
 		Silent,
+		Trace,
 		ListConns,
 		Simulate,
 		FixModel,
@@ -269,6 +342,9 @@ class __libcli PgModelerCliApp: public Application {
 		ForceChildren,
 		OnlyMatching,
 		CommentsAsAliases,
+		ForceLayout,
+		Batch,
+		JobFile,
 		PartialDiff,
 		Force,
 		StartDate,
@@ -340,6 +416,11 @@ class __libcli PgModelerCliApp: public Application {
 
 	//! \brief Replaces the value of a single parsed option
 	void setParsedOptValue(const QString &opt, const QString &value);
+
+	/*! \brief Parses a line of a batch job file storing the job id and arguments in the provided references.
+	 *  The job_id is changed only when the job defines one. Returns false for empty and comment (#) lines,
+	 *  which must be skipped, and raises an error if the line isn't a valid job definition */
+	static bool parseBatchJob(const QString &line, unsigned line_num, QString &job_id, QStringList &args);
 		void fixModel();
 		void exportModel();
 		void importDatabase();
@@ -20,7 +20,9 @@
 */
 #include "catalog.h"
 #include "utilsns.h"
+#include "tracer.h"
 #include "tableobject.h"
+#include "pgsqlversions.h"
 
 const QString Catalog::PgModelerTempDbObj {"__pgmodeler_tmp"};
 const QString Catalog::EscapedNullChar {"\\000"};
@@ -40,6 +42,12 @@ const QString Catalog::GetExtensionObjsSql {
 		ORDER BY extname;"
 };
 
+const QString Catalog::FingerprintSql {
+	"SELECT ob.oid, ob.xmin::text || ':' || \
+		(SELECT count(*) || ':' || coalesce(sum(hashtext(dp.xmin::text || '.' || dp.id)), 0) FROM (%1) AS dp) AS fingerprint \
+		FROM %2 AS ob WHERE ob.oid = ANY('{%3}'::oid[])"
+};
+
 const std::map<ObjectType, QString> Catalog::oid_fields {
 	{ObjectType::Database, "oid"}, {ObjectType::Role, "oid"}, {ObjectType::Schema,"oid"},
 	{ObjectType::Language, "oid"}, {ObjectType::Tablespace, "oid"}, {ObjectType::Extension, "ex.oid"},
@@ -103,11 +111,42 @@ const std::map<ObjectType, QString> Catalog::parent_aliases {
 	{ObjectType::Policy, "tb"}
 };
 
+const std::map<QString, QString> Catalog::fingerprint_deps {
+	{ "pg_class",
+		"SELECT xmin, attnum AS id FROM pg_attribute WHERE attrelid = ob.oid AND attnum > 0 \
+		 UNION ALL SELECT xmin, adnum FROM pg_attrdef WHERE adrelid = ob.oid \
+		 UNION ALL SELECT xmin, 0 FROM pg_index WHERE indexrelid = ob.oid \
+		 UNION ALL SELECT xmin, 0 FROM pg_sequence WHERE seqrelid = ob.oid \
+		 UNION ALL SELECT xmin, inhseqno FROM pg_inherits WHERE inhrelid = ob.oid \
+		 UNION ALL SELECT xmin, 0 FROM pg_foreign_table WHERE ftrelid = ob.oid \
+		 UNION ALL SELECT xmin, 0 FROM pg_rewrite WHERE ev_class = ob.oid AND rulename = '_RETURN'" },
+
+	{ "pg_proc",
+		"SELECT xmin, 0 FROM pg_aggregate WHERE aggfnoid = ob.oid" },
+
+	{ "pg_type",
+		"SELECT xmin, attnum FROM pg_attribute WHERE attrelid = ob.typrelid AND attnum > 0 \
+		 UNION ALL SELECT xmin, 0 FROM pg_enum WHERE enumtypid = ob.oid \
+		 UNION ALL SELECT xmin, 0 FROM pg_constraint WHERE contypid = ob.oid \
+		 UNION ALL SELECT xmin, 0 FROM pg_range WHERE rngtypid = ob.oid" }
+};
+
 attribs_map Catalog::catalog_queries {};
+QMutex Catalog::catalog_queries_mtx;
+
+const QStringList Catalog::ParamAttributes {
+	Attributes::Schema, Attributes::Table,
+	Attributes::Name, Attributes::FilterOids
+};
+
+std::map<QString, Catalog::PreparedQuery> Catalog::prepared_queries;
+QMutex Catalog::prepared_queries_mtx;
+Catalog::PreparedQueryStats Catalog::prepared_stats;
 
 Catalog::Catalog()
 {
 	match_signature = true;
+	use_prepared_queries = false;
 	last_sys_oid=0;
 	setQueryFilter(ExclExtensionObjs | ExclSystemObjs);
 }
@@ -171,6 +210,28 @@ bool Catalog::isConnectionValid()
 	return connection.isConfigured();
 }
 
+void Catalog::setPreparedQueries(bool value)
+{
+	use_prepared_queries = value;
+}
+
+bool Catalog::isPreparedQueries()
+{
+	return use_prepared_queries;
+}
+
+Catalog::PreparedQueryStats Catalog::getPreparedQueryStats()
+{
+	QMutexLocker locker(&prepared_queries_mtx);
+	return prepared_stats;
+}
+
+void Catalog::resetPreparedQueryStats()
+{
+	QMutexLocker locker(&prepared_queries_mtx);
+	prepared_stats = PreparedQueryStats();
+}
+
 void Catalog::setQueryFilter(QueryFilter filter)
 {
 	bool list_all=(ListAllObjects & filter) == ListAllObjects;
@@ -415,6 +476,8 @@ bool Catalog::isExtensionObject(unsigned oid, const QString &ext_name)
 
 void Catalog::loadCatalogQuery(const QString &qry_id)
 {
+	QMutexLocker locker(&catalog_queries_mtx);
+
 	if(catalog_queries.count(qry_id)==0)
 		catalog_queries[qry_id] = UtilsNs::loadFile(GlobalAttributes::getSchemaFilePath(GlobalAttributes::CatalogSchemasDir, qry_id));
 
@@ -423,7 +486,7 @@ void Catalog::loadCatalogQuery(const QString &qry_id)
 
 QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs)
 {
-	QString sql, custom_filter;
+	QString custom_filter;
 
 	/* Escaping apostrophe (') in the attributes values to avoid SQL errors
 	 * due to support to this char in the middle of objects' names. The only exception
@@ -438,6 +501,12 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 		}
 	}
 
+	attribs = getQueryAttributes(qry_type, obj_type, attribs, custom_filter);
+	return renderCatalogQuery(obj_type, attribs, custom_filter, single_result);
+}
+
+attribs_map Catalog::getQueryAttributes(const QString &qry_type, ObjectType obj_type, attribs_map attribs, QString &custom_filter)
+{
 	schparser.setPgSQLVersion(connection.getPgSQLVersion(true),
 														Connection::isDbVersionIgnored());
 	attribs[qry_type]=Attributes::True;
@@ -465,6 +534,8 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 		attribs[Attributes::ExtraCondition] = extra_filter_conds[obj_type];
 
 	//Checking if the custom filter expression is present
+	custom_filter.clear();
+
 	if(attribs.count(Attributes::CustomFilter))
 	{
 		custom_filter=attribs[Attributes::CustomFilter];
@@ -479,11 +550,17 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 			attribs[Attributes::NotExtObject]=getNotExtObjectQuery(ext_oid_fields.at(obj_type));
 	}
 
+	attribs[Attributes::PgSqlVersion]=schparser.getPgSQLVersion();
+	return attribs;
+}
+
+QString Catalog::renderCatalogQuery(ObjectType obj_type, attribs_map &attribs, QString custom_filter, bool single_result)
+{
+	QString sql;
+
 	loadCatalogQuery(BaseObject::getSchemaName(obj_type));
 	schparser.ignoreUnkownAttributes(true);
 	schparser.ignoreEmptyAttributes(true);
-
-	attribs[Attributes::PgSqlVersion]=schparser.getPgSQLVersion();
 	sql=schparser.getSourceCode(attribs).simplified();
 
 	//Appeding the custom filter to the whole catalog query
@@ -538,9 +615,16 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 
 void Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result, attribs_map attribs)
 {
+	PGM_TRACE_SCOPE("catalog", "Catalog::executeCatalogQuery");
+
 	try
 	{
-		connection.executeDMLCommand(getCatalogQuery(qry_type, obj_type, single_result, attribs), result);
+		if(use_prepared_queries)
+			executePreparedCatalogQuery(qry_type, obj_type, result, single_result, attribs);
+		else
+			connection.executeDMLCommand(getCatalogQuery(qry_type, obj_type, single_result, attribs), result);
+
+		PGM_TRACE_COUNTER("catalog", "Catalog query rows", result.getTupleCount());
 	}
 	catch(Exception &e)
 	{
@@ -549,6 +633,197 @@ void Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type,
 	}
 }
 
+void Catalog::executePreparedCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result, attribs_map attribs)
+{
+	attribs_map orig_attribs = attribs;
+	std::map<QString, QString> placeholders, param_vals;
+	QString custom_filter, shape;
+	QStringList params;
+	PreparedQuery prep_qry;
+	bool found = false, reused = false;
+	double planning_time = 0;
+
+	/* The values of the parameter attributes are replaced by placeholders so the shape of the query
+	 * doesn't depend on them. Empty values are kept as is since they change the code generated by
+	 * the conditional instructions of the catalog schema files */
+	for(auto &attr : ParamAttributes)
+	{
+		if(attribs.count(attr) && !attribs[attr].isEmpty())
+		{
+			param_vals[attr] = attribs[attr];
+			placeholders[attr] = QString("__pgm_param%1__").arg(placeholders.size() + 1);
+			attribs[attr] = placeholders[attr];
+		}
+	}
+
+	for(auto &attr : attribs)
+	{
+		if(attr.first != Attributes::CustomFilter &&
+			 attr.first != Attributes::Comment &&
+			 attr.second.contains(QChar('\'')))
+		{
+			attr.second.replace(QChar('\''), "''");
+		}
+	}
+
+	attribs = getQueryAttributes(qry_type, obj_type, attribs, custom_filter);
+	shape = QString("%1:%2:%3").arg(qry_type, BaseObject::getSchemaName(obj_type)).arg(single_result);
+
+	for(auto &[attr, value] : attribs)
+		shape += QString("\n%1=%2").arg(attr, value);
+
+	/* Custom filters carry the values in their own code (see getObjectOID()) so
+	 * the queries using them are not reused and run in the usual way */
+	if(custom_filter.isEmpty())
+	{
+		QMutexLocker locker(&prepared_queries_mtx);
+		auto itr = prepared_queries.find(shape);
+
+		if(itr != prepared_queries.end())
+		{
+			prep_qry = itr->second;
+			found = true;
+		}
+		else if(prepared_queries.size() < MaxPreparedQueries)
+		{
+			locker.unlock();
+			prep_qry.sql = renderCatalogQuery(obj_type, attribs, custom_filter, single_result);
+			prep_qry.parameterized = parameterizeQuery(prep_qry.sql, placeholders, prep_qry.param_attrs);
+			prep_qry.planning_time = 0;
+			locker.relock();
+
+			/* Another catalog may have rendered the same shape in the meantime,
+			 * in that case its statement name is kept */
+			prep_qry.stmt_name = QString("pgm_catalog_%1").arg(prepared_queries.size() + 1);
+			prep_qry = prepared_queries.emplace(shape, prep_qry).first->second;
+			found = true;
+		}
+	}
+
+	if(!found || !prep_qry.parameterized)
+	{
+		connection.executeDMLCommand(getCatalogQuery(qry_type, obj_type, single_result, orig_attribs), result);
+
+		QMutexLocker locker(&prepared_queries_mtx);
+		prepared_stats.unprepared_count++;
+		return;
+	}
+
+	for(auto &attr : prep_qry.param_attrs)
+	{
+		// Oid lists are sent as arrays since their IN (...) clauses were turned into = ANY($n)
+		if(attr == Attributes::FilterOids)
+			params.append(QString("{%1}").arg(param_vals[attr]));
+		else
+			params.append(param_vals[attr]);
+	}
+
+	reused = connection.isStatementPrepared(prep_qry.stmt_name);
+
+	if(!reused)
+	{
+		/* Forcing generic plans makes the server plan the statement only once per
+		 * session instead of planning it again in each execution (PostgreSQL 12+) */
+		if(connection.getPgSQLVersion(true).toDouble() >= PgSqlVersions::PgSqlVersion120.toDouble())
+			connection.executeDDLCommand("SET plan_cache_mode = force_generic_plan");
+
+		connection.prepareStatement(prep_qry.stmt_name, prep_qry.sql);
+		planning_time = getPlanningTime(prep_qry.stmt_name, params);
+	}
+
+	connection.executePreparedStatement(prep_qry.stmt_name, params, result);
+
+	QMutexLocker locker(&prepared_queries_mtx);
+
+	if(reused)
+	{
+		prepared_stats.reused_count++;
+		prepared_stats.planning_time_saved += prepared_queries[shape].planning_time;
+	}
+	else
+	{
+		prepared_stats.prepared_count++;
+		prepared_queries[shape].planning_time = planning_time;
+	}
+}
+
+bool Catalog::parameterizeQuery(QString &sql, const std::map<QString, QString> &placeholders, QStringList &param_attrs)
+{
+	QString param;
+	qsizetype count = 0;
+
+	param_attrs.clear();
+
+	for(auto &[attr, placeholder] : placeholders)
+	{
+		param = QString("$%1").arg(param_attrs.size() + 1);
+		count = 0;
+
+		// Oid lists are only accepted in the form IN (oid, oid, ...) which is turned into = ANY($n)
+		if(attr == Attributes::FilterOids)
+		{
+			QRegularExpression in_regexp(QString("\\bIN\\s*\\(\\s*%1\\s*\\)").arg(placeholder),
+																	 QRegularExpression::CaseInsensitiveOption);
+
+			count = sql.count(in_regexp);
+			sql.replace(in_regexp, QString("= ANY(%1)").arg(param));
+		}
+		// Other values are only accepted as plain string literals
+		else if(!sql.contains(QString("E'%1'").arg(placeholder)))
+		{
+			QString literal = QString("'%1'").arg(placeholder);
+
+			count = sql.count(literal);
+			sql.replace(literal, param);
+		}
+
+		// The placeholder is used somewhere else so the query can't be parameterized
+		if(sql.contains(placeholder))
+			return false;
+
+		if(count > 0)
+			param_attrs.append(attr);
+	}
+
+	return true;
+}
+
+double Catalog::getPlanningTime(const QString &stmt_name, const QStringList &params)
+{
+	try
+	{
+		ResultSet res;
+		QStringList values;
+		QRegularExpressionMatch match;
+		QRegularExpression regexp("Planning Time: ([0-9.]+) ms", QRegularExpression::CaseInsensitiveOption);
+
+		for(auto value : params)
+			values.append(QString("'%1'").arg(value.replace(QChar('\''), "''")));
+
+		connection.executeDMLCommand(QString("EXPLAIN (SUMMARY ON, COSTS OFF) EXECUTE %1 %2")
+																 .arg(stmt_name, values.isEmpty() ? "" : "(" + values.join(", ") + ")"), res);
+
+		if(res.accessTuple(ResultSet::FirstTuple))
+		{
+			do
+			{
+				match = regexp.match(res.getColumnValue(0));
+
+				if(match.hasMatch())
+					return match.captured(1).toDouble();
+			}
+			while(res.accessTuple(ResultSet::NextTuple));
+		}
+	}
+	catch(Exception &)
+	{
+		/* Failing to measure the planning time is harmless since
+		 * the value is only used in the statistics */
+	}
+
+	return 0;
+}
+
 unsigned Catalog::getObjectsCount(std::vector<ObjectType> obj_types, bool incl_sys_objs, const QString &sch_name, const QString &tab_name, attribs_map extra_attribs)
 {
 	try
@@ -675,6 +950,79 @@ void Catalog::getObjectsOIDs(std::map<ObjectType, std::vector<unsigned> > &obj_o
 	}
 }
 
+bool Catalog::isFingerprintable(ObjectType obj_type)
+{
+	return obj_relnames.count(obj_type) &&
+				 obj_type != ObjectType::Role &&
+				 obj_type != ObjectType::UserMapping &&
+				 obj_type != ObjectType::Column;
+}
+
+std::map<unsigned, QString> Catalog::getObjectsFingerprints(const std::map<ObjectType, std::vector<unsigned>> &obj_oids)
+{
+	try
+	{
+		ResultSet res;
+		std::map<unsigned, QString> fingerprints;
+		std::map<QString, QStringList> rel_oids;
+		QStringList queries;
+		QString relname, deps;
+
+		/* Grouping the oids by the catalog table that holds the objects
+		 * so each catalog is scanned only once */
+		for(auto &[obj_type, oids] : obj_oids)
+		{
+			if(!isFingerprintable(obj_type) || oids.empty())
+				continue;
+
+			// Aggregates and foreign tables have their main rows in pg_proc and pg_class
+			if(obj_type == ObjectType::Aggregate)
+				relname = "pg_proc";
+			else if(obj_type == ObjectType::ForeignTable)
+				relname = "pg_class";
+			else
+				relname = obj_relnames.at(obj_type);
+
+			for(auto &oid : oids)
+				rel_oids[relname].append(QString::number(oid));
+		}
+
+		for(auto &[rel, oids] : rel_oids)
+		{
+			// Comments on shared objects (databases and tablespaces) are stored in pg_shdescription
+			if(rel == "pg_database" || rel == "pg_tablespace")
+				deps = QString("SELECT xmin, 0 AS id FROM pg_shdescription WHERE objoid = ob.oid AND classoid = '%1'::regclass").arg(rel);
+			else
+				deps = QString("SELECT xmin, objsubid AS id FROM pg_description WHERE objoid = ob.oid AND classoid = '%1'::regclass").arg(rel);
+
+			if(fingerprint_deps.count(rel))
+				deps += " UNION ALL " + fingerprint_deps.at(rel);
+
+			queries.append(FingerprintSql.arg(deps, rel, oids.join(',')));
+		}
+
+		if(queries.isEmpty())
+			return fingerprints;
+
+		connection.executeDMLCommand(queries.join("\nUNION ALL\n"), res);
+
+		if(res.accessTuple(ResultSet::FirstTuple))
+		{
+			do
+			{
+				fingerprints[QString(res.getColumnValue(Attributes::Oid)).toUInt()] = res.getColumnValue(Attributes::Fingerprint);
+			}
+			while(res.accessTuple(ResultSet::NextTuple));
+		}
+
+		return fingerprints;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
 attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_name, const QString &tab_name, attribs_map extra_attribs)
 {
 	try
@@ -1328,6 +1676,7 @@ void Catalog::operator = (const Catalog &catalog)
 		this->list_only_sys_objs=catalog.list_only_sys_objs;
 		this->obj_filters=catalog.obj_filters;
 		this->extra_filter_conds=catalog.extra_filter_conds;
+		this->use_prepared_queries=catalog.use_prepared_queries;
 		this->connection.connect();
 	}
 	catch(Exception &e)
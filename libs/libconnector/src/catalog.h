@@ -33,6 +33,8 @@ This class is the basis for the reverse engineering feature.
 #include "baseobject.h"
 #include <QTextStream>
 #include <QApplication>
+#include <QMutex>
+#include <map>
 
 class __libconnector Catalog {
 	public:
@@ -57,6 +59,22 @@ class __libconnector Catalog {
 			ListAllObjects=16
 		};
 
+		//! \brief Statistics about the catalog queries executed as prepared statements
+		struct PreparedQueryStats {
+			//! \brief Amount of statements prepared in all connections
+			unsigned prepared_count = 0,
+
+			//! \brief Amount of executions that reused an already prepared statement
+			reused_count = 0,
+
+			//! \brief Amount of queries executed in the usual way because they could not be parameterized
+			unprepared_count = 0;
+
+			/*! \brief Estimated server-side planning time (in ms) saved by reusing prepared statements,
+			 * based on the planning time measured when each statement was prepared */
+			double planning_time_saved = 0;
+		};
+
 	private:
 		SchemaParser schparser;
 
@@ -80,6 +98,11 @@ class __libconnector Catalog {
 		 * they are handled in extension catalog query */
 		GetExtensionObjsSql,
 
+		/*! \brief Query template used to compute the fingerprints of the objects stored in a certain catalog table (see getObjectsFingerprints()).
+		 * The placeholders are, in this order, the rows in dependent catalogs that are part of the fingerprint, the catalog
+		 * table that holds the objects and the list of oids */
+		FingerprintSql,
+
 		//! \brief This pattern matches the PostgreSQL array values in format [n:n]={a,b,c,d,...} or {a,b,c,d,...}
 		ArrayPattern,
 
@@ -124,11 +147,57 @@ class __libconnector Catalog {
 		/*! \brief This map stores the aliases that are used to reference the table (parent) on each table object catalog query.
 		 * This is mainly used to force the filter of constraints/indexes/triggers/rules/policies in presence of one or more table
 		 * filter (see setObjectFilter) */
-		parent_aliases;
+		parent_aliases,
+
+		/*! \brief This map stores, for each catalog table, the queries that retrieve the rows of the dependent catalogs
+		 * which are changed by DDL commands without touching the object's own row (e.g. adding a column changes pg_attribute,
+		 * adding an enum label changes pg_enum). These rows are taken into account when computing the fingerprint of an object */
+		fingerprint_deps;
 
 		//! \brief Store the cached catalog queries
 		static attribs_map catalog_queries;
 
+		//! \brief Guards the cached catalog queries when several catalogs are queried in parallel
+		static QMutex catalog_queries_mtx;
+
+		/*! \brief Attributes which values are sent as parameters of prepared catalog queries instead
+		 * of being written as literals in the query code (see executePreparedCatalogQuery()) */
+		static const QStringList ParamAttributes;
+
+		/*! \brief Describes the parameterized form of a catalog query. The form depends only on the query shape
+		 * (query type, object type and the attributes used to render it except the parameters values) so it is
+		 * shared by all catalog instances and rendered only once */
+		struct PreparedQuery {
+			//! \brief Name of the statement prepared in each connection
+			QString stmt_name;
+
+			//! \brief The parameterized query code in which parameters are referenced as $1, $2, ...
+			QString sql;
+
+			//! \brief Attributes which values are bound to $1, $2, ... in that order
+			QStringList param_attrs;
+
+			/*! \brief Indicates that the query could not be parameterized because one or more
+			 * parameter values is used in a way other than a literal or an oid list */
+			bool parameterized;
+
+			//! \brief Server-side planning time (in ms) measured when the statement was first prepared
+			double planning_time;
+		};
+
+		/*! \brief Maximum amount of parameterized queries kept in memory. Shapes created after
+		 * reaching that limit are executed in the usual way */
+		static constexpr unsigned MaxPreparedQueries = 500;
+
+		//! \brief Stores the parameterized catalog queries indexed by their shapes
+		static std::map<QString, PreparedQuery> prepared_queries;
+
+		//! \brief Guards the parameterized queries and their statistics
+		static QMutex prepared_queries_mtx;
+
+		//! \brief Statistics about the prepared catalog queries executed by all catalogs
+		static PreparedQueryStats prepared_stats;
+
 		//! \brief Connection used to query the pg_catalog
 		Connection connection;
 
@@ -150,7 +219,10 @@ class __libconnector Catalog {
 		list_only_sys_objs,
 
 		//! \brief Indicates that the name filtering should occur in the objects' signature instead of their names
-		match_signature;
+		match_signature,
+
+		//! \brief Indicates that the catalog queries are executed as prepared statements (see setPreparedQueries())
+		use_prepared_queries;
 
 		/*! \brief Load the schema parser buffer with the catalog query using identified by qry_id.
 		The method will cache the catalog query if it's not cached yet (only when use_cached_queries=true) */
@@ -165,6 +237,21 @@ class __libconnector Catalog {
 		//! \brief Returns the catalog query according to the type of the object type provided
 		QString getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map());
 
+		/*! \brief Returns the complete set of attributes used to render the catalog query of the provided type.
+		 * The custom filter (if present) is removed from the attributes and returned in the parameter custom_filter */
+		attribs_map getQueryAttributes(const QString &qry_type, ObjectType obj_type, attribs_map attribs, QString &custom_filter);
+
+		//! \brief Renders the catalog query of the object type using a set of attributes returned by getQueryAttributes()
+		QString renderCatalogQuery(ObjectType obj_type, attribs_map &attribs, QString custom_filter, bool single_result);
+
+		/*! \brief Executes the catalog query as a prepared statement. The query is rendered once per shape having the values
+		 * of the attributes listed in ParamAttributes replaced by parameters, then it is prepared once per connection.
+		 * Queries that can't be parameterized are executed in the usual way */
+		void executePreparedCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result, attribs_map attribs);
+
+		//! \brief Returns the server-side planning time (in ms) of the prepared statement executed with the provided parameters
+		double getPlanningTime(const QString &stmt_name, const QStringList &params);
+
 		/*! \brief Recreates the attribute map in such way that attribute names that have
 		underscores have this char replaced by dashes. Another special operation made is to replace
 		the values of fiels which suffix is _bool to '1' when 't' and to empty when 'f', this is because
@@ -209,6 +296,25 @@ class __libconnector Catalog {
 		//! \brief Configures the catalog query filter
 		void setQueryFilter(QueryFilter filter);
 
+		/*! \brief Toggles the execution of the catalog queries as prepared statements. This is intended for catalogs that
+		 * issue many similar queries during their lifetime (e.g. the ones used while browsing a database) since they save
+		 * the rendering of the query code and the server-side parsing and planning of each query */
+		void setPreparedQueries(bool value);
+
+		//! \brief Returns if the catalog queries are executed as prepared statements
+		bool isPreparedQueries();
+
+		//! \brief Returns the statistics about the prepared catalog queries executed by all catalogs
+		static PreparedQueryStats getPreparedQueryStats();
+
+		//! \brief Resets the statistics about the prepared catalog queries
+		static void resetPreparedQueryStats();
+
+		/*! \brief Replaces the placeholders of the parameters values in the rendered sql by $1, $2, ...
+		 * Returns false if any placeholder is used in a way that can't be replaced by a parameter,
+		 * in that case the query is executed in the usual way (see executePreparedCatalogQuery()) */
+		static bool parameterizeQuery(QString &sql, const std::map<QString, QString> &placeholders, QStringList &param_attrs);
+
 		/*! \brief Configures the objects name filtering.
 		 * The parameter only_matching creates extra filters for the other kind of objects not provided by the user in order to avoid listing them.
 		 * The tab_obj_types contains a list of table children object type names in which should be forcibly listed
@@ -252,6 +358,15 @@ class __libconnector Catalog {
 		//! \brief Fills the specified maps with all object's oids querying the catalog with the specified filter
 		void getObjectsOIDs(std::map<ObjectType, std::vector<unsigned> > &obj_oids, std::map<unsigned, std::vector<unsigned> > &col_oids, attribs_map extra_attribs=attribs_map());
 
+		/*! \brief Returns a cheap fingerprint (value) of each object in obj_oids (key) in a single query. The fingerprint is composed by the xmin
+		 * of the object's catalog row and the xmin of the rows of dependent catalogs (columns, comments, enum labels, etc), so it changes
+		 * whenever a DDL command touches the object. Objects that don't exist anymore are absent from the result. Roles, user mappings and
+		 * columns are not fingerprinted since their catalogs are not readable by all users (columns are part of their tables' fingerprints) */
+		std::map<unsigned, QString> getObjectsFingerprints(const std::map<ObjectType, std::vector<unsigned>> &obj_oids);
+
+		//! \brief Returns true when the objects of the provided type can be fingerprinted (see getObjectsFingerprints())
+		static bool isFingerprintable(ObjectType obj_type);
+
 		/*! \brief Returns a attributes map containing the oids (key) and names (values) of the objects from
 		the specified type.	A schema name can be specified in order to filter only objects of the specifed schema */
 		attribs_map getObjectsNames(ObjectType obj_type, const QString &sch_name="", const QString &tab_name="", attribs_map extra_attribs=attribs_map());
@@ -0,0 +1,531 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "catalogsymbolindex.h"
+#include "catalog.h"
+#include <algorithm>
+
+SymbolTrie::SymbolTrie()
+{
+	clear();
+}
+
+unsigned SymbolTrie::getChild(unsigned node, QChar chr) const
+{
+	for(auto &child : nodes[node].children)
+	{
+		if(nodes[child].label.at(0) == chr)
+			return child;
+	}
+
+	return 0;
+}
+
+void SymbolTrie::insert(const QString &key, unsigned sym_id)
+{
+	QString lc_key = key.toLower();
+	unsigned node = 0, child = 0, mid = 0;
+	qsizetype pos = 0, common = 0;
+
+	while(pos < lc_key.size())
+	{
+		child = getChild(node, lc_key.at(pos));
+
+		// There's no edge starting with the next char, so the remaining of the key becomes a new leaf
+		if(child == 0)
+		{
+			TrieNode leaf;
+			QChar first_chr = lc_key.at(pos);
+
+			leaf.label = lc_key.mid(pos);
+			leaf.symbols.push_back(sym_id);
+			nodes.push_back(leaf);
+
+			std::vector<unsigned> &children = nodes[node].children;
+			children.insert(std::upper_bound(children.begin(), children.end(), first_chr,
+																			 [this](QChar chr, unsigned id) {
+																				 return chr < nodes[id].label.at(0);
+																			 }), nodes.size() - 1);
+			return;
+		}
+
+		const QString &label = nodes[child].label;
+		common = 0;
+
+		while(common < label.size() && pos + common < lc_key.size() &&
+					label.at(common) == lc_key.at(pos + common))
+			common++;
+
+		/* The key diverges in the middle of the edge label, so we split the edge
+		 * creating an intermediate node holding the common part of the label */
+		if(common < label.size())
+		{
+			TrieNode split;
+
+			split.label = label.left(common);
+			split.children.push_back(child);
+			nodes[child].label.remove(0, common);
+			nodes.push_back(split);
+			mid = nodes.size() - 1;
+
+			std::replace(nodes[node].children.begin(), nodes[node].children.end(), child, mid);
+			child = mid;
+		}
+
+		node = child;
+		pos += common;
+	}
+
+	nodes[node].symbols.push_back(sym_id);
+}
+
+std::vector<unsigned> SymbolTrie::find(const QString &prefix, unsigned limit) const
+{
+	QString lc_prefix = prefix.toLower();
+	std::vector<unsigned> ids, pending;
+	unsigned node = 0, child = 0;
+	qsizetype pos = 0, len = 0;
+
+	while(pos < lc_prefix.size())
+	{
+		child = getChild(node, lc_prefix.at(pos));
+
+		if(child == 0)
+			return ids;
+
+		const QString &label = nodes[child].label;
+		len = std::min(label.size(), lc_prefix.size() - pos);
+
+		if(QStringView(label).left(len) != QStringView(lc_prefix).mid(pos, len))
+			return ids;
+
+		node = child;
+		pos += len;
+	}
+
+	// Collecting the symbols of the subtree in pre-order so they are returned in alphabetical order
+	pending.push_back(node);
+
+	while(!pending.empty())
+	{
+		node = pending.back();
+		pending.pop_back();
+
+		for(auto &id : nodes[node].symbols)
+		{
+			ids.push_back(id);
+
+			if(limit > 0 && ids.size() >= limit)
+				return ids;
+		}
+
+		pending.insert(pending.end(), nodes[node].children.rbegin(), nodes[node].children.rend());
+	}
+
+	return ids;
+}
+
+unsigned SymbolTrie::getNodeCount() const
+{
+	return nodes.size();
+}
+
+void SymbolTrie::clear()
+{
+	nodes.clear();
+	nodes.push_back(TrieNode());
+}
+
+const QString CatalogSymbolIndex::FingerprintSql {
+	"SELECT ns.nspname AS name, count(sym.hash) || ':' || coalesce(sum(sym.hash), 0) AS fingerprint \
+	 FROM pg_namespace AS ns \
+	 LEFT JOIN ( \
+		SELECT relnamespace AS nsp, hashtext('r' || oid || relname)::bigint AS hash FROM pg_class \
+		WHERE relkind IN ('r','p','v','m','f','S') \
+		UNION ALL \
+		SELECT tb.relnamespace, hashtext('c' || cl.attrelid || cl.attname || cl.attnum || cl.atttypid)::bigint \
+		FROM pg_attribute AS cl JOIN pg_class AS tb ON tb.oid = cl.attrelid \
+		WHERE tb.relkind IN ('r','p','v','m','f') AND cl.attnum > 0 AND NOT cl.attisdropped \
+		UNION ALL \
+		SELECT pronamespace, hashtext('p' || oid || proname)::bigint FROM pg_proc \
+		UNION ALL \
+		SELECT typnamespace, hashtext('t' || oid || typname)::bigint FROM pg_type \
+	 ) AS sym ON sym.nsp = ns.oid \
+	 WHERE ns.nspname NOT LIKE 'pg\\_toast%' AND ns.nspname NOT LIKE 'pg\\_temp\\_%' \
+	 GROUP BY ns.nspname"
+};
+
+const QString CatalogSymbolIndex::CatalogVersionSql {
+	"SELECT concat_ws(':', \
+		(SELECT max(oid) FROM pg_namespace), (SELECT max(oid) FROM pg_class), \
+		(SELECT max(oid) FROM pg_proc), (SELECT max(oid) FROM pg_type), \
+		(SELECT sum(pg_stat_get_tuples_inserted(rel) + pg_stat_get_tuples_updated(rel) + pg_stat_get_tuples_deleted(rel)) \
+		 FROM unnest(ARRAY['pg_namespace', 'pg_class', 'pg_attribute', 'pg_proc', 'pg_type']::regclass[]) AS rel)) AS version"
+};
+
+const QString CatalogSymbolIndex::ColumnsSql {
+	"SELECT ns.nspname AS schema_name, tb.relname AS table_name, cl.attname AS name \
+	 FROM pg_attribute AS cl \
+	 JOIN pg_class AS tb ON tb.oid = cl.attrelid \
+	 JOIN pg_namespace AS ns ON ns.oid = tb.relnamespace \
+	 WHERE tb.relkind IN ('r','p','v','m','f') AND cl.attnum > 0 AND NOT cl.attisdropped \
+	 AND ns.nspname = ANY($1) \
+	 ORDER BY ns.nspname, tb.relname, cl.attnum"
+};
+
+const std::vector<ObjectType> CatalogSymbolIndex::SchemaObjectTypes {
+	ObjectType::Table, ObjectType::ForeignTable, ObjectType::View,
+	ObjectType::Sequence, ObjectType::Function, ObjectType::Procedure,
+	ObjectType::Aggregate, ObjectType::Type, ObjectType::Domain
+};
+
+std::map<QString, std::weak_ptr<CatalogSymbolIndex>> CatalogSymbolIndex::indexes;
+
+QMutex CatalogSymbolIndex::indexes_mtx;
+
+void CatalogSymbolIndex::SymbolScope::addSymbol(const QString &name, ObjectType obj_type)
+{
+	QString key = name;
+
+	// Functions are searched by their names without the parameters list
+	if(obj_type == ObjectType::Function ||
+		 obj_type == ObjectType::Procedure ||
+		 obj_type == ObjectType::Aggregate)
+		key = name.left(name.indexOf('('));
+
+	symbols.push_back({ name, obj_type });
+	trie.insert(key, symbols.size() - 1);
+}
+
+CatalogSymbolIndex::CatalogSymbolIndex(Connection &conn)
+{
+	conn_params = conn.getConnectionParams();
+	loaded = canceled = refresh_pending = false;
+	check_fingerprints = true;
+	refresh_ctx.moveToThread(&refresh_thread);
+
+	connect(&refresh_thread, &QThread::started, &refresh_ctx, [this](){
+		refreshSymbols();
+		refresh_thread.quit();
+	});
+
+	connect(&refresh_thread, &QThread::finished, this, [this](){
+		emit s_indexUpdated();
+
+		if(refresh_pending && !canceled)
+			startRefresh();
+	});
+
+	refresh_timer.setInterval(RefreshInterval);
+	connect(&refresh_timer, &QTimer::timeout, this, &CatalogSymbolIndex::startRefresh);
+	refresh_timer.start();
+}
+
+CatalogSymbolIndex::~CatalogSymbolIndex()
+{
+	canceled = true;
+	refresh_timer.stop();
+	refresh_thread.quit();
+	refresh_thread.wait();
+
+	QMutexLocker locker(&indexes_mtx);
+
+	// Removing from the registry the indexes not used anymore
+	for(auto itr = indexes.begin(); itr != indexes.end();)
+	{
+		if(itr->second.expired())
+			itr = indexes.erase(itr);
+		else
+			itr++;
+	}
+}
+
+QString CatalogSymbolIndex::getIndexId(Connection &conn)
+{
+	QString user = conn.getConnectionParam(Connection::ParamUser);
+
+	if(!conn.getConnectionParam(Connection::ParamSetRole).isEmpty())
+		user = conn.getConnectionParam(Connection::ParamSetRole);
+
+	return QString("%1:%2").arg(user, conn.getConnectionId(true, true));
+}
+
+std::shared_ptr<CatalogSymbolIndex> CatalogSymbolIndex::getSharedIndex(Connection conn)
+{
+	if(!conn.isConfigured())
+		return nullptr;
+
+	QMutexLocker locker(&indexes_mtx);
+	QString id = getIndexId(conn);
+	std::shared_ptr<CatalogSymbolIndex> index = indexes[id].lock();
+
+	if(!index)
+	{
+		index.reset(new CatalogSymbolIndex(conn));
+		indexes[id] = index;
+		index->refresh();
+	}
+
+	return index;
+}
+
+bool CatalogSymbolIndex::isIndexedType(ObjectType obj_type)
+{
+	return obj_type == ObjectType::Schema || obj_type == ObjectType::Column ||
+				 std::find(SchemaObjectTypes.begin(), SchemaObjectTypes.end(), obj_type) != SchemaObjectTypes.end();
+}
+
+bool CatalogSymbolIndex::isLoaded()
+{
+	return loaded;
+}
+
+bool CatalogSymbolIndex::isRefreshing()
+{
+	return refresh_thread.isRunning();
+}
+
+void CatalogSymbolIndex::refresh()
+{
+	check_fingerprints = true;
+	startRefresh();
+}
+
+void CatalogSymbolIndex::startRefresh()
+{
+	if(refresh_thread.isRunning())
+	{
+		refresh_pending = true;
+		return;
+	}
+
+	refresh_pending = false;
+	refresh_thread.start();
+}
+
+void CatalogSymbolIndex::refreshSymbols()
+{
+	try
+	{
+		Connection conn(conn_params);
+		ResultSet res;
+		std::map<QString, QString> fingerprints;
+		std::map<QString, std::shared_ptr<SchemaSymbols>> schemas_syms;
+		std::shared_ptr<SymbolScope> sch_scope = std::make_shared<SymbolScope>();
+		QStringList changed_schs;
+		QString version;
+		bool check_fps = check_fingerprints.exchange(false);
+
+		conn.connect();
+		conn.executeDMLCommand(CatalogVersionSql, res);
+
+		if(res.accessTuple(ResultSet::FirstTuple))
+			version = res.getColumnValue("version");
+
+		/* The fingerprints scan the whole catalogs so the periodic refreshes compute them only when the
+		 * version of the catalogs changed. The refreshes requested explicitly always compute them since the
+		 * statistics used in the version may take a while to reflect the changes made by other sessions */
+		if(!check_fps && loaded && version == catalog_version)
+		{
+			conn.close();
+			return;
+		}
+
+		catalog_version = version;
+		conn.executeDMLCommand(FingerprintSql, res);
+
+		if(res.accessTuple(ResultSet::FirstTuple))
+		{
+			do
+			{
+				fingerprints[res.getColumnValue(Attributes::Name)] = res.getColumnValue("fingerprint");
+			}
+			while(res.accessTuple(ResultSet::NextTuple));
+		}
+
+		symbols_mtx.lock();
+
+		for(auto &[sch_name, fingerprint] : fingerprints)
+		{
+			auto itr = schemas.find(sch_name);
+
+			if(itr == schemas.end() || itr->second->fingerprint != fingerprint)
+				changed_schs.append(sch_name);
+		}
+
+		symbols_mtx.unlock();
+
+		/* In the first load all the symbols are retrieved at once, in the subsequent
+		 * refreshes only the symbols of the changed schemas are retrieved again */
+		if(!changed_schs.isEmpty() && !canceled)
+			retrieveSymbols(conn, changed_schs, !loaded, schemas_syms);
+
+		conn.close();
+
+		if(canceled)
+			return;
+
+		for(auto &[sch_name, fingerprint] : fingerprints)
+		{
+			sch_scope->addSymbol(sch_name, ObjectType::Schema);
+
+			if(schemas_syms.count(sch_name))
+				schemas_syms[sch_name]->fingerprint = fingerprint;
+		}
+
+		QMutexLocker locker(&symbols_mtx);
+
+		for(auto itr = schemas.begin(); itr != schemas.end();)
+		{
+			if(!fingerprints.count(itr->first))
+				itr = schemas.erase(itr);
+			else
+				itr++;
+		}
+
+		for(auto &[sch_name, sch_syms] : schemas_syms)
+			schemas[sch_name] = sch_syms;
+
+		schema_names = sch_scope;
+		loaded = true;
+	}
+	catch(Exception &)
+	{
+		/* Errors are not reported here since the index is just a cache: the current symbols are kept
+		 * and the code completion queries the catalog directly until the index gets loaded */
+	}
+}
+
+void CatalogSymbolIndex::retrieveSymbols(Connection &conn, const QStringList &sch_names, bool all_schemas,
+																				 std::map<QString, std::shared_ptr<SchemaSymbols>> &schemas_syms)
+{
+	Catalog catalog;
+	ResultSet res;
+	std::vector<attribs_map> objects, sch_objects;
+	QStringList array_elems;
+	QString elem;
+
+	for(auto &sch_name : sch_names)
+		schemas_syms[sch_name] = std::make_shared<SchemaSymbols>();
+
+	catalog.setConnection(conn);
+	catalog.setQueryFilter(static_cast<Catalog::QueryFilter>(Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes));
+
+	if(all_schemas)
+		objects = catalog.getObjectsNames(SchemaObjectTypes);
+	else
+	{
+		for(auto &sch_name : sch_names)
+		{
+			sch_objects = catalog.getObjectsNames(SchemaObjectTypes, sch_name);
+			objects.insert(objects.end(), sch_objects.begin(), sch_objects.end());
+		}
+	}
+
+	catalog.closeConnection();
+
+	for(auto &attribs : objects)
+	{
+		auto itr = schemas_syms.find(attribs[Attributes::Parent]);
+
+		if(itr != schemas_syms.end())
+			itr->second->objects.addSymbol(attribs[Attributes::Name],
+																		 static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt()));
+	}
+
+	objects.clear();
+
+	if(canceled)
+		return;
+
+	// The schemas names are sent as an array parameter so they don't need to be escaped as SQL literals
+	for(auto &sch_name : sch_names)
+	{
+		elem = sch_name;
+		elem.replace("\\", "\\\\");
+		elem.replace("\"", "\\\"");
+		array_elems.append(QString("\"%1\"").arg(elem));
+	}
+
+	conn.prepareStatement("pgm_symbol_index_columns", ColumnsSql);
+	conn.executePreparedStatement("pgm_symbol_index_columns", { QString("{%1}").arg(array_elems.join(',')) }, res);
+
+	if(res.accessTuple(ResultSet::FirstTuple))
+	{
+		do
+		{
+			schemas_syms[res.getColumnValue("schema_name")]->columns[res.getColumnValue("table_name")]
+					.addSymbol(res.getColumnValue(Attributes::Name), ObjectType::Column);
+		}
+		while(res.accessTuple(ResultSet::NextTuple));
+	}
+}
+
+attribs_map CatalogSymbolIndex::findSymbols(ObjectType obj_type, const QString &sch_name, const QString &tab_name, const QString &prefix, unsigned limit)
+{
+	std::shared_ptr<const SymbolScope> sch_scope;
+	std::shared_ptr<const SchemaSymbols> sch_syms;
+	const SymbolScope *scope = nullptr;
+	attribs_map names;
+	unsigned pos = 0;
+
+	if(!isIndexedType(obj_type))
+		return names;
+
+	/* The mutex is held only to copy the pointers to the symbols, the refresh replaces the symbols
+	 * of changed schemas instead of modifying them, so the search itself is done without locking */
+	symbols_mtx.lock();
+
+	if(obj_type == ObjectType::Schema)
+		sch_scope = schema_names;
+	else if(schemas.count(sch_name))
+		sch_syms = schemas.at(sch_name);
+
+	symbols_mtx.unlock();
+
+	if(obj_type == ObjectType::Schema)
+		scope = sch_scope.get();
+	else if(sch_syms && obj_type == ObjectType::Column)
+	{
+		auto itr = sch_syms->columns.find(tab_name);
+
+		if(itr != sch_syms->columns.end())
+			scope = &itr->second;
+	}
+	else if(sch_syms)
+		scope = &sch_syms->objects;
+
+	if(!scope)
+		return names;
+
+	for(auto &id : scope->trie.find(prefix))
+	{
+		if(scope->symbols[id].second != obj_type)
+			continue;
+
+		names[QString::number(pos++).rightJustified(8, '0')] = scope->symbols[id].first;
+
+		if(limit > 0 && pos >= limit)
+			break;
+	}
+
+	return names;
+}
@@ -0,0 +1,218 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libconnector
+\class CatalogSymbolIndex
+\brief Implements an in-memory index of the names of schemas, relations, columns, functions and types of a database.
+The index is filled in background by bulk catalog queries and shared by all code completion widgets using the same connection,
+this way, the completion can be done without querying the server at each keystroke. The index is periodically refreshed
+but only when the catalogs changed and, in that case, only the schemas which contents changed since the last refresh are retrieved again.
+*/
+
+#ifndef CATALOG_SYMBOL_INDEX_H
+#define CATALOG_SYMBOL_INDEX_H
+
+#include "connectorglobal.h"
+#include "connection.h"
+#include "baseobject.h"
+#include <QThread>
+#include <QTimer>
+#include <QMutex>
+#include <atomic>
+#include <memory>
+#include <map>
+
+/*! \brief Implements a compact prefix tree (radix tree) that maps lower case keys to symbol ids.
+ * Prefix searches return the ids in the alphabetical order of the keys */
+class __libconnector SymbolTrie {
+	private:
+		struct TrieNode {
+			//! \brief Part of the key stored in the edge that reaches this node
+			QString label;
+
+			//! \brief Child nodes sorted by the first char of their labels
+			std::vector<unsigned> children;
+
+			//! \brief Ids of the symbols which key ends in this node
+			std::vector<unsigned> symbols;
+		};
+
+		//! \brief Stores the nodes of the tree, the first one being the root
+		std::vector<TrieNode> nodes;
+
+		//! \brief Returns the child of the node which label starts with the provided char or 0 when there's no such child
+		unsigned getChild(unsigned node, QChar chr) const;
+
+	public:
+		SymbolTrie();
+
+		//! \brief Associates the symbol id to the provided key (which is stored in lower case)
+		void insert(const QString &key, unsigned sym_id);
+
+		/*! \brief Returns the ids of the symbols which keys start with the provided prefix (case insensitive).
+		 * The limit parameter, when greater than zero, restricts the amount of returned ids */
+		std::vector<unsigned> find(const QString &prefix, unsigned limit = 0) const;
+
+		//! \brief Returns the amount of nodes in the tree (root included)
+		unsigned getNodeCount() const;
+
+		void clear();
+};
+
+class __libconnector CatalogSymbolIndex: public QObject {
+	Q_OBJECT
+
+	private:
+		//! \brief Stores the symbols of a certain scope (the schemas list, the objects of a schema or the columns of a table)
+		struct SymbolScope {
+			//! \brief The symbols names and types in the order they were inserted
+			std::vector<std::pair<QString, ObjectType>> symbols;
+
+			//! \brief The prefix tree used to search the symbols by name
+			SymbolTrie trie;
+
+			void addSymbol(const QString &name, ObjectType obj_type);
+		};
+
+		//! \brief Stores all the symbols of a schema
+		struct SchemaSymbols {
+			//! \brief Value computed by the server that changes every time a symbol is created, renamed or dropped in the schema
+			QString fingerprint;
+
+			//! \brief Relations, functions and types of the schema
+			SymbolScope objects;
+
+			//! \brief Columns of the tables, views and foreign tables of the schema indexed by the table name
+			std::map<QString, SymbolScope> columns;
+		};
+
+		//! \brief Query that computes the fingerprint of all the schemas in the database
+		static const QString FingerprintSql,
+
+		/*! \brief Query that computes a cheap version of the catalogs holding the indexed symbols. It's made of the
+		 * greatest oids (retrieved through the catalogs' oid indexes) and the amount of rows changed in each catalog
+		 * according to the cumulative statistics, so no catalog is scanned in order to tell if any symbol may have changed */
+		CatalogVersionSql,
+
+		//! \brief Query that retrieves the columns names of all relations in a set of schemas
+		ColumnsSql;
+
+		//! \brief Types of the schema children which names are stored in the index
+		static const std::vector<ObjectType> SchemaObjectTypes;
+
+		//! \brief Interval (in ms) between automatic refreshes of the index
+		static constexpr int RefreshInterval = 60000;
+
+		//! \brief Indexes that are currently in use indexed by the connection id (see getIndexId())
+		static std::map<QString, std::weak_ptr<CatalogSymbolIndex>> indexes;
+
+		//! \brief Guards the indexes registry
+		static QMutex indexes_mtx;
+
+		//! \brief Parameters of the connection used to retrieve the symbols
+		attribs_map conn_params;
+
+		//! \brief The symbols of each schema indexed by schema name
+		std::map<QString, std::shared_ptr<const SchemaSymbols>> schemas;
+
+		//! \brief The names of all indexed schemas
+		std::shared_ptr<const SymbolScope> schema_names;
+
+		//! \brief Guards the indexed symbols while they are replaced by a refresh
+		QMutex symbols_mtx;
+
+		//! \brief Thread in which the symbols are retrieved
+		QThread refresh_thread;
+
+		//! \brief Context object of the refresh thread's slots
+		QObject refresh_ctx;
+
+		//! \brief Triggers the periodic refresh of the index
+		QTimer refresh_timer;
+
+		//! \brief The catalogs version (see CatalogVersionSql) retrieved in the last refresh (accessed only by the refresh thread)
+		QString catalog_version;
+
+		//! \brief Indicates that the index was completely loaded at least once
+		std::atomic<bool> loaded,
+
+		//! \brief Indicates that the running refresh must be aborted
+		canceled,
+
+		//! \brief Indicates that a new refresh was requested while another one was running
+		refresh_pending,
+
+		//! \brief Indicates that the next refresh must compare the schemas fingerprints even if the catalogs version didn't change
+		check_fingerprints;
+
+		CatalogSymbolIndex(Connection &conn);
+
+		//! \brief Returns the id of the index that should be used by the provided connection
+		static QString getIndexId(Connection &conn);
+
+		/*! \brief Retrieves the symbols of the schemas that changed since the last refresh. This method runs in the refresh thread.
+		 * The schemas fingerprints are compared only when the catalogs version changed or when the refresh was requested explicitly */
+		void refreshSymbols();
+
+		//! \brief Retrieves the symbols of the provided schemas and stores them in the map schemas_syms
+		void retrieveSymbols(Connection &conn, const QStringList &sch_names, bool all_schemas,
+												 std::map<QString, std::shared_ptr<SchemaSymbols>> &schemas_syms);
+
+	public:
+		~CatalogSymbolIndex() override;
+
+		/*! \brief Returns the index shared by all the callers using the same server, database and user of
+		 * the provided connection. The index is created and its first load is started if needed */
+		static std::shared_ptr<CatalogSymbolIndex> getSharedIndex(Connection conn);
+
+		//! \brief Returns true when the provided object type has its names stored in the index
+		static bool isIndexedType(ObjectType obj_type);
+
+		//! \brief Returns true when the index was completely loaded at least once
+		bool isLoaded();
+
+		//! \brief Returns true when a refresh of the index is running
+		bool isRefreshing();
+
+		/*! \brief Returns the names of the objects of the provided type which start with the prefix (case insensitive).
+		 * Schema children are searched in the schema sch_name and columns in the table tab_name of that schema.
+		 * The returned map uses the same format of Catalog::getObjectsNames() but its keys are the positions of the
+		 * names in alphabetical order instead of oids. No catalog query is executed by this method.
+		 * Like the name filter of the catalog queries (which uses the operator ~*) the prefix is case insensitive */
+		attribs_map findSymbols(ObjectType obj_type, const QString &sch_name, const QString &tab_name, const QString &prefix, unsigned limit = 0);
+
+	private slots:
+		/*! \brief Starts the background refresh of the index. If a refresh is already running
+		 * another one is started right after it finishes */
+		void startRefresh();
+
+	public slots:
+		/*! \brief Requests a refresh of the index that compares the fingerprints of all schemas. This is intended
+		 * to be called when the caller knows the database objects were changed (e.g. after running DDL commands) */
+		void refresh();
+
+	signals:
+		//! \brief This signal is emitted when a refresh finishes and the index contents may have changed
+		void s_indexUpdated();
+};
+
+#endif
@@ -22,10 +22,12 @@
 #include "connection.h"
 #include <QTextStream>
 #include "globalattributes.h"
+#include "tracer.h"
 #include "pgsqlversions.h"
 #include "exception.h"
 
 QStringList Connection::notices;
+QMutex Connection::notices_mtx;
 
 bool Connection::notice_enabled {false};
 bool Connection::print_sql {false};
@@ -64,6 +66,8 @@ Connection::Connection()
 {
 	connection=nullptr;
 	auto_browse_db=false;	
+	copy_in_progress=false;
+	replaying=false;
 	cmd_exec_timeout=0;
 
 	for(unsigned idx=OpValidation; idx <= OpDiff; idx++)
@@ -170,9 +174,16 @@ void Connection::generateConnectionString()
 
 void Connection::noticeProcessor(void *, const char *message)
 {
+	QMutexLocker locker(&notices_mtx);
 	notices.push_back(QString(message));
 }
 
+void Connection::clearNotices()
+{
+	QMutexLocker locker(&notices_mtx);
+	notices.clear();
+}
+
 void Connection::validateConnectionStatus()
 {
 	if(cmd_exec_timeout > 0)
@@ -187,7 +198,7 @@ void Connection::validateConnectionStatus()
 		}
 	}
 
-	if(PQstatus(connection)==CONNECTION_BAD)
+	if(!replaying && PQstatus(connection)==CONNECTION_BAD)
 		throw Exception(Exception::getErrorMessage(ErrorCode::ConnectionBroken)
 										.arg(connection_params[ParamServerFqdn].isEmpty() ? connection_params[ParamServerIp] : connection_params[ParamServerFqdn])
 										.arg(connection_params[ParamPort]),
@@ -242,7 +253,7 @@ void Connection::connect()
 	if(connection_str.isEmpty())
 		throw Exception(ErrorCode::ConnectionNotConfigured, PGM_FUNC, PGM_FILE, PGM_LINE);
 
-	if(connection)
+	if(isStablished())
 	{
 		if(!silence_conn_err)
 			throw Exception(ErrorCode::ConnectionAlreadyStablished, PGM_FUNC, PGM_FILE, PGM_LINE);
@@ -254,28 +265,41 @@ void Connection::connect()
 		this->close();
 	}
 
-	//Try to connect to the database
-	connection = PQconnectdb(connection_str.toStdString().c_str());
+	prepared_stmts.clear();
+	copy_in_progress = false;
 	last_cmd_execution = QDateTime::currentDateTime();
 
-	/* If the connection descriptor has not been allocated or if the connection state
-		is CONNECTION_BAD it indicates that the connection was not successful */
-	if(connection==nullptr || PQstatus(connection)==CONNECTION_BAD)
+	/* While a recording is being replayed no server is contacted, the connection
+	 * is only flagged as established and the commands are answered by the recorder */
+	if(ConnectionRecorder::isReplaying())
+		replaying = true;
+	else
 	{
-		//Raise the error generated by the DBMS
-		throw Exception(Exception::getErrorMessage(ErrorCode::ConnectionNotStablished)
-						.arg(PQerrorMessage(connection)), ErrorCode::ConnectionNotStablished,
-						PGM_FUNC, PGM_FILE, PGM_LINE);
-	}
+		//Try to connect to the database
+		connection = PQconnectdb(connection_str.toStdString().c_str());
 
-	notices.clear();
+		/* If the connection descriptor has not been allocated or if the connection state
+			is CONNECTION_BAD it indicates that the connection was not successful */
+		if(connection==nullptr || PQstatus(connection)==CONNECTION_BAD)
+		{
+			//Raise the error generated by the DBMS
+			throw Exception(Exception::getErrorMessage(ErrorCode::ConnectionNotStablished)
+							.arg(PQerrorMessage(connection)), ErrorCode::ConnectionNotStablished,
+							PGM_FUNC, PGM_FILE, PGM_LINE);
+		}
 
-	if(!notice_enabled)
-		//Completely disable notice/warnings in the connection
-		PQsetNoticeReceiver(connection, disableNoticeOutput, nullptr);
-	else
-		//Enable the notice/warnings in the connection by pushing them into the list of generated notices
-		PQsetNoticeProcessor(connection, noticeProcessor, nullptr);
+		clearNotices();
+
+		if(!notice_enabled)
+			//Completely disable notice/warnings in the connection
+			PQsetNoticeReceiver(connection, disableNoticeOutput, nullptr);
+		else
+			//Enable the notice/warnings in the connection by pushing them into the list of generated notices
+			PQsetNoticeProcessor(connection, noticeProcessor, nullptr);
+
+		if(ConnectionRecorder::isRecording())
+			ConnectionRecorder::recordServerVersion(PQserverVersion(connection));
+	}
 
 	// Aborts the connection if an unsupported version of PostgreSQL is detected
 	if(!ignore_db_version && !isServerSupported())
@@ -295,25 +319,32 @@ void Connection::connect()
 
 void Connection::close()
 {
-	if(connection)
+	if(isStablished())
 	{
 		//Finalizes the connection if the status is OK
-		if(PQstatus(connection) == CONNECTION_OK)
+		if(connection && PQstatus(connection) == CONNECTION_OK)
 			PQfinish(connection);
 
 		connection=nullptr;
+		replaying=false;
 		last_cmd_execution=QDateTime();
+		prepared_stmts.clear();
+		copy_in_progress=false;
 	}
 }
 
 void Connection::reset()
 {
 	//Raise an erro in case the user try to reset a not opened connection
-	if(!connection)
+	if(!isStablished())
 		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
 
 	//Reinicia a conexão
-	PQreset(connection);
+	if(connection)
+		PQreset(connection);
+
+	prepared_stmts.clear();
+	copy_in_progress=false;
 }
 
 QString Connection::getConnectionParam(const QString &param)
@@ -330,12 +361,13 @@ attribs_map Connection::getServerInfo()
 {
 	attribs_map info;
 
-	if(!connection)
+	if(!isStablished())
 		throw Exception(ErrorCode::OprNotAllocatedConnection,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-	info[ServerPid]=QString::number(PQbackendPID(connection));
+	// Replayed connections have no backend process, so a fake pid and the current protocol version are returned
+	info[ServerPid]=QString::number(connection ? PQbackendPID(connection) : 0);
 	info[ServerVersion]=getPgSQLVersion();
-	info[ServerProtocol]=QString::number(PQprotocolVersion(connection));
+	info[ServerProtocol]=QString::number(connection ? PQprotocolVersion(connection) : 3);
 
 	return info;
 }
@@ -380,7 +412,7 @@ QString Connection::getConnectionId(bool host_port_only, bool incl_db_name, bool
 
 bool Connection::isStablished()
 {
-	return (connection != nullptr);
+	return (connection != nullptr || replaying);
 }
 
 bool Connection::isConfigured()
@@ -397,10 +429,10 @@ QString Connection::getPgSQLVersion(bool major_only)
 {
 	QString raw_ver, fmt_ver;
 
-	if(!connection)
+	if(!isStablished())
 		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
 
-	raw_ver=QString("%1").arg(PQserverVersion(connection));
+	raw_ver=QString("%1").arg(getServerVersion());
 
 	//If the version is 10+
 	if(raw_ver.contains(QRegularExpression("^((1)[0-9])(.)+")))
@@ -429,29 +461,39 @@ QString Connection::getPgSQLVersion(bool major_only)
 
 QStringList Connection::getNotices()
 {
+	QMutexLocker locker(&notices_mtx);
 	return notices;
 }
 
 void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 {
+	PGM_TRACE_SCOPE("connection", "Connection::executeDMLCommand");
     PGresult *sql_res = nullptr;
 
 	//Raise an error in case the user try to close a not opened connection
-	if(!connection)
+	if(!isStablished())
 		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
 
 	validateConnectionStatus();
-	notices.clear();
+	clearNotices();
 
 	//Alocates a new result to receive the resultset returned by the sql command
-    sql_res = PQexec(connection, sql.toStdString().c_str());
+	if(replaying)
+		sql_res = replayCommand(sql);
+	else
+	{
+		sql_res = PQexec(connection, sql.toStdString().c_str());
+
+		if(ConnectionRecorder::isRecording())
+			ConnectionRecorder::recordResult(connection_params[ParamDbName], sql, sql_res, PQerrorMessage(connection));
+	}
 
 	//Prints the SQL to stdout when the flag is active
 	if(print_sql)
         qDebug().noquote() << "\n---\n" << sql;
 
 	//Raise an error in case the command sql execution is not sucessful
-	if(strlen(PQerrorMessage(connection))>0)
+	if(!replaying && strlen(PQerrorMessage(connection))>0)
 	{
 		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
 						.arg(PQerrorMessage(connection)),
@@ -465,15 +507,25 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 
 void Connection::executeDDLCommand(const QString &sql)
 {
+	PGM_TRACE_SCOPE("connection", "Connection::executeDDLCommand");
 	PGresult *sql_res=nullptr;
 
 	//Raise an error in case the user try to close a not opened connection
-	if(!connection)
+	if(!isStablished())
 		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
 
 	validateConnectionStatus();
-	notices.clear();
-	sql_res=PQexec(connection, sql.toStdString().c_str());
+	clearNotices();
+
+	if(replaying)
+		sql_res=replayCommand(sql);
+	else
+	{
+		sql_res=PQexec(connection, sql.toStdString().c_str());
+
+		if(ConnectionRecorder::isRecording())
+			ConnectionRecorder::recordResult(connection_params[ParamDbName], sql, sql_res, PQerrorMessage(connection));
+	}
 
 	//Prints the SQL to stdout when the flag is active
 	if(print_sql)
@@ -482,7 +534,170 @@ void Connection::executeDDLCommand(const QString &sql)
 	}
 
 	//Raise an error in case the command sql execution is not sucessful
-	if(strlen(PQerrorMessage(connection)) > 0)
+	if(!replaying && strlen(PQerrorMessage(connection)) > 0)
+	{
+		QString field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr,	field);
+	}
+
+	PQclear(sql_res);
+}
+
+void Connection::prepareStatement(const QString &stmt_name, const QString &sql)
+{
+	PGresult *sql_res=nullptr;
+
+	//Raise an error in case the user try to use a not opened connection
+	if(!isStablished())
+		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	validateConnectionStatus();
+	clearNotices();
+
+	/* The statements are recorded by their SQL (and not by their names) since the same
+	 * statement may be prepared with different names by different connections */
+	if(replaying)
+		sql_res = replayCommand("PREPARE " + sql);
+	else
+	{
+		sql_res = PQprepare(connection, stmt_name.toStdString().c_str(), sql.toStdString().c_str(), 0, nullptr);
+
+		if(ConnectionRecorder::isRecording())
+			ConnectionRecorder::recordResult(connection_params[ParamDbName], "PREPARE " + sql, sql_res, PQerrorMessage(connection));
+	}
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+		qDebug().noquote() << "\n--- PREPARE" << stmt_name << "\n" << sql;
+
+	//Raise an error in case the statement could not be prepared
+	if(!replaying && strlen(PQerrorMessage(connection)) > 0)
+	{
+		QString field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr,	field);
+	}
+
+	PQclear(sql_res);
+	prepared_stmts[stmt_name] = sql;
+}
+
+bool Connection::isStatementPrepared(const QString &stmt_name)
+{
+	return isStablished() && prepared_stmts.count(stmt_name);
+}
+
+void Connection::executePreparedStatement(const QString &stmt_name, const QStringList &params, ResultSet &result)
+{
+	PGresult *sql_res = nullptr;
+	std::vector<QByteArray> values;
+	std::vector<const char *> values_ptrs;
+	QString rec_command;
+
+	//Raise an error in case the user try to use a not opened connection
+	if(!isStablished())
+		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	validateConnectionStatus();
+	clearNotices();
+
+	// The executions are recorded by the statement's SQL and the values of the parameters
+	if(replaying || ConnectionRecorder::isRecording())
+	{
+		rec_command = QString("EXECUTE %1 (%2)").arg(prepared_stmts.count(stmt_name) ? prepared_stmts[stmt_name] : stmt_name,
+																								 params.join(QChar(0x1f)));
+	}
+
+	if(replaying)
+	{
+		sql_res = replayCommand(rec_command);
+
+		if(print_sql)
+			qDebug().noquote() << "\n--- EXECUTE" << stmt_name << "(" << params.join(", ") << ")";
+
+		result.initResultSet(sql_res);
+		return;
+	}
+
+	// The byte arrays must outlive the execution since libpq only receives pointers to their data
+	values.reserve(params.size());
+	values_ptrs.reserve(params.size());
+
+	for(auto &param : params)
+	{
+		values.push_back(param.toUtf8());
+		values_ptrs.push_back(values.back().constData());
+	}
+
+	sql_res = PQexecPrepared(connection, stmt_name.toStdString().c_str(), values_ptrs.size(),
+													 values_ptrs.data(), nullptr, nullptr, 0);
+
+	if(ConnectionRecorder::isRecording())
+		ConnectionRecorder::recordResult(connection_params[ParamDbName], rec_command, sql_res, PQerrorMessage(connection));
+
+	//Prints the statement and its parameters to stdout when the flag is active
+	if(print_sql)
+		qDebug().noquote() << "\n--- EXECUTE" << stmt_name << "(" << params.join(", ") << ")";
+
+	//Raise an error in case the command sql execution is not sucessful
+	if(strlen(PQerrorMessage(connection))>0)
+	{
+		QString field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, field);
+	}
+
+	// Initializes the result set with the PG result instance.
+	result.initResultSet(sql_res);
+}
+
+void Connection::startCopy(const QString &copy_cmd)
+{
+	PGresult *sql_res = nullptr;
+
+	//Raise an error in case the user try to use a not opened connection
+	if(!isStablished())
+		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	validateConnectionStatus();
+	clearNotices();
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+		qDebug().noquote() << "\n---\n" << copy_cmd;
+
+	/* Only the outcome of the COPY command is recorded, the copied data isn't, so
+	 * while replaying the rows are discarded and the copy always reports zero rows */
+	if(replaying)
+	{
+		PQclear(replayCommand(copy_cmd));
+		copy_in_progress = true;
+		return;
+	}
+
+	sql_res = PQexec(connection, copy_cmd.toStdString().c_str());
+
+	if(ConnectionRecorder::isRecording())
+	{
+		ConnectionRecorder::recordResult(connection_params[ParamDbName], copy_cmd, sql_res,
+																		 PQresultStatus(sql_res) != PGRES_COPY_IN ? PQerrorMessage(connection) : "");
+	}
+
+	//Raise an error in case the server didn't switch to the COPY IN state
+	if(PQresultStatus(sql_res) != PGRES_COPY_IN)
 	{
 		QString field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
 
@@ -494,6 +709,83 @@ void Connection::executeDDLCommand(const QString &sql)
 	}
 
 	PQclear(sql_res);
+	copy_in_progress = true;
+}
+
+void Connection::putCopyData(const QByteArray &data)
+{
+	if(!isStablished())
+		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	if(!copy_in_progress || data.isEmpty() || replaying)
+		return;
+
+	// In blocking mode PQputCopyData only fails (-1) when the connection is broken
+	if(PQputCopyData(connection, data.constData(), data.size()) != 1)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	last_cmd_execution = QDateTime::currentDateTime();
+}
+
+unsigned Connection::endCopy(const QString &abort_msg)
+{
+	PGresult *sql_res = nullptr;
+	QString errmsg, field;
+	unsigned row_cnt = 0;
+
+	if(!isStablished())
+		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	if(!copy_in_progress)
+		return 0;
+
+	copy_in_progress = false;
+
+	if(replaying)
+		return 0;
+
+	if(PQputCopyEnd(connection, abort_msg.isEmpty() ? nullptr : abort_msg.toStdString().c_str()) != 1)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted)
+						.arg(PQerrorMessage(connection)),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	/* The final status of the COPY is only known after consuming all the pending results,
+	 * which must be done even in case of errors so the connection can be used again */
+	while((sql_res = PQgetResult(connection)))
+	{
+		if(PQresultStatus(sql_res) != PGRES_COMMAND_OK && errmsg.isEmpty())
+		{
+			errmsg = PQresultErrorMessage(sql_res);
+			field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+		}
+		else if(PQresultStatus(sql_res) == PGRES_COMMAND_OK)
+			row_cnt = QString(PQcmdTuples(sql_res)).toUInt();
+
+		PQclear(sql_res);
+	}
+
+	last_cmd_execution = QDateTime::currentDateTime();
+
+	/* Aborted copies are always reported by the server as failed, in that case
+	 * the error is only raised when the caller didn't request the abort */
+	if(!errmsg.isEmpty() && abort_msg.isEmpty())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(errmsg),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr,	field);
+	}
+
+	return row_cnt;
+}
+
+bool Connection::isCopyInProgress()
+{
+	return isStablished() && copy_in_progress;
 }
 
 void Connection::setDefaultForOperation(ConnOperation op_id, bool value)
@@ -551,6 +843,9 @@ void Connection::operator = (const Connection &conn)
 	this->connection_params=conn.connection_params;
 	this->connection_str=conn.connection_str;
 	this->connection=nullptr;
+	this->prepared_stmts.clear();
+	this->copy_in_progress=false;
+	this->replaying=false;
 
 	for(unsigned idx=OpValidation; idx <= OpDiff; idx++)
 		default_for_oper[idx]=conn.default_for_oper[idx];
@@ -558,9 +853,13 @@ void Connection::operator = (const Connection &conn)
 
 void Connection::requestCancel()
 {
-	if(!connection)
+	if(!isStablished())
 		throw Exception(ErrorCode::OprNotAllocatedConnection, PGM_FUNC, PGM_FILE, PGM_LINE);
 
+	// Replayed commands are answered immediately so there's nothing to be cancelled
+	if(replaying)
+		return;
+
 	PGcancel *cancel = PQgetCancel(connection);
 
 	if(cancel)
@@ -583,3 +882,23 @@ bool Connection::isServerSupported()
 		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
 	}
 }
+
+int Connection::getServerVersion()
+{
+	return replaying ? ConnectionRecorder::getServerVersion() : PQserverVersion(connection);
+}
+
+PGresult *Connection::replayCommand(const QString &command)
+{
+	QString errmsg, sql_state;
+	PGresult *sql_res = ConnectionRecorder::replayResult(connection_params[ParamDbName], command, errmsg, sql_state);
+
+	if(!errmsg.isEmpty())
+	{
+		PQclear(sql_res);
+		throw Exception(Exception::getErrorMessage(ErrorCode::SQLCommandNotExecuted).arg(errmsg),
+						ErrorCode::SQLCommandNotExecuted, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, sql_state);
+	}
+
+	return sql_res;
+}
@@ -30,9 +30,12 @@
 #define CONNECTION_H
 
 #include "resultset.h"
+#include "connectionrecorder.h"
 #include "attribsmap.h"
 #include <QRegularExpression>
 #include <QDateTime>
+#include <QMutex>
+#include <map>
 
 class __libconnector Connection {
 	private:
@@ -59,6 +62,13 @@ class __libconnector Connection {
 		The list is filled only if notice_enabled is true */
 		static QStringList notices;
 
+		/*! \brief Guards the notices list since connections may run commands
+		 * in different threads at the same time (e.g. concurrent database imports) */
+		static QMutex notices_mtx;
+
+		//! \brief Clears the list of notices in a thread-safe way
+		static void clearNotices();
+
 		//! \brief Generates the connection string based on the parameter map
 		void generateConnectionString();
 
@@ -95,6 +105,24 @@ class __libconnector Connection {
 		is used if none is explicitly specified by the user in the UI */
 		default_for_oper[4];
 
+		/*! \brief Names and SQL of the statements prepared in the current session (see prepareStatement()).
+		 *  The SQL is used to identify the executions of the statements in connection recordings */
+		std::map<QString, QString> prepared_stmts;
+
+		//! \brief Indicates that a COPY ... FROM STDIN is in progress (see startCopy())
+		bool copy_in_progress,
+
+		/*! \brief Indicates that the connection was opened while a recording was being replayed (see ConnectionRecorder).
+		 *  In that case there's no real connection to a server and all commands are answered by the recorder */
+		replaying;
+
+		//! \brief Returns the server version in the same format of PQserverVersion()
+		int getServerVersion();
+
+		/*! \brief Returns the result recorded for the command in the recording being replayed.
+		 *  In case the recorded command failed the same error is raised */
+		PGresult *replayCommand(const QString &command);
+
 		/*! \brief Validates the connection status (command exec. timeout and connection status) and
 		raise errors in case of exceeded timeout or bad connection. This method is called prior any
 		command execution */
@@ -259,6 +287,35 @@ class __libconnector Connection {
 		 to be an data definition one  */
 		void executeDDLCommand(const QString &sql);
 
+		/*! \brief Prepares a named statement in the current session. Parameters in the sql must be referenced
+		 * as $1, $2, ... and their types are inferred by the server. Prepared statements last until the connection
+		 * is closed or reset, so the caller must use isStatementPrepared() to check if it needs to be prepared again */
+		void prepareStatement(const QString &stmt_name, const QString &sql);
+
+		//! \brief Returns if the named statement was prepared in the current session
+		bool isStatementPrepared(const QString &stmt_name);
+
+		/*! \brief Executes a statement previously prepared by prepareStatement() using the provided values
+		 * (in text format) as its parameters. Its mandatory to specify the object to receive the returned resultset */
+		void executePreparedStatement(const QString &stmt_name, const QStringList &params, ResultSet &result);
+
+		/*! \brief Starts a COPY ... FROM STDIN command on the server. After this call the rows must be sent
+		 * through putCopyData() and the operation finished via endCopy(). No other command can be executed
+		 * in the connection while the copy is in progress */
+		void startCopy(const QString &copy_cmd);
+
+		/*! \brief Sends a chunk of rows (in the format expected by the COPY command that started the operation)
+		 * to the server. Rows can be split across several calls, the server only parses them at endCopy() */
+		void putCopyData(const QByteArray &data);
+
+		/*! \brief Finishes the current COPY operation. If abort_msg is not empty the copy is aborted and the
+		 * server discards all the rows sent so far, otherwise an error is raised if the server rejects the data.
+		 * Returns the amount of rows copied */
+		unsigned endCopy(const QString &abort_msg = "");
+
+		//! \brief Returns if a COPY ... FROM STDIN operation is in progress in the connection
+		bool isCopyInProgress();
+
 		//! \brief Toggles the default status for the connect in the specified operation (OP_??? constants).
 		void setDefaultForOperation(ConnOperation op_id, bool value);
 
@@ -0,0 +1,377 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "connectionrecorder.h"
+#include "exception.h"
+#include <QFile>
+#include <QThread>
+
+const QByteArray ConnectionRecorder::FileMagic {"PGMCONNREC"};
+const QString ConnectionRecorder::RecordEnvVar {"PGMODELER_CONN_RECORD"};
+const QString ConnectionRecorder::ReplayEnvVar {"PGMODELER_CONN_REPLAY"};
+const QString ConnectionRecorder::LatencyEnvVar {"PGMODELER_CONN_LATENCY"};
+
+std::atomic<ConnectionRecorder::RecorderMode> ConnectionRecorder::mode {Disabled};
+QMutex ConnectionRecorder::mutex;
+QString ConnectionRecorder::output_file;
+QHash<QString, std::vector<ConnectionRecorder::RecordedResult>> ConnectionRecorder::results;
+QHash<QString, size_t> ConnectionRecorder::replay_pos;
+int ConnectionRecorder::server_version {0};
+unsigned ConnectionRecorder::latency {0};
+ConnectionRecorder::Statistics ConnectionRecorder::statistics;
+
+QString ConnectionRecorder::getCommandKey(const QString &db_name, const QString &command)
+{
+	return db_name + QChar::LineFeed + command;
+}
+
+void ConnectionRecorder::startRecording(const QString &filename)
+{
+	QMutexLocker locker(&mutex);
+
+	results.clear();
+	replay_pos.clear();
+	statistics = Statistics();
+	server_version = 0;
+	output_file = filename;
+	mode.store(Record);
+}
+
+void ConnectionRecorder::startReplay(const QString &filename, unsigned latency)
+{
+	QMutexLocker locker(&mutex);
+
+	mode.store(Disabled);
+	loadRecording(filename);
+	replay_pos.clear();
+	statistics = Statistics();
+	ConnectionRecorder::latency = latency;
+	mode.store(Replay);
+}
+
+void ConnectionRecorder::startFromEnvironment()
+{
+	QString rec_file = qEnvironmentVariable(RecordEnvVar.toStdString().c_str()),
+			replay_file = qEnvironmentVariable(ReplayEnvVar.toStdString().c_str());
+
+	if(getMode() != Disabled)
+		return;
+
+	if(!replay_file.isEmpty())
+	{
+		// The latency is informed in milliseconds (fractions allowed) but stored in microseconds
+		double lat_ms = qEnvironmentVariable(LatencyEnvVar.toStdString().c_str()).toDouble();
+		startReplay(replay_file, static_cast<unsigned>(qMax(0.0, lat_ms) * 1000));
+	}
+	else if(!rec_file.isEmpty())
+		startRecording(rec_file);
+}
+
+void ConnectionRecorder::stop()
+{
+	QMutexLocker locker(&mutex);
+	RecorderMode prev_mode = mode.exchange(Disabled);
+
+	try
+	{
+		if(prev_mode == Record)
+			saveRecording(output_file);
+	}
+	catch(Exception &e)
+	{
+		results.clear();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+
+	results.clear();
+	replay_pos.clear();
+}
+
+ConnectionRecorder::RecorderMode ConnectionRecorder::getMode()
+{
+	return mode.load();
+}
+
+void ConnectionRecorder::setLatency(unsigned usecs)
+{
+	QMutexLocker locker(&mutex);
+	latency = usecs;
+}
+
+unsigned ConnectionRecorder::getLatency()
+{
+	QMutexLocker locker(&mutex);
+	return latency;
+}
+
+ConnectionRecorder::Statistics ConnectionRecorder::getStatistics()
+{
+	QMutexLocker locker(&mutex);
+	return statistics;
+}
+
+void ConnectionRecorder::resetStatistics()
+{
+	QMutexLocker locker(&mutex);
+	statistics = Statistics();
+}
+
+QString ConnectionRecorder::getStatisticsSummary()
+{
+	Statistics stats = getStatistics();
+
+	return QString("Connection round trips: %1 (replayed: %2, misses: %3), injected latency: %4 ms")
+			.arg(stats.round_trips).arg(stats.replayed).arg(stats.misses)
+			.arg(stats.injected_latency / 1000.0, 0, 'f', 1);
+}
+
+void ConnectionRecorder::recordServerVersion(int version)
+{
+	QMutexLocker locker(&mutex);
+
+	if(isRecording())
+		server_version = version;
+}
+
+int ConnectionRecorder::getServerVersion()
+{
+	QMutexLocker locker(&mutex);
+	return server_version;
+}
+
+void ConnectionRecorder::recordResult(const QString &db_name, const QString &command, const PGresult *result, const QString &error_msg)
+{
+	RecordedResult rec_res;
+	int col_count = 0, val_idx = 0;
+
+	if(!isRecording())
+		return;
+
+	rec_res.status = result ? PQresultStatus(result) : PGRES_FATAL_ERROR;
+	rec_res.error_msg = error_msg.toUtf8();
+
+	if(result)
+		rec_res.sql_state = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+
+	if(rec_res.status == PGRES_TUPLES_OK)
+	{
+		col_count = PQnfields(result);
+		rec_res.tuple_count = PQntuples(result);
+
+		for(int col = 0; col < col_count; col++)
+		{
+			rec_res.col_names.append(PQfname(result, col));
+			rec_res.col_types.append(static_cast<unsigned>(PQftype(result, col)));
+			rec_res.col_formats.append(PQfformat(result, col));
+		}
+
+		rec_res.values.reserve(rec_res.tuple_count * col_count);
+		rec_res.nulls.resize(rec_res.tuple_count * col_count);
+
+		for(int tup = 0; tup < rec_res.tuple_count; tup++)
+		{
+			for(int col = 0; col < col_count; col++, val_idx++)
+			{
+				if(PQgetisnull(result, tup, col))
+				{
+					rec_res.nulls.setBit(val_idx);
+					rec_res.values.append(QByteArray());
+				}
+				else
+					// The length is used so binary values are captured entirely
+					rec_res.values.append(QByteArray(PQgetvalue(result, tup, col), PQgetlength(result, tup, col)));
+			}
+		}
+	}
+
+	QMutexLocker locker(&mutex);
+	results[getCommandKey(db_name, command)].push_back(rec_res);
+	statistics.round_trips++;
+}
+
+PGresult *ConnectionRecorder::replayResult(const QString &db_name, const QString &command, QString &error_msg, QString &sql_state)
+{
+	QString key = getCommandKey(db_name, command);
+	PGresult *result = nullptr;
+	std::vector<PGresAttDesc> attribs;
+	unsigned usecs = 0;
+	int col_count = 0, val_idx = 0;
+
+	{
+		QMutexLocker locker(&mutex);
+		auto itr = results.find(key);
+
+		statistics.round_trips++;
+
+		if(itr == results.end() || itr->empty())
+		{
+			statistics.misses++;
+			throw Exception(Exception::getErrorMessage(ErrorCode::ConnRecordingResultNotFound).arg(db_name, command),
+											ErrorCode::ConnRecordingResultNotFound, PGM_FUNC, PGM_FILE, PGM_LINE);
+		}
+
+		/* The results of a command are replayed in the order they were recorded
+		 * and the last one is repeated when the sequence is exhausted */
+		size_t &pos = replay_pos[key];
+		const RecordedResult &rec_res = itr->at(qMin(pos, itr->size() - 1));
+
+		pos++;
+		statistics.replayed++;
+		statistics.injected_latency += latency;
+		usecs = latency;
+
+		error_msg = QString::fromUtf8(rec_res.error_msg);
+		sql_state = QString::fromUtf8(rec_res.sql_state);
+		result = PQmakeEmptyPGresult(nullptr, static_cast<ExecStatusType>(rec_res.status));
+		col_count = rec_res.col_names.size();
+
+		if(col_count > 0)
+		{
+			for(int col = 0; col < col_count; col++)
+			{
+				attribs.push_back(PGresAttDesc { const_cast<char *>(rec_res.col_names[col].constData()),
+																				 0, 0, rec_res.col_formats[col], rec_res.col_types[col], -1, -1 });
+			}
+
+			// libpq copies the attributes and values so the recorded data is not shared with the result
+			PQsetResultAttrs(result, col_count, attribs.data());
+
+			for(int tup = 0; tup < rec_res.tuple_count; tup++)
+			{
+				for(int col = 0; col < col_count; col++, val_idx++)
+				{
+					if(rec_res.nulls.testBit(val_idx))
+						PQsetvalue(result, tup, col, nullptr, -1);
+					else
+						PQsetvalue(result, tup, col, const_cast<char *>(rec_res.values[val_idx].constData()), rec_res.values[val_idx].size());
+				}
+			}
+		}
+	}
+
+	// The latency is injected outside the lock so concurrent connections are delayed independently
+	if(usecs > 0)
+		QThread::usleep(usecs);
+
+	return result;
+}
+
+void ConnectionRecorder::writeResult(QDataStream &stream, const RecordedResult &result)
+{
+	stream << static_cast<qint32>(result.status) << result.error_msg << result.sql_state
+				 << result.col_names << result.col_types << result.col_formats
+				 << static_cast<qint32>(result.tuple_count) << result.values << result.nulls;
+}
+
+void ConnectionRecorder::readResult(QDataStream &stream, RecordedResult &result)
+{
+	qint32 status = 0, tuple_count = 0;
+
+	stream >> status >> result.error_msg >> result.sql_state
+				 >> result.col_names >> result.col_types >> result.col_formats
+				 >> tuple_count >> result.values >> result.nulls;
+
+	result.status = status;
+	result.tuple_count = tuple_count;
+}
+
+void ConnectionRecorder::saveRecording(const QString &filename)
+{
+	QFile file(filename);
+	QByteArray buffer;
+	QDataStream stream(&buffer, QIODevice::WriteOnly);
+
+	stream << static_cast<quint32>(results.size());
+
+	for(auto itr = results.cbegin(); itr != results.cend(); itr++)
+	{
+		stream << itr.key() << static_cast<quint32>(itr.value().size());
+
+		for(auto &result : itr.value())
+			writeResult(stream, result);
+	}
+
+	if(!file.open(QFile::WriteOnly | QFile::Truncate))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, file.errorString());
+	}
+
+	QDataStream out(&file);
+
+	// Catalog query results are very repetitive so the payload is compressed
+	out.writeRawData(FileMagic.constData(), FileMagic.size());
+	out << FileVersion << static_cast<qint32>(server_version) << qCompress(buffer);
+	file.close();
+}
+
+void ConnectionRecorder::loadRecording(const QString &filename)
+{
+	QFile file(filename);
+	QByteArray magic, buffer;
+	qint32 version = 0, srv_version = 0;
+	quint32 key_count = 0, res_count = 0;
+	QString key;
+
+	if(!file.open(QFile::ReadOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+										ErrorCode::FileDirectoryNotAccessed, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, file.errorString());
+	}
+
+	QDataStream in(&file);
+
+	magic.resize(FileMagic.size());
+	in.readRawData(magic.data(), magic.size());
+	in >> version >> srv_version >> buffer;
+	buffer = qUncompress(buffer);
+
+	if(magic != FileMagic || version != FileVersion || buffer.isEmpty())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::InvConnRecordingFile).arg(filename),
+										ErrorCode::InvConnRecordingFile, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	QDataStream stream(buffer);
+
+	results.clear();
+	stream >> key_count;
+
+	for(quint32 key_idx = 0; key_idx < key_count && stream.status() == QDataStream::Ok; key_idx++)
+	{
+		stream >> key >> res_count;
+		std::vector<RecordedResult> &key_results = results[key];
+
+		key_results.resize(res_count);
+
+		for(auto &result : key_results)
+			readResult(stream, result);
+	}
+
+	if(stream.status() != QDataStream::Ok)
+	{
+		results.clear();
+		throw Exception(Exception::getErrorMessage(ErrorCode::InvConnRecordingFile).arg(filename),
+										ErrorCode::InvConnRecordingFile, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	server_version = srv_version;
+}
@@ -0,0 +1,200 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libconnector
+\class ConnectionRecorder
+\brief Implements a record/replay layer for the commands executed through Connection.
+While recording, the results returned by the server (tuples, column descriptions and errors) are captured
+and saved into a compressed file when stop() is called. While replaying, no server is contacted at all:
+the connections are "opened" without calling libpq and each command receives the result recorded for it,
+rebuilt as a regular PGresult so ResultSet, Catalog and all the helpers built upon them work unchanged.
+This allows running import, diff and export benchmarks/tests offline and deterministically, optionally
+injecting a fixed latency to each round trip in order to measure how sensitive an operation is to the
+amount of commands it sends to the server.
+
+Results are keyed by the database name plus the command (and parameters, for prepared statements). When the
+same command is executed many times the recorded results are replayed in the same order they were captured,
+the last one being repeated once the sequence is exhausted.
+
+The recorder is disabled by default. Besides the API below, the CLI enables it via the environment variables
+PGMODELER_CONN_RECORD (recording file), PGMODELER_CONN_REPLAY (replayed file) and PGMODELER_CONN_LATENCY
+(injected latency in milliseconds, used only when replaying).
+*/
+
+#ifndef CONNECTION_RECORDER_H
+#define CONNECTION_RECORDER_H
+
+#include "connectorglobal.h"
+#include <libpq-fe.h>
+#include <QBitArray>
+#include <QDataStream>
+#include <QHash>
+#include <QMutex>
+#include <atomic>
+#include <vector>
+
+class __libconnector ConnectionRecorder {
+	public:
+		enum RecorderMode: unsigned {
+			Disabled,
+			Record,
+			Replay
+		};
+
+		struct Statistics {
+			//! \brief Amount of commands sent to the server (or to the recording, while replaying)
+			unsigned round_trips = 0,
+
+			//! \brief Amount of commands which result was found in the recording
+			replayed = 0,
+
+			//! \brief Amount of commands with no result in the recording
+			misses = 0;
+
+			//! \brief Total time (in microseconds) injected as latency in the replayed round trips
+			qint64 injected_latency = 0;
+		};
+
+	private:
+		//! \brief Stores the data of a single result returned by the server
+		struct RecordedResult {
+			//! \brief The result status (ExecStatusType)
+			int status = PGRES_COMMAND_OK;
+
+			//! \brief The error message and SQLSTATE code in case the command failed
+			QByteArray error_msg, sql_state;
+
+			QList<QByteArray> col_names;
+
+			QList<unsigned> col_types;
+
+			QList<int> col_formats;
+
+			int tuple_count = 0;
+
+			//! \brief The values of all the tuples (row by row)
+			QList<QByteArray> values;
+
+			//! \brief Indicates which of the values are null
+			QBitArray nulls;
+		};
+
+		//! \brief File header used to identify the recordings
+		static const QByteArray FileMagic;
+
+		//! \brief Current version of the recording file format
+		static constexpr qint32 FileVersion = 1;
+
+		static std::atomic<RecorderMode> mode;
+
+		static QMutex mutex;
+
+		//! \brief The file where the recording is saved (when recording)
+		static QString output_file;
+
+		//! \brief Stores the results in the order they were captured for each command key
+		static QHash<QString, std::vector<RecordedResult>> results;
+
+		//! \brief Stores the index of the next result to be replayed for each command key
+		static QHash<QString, size_t> replay_pos;
+
+		//! \brief The server version (as returned by PQserverVersion()) of the recorded server
+		static int server_version;
+
+		//! \brief The latency (in microseconds) injected in each replayed round trip
+		static unsigned latency;
+
+		static Statistics statistics;
+
+		//! \brief Returns the key used to store/find the results of a command
+		static QString getCommandKey(const QString &db_name, const QString &command);
+
+		static void writeResult(QDataStream &stream, const RecordedResult &result);
+
+		static void readResult(QDataStream &stream, RecordedResult &result);
+
+		static void loadRecording(const QString &filename);
+
+		static void saveRecording(const QString &filename);
+
+	public:
+		//! \brief Environment variables that configure the recorder (see startFromEnvironment())
+		static const QString RecordEnvVar,
+		ReplayEnvVar,
+		LatencyEnvVar;
+
+		ConnectionRecorder() = delete;
+
+		//! \brief Starts capturing the results of the commands. They are saved in the provided file when stop() is called
+		static void startRecording(const QString &filename);
+
+		/*! \brief Loads the provided recording and starts answering the commands with it.
+		 *  The latency (in microseconds) is injected in each replayed round trip */
+		static void startReplay(const QString &filename, unsigned latency = 0);
+
+		/*! \brief Starts recording or replaying in case the environment variables PGMODELER_CONN_RECORD or
+		 *  PGMODELER_CONN_REPLAY are set. The latter has precedence when both are set */
+		static void startFromEnvironment();
+
+		/*! \brief Stops recording/replaying. When recording, the captured results are written to
+		 *  the output file. In case of any failure while writing the file an exception is raised */
+		static void stop();
+
+		static RecorderMode getMode();
+
+		static bool isRecording()
+		{
+			return mode.load(std::memory_order_relaxed) == Record;
+		}
+
+		static bool isReplaying()
+		{
+			return mode.load(std::memory_order_relaxed) == Replay;
+		}
+
+		//! \brief Defines the latency (in microseconds) injected in each replayed round trip
+		static void setLatency(unsigned usecs);
+		static unsigned getLatency();
+
+		static Statistics getStatistics();
+		static void resetStatistics();
+
+		//! \brief Returns a human readable summary of the statistics
+		static QString getStatisticsSummary();
+
+		//! \brief Stores the version of the server being recorded (as returned by PQserverVersion())
+		static void recordServerVersion(int version);
+
+		//! \brief Returns the version of the recorded server
+		static int getServerVersion();
+
+		/*! \brief Captures the result of a command executed in the provided database. The error message
+		 *  must be the one returned by the connection (PQerrorMessage()) after the command execution */
+		static void recordResult(const QString &db_name, const QString &command, const PGresult *result, const QString &error_msg);
+
+		/*! \brief Returns a copy of the result recorded for the command executed in the provided database, filling
+		 *  error_msg and sql_state in case the recorded command failed. The caller takes the ownership of the result.
+		 *  The configured latency is injected before returning. An exception is raised if there's no recorded result */
+		static PGresult *replayResult(const QString &db_name, const QString &command, QString &error_msg, QString &sql_state);
+};
+
+#endif
@@ -134,6 +134,8 @@ BaseObject::BaseObject()
 
 BaseObject::~BaseObject()
 {
+	CodeCache::remove(this);
+
 	if(clear_deps_in_dtor)
 		clearAllDepsRefs();
 }
@@ -406,6 +408,17 @@ BaseObject *BaseObject::getDatabase()
 	return this->database;
 }
 
+void BaseObject::updateDatabaseIndexes()
+{
+	if(database)
+		database->updateObjectIndexes(this);
+}
+
+void BaseObject::updateObjectIndexes(BaseObject *)
+{
+
+}
+
 void BaseObject::setProtected(bool value)
 {
 	setCodeInvalidated(this->is_protected != value);
@@ -625,8 +638,13 @@ void BaseObject::setSchema(BaseObject *schema)
 	if(!acceptsSchema())
 		throw Exception(ErrorCode::AsgInvalidSchemaObject,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-	setCodeInvalidated(this->schema != schema);
+	bool schema_changed = this->schema != schema;
+
+	setCodeInvalidated(schema_changed);
 	this->schema = schema;
+
+	if(schema_changed)
+		updateDatabaseIndexes();
 }
 
 void BaseObject::setOwner(BaseObject *owner)
@@ -1006,10 +1024,12 @@ QString BaseObject::getSourceCode(SchemaParser::CodeType def_type, bool reduced_
 			//Database object doesn't handles cached code.
 			if(obj_type != ObjectType::Database)
 			{
-				if(def_type==SchemaParser::SqlCode ||	(!reduced_form && def_type==SchemaParser::XmlCode))
-					cached_code[def_type] = code_def;
-				else if(reduced_form)
-					cached_reduced_code = code_def;
+				if(def_type==SchemaParser::SqlCode)
+					CodeCache::insert(this, CodeCache::SqlCode, code_def);
+				else if(!reduced_form)
+					CodeCache::insert(this, CodeCache::XmlCode, code_def);
+				else
+					CodeCache::insert(this, CodeCache::ReducedXmlCode, code_def);
 			}
 
 			code_invalidated = false;
@@ -1253,6 +1273,7 @@ void BaseObject::operator = (BaseObject &obj)
 	this->sql_disabled=obj.sql_disabled;
 	this->system_obj=obj.system_obj;
 	this->setCodeInvalidated(true);
+	this->updateDatabaseIndexes();
 	//updateDependencies();
 }
 
@@ -1261,11 +1282,7 @@ void BaseObject::setCodeInvalidated(bool value)
 	if(value != code_invalidated)
 	{
 		if(value)
-		{
-			cached_reduced_code.clear();
-			cached_code[SchemaParser::SqlCode].clear();
-			cached_code[SchemaParser::XmlCode].clear();
-		}
+			CodeCache::remove(this);
 
 		code_invalidated=value;
 	}
@@ -1363,17 +1380,16 @@ QString BaseObject::getCachedCode(unsigned def_type, bool reduced_form)
 	if(def_type==SchemaParser::SqlCode && schparser.getPgSQLVersion()!=BaseObject::pgsql_ver)
 		code_invalidated=true;
 
-	if(!code_invalidated &&
-			((!reduced_form && !cached_code[def_type].isEmpty()) ||
-			 (def_type==SchemaParser::XmlCode  && reduced_form && !cached_reduced_code.isEmpty())))
-	{
-		if(def_type==SchemaParser::XmlCode  && reduced_form)
-			return cached_reduced_code;
-		
-		return cached_code[def_type];
-	}
+	if(code_invalidated)
+		return "";
 
-	return "";
+	if(def_type==SchemaParser::XmlCode && reduced_form)
+		return CodeCache::get(this, CodeCache::ReducedXmlCode);
+
+	if(reduced_form)
+		return "";
+
+	return CodeCache::get(this, def_type == SchemaParser::SqlCode ? CodeCache::SqlCode : CodeCache::XmlCode);
 }
 
 QString BaseObject::getDropCode(bool cascade)
@@ -38,6 +38,7 @@
 #include "enumtype.h"
 #include "exception.h"
 #include "pgsqlversions.h"
+#include "codecache.h"
 
 enum class ObjectType: unsigned {
 	Column,
@@ -181,16 +182,11 @@ class __libcore BaseObject {
 				generate it again */
 		code_invalidated;
 
-		//! \brief Stores the cached xml and sql code
-		QString cached_code[2],
-
-		//! \brief Stores the xml code in reduced form
-		cached_reduced_code,
-
 		/*! \brief Store the cached names of the object (raw name, formated name, signature)
 		 *  This will avoid calling the name validation/formatting everytime the object name
-		 *  need to be retrieved, improving the overall perfomance */
-		cached_names[3];
+		 *  need to be retrieved, improving the overall perfomance. The generated SQL/XML code,
+		 *  which is much larger, is held in the memory-budgeted global cache (see CodeCache) */
+		QString cached_names[3];
 
 		//! \brief References the cached names entries
 		enum CachedNameId: unsigned {
@@ -267,6 +263,14 @@ class __libcore BaseObject {
 		 This is the real implementation of the virtual method getSourceCode(SchemaParser::CodeType). */
 		QString __getSourceCode(SchemaParser::CodeType def_type);
 
+		/*! \brief Notifies the database that owns the object that some attribute used by the database's internal indexes
+		 *  (e.g. the object's schema or the tables connected by a relationship) has changed. See updateObjectIndexes() */
+		void updateDatabaseIndexes();
+
+		/*! \brief Updates the internal indexes related to the provided object. This method does nothing by default
+		 *  and is reimplemented by DatabaseModel */
+		virtual void updateObjectIndexes(BaseObject *object);
+
 		/*! \brief Set the database that owns the object
 		ATTENTION: calling this method with a nullptr parameter doesn't means that the object will
 							 be removed from the database, only the attribute will be set as nullptr and
@@ -385,17 +385,18 @@ void BaseRelationship::setRelationshipAttributes()
 
 QString BaseRelationship::getCachedCode(unsigned def_type)
 {
-	if(!code_invalidated &&
-			((!cached_code[def_type].isEmpty()) ||
-			 (def_type==SchemaParser::XmlCode  && !cached_reduced_code.isEmpty())))
-	{
-		if(def_type==SchemaParser::XmlCode  && !cached_reduced_code.isEmpty())
-			return cached_reduced_code;
-		
-		return cached_code[def_type];
-	}
-	
-	return "";
+	QString code_def;
+
+	if(code_invalidated)
+		return "";
+
+	if(def_type==SchemaParser::XmlCode)
+		code_def = CodeCache::get(this, CodeCache::ReducedXmlCode);
+
+	if(code_def.isEmpty())
+		code_def = CodeCache::get(this, def_type == SchemaParser::SqlCode ? CodeCache::SqlCode : CodeCache::XmlCode);
+
+	return code_def;
 }
 
 void BaseRelationship::setReferenceForeignKey(Constraint *ref_fk)
@@ -462,8 +463,9 @@ QString BaseRelationship::getSourceCode(SchemaParser::CodeType def_type)
 		if(rel_type!=RelationshipFk)
 			return "";
 		
-		cached_code[def_type] = reference_fk->getSourceCode(SchemaParser::SqlCode);
-		return cached_code[def_type];
+		code_def = reference_fk->getSourceCode(SchemaParser::SqlCode);
+		CodeCache::insert(this, CodeCache::SqlCode, code_def);
+		return code_def;
 	}
 	
 	bool reduced_form;
@@ -472,7 +474,7 @@ QString BaseRelationship::getSourceCode(SchemaParser::CodeType def_type)
 								attributes[Attributes::LabelsPos].isEmpty());
 
 	if(!reduced_form)
-		cached_reduced_code.clear();
+		CodeCache::remove(this, CodeCache::ReducedXmlCode);
 
 	return BaseObject::getSourceCode(SchemaParser::XmlCode,reduced_form);	
 }
@@ -549,6 +551,9 @@ void BaseRelationship::operator = (BaseRelationship &rel)
 
 	this->setMandatoryTable(SrcTable, rel.src_mandatory);
 	this->setMandatoryTable(DstTable, rel.dst_mandatory);
+
+	//The connected tables may have changed so the database indexes must be updated
+	this->updateDatabaseIndexes();
 }
 
 QString BaseRelationship::getRelTypeAttribute()
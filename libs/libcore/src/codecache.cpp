@@ -0,0 +1,268 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "codecache.h"
+#include <vector>
+
+QMutex CodeCache::mutex;
+CodeCache::EntryList CodeCache::hot_entries;
+CodeCache::EntryList CodeCache::cold_entries;
+QHash<CodeCache::EntryKey, CodeCache::EntryList::iterator> CodeCache::entries_idx;
+bool CodeCache::compress_cold = false;
+CodeCache::Statistics CodeCache::stats { 0, 0, 0, 0, 0, 0, 0, static_cast<qint64>(CodeCache::DefaultBudgetMb) * 1024 * 1024 };
+
+qint64 CodeCache::getEntrySize(const CacheEntry &entry)
+{
+	return EntryOverhead + (entry.code.size() * static_cast<qint64>(sizeof(QChar))) + entry.zcode.size();
+}
+
+void CodeCache::removeEntry(EntryList::iterator itr)
+{
+	stats.used_bytes -= itr->size;
+	entries_idx.remove(EntryKey(itr->owner, itr->slot));
+
+	if(itr->cold)
+		cold_entries.erase(itr);
+	else
+		hot_entries.erase(itr);
+
+	stats.entries = hot_entries.size() + cold_entries.size();
+}
+
+void CodeCache::enforceBudget(QMutexLocker<QMutex> &locker)
+{
+	struct PendingEntry {
+		EntryKey key;
+		QString code;
+		QByteArray zcode;
+	};
+
+	std::vector<PendingEntry> pending;
+	EntryList::iterator itr;
+	qint64 excess = 0;
+
+	/* First, when enabled, the least recently used plain entries are moved to the cold list and compressed.
+	 * The most recently used entry is never compressed since it was just inserted or accessed */
+	while(compress_cold && stats.budget > 0 && stats.used_bytes > stats.budget && hot_entries.size() > 1)
+	{
+		pending.clear();
+		excess = stats.used_bytes - stats.budget;
+
+		while(excess > 0 && hot_entries.size() > 1)
+		{
+			itr = std::prev(hot_entries.end());
+			stats.scanned++;
+
+			// Entries too small to be compressed are moved to the cold list as they are
+			if(itr->code.size() * static_cast<qint64>(sizeof(QChar)) >= MinCompressSize)
+			{
+				pending.push_back(PendingEntry { EntryKey(itr->owner, itr->slot), itr->code, QByteArray() });
+				excess -= itr->size;
+			}
+
+			itr->cold = true;
+			cold_entries.splice(cold_entries.begin(), hot_entries, itr);
+		}
+
+		if(pending.empty())
+			continue;
+
+		// The compression is done without holding the lock so other threads can use the cache meanwhile
+		locker.unlock();
+
+		for(auto &pend : pending)
+			pend.zcode = qCompress(pend.code.toUtf8());
+
+		locker.relock();
+
+		for(auto &pend : pending)
+		{
+			auto idx_itr = entries_idx.find(pend.key);
+
+			if(idx_itr == entries_idx.end())
+				continue;
+
+			itr = idx_itr.value();
+
+			/* Discarding the compressed code if the entry was accessed, replaced or
+			 * compressed by another thread while the lock was released */
+			if(!itr->cold || !itr->zcode.isEmpty() || itr->code.constData() != pend.code.constData())
+				continue;
+
+			itr->zcode = pend.zcode;
+			itr->code.clear();
+
+			stats.used_bytes -= itr->size;
+			itr->size = getEntrySize(*itr);
+			stats.used_bytes += itr->size;
+			stats.compressions++;
+		}
+	}
+
+	//If the budget is still exceeded the least recently used entries are evicted, starting by the cold ones
+	while(stats.budget > 0 && stats.used_bytes > stats.budget && (!cold_entries.empty() || !hot_entries.empty()))
+	{
+		removeEntry(std::prev(!cold_entries.empty() ? cold_entries.end() : hot_entries.end()));
+		stats.evictions++;
+	}
+}
+
+void CodeCache::setBudget(qint64 bytes)
+{
+	QMutexLocker locker(&mutex);
+	stats.budget = bytes < 0 ? 0 : bytes;
+	enforceBudget(locker);
+}
+
+qint64 CodeCache::getBudget()
+{
+	QMutexLocker locker(&mutex);
+	return stats.budget;
+}
+
+void CodeCache::setCompressColdEntries(bool value)
+{
+	QMutexLocker locker(&mutex);
+	compress_cold = value;
+}
+
+bool CodeCache::isCompressColdEntries()
+{
+	QMutexLocker locker(&mutex);
+	return compress_cold;
+}
+
+void CodeCache::insert(const BaseObject *owner, CodeSlot slot, const QString &code)
+{
+	if(!owner)
+		return;
+
+	QMutexLocker locker(&mutex);
+	auto idx_itr = entries_idx.find(EntryKey(owner, slot));
+
+	if(idx_itr != entries_idx.end())
+		removeEntry(idx_itr.value());
+
+	if(code.isEmpty())
+		return;
+
+	hot_entries.push_front(CacheEntry { owner, slot, code, QByteArray(), 0, false });
+	hot_entries.front().size = getEntrySize(hot_entries.front());
+	entries_idx[EntryKey(owner, slot)] = hot_entries.begin();
+
+	stats.used_bytes += hot_entries.front().size;
+	stats.entries = hot_entries.size() + cold_entries.size();
+	enforceBudget(locker);
+}
+
+QString CodeCache::get(const BaseObject *owner, CodeSlot slot)
+{
+	QMutexLocker locker(&mutex);
+	auto idx_itr = entries_idx.find(EntryKey(owner, slot));
+
+	if(idx_itr == entries_idx.end())
+	{
+		stats.misses++;
+		return "";
+	}
+
+	EntryList::iterator itr = idx_itr.value();
+
+	//Compressed entries are restored to their plain form since they became hot again
+	if(!itr->zcode.isEmpty())
+	{
+		itr->code = QString::fromUtf8(qUncompress(itr->zcode));
+		itr->zcode.clear();
+
+		stats.used_bytes -= itr->size;
+		itr->size = getEntrySize(*itr);
+		stats.used_bytes += itr->size;
+	}
+
+	//Moving the entry to the front of the hot list marking it as the most recently used
+	hot_entries.splice(hot_entries.begin(), itr->cold ? cold_entries : hot_entries, itr);
+	itr->cold = false;
+	stats.hits++;
+
+	QString code = itr->code;
+	enforceBudget(locker);
+
+	return code;
+}
+
+void CodeCache::remove(const BaseObject *owner, CodeSlot slot)
+{
+	QMutexLocker locker(&mutex);
+	auto idx_itr = entries_idx.find(EntryKey(owner, slot));
+
+	if(idx_itr != entries_idx.end())
+		removeEntry(idx_itr.value());
+}
+
+void CodeCache::remove(const BaseObject *owner)
+{
+	QMutexLocker locker(&mutex);
+
+	for(auto slot : { SqlCode, XmlCode, ReducedXmlCode })
+	{
+		auto idx_itr = entries_idx.find(EntryKey(owner, slot));
+
+		if(idx_itr != entries_idx.end())
+			removeEntry(idx_itr.value());
+	}
+}
+
+void CodeCache::clear()
+{
+	QMutexLocker locker(&mutex);
+	hot_entries.clear();
+	cold_entries.clear();
+	entries_idx.clear();
+	stats.used_bytes = stats.entries = 0;
+}
+
+CodeCache::Statistics CodeCache::getStatistics()
+{
+	QMutexLocker locker(&mutex);
+	return stats;
+}
+
+void CodeCache::resetStatistics()
+{
+	QMutexLocker locker(&mutex);
+	stats.hits = stats.misses = stats.evictions = stats.compressions = stats.scanned = 0;
+}
+
+QString CodeCache::getStatisticsSummary()
+{
+	Statistics st = getStatistics();
+	unsigned long long lookups = st.hits + st.misses;
+
+	return QString("Code cache: %1 entries, %2 of %3 KB used, %4 hits, %5 misses (%6% hit rate), %7 evictions, %8 compressions")
+			.arg(st.entries)
+			.arg(st.used_bytes / 1024)
+			.arg(st.budget > 0 ? QString::number(st.budget / 1024) : QString("unlimited"))
+			.arg(st.hits)
+			.arg(st.misses)
+			.arg(lookups > 0 ? (st.hits * 100.0) / lookups : 0.0, 0, 'f', 1)
+			.arg(st.evictions)
+			.arg(st.compressions);
+}
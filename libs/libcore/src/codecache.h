@@ -0,0 +1,165 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcore
+\class CodeCache
+\brief Implements the global cache that holds the SQL/XML code generated by the database model objects.
+The cache is bounded by a memory budget and, once the budget is exceeded, the least recently used
+entries are (optionally) compressed and then evicted. The entries already considered for compression
+are kept in a separated (cold) list so the compression never walks over them again. An evicted entry is simply regenerated by the
+object on the next code request, so the cache never affects the generated code, only the memory
+usage and speed. The entries of an object are discarded via BaseObject::setCodeInvalidated().
+*/
+
+#ifndef CODE_CACHE_H
+#define CODE_CACHE_H
+
+#include "coreglobal.h"
+#include <QString>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <list>
+
+class BaseObject;
+
+class __libcore CodeCache {
+	public:
+		//! \brief Identifies the kinds of code that can be cached for a single object
+		enum CodeSlot: unsigned {
+			SqlCode,
+			XmlCode,
+			ReducedXmlCode
+		};
+
+		//! \brief Holds the counters that describe the cache usage
+		struct Statistics {
+			unsigned long long hits = 0,
+			misses = 0,
+			evictions = 0,
+			compressions = 0,
+
+			//! \brief Amount of entries examined while looking for entries to compress
+			scanned = 0;
+
+			//! \brief Amount of entries and bytes currently held by the cache
+			qint64 entries = 0,
+			used_bytes = 0,
+
+			//! \brief Memory budget in bytes (zero means unlimited)
+			budget = 0;
+		};
+
+		//! \brief Default memory budget of the cache (in megabytes)
+		static constexpr int DefaultBudgetMb = 256;
+
+	private:
+		struct CacheEntry {
+			const BaseObject *owner;
+			CodeSlot slot;
+
+			//! \brief The plain code (empty when the entry is compressed)
+			QString code;
+
+			//! \brief The compressed code (empty when the entry is not compressed)
+			QByteArray zcode;
+
+			//! \brief Approximated amount of memory held by the entry
+			qint64 size;
+
+			//! \brief Indicates that the entry is in the cold entries list
+			bool cold;
+		};
+
+		using EntryKey = std::pair<const BaseObject *, unsigned>;
+		using EntryList = std::list<CacheEntry>;
+
+		//! \brief Approximated fixed cost of each entry (list node, hash node and string headers)
+		static constexpr qint64 EntryOverhead = 96;
+
+		//! \brief Codes smaller than this amount of bytes are not compressed since the gain is negligible
+		static constexpr qint64 MinCompressSize = 512;
+
+		static QMutex mutex;
+
+		/*! \brief The plain entries ordered from the most to the least recently used.
+		 *  These are the candidates to compression when the budget is exceeded */
+		static EntryList hot_entries;
+
+		/*! \brief The entries that were already compressed (or were too small to be compressed)
+		 *  ordered from the most to the least recently used. These are the first ones to be evicted */
+		static EntryList cold_entries;
+
+		//! \brief Index of the entries by their owner and code slot
+		static QHash<EntryKey, EntryList::iterator> entries_idx;
+
+		//! \brief Indicates if the least recently used entries must be compressed before being evicted
+		static bool compress_cold;
+
+		static Statistics stats;
+
+		//! \brief Computes the approximated amount of memory held by the entry
+		static qint64 getEntrySize(const CacheEntry &entry);
+
+		//! \brief Removes the entry pointed by the iterator updating the memory usage
+		static void removeEntry(EntryList::iterator itr);
+
+		/*! \brief Compresses and/or evicts the least recently used entries until the memory usage
+		 *  fits the budget. This method must be called with the mutex locked by the provided locker
+		 *  which is temporarily unlocked while the entries are compressed */
+		static void enforceBudget(QMutexLocker<QMutex> &locker);
+
+	public:
+		CodeCache() = delete;
+
+		/*! \brief Defines the memory budget of the cache in bytes. A zero value means unlimited.
+		 *  Reducing the budget causes the immediate compression/eviction of the exceeding entries */
+		static void setBudget(qint64 bytes);
+		static qint64 getBudget();
+
+		//! \brief Defines if the least recently used entries are compressed before being evicted
+		static void setCompressColdEntries(bool value);
+		static bool isCompressColdEntries();
+
+		//! \brief Stores the code of the object in the specified slot replacing any previous entry
+		static void insert(const BaseObject *owner, CodeSlot slot, const QString &code);
+
+		//! \brief Returns the code of the object in the specified slot or an empty string if it is not cached
+		static QString get(const BaseObject *owner, CodeSlot slot);
+
+		//! \brief Discards the code of the object in the specified slot
+		static void remove(const BaseObject *owner, CodeSlot slot);
+
+		//! \brief Discards all the codes of the object
+		static void remove(const BaseObject *owner);
+
+		//! \brief Discards all entries of the cache
+		static void clear();
+
+		static Statistics getStatistics();
+		static void resetStatistics();
+
+		//! \brief Returns a single line summary of the cache statistics for logging purposes
+		static QString getStatisticsSummary();
+};
+
+#endif
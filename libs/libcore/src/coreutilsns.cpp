@@ -287,4 +287,67 @@ namespace CoreUtilsNs {
 		
 		return keywords[chr].contains(word.toUpper());
 	}
+
+	QString generateUniqueName(BaseObject *obj, const QSet<QString> &used_names, const QString &suffix, bool use_suf_on_conflict)
+	{
+		unsigned counter = 0;
+		QString uniq_name, obj_name, id;
+		QChar oper_uniq_chr = '?'; //Char appended at end of operator names in order to resolve conflicts
+		ObjectType obj_type;
+
+		if(!obj)
+			return("");
+
+		//Cast objects will not have the name changed since their name are automatically generated
+		if(obj->getObjectType()==ObjectType::Cast || obj->getObjectType()==ObjectType::Database)
+			return(obj->getName());
+
+		obj_name = obj->getName(false);
+		obj_type = obj->getObjectType();
+
+		if(!use_suf_on_conflict && obj_type != ObjectType::Operator)
+			obj_name += suffix;
+
+		counter = (use_suf_on_conflict && obj_type!= ObjectType::Operator? 0 : 1);
+		uniq_name = obj_name;
+
+		if(used_names.isEmpty())
+			return uniq_name;
+
+		while(true)
+		{
+			//If the name length exceeds the maximum size we need to truncate it
+			if(uniq_name.size() > BaseObject::ObjectNameMaxLength)
+			{
+				/* Generating the hash of the current timestamp (in msecs) so we can extract
+				 * the first 6 characters to use as a temporary disambiguation suffix */
+				id = UtilsNs::getStringHash(QString::number(QDateTime::currentMSecsSinceEpoch())).mid(0,6);
+
+				/* Truncates the name until 7 bytes before the maximum allowed length
+				 * so we can append the id properly */
+				uniq_name.truncate(BaseObject::ObjectNameMaxLength - id.size() - 1);
+
+				//Append the id of the object on its name (this is not applied to operators)
+				if(obj_type != ObjectType::Operator)
+					uniq_name += "_" + id;
+			}
+
+			if(!used_names.contains(uniq_name))
+				break;
+
+			//For operators is appended a '?' on the name
+			if(obj_type == ObjectType::Operator)
+				uniq_name = QString("%1%2").arg(obj_name, QString("").leftJustified(counter++, oper_uniq_chr));
+			else
+			{
+				uniq_name = QString("%1%2%3")
+										.arg(obj_name,
+												 use_suf_on_conflict ? suffix : "",
+												 use_suf_on_conflict && counter == 0 ? "" : QString::number(counter));
+				counter++;
+			}
+		}
+
+		return uniq_name;
+	}
 }
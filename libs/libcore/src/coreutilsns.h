@@ -30,6 +30,7 @@
 
 #include "baseobject.h"
 #include "utilsns.h"
+#include <QSet>
 
 namespace CoreUtilsNs {
 	/*! \brief Holds the check mark character for use in data dictionary
@@ -57,6 +58,12 @@ namespace CoreUtilsNs {
 	//! \brief Returns true if the specified word is a PostgreSQL reserved word.
 	__libcore bool isReservedKeyword(const QString &word);
 
+	/*! \brief Generates an unique name for the object that doesn't conflict with any of the names in the provided set.
+	 * The parameters suffix and use_suf_on_conflict work as in the template form below. This form is meant for bulk operations
+	 * where the set of names in use is built once by the caller and updated as new names are generated */
+	__libcore QString generateUniqueName(BaseObject *obj, const QSet<QString> &used_names,
+																			 const QString &suffix = "", bool use_suf_on_conflict = false);
+
 	/*! \brief Generates an unique name based on the specified object and the list of objects of the same type.
 	 * The user can specify a suffix for the generated name as well if the comparison inside the method must take into account
 	 * the schema names of the involved objects comp_sch_names parameter. The optinal parameter use_suf_on_conflict indicates
@@ -69,76 +76,22 @@ namespace CoreUtilsNs {
 											bool comp_sch_names = false, const QString &suffix = "",
 											bool use_suf_on_conflict = false, bool discard_input_obj = false)
 	{
-		unsigned counter = 0;
-		QString uniq_name, obj_name, id;
-		Class *aux_obj = nullptr;
-		typename std::vector<Class *>::iterator itr = obj_vector.begin(), itr_end = obj_vector.end();
-		QChar oper_uniq_chr = '?'; //Char appended at end of operator names in order to resolve conflicts
-		ObjectType obj_type;
+		QSet<QString> used_names;
 
 		if(!obj)
 			return("");
-		
-		//Cast objects will not have the name changed since their name are automatically generated
-		if(obj->getObjectType()==ObjectType::Cast || obj->getObjectType()==ObjectType::Database)
-			return(obj->getName());
-
-		obj_name = obj->getName(false);
-		obj_type = obj->getObjectType();
-
-		if(!use_suf_on_conflict && obj_type != ObjectType::Operator)
-			obj_name += suffix;
 
-		counter = (use_suf_on_conflict && obj_type!= ObjectType::Operator? 0 : 1);
-		uniq_name = obj_name;
-
-					 //Check if the object's new name conflicts with some of the objects within the list
-		while(itr != itr_end)
+		//The names in use are gathered only once so each generated name is checked in constant time
+		for(auto &aux_obj : obj_vector)
 		{
-			//If the name length exceeds the maximum size we need to truncate it
-			if(uniq_name.size() > BaseObject::ObjectNameMaxLength)
-			{
-				/* Generating the hash of the current timestamp (in msecs) so we can extract
-				 * the first 6 characters to use as a temporary disambiguation suffix */
-				id = UtilsNs::getStringHash(QString::number(QDateTime::currentMSecsSinceEpoch())).mid(0,6);
-
-				/* Truncates the name until 7 bytes before the maximum allowed length
-				 * so we can append the id properly */
-				uniq_name.truncate(BaseObject::ObjectNameMaxLength - id.size() - 1);
-
-							 //Append the id of the object on its name (this is not applied to operators)
-				if(obj_type != ObjectType::Operator)
-					uniq_name += "_" + id;
-			}
-
-			aux_obj = (*itr);
-			itr++;
-
-			if(discard_input_obj && aux_obj == obj)
+			if((discard_input_obj && aux_obj == obj) ||
+				 (comp_sch_names && aux_obj->getSchema() != obj->getSchema()))
 				continue;
 
-						 //If a conflicting object is found
-			if(aux_obj->getName() == uniq_name &&
-					((!comp_sch_names) ||
-					 (comp_sch_names && aux_obj->getSchema() == obj->getSchema())))
-			{
-				//For operators is appended a '?' on the name
-				if(obj_type == ObjectType::Operator)
-					uniq_name = QString("%1%2").arg(obj_name, QString("").leftJustified(counter++, oper_uniq_chr));
-				else
-				{
-					uniq_name = QString("%1%2%3")
-													.arg(obj_name,
-																use_suf_on_conflict ? suffix : "",
-																use_suf_on_conflict && counter == 0 ? "" : QString::number(counter));
-					counter++;
-				}
-
-				itr = obj_vector.begin();
-			}
+			used_names.insert(aux_obj->getName());
 		}
 
-		return uniq_name;
+		return generateUniqueName(obj, used_names, suffix, use_suf_on_conflict);
 	}
 }
 
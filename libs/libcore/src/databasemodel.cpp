@@ -26,9 +26,20 @@
 #include <random>
 #include "utilsns.h"
 #include "doublenan.h"
+#include "tracer.h"
+#include <QThreadPool>
+#include <QThread>
+#include <QMutex>
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <atomic>
+#include <unordered_set>
 
 unsigned DatabaseModel::dbmodel_id {2000};
 
+const QString DatabaseModel::DataDictManifest {"datadict-manifest.json"};
+
 DatabaseModel::DatabaseModel()
 {
 	this->model_wgt=nullptr;
@@ -42,6 +53,7 @@ DatabaseModel::DatabaseModel()
 
 	is_layer_names_visible = is_layer_rects_visible = false;
 	persist_changelog = false;
+	snapshot_db_oid = 0;
 	is_template = false;
 	allow_conns = true;
 	cancel_saving = false;
@@ -70,6 +82,7 @@ DatabaseModel::DatabaseModel()
 	attributes[Attributes::IsTemplate]="";
 	attributes[Attributes::UseChangelog]="";
 	attributes[Attributes::Changelog]="";
+	attributes[Attributes::CatalogSnapshot]="";
 	attributes[Attributes::GenDisabledObjsCode]="";
 
 	obj_lists = {
@@ -484,6 +497,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	}
 
 	object->setDatabase(this);
+	indexObject(object);
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
 }
@@ -547,8 +561,24 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 			removePermissions(object);
 
 		obj_list->erase(obj_list->begin() + obj_idx);
+
+		if(obj_type == ObjectType::Permission)
+		{
+			Permission *perm = dynamic_cast<Permission *>(object);
+			auto itr = obj_perms.find(perm->getObject());
+
+			if(itr != obj_perms.end())
+			{
+				std::vector<Permission *> &perms = itr->second;
+				perms.erase(std::remove(perms.begin(), perms.end(), perm), perms.end());
+
+				if(perms.empty())
+					obj_perms.erase(itr);
+			}
+		}
 	}
 
+	unindexObject(object);
 	object->clearAllDepsRefs();
 	object->setDatabase(nullptr);
 	emit s_objectRemoved(object);
@@ -565,6 +595,48 @@ std::vector<BaseObject *> DatabaseModel::getObjects(ObjectType obj_type, BaseObj
 	if(!obj_list)
 		throw Exception(ErrorCode::ObtObjectInvalidType,PGM_FUNC,PGM_FILE,PGM_LINE);
 
+	// Tables, foreign tables and views are retrieved directly from the schema's children index
+	if(BaseTable::isBaseTable(obj_type))
+	{
+		auto sch_itr = sch_children.find(schema);
+
+		if(sch_itr != sch_children.end())
+		{
+			std::copy_if(sch_itr->second.begin(), sch_itr->second.end(), std::back_inserter(sel_list),
+									 [obj_type](BaseObject *obj){
+										 return obj->getObjectType() == obj_type;
+									 });
+		}
+
+		return sel_list;
+	}
+
+	// Relationships are retrieved from the relationships connected to the schema's children
+	if(obj_type == ObjectType::Relationship || obj_type == ObjectType::BaseRelationship)
+	{
+		auto sch_itr = sch_children.find(schema);
+		std::unordered_set<BaseRelationship *> sel_rels;
+
+		if(sch_itr == sch_children.end())
+			return sel_list;
+
+		for(auto &obj : sch_itr->second)
+		{
+			auto tab_itr = table_rels.find(dynamic_cast<BaseTable *>(obj));
+
+			if(tab_itr == table_rels.end())
+				continue;
+
+			for(auto &tab_rel : tab_itr->second)
+			{
+				if(tab_rel->getObjectType() == obj_type && sel_rels.insert(tab_rel).second)
+					sel_list.push_back(tab_rel);
+			}
+		}
+
+		return sel_list;
+	}
+
 	itr=obj_list->begin();
 	itr_end=obj_list->end();
 
@@ -871,6 +943,11 @@ void DatabaseModel::destroyObjects()
 		delete perm;
 
 	permissions.clear();
+	obj_perms.clear();
+	table_rels.clear();
+	rel_tables.clear();
+	sch_children.clear();
+	obj_schemas.clear();
 
 	for(auto &inv_obj : invalid_special_objs)
 		delete inv_obj;
@@ -1678,6 +1755,158 @@ void DatabaseModel::updateTablesFKRelationships()
 	}
 }
 
+Table *DatabaseModel::cloneTable(Table *table, bool incl_rel_added_objs)
+{
+	if(!table)
+		throw Exception(ErrorCode::OprNotAllocatedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	if(table->isPartitioned())
+		return nullptr;
+
+	Table *clone = nullptr;
+	Column *col = nullptr, *col_clone = nullptr;
+	Constraint *constr = nullptr, *constr_clone = nullptr;
+	BaseObject *ref_schema = nullptr, *ref_owner = nullptr, *ref_tabspc = nullptr, *ref_tag = nullptr,
+			*ref_coll = nullptr, *ref_seq = nullptr, *usr_type = nullptr;
+	std::map<Column *, Column *> cloned_cols;
+	std::vector<Column *> constr_cols;
+	PgSqlType type;
+	bool remapped = true;
+
+	/* Returns the object in this model that has the same signature and type of the
+	 * provided object. If the reference can't be resolved the flag remapped is unset */
+	auto remap = [this, &remapped](BaseObject *object) -> BaseObject * {
+		if(!object || object->getDatabase() == this)
+			return object;
+
+		BaseObject *rcv_obj = getObject(object->getSignature(), object->getObjectType());
+
+		if(!rcv_obj)
+			remapped = false;
+
+		return rcv_obj;
+	};
+
+	ref_schema = remap(table->getSchema());
+	ref_owner = remap(table->getOwner());
+	ref_tabspc = remap(table->getTablespace());
+	ref_tag = remap(table->getTag());
+
+	if(!remapped)
+		return nullptr;
+
+	try
+	{
+		clone = new Table;
+		(*clone) = (*table);
+
+		clone->setSchema(ref_schema);
+		clone->setOwner(ref_owner);
+		clone->setTablespace(ref_tabspc);
+		clone->setTag(dynamic_cast<Tag *>(ref_tag));
+		clone->setCollapseMode(table->getCollapseMode());
+		clone->setPaginationEnabled(table->isPaginationEnabled());
+		clone->setCurrentPage(BaseTable::AttribsSection, table->getCurrentPage(BaseTable::AttribsSection));
+		clone->setCurrentPage(BaseTable::ExtAttribsSection, table->getCurrentPage(BaseTable::ExtAttribsSection));
+		clone->setFadedOut(table->isFadedOut());
+		clone->setObjectListsCapacity(table->getMaxObjectCount());
+
+		for(auto &tab_obj : *table->getObjectList(ObjectType::Column))
+		{
+			col = dynamic_cast<Column *>(tab_obj);
+
+			if(col->isAddedByRelationship() && !incl_rel_added_objs)
+				continue;
+
+			type = col->getType();
+			ref_coll = remap(col->getCollation());
+			ref_seq = remap(col->getSequence());
+			usr_type = type.isUserType() ? remap(type.getObject()) : nullptr;
+
+			if(!remapped)
+			{
+				delete clone;
+				return nullptr;
+			}
+
+			col_clone = new Column;
+			(*col_clone) = (*col);
+			cloned_cols[col] = col_clone;
+			col_clone->setParentRelationship(nullptr);
+			col_clone->setParentTable(clone);
+			col_clone->setCollation(ref_coll);
+			col_clone->setSequence(ref_seq);
+
+			if(usr_type && usr_type != type.getObject())
+			{
+				col_clone->setType(PgSqlType(usr_type, type.getDimension(), type.getLength(),
+																		 type.getPrecision(), type.isWithTimezone(),
+																		 type.getIntervalType(), type.getSpatialType()));
+			}
+
+			clone->addObject(col_clone);
+		}
+
+		/* Only the constraints that are written in the table's XML code are cloned (see PhysicalTable::setConstraintsAttribute()),
+		 * the foreign keys are handled as separated objects by the callers */
+		for(auto &tab_obj : *table->getObjectList(ObjectType::Constraint))
+		{
+			constr = dynamic_cast<Constraint *>(tab_obj);
+
+			if(constr->getConstraintType() == ConstraintType::ForeignKey || constr->isAddedByRelationship() ||
+				 (constr->getConstraintType() != ConstraintType::PrimaryKey && constr->isReferRelationshipAddedColumns()))
+				continue;
+
+			if(constr->getConstraintType() == ConstraintType::Exclude)
+			{
+				delete clone;
+				return nullptr;
+			}
+
+			constr_cols.clear();
+
+			for(auto &src_col : constr->getColumns(Constraint::SourceCols))
+			{
+				// Constraints referencing columns that weren't cloned can't be copied directly
+				if(!cloned_cols.count(src_col))
+				{
+					delete clone;
+					return nullptr;
+				}
+
+				constr_cols.push_back(cloned_cols[src_col]);
+			}
+
+			ref_tabspc = remap(constr->getTablespace());
+
+			if(!remapped)
+			{
+				delete clone;
+				return nullptr;
+			}
+
+			constr_clone = new Constraint;
+			(*constr_clone) = (*constr);
+
+			// Replacing the original columns without touching their not-null state (see Constraint::removeColumns())
+			constr_clone->addColumns(constr_cols, Constraint::SourceCols);
+			constr_clone->setParentTable(clone);
+			constr_clone->setTablespace(ref_tabspc);
+			clone->addObject(constr_clone);
+		}
+
+		clone->setGenerateAlterCmds(table->isGenerateAlterCmds());
+		clone->setProtected(table->isProtected());
+
+		return clone;
+	}
+	catch(Exception &e)
+	{
+		delete clone;
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE,&e);
+	}
+}
+
 void DatabaseModel::restoreFKRelationshipLayers()
 {
 	BaseRelationship *rel = nullptr;
@@ -1906,6 +2135,8 @@ void DatabaseModel::updateRelsGeneratedObjects()
 
 bool DatabaseModel::validateRelationships()
 {
+	PGM_TRACE_SCOPE("model", "DatabaseModel::validateRelationships");
+
 	Relationship *rel = nullptr;
 	BaseRelationship *base_rel = nullptr;
 	std::vector<Exception> errors;
@@ -2484,71 +2715,151 @@ BaseRelationship *DatabaseModel::getRelationship(const QString &name)
 
 BaseRelationship *DatabaseModel::getRelationship(BaseTable *src_tab, BaseTable *dst_tab, Constraint *ref_fk)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	std::vector<BaseObject *> rel_list;
-	BaseRelationship *rel=nullptr;
-	bool found=false, search_uniq_tab=false;
 	BaseTable *tab1=nullptr, *tab2=nullptr;
+	bool search_uniq_tab=false, only_base_rels=false;
+
+	if(!src_tab)
+		return nullptr;
 
-	if(src_tab)
+	if(!dst_tab)
 	{
-		if(!dst_tab)
-		{
-			dst_tab=src_tab;
-			search_uniq_tab=true;
-		}
+		dst_tab=src_tab;
+		search_uniq_tab=true;
+	}
 
-		if(ref_fk || src_tab->getObjectType()==ObjectType::View || dst_tab->getObjectType()==ObjectType::View)
-		{
-			itr=base_relationships.begin();
-			itr_end=base_relationships.end();
-		}
-		else
-		{
-			rel_list.assign(base_relationships.begin(), base_relationships.end());
-			rel_list.insert(rel_list.end(), relationships.begin(), relationships.end());
-			itr=rel_list.begin();
-			itr_end=rel_list.end();
-		}
+	auto itr = table_rels.find(src_tab);
 
-		while(itr!=itr_end && !found)
+	if(itr == table_rels.end())
+		return nullptr;
+
+	only_base_rels = ref_fk || src_tab->getObjectType()==ObjectType::View || dst_tab->getObjectType()==ObjectType::View;
+
+	/* The base relationships (fk, generalization/dependency/partitioning and table-view relationships)
+	 * have precedence over the table-table relationships, so they are checked first */
+	for(auto &rel_type : { ObjectType::BaseRelationship, ObjectType::Relationship })
+	{
+		if(rel_type == ObjectType::Relationship && only_base_rels)
+			break;
+
+		for(auto &rel : itr->second)
 		{
-			rel=dynamic_cast<BaseRelationship *>(*itr);
+			if(rel->getObjectType() != rel_type)
+				continue;
+
 			tab1=rel->getTable(BaseRelationship::SrcTable);
 			tab2=rel->getTable(BaseRelationship::DstTable);
 
-			found=((!ref_fk || (ref_fk && rel->getReferenceForeignKey() == ref_fk)) &&
-						 ((tab1==src_tab && tab2==dst_tab) ||
-							(tab2==src_tab && tab1==dst_tab) ||
-							(search_uniq_tab && (tab1==src_tab || tab2==src_tab))));
-
-			if(!found)
-			{ rel=nullptr; itr++; }
+			if((!ref_fk || (ref_fk && rel->getReferenceForeignKey() == ref_fk)) &&
+				 ((tab1==src_tab && tab2==dst_tab) ||
+					(tab2==src_tab && tab1==dst_tab) ||
+					(search_uniq_tab && (tab1==src_tab || tab2==src_tab))))
+				return rel;
 		}
 	}
 
-	return rel;
+	return nullptr;
 }
 
 std::vector<BaseRelationship *> DatabaseModel::getRelationships(BaseTable *tab)
 {
-	std::vector<BaseRelationship *> aux_rels;
-	std::vector<BaseObject *> rels;
-	BaseRelationship *base_rel=nullptr;
+	auto itr = table_rels.find(tab);
+
+	if(itr == table_rels.end())
+		return std::vector<BaseRelationship *>();
+
+	return itr->second;
+}
+
+void DatabaseModel::indexObject(BaseObject *object)
+{
+	BaseRelationship *rel = dynamic_cast<BaseRelationship *>(object);
+
+	if(rel)
+	{
+		BaseTable *src_tab = rel->getTable(BaseRelationship::SrcTable),
+				*dst_tab = rel->getTable(BaseRelationship::DstTable);
+
+		rel_tables[rel] = { src_tab, dst_tab };
+
+		if(src_tab)
+			table_rels[src_tab].push_back(rel);
+
+		//Self relationships are indexed only once
+		if(dst_tab && dst_tab != src_tab)
+			table_rels[dst_tab].push_back(rel);
+	}
+	else if(BaseTable::isBaseTable(object->getObjectType()))
+	{
+		obj_schemas[object] = object->getSchema();
+		sch_children[object->getSchema()].push_back(object);
+	}
+}
+
+void DatabaseModel::unindexObject(BaseObject *object)
+{
+	auto remove_item = [](auto &index, auto key, auto item) {
+		auto itr = index.find(key);
+
+		if(itr == index.end())
+			return;
+
+		itr->second.erase(std::remove(itr->second.begin(), itr->second.end(), item), itr->second.end());
 
-	rels=base_relationships;
-	rels.insert(rels.end(), relationships.begin(), relationships.end());
+		if(itr->second.empty())
+			index.erase(itr);
+	};
+
+	BaseRelationship *rel = dynamic_cast<BaseRelationship *>(object);
 
-	for(auto &obj : rels)
+	if(rel)
 	{
-		base_rel=dynamic_cast<BaseRelationship *>(obj);
+		auto itr = rel_tables.find(rel);
+
+		if(itr == rel_tables.end())
+			return;
 
-		if(base_rel->getTable(BaseRelationship::SrcTable)==tab ||
-			 base_rel->getTable(BaseRelationship::DstTable)==tab)
-			aux_rels.push_back(base_rel);
+		remove_item(table_rels, itr->second.first, rel);
+		remove_item(table_rels, itr->second.second, rel);
+		rel_tables.erase(itr);
 	}
+	else
+	{
+		auto itr = obj_schemas.find(object);
+
+		if(itr == obj_schemas.end())
+			return;
 
-	return aux_rels;
+		remove_item(sch_children, itr->second, object);
+		obj_schemas.erase(itr);
+	}
+}
+
+void DatabaseModel::updateObjectIndexes(BaseObject *object)
+{
+	BaseRelationship *rel = dynamic_cast<BaseRelationship *>(object);
+	bool reindex = false;
+
+	/* Only the objects already indexed are updated, this way, copies of the objects (e.g. the ones stored
+	 * in the operation history) that still reference the database are ignored */
+	if(rel)
+	{
+		auto itr = rel_tables.find(rel);
+
+		reindex = itr != rel_tables.end() &&
+							(itr->second.first != rel->getTable(BaseRelationship::SrcTable) ||
+							 itr->second.second != rel->getTable(BaseRelationship::DstTable));
+	}
+	else
+	{
+		auto itr = obj_schemas.find(object);
+		reindex = itr != obj_schemas.end() && itr->second != object->getSchema();
+	}
+
+	if(reindex)
+	{
+		unindexObject(object);
+		indexObject(object);
+	}
 }
 
 void DatabaseModel::addTextbox(Textbox *txtbox, int obj_idx)
@@ -3144,7 +3455,7 @@ void DatabaseModel::addPermission(Permission *perm)
 
 		TableObject *tab_obj=dynamic_cast<TableObject *>(perm->getObject());
 
-		if(getPermissionIndex(perm, false) >=0)
+		if(getDuplicatedPermission(perm, false))
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedPermission)
 											.arg(perm->getObject()->getName())
@@ -3152,8 +3463,10 @@ void DatabaseModel::addPermission(Permission *perm)
 											ErrorCode::AsgDuplicatedPermission, PGM_FUNC, PGM_FILE, PGM_LINE);
 		}
 		
-		//Raises an error if the permission is referencing an object that does not exists on model
-		if(perm->getObject() != this &&
+		/* Raises an error if the permission is referencing an object that does not exists on model.
+		 * If the object already has permissions the check is skipped since it was made when the first
+		 * permission was added (the permissions are removed together with the object they reference) */
+		if(perm->getObject() != this && obj_perms.count(perm->getObject()) == 0 &&
 			((tab_obj && (getObjectIndex(tab_obj->getParentTable()) < 0)) ||
 	 		(!tab_obj && (getObjectIndex(perm->getObject()) < 0))))
 		{
@@ -3166,6 +3479,7 @@ void DatabaseModel::addPermission(Permission *perm)
 		}
 
 		permissions.push_back(perm);
+		obj_perms[perm->getObject()].push_back(perm);
 		perm->setDatabase(this);
 		perm->updateDependencies();
 	}
@@ -3197,126 +3511,107 @@ void DatabaseModel::removePermission(Permission *perm)
 
 void DatabaseModel::removePermissions(BaseObject *object)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-	unsigned idx=0;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	auto itr = obj_perms.find(object);
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
+	if(itr == obj_perms.end())
+		return;
 
-		if(perm->getObject()==object)
-		{
-			invalid_special_objs.push_back(perm);
+	std::vector<Permission *> perms = std::move(itr->second);
 
-			permissions.erase(itr);
-			itr=itr_end=permissions.end();
+	obj_perms.erase(itr);
 
-			if(!permissions.empty())
-				itr=permissions.begin() + idx;
-		}
-		else
-		{ itr++; idx++; }
-	}
+	for(auto &perm : perms)
+		invalid_special_objs.push_back(perm);
+
+	permissions.erase(std::remove_if(permissions.begin(), permissions.end(), [&perms](BaseObject *obj){
+											return std::find(perms.begin(), perms.end(), obj) != perms.end();
+										}), permissions.end());
 }
 
 void DatabaseModel::getPermissions(BaseObject *object, std::vector<Permission *> &perms)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	auto itr = obj_perms.find(object);
 
 	perms.clear();
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
-
-		if(perm->getObject()==object)
-			perms.push_back(perm);
-
-		itr++;
-	}
+	if(itr != obj_perms.end())
+		perms = itr->second;
 }
 
-int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
+Permission *DatabaseModel::getDuplicatedPermission(Permission *perm, bool exact_match)
 {
-	int perm_idx=-1;
+	if(!perm)
+		return nullptr;
 
-	if(perm)
-	{
-		Permission *perm_aux=nullptr;
-		std::vector<BaseObject *>::iterator itr, itr_end;
+	BaseObject *object = perm->getObject();
+	auto itr = obj_perms.find(object);
 
-		itr=permissions.begin();
-		itr_end=permissions.end();
+	if(exact_match)
+	{
+		if(itr != obj_perms.end())
+		{
+			for(auto &perm_aux : itr->second)
+			{
+				if(perm->isSimilarTo(perm_aux))
+					return perm_aux;
+			}
+		}
 
-		if(exact_match)
+		/* Permissions of objects from other models (e.g. during the diff) are
+		 * compared by the objects' signatures so the whole list needs to be checked */
+		if(object && object->getDatabase() != this)
 		{
-			while(itr!=itr_end)
+			for(auto &obj : permissions)
 			{
-				perm_aux=dynamic_cast<Permission *>(*itr);
+				Permission *perm_aux = dynamic_cast<Permission *>(obj);
 
 				if(perm->isSimilarTo(perm_aux))
-				{
-					perm_idx=itr-permissions.begin();
-					break;
-				}
-
-				itr++;
+					return perm_aux;
 			}
 		}
-		else
-		{
-			BaseObject *object=nullptr;
-			Role *role=nullptr;
-			unsigned count, i;
-			bool ref_role=false;
 
-			object=perm->getObject();
+		return nullptr;
+	}
 
-			while(itr!=itr_end)
-			{
-				perm_aux=dynamic_cast<Permission *>(*itr);
+	if(itr == obj_perms.end())
+		return nullptr;
 
-				/* When the object of the auxiliary permission is the same as the
-		   specified permission it will be check if the existant roles are
-		   the same on both permissions */
-				if(object==perm_aux->getObject())
-				{
-					count=perm->getRoleCount();
+	std::vector<Role *> roles = perm->getRoles();
+	std::unordered_set<Role *> perm_roles(roles.begin(), roles.end());
 
-					for(i=0; i < count && !ref_role; i++)
-					{
-						role=perm->getRole(i);
-						ref_role=perm_aux->isRoleExists(role);
-					}
-				}
+	for(auto &perm_aux : itr->second)
+	{
+		if(perm == perm_aux)
+			return perm_aux;
 
-				//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
-				if(perm==perm_aux || (ref_role && perm->isRevoke()==perm_aux->isRevoke()))
-				{
-					perm_idx=itr-permissions.begin();
-					break;
-				}
+		//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
+		if(perm->isRevoke() != perm_aux->isRevoke())
+			continue;
 
-				itr++;
-			}
+		for(auto &role : perm_aux->getRoles())
+		{
+			if(perm_roles.count(role))
+				return perm_aux;
 		}
 	}
 
-	return perm_idx;
+	return nullptr;
+}
+
+int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
+{
+	Permission *perm_aux = getDuplicatedPermission(perm, exact_match);
+
+	if(!perm_aux)
+		return -1;
+
+	return std::find(permissions.begin(), permissions.end(), perm_aux) - permissions.begin();
 }
 
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type)
@@ -3384,6 +3679,8 @@ void DatabaseModel::loadModel(const QString &filename)
 	if(filename.isEmpty())
 		return;
 
+	PGM_TRACE_SCOPE("model", "DatabaseModel::loadModel");
+
 	BaseGraphicObject::setUpdatesEnabled(false);
 
 	QString dtd_file, str_aux, elem_name;
@@ -3551,6 +3848,37 @@ void DatabaseModel::loadModel(const QString &filename)
 
 						xmlparser.restorePosition();
 					}
+					else if(elem_name == Attributes::CatalogSnapshot)
+					{
+						attribs_map entry_attr;
+						ObjectType entry_type;
+
+						xmlparser.getElementAttributes(entry_attr);
+						snapshot_db_oid = entry_attr[Attributes::Database].toUInt();
+						xmlparser.savePosition();
+
+						if(xmlparser.accessElement(XmlParser::ChildElement))
+						{
+							do
+							{
+								if(xmlparser.getElementType() != XML_ELEMENT_NODE)
+									continue;
+
+								xmlparser.getElementAttributes(entry_attr);
+								entry_type = BaseObject::getObjectType(entry_attr[Attributes::Type]);
+
+								if(entry_type != ObjectType::BaseObject)
+								{
+									catalog_snapshot[entry_attr[Attributes::Oid].toUInt()] =
+											std::make_tuple(entry_type, entry_attr[Attributes::Signature],
+																			entry_attr[Attributes::Parent], entry_attr[Attributes::Value]);
+								}
+							}
+							while(xmlparser.accessElement(XmlParser::NextElement));
+						}
+
+						xmlparser.restorePosition();
+					}
 					else if(obj_type==ObjectType::Database)
 					{
 						xmlparser.getElementAttributes(attribs);
@@ -7476,6 +7804,8 @@ Permission *DatabaseModel::createPermission()
 
 void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab)
 {
+	PGM_TRACE_SCOPE("model", "DatabaseModel::validateRelationships(TableObject *, Table *)");
+
 	try
 	{
 		bool revalidate_rels=false, ref_tab_inheritance=false;
@@ -7859,6 +8189,7 @@ void DatabaseModel::setDatabaseModelAttributes(attribs_map &attribs, SchemaParse
 			//Configuring the changelog attributes when generating XML code
 			attribs[Attributes::UseChangelog] = persist_changelog ? Attributes::True : Attributes::False;
 			attribs[Attributes::Changelog] = persist_changelog ? getChangelogDefinition() : "";
+			attribs[Attributes::CatalogSnapshot] = getCatalogSnapshotDefinition();
 			attribs[Attributes::GenDisabledObjsCode]= gen_dis_objs_code ? Attributes::True : Attributes::False;
 			attribs[Attributes::ShowSysSchemasRects]= show_sys_sch_rects ? Attributes::True : Attributes::False;
 		}
@@ -7902,6 +8233,7 @@ void DatabaseModel::setDatabaseModelAttributes(attribs_map &attribs, SchemaParse
 
 std::map<unsigned, BaseObject *> DatabaseModel::getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs, bool incl_rel1n_constrs, bool realloc_fk_perms)
 {
+	PGM_TRACE_SCOPE("model", "DatabaseModel::getCreationOrder");
 	std::vector<BaseObject *> fkeys, fk_rels, aux_tables;
 	std::vector<BaseObject *> *obj_list = nullptr;
 	std::map<unsigned, BaseObject *> objects_map;
@@ -8122,6 +8454,7 @@ std::map<unsigned, BaseObject *> DatabaseModel::getCreationOrder(SchemaParser::C
 
 std::vector<BaseObject *> DatabaseModel::getCreationOrder(BaseObject *object, bool only_children)
 {
+	PGM_TRACE_SCOPE("model", "DatabaseModel::getCreationOrder(BaseObject *)");
 	if(!object)
 		return {};
 
@@ -9964,6 +10297,28 @@ void DatabaseModel::clearChangelog()
 	changelog.clear();
 }
 
+void DatabaseModel::setCatalogSnapshot(unsigned db_oid, const std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>> &snapshot)
+{
+	snapshot_db_oid = db_oid;
+	catalog_snapshot = snapshot;
+}
+
+const std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>> &DatabaseModel::getCatalogSnapshot()
+{
+	return catalog_snapshot;
+}
+
+unsigned DatabaseModel::getCatalogSnapshotDatabase()
+{
+	return snapshot_db_oid;
+}
+
+void DatabaseModel::clearCatalogSnapshot()
+{
+	catalog_snapshot.clear();
+	snapshot_db_oid = 0;
+}
+
 QDateTime DatabaseModel::getLastChangelogDate()
 {
 	return changelog.empty() ?
@@ -10148,25 +10503,19 @@ TableClass *DatabaseModel::createPhysicalTable()
 	return table;
 }
 
-void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, bool split, bool md_format)
+void DatabaseModel::getDataDictionaryTables(std::map<QString, BaseTable *> &tabs_map, QStringList &dict_index_list)
 {
-	int idx = 0;
-	BaseTable *base_tab = nullptr;
 	std::vector<BaseObject *> objects;
-	std::map<QString, BaseObject *> objs_map;
-	QString styles, id, dict_index;
-	attribs_map attribs, aux_attribs;
-	QStringList dict_index_list;
-	QString dict_ext = md_format ? ".md" : ".html",
-			dict_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, GlobalAttributes::DataDictSchemaDir),
-			item_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, Attributes::Item),
-			dict_idx_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, Attributes::DataDictIndex);
+	QString id;
 
 	objects.assign(tables.begin(), tables.end());
 	objects.insert(objects.end(), foreign_tables.begin(), foreign_tables.end());
 	objects.insert(objects.end(), views.begin(), views.end());
 	objects.insert(objects.end(), relationships.begin(), relationships.end());
 
+	tabs_map.clear();
+	dict_index_list.clear();
+
 	// Placing the objects in alphabectical order
 	for(auto &obj : objects)
 	{
@@ -10182,11 +10531,88 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 		}
 
 		id = obj->getSignature().remove(QChar('"'));
-		objs_map[id] = obj;
+		tabs_map[id] = dynamic_cast<BaseTable *>(obj);
 		dict_index_list.push_back(id);
 	}
 
 	dict_index_list.sort();
+}
+
+attribs_map DatabaseModel::getDataDictionaryAttribs(BaseTable *base_tab, bool browsable, bool md_format, const QString &prev_item, const QString &next_item)
+{
+	attribs_map attribs;
+
+	attribs[Attributes::DataDictIndex] = browsable ? Attributes::True : "";
+	attribs[Attributes::Previous] = prev_item;
+	attribs[Attributes::Next] = next_item;
+	attribs[Attributes::Sequences] = "";
+
+	if(base_tab->getObjectType() != ObjectType::View)
+	{
+		Column *col = nullptr;
+		std::vector<TableObject *> *cols = dynamic_cast<PhysicalTable *>(base_tab)->getObjectList(ObjectType::Column);
+		std::map<Sequence *, QStringList> col_seqs;
+
+		for(auto & itr : *cols)
+		{
+			col = dynamic_cast<Column *>(itr);
+
+			if(col->getSequence())
+				col_seqs[dynamic_cast<Sequence *>(col->getSequence())].append(col->getName());
+		}
+
+		for(auto &itr : col_seqs)
+		{
+			attribs[Attributes::Sequences] +=
+					itr.first->getDataDictionary(md_format, {{ Attributes::Columns, itr.second.join(", ") }});
+		}
+	}
+
+	return attribs;
+}
+
+QString DatabaseModel::getDataDictionaryIndex(std::map<QString, BaseTable *> &tabs_map, const QStringList &dict_index_list,
+																							bool split, bool md_format, const QString &date, const QString &year)
+{
+	attribs_map idx_attribs, item_attribs;
+	QString item_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, Attributes::Item),
+			dict_idx_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, Attributes::DataDictIndex);
+
+	idx_attribs[BaseObject::getSchemaName(ObjectType::Table)] = "";
+	idx_attribs[BaseObject::getSchemaName(ObjectType::View)] = "";
+	idx_attribs[BaseObject::getSchemaName(ObjectType::ForeignTable)] = "";
+	idx_attribs[Attributes::Year] = year;
+	idx_attribs[Attributes::Date] = date;
+	idx_attribs[Attributes::Styles] = "";
+	idx_attribs[Attributes::Version] = GlobalAttributes::PgModelerVersion;
+
+	// Generating the index items
+	for(auto &item : dict_index_list)
+	{
+		item_attribs[Attributes::Split] = split ? Attributes::True : "";
+		item_attribs[Attributes::Item] = item;
+		idx_attribs[tabs_map[item]->getSchemaName()] += schparser.getSourceCode(item_sch_file, item_attribs);
+	}
+
+	idx_attribs[Attributes::Name] = this->obj_name;
+	idx_attribs[Attributes::Split] = split ? Attributes::True : "";
+
+	schparser.ignoreEmptyAttributes(true);
+	return schparser.getSourceCode(dict_idx_sch_file, idx_attribs);
+}
+
+void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, bool split, bool md_format)
+{
+	int idx = 0;
+	BaseTable *base_tab = nullptr;
+	std::map<QString, BaseTable *> tabs_map;
+	QString styles, id, dict_index;
+	attribs_map attribs;
+	QStringList dict_index_list;
+	QString dict_ext = md_format ? ".md" : ".html",
+			dict_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, GlobalAttributes::DataDictSchemaDir);
+
+	getDataDictionaryTables(tabs_map, dict_index_list);
 	datadict.clear();
 
 	attribs[Attributes::Styles] = "";
@@ -10210,49 +10636,22 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 	}
 
 	// Generating individual data dictionaries
-	for(auto &itr : objs_map)
+	for(auto &itr : tabs_map)
 	{
-		base_tab = dynamic_cast<BaseTable *>( itr.second);
-
-		// Generate the individual data dictionaries
-		aux_attribs[Attributes::DataDictIndex] = browsable ? Attributes::True : "";
-		aux_attribs[Attributes::Previous] = idx - 1 >= 0 ? dict_index_list.at(idx - 1) : "";
-		aux_attribs[Attributes::Next] = (++idx <= dict_index_list.size() - 1) ? dict_index_list.at(idx) : "";	
-
-		if(base_tab->getObjectType() != ObjectType::View)
-		{
-			Column *col = nullptr;
-			std::vector<TableObject *> *cols = dynamic_cast<PhysicalTable *>(base_tab)->getObjectList(ObjectType::Column);
-			std::map<Sequence *, QStringList> col_seqs;
-
-			aux_attribs[Attributes::Sequences] = "";
-
-			for(auto & itr : *cols)
-			{
-				col = dynamic_cast<Column *>(itr);
-
-				if(col->getSequence())
-					col_seqs[dynamic_cast<Sequence *>(col->getSequence())].append(col->getName());
-			}
+		base_tab = itr.second;
 
-			for(auto &itr : col_seqs)
-			{
-				aux_attribs[Attributes::Sequences] +=
-						itr.first->getDataDictionary(md_format, {{ Attributes::Columns, itr.second.join(", ") }});
-			}
-
-			col_seqs.clear();
-		}
-		else
-			aux_attribs[Attributes::Sequences] = "";
-
-		attribs[Attributes::Objects] += base_tab->getDataDictionary(split, md_format, aux_attribs);
+		attribs[Attributes::Objects] +=
+				base_tab->getDataDictionary(split, md_format,
+																		getDataDictionaryAttribs(base_tab, browsable, md_format,
+																														 idx - 1 >= 0 ? dict_index_list.at(idx - 1) : "",
+																														 idx + 1 < dict_index_list.size() ? dict_index_list.at(idx + 1) : ""));
+		idx++;
 
 		// If the generation is configured to be splitted we generate a complete HTML file for the current table
 		if(split && !attribs[Attributes::Objects].isEmpty())
 		{
 			id = itr.first + dict_ext;
-			schparser.ignoreEmptyAttributes(true);			
+			schparser.ignoreEmptyAttributes(true);
 			datadict[id] = schparser.getSourceCode(dict_sch_file, attribs);
 			attribs[Attributes::Objects].clear();
 		}
@@ -10261,29 +10660,8 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 	// If the data dictionary is browsable we proceed with the index generation
 	if(browsable)
 	{
-		attribs_map idx_attribs;
-
-		idx_attribs[BaseObject::getSchemaName(ObjectType::Table)] = "";
-		idx_attribs[BaseObject::getSchemaName(ObjectType::View)] = "";
-		idx_attribs[BaseObject::getSchemaName(ObjectType::ForeignTable)] = "";
-		idx_attribs[Attributes::Year] = attribs[Attributes::Year];
-		idx_attribs[Attributes::Date] = attribs[Attributes::Date];
-		idx_attribs[Attributes::Styles] = "";
-		idx_attribs[Attributes::Version] = GlobalAttributes::PgModelerVersion;
-
-		// Generating the index items
-		for(auto &item : dict_index_list)
-		{
-			aux_attribs[Attributes::Split] = attribs[Attributes::Split];
-			aux_attribs[Attributes::Item] = item;
-			idx_attribs[objs_map[item]->getSchemaName()] += schparser.getSourceCode(item_sch_file, aux_attribs);
-		}
-
-		idx_attribs[Attributes::Name] = this->obj_name;
-		idx_attribs[Attributes::Split] = attribs[Attributes::Split];
-
-		schparser.ignoreEmptyAttributes(true);
-		dict_index = schparser.getSourceCode(dict_idx_sch_file, idx_attribs);
+		dict_index = getDataDictionaryIndex(tabs_map, dict_index_list, split, md_format,
+																				attribs[Attributes::Date], attribs[Attributes::Year]);
 	}
 
 	// If the data dictionary is browsable and splitted the index goes into a separated file
@@ -10297,7 +10675,7 @@ void DatabaseModel::getDataDictionary(attribs_map &datadict, bool browsable, boo
 	}
 }
 
-void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool split, bool md_format)
+void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool split, bool md_format, bool incremental)
 {
 	try
 	{
@@ -10305,7 +10683,6 @@ void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool
 		QByteArray buffer;
 		QFileInfo finfo(path);
 		QDir dir;
-		QString filename;
 
 		if(split)
 		{
@@ -10315,18 +10692,17 @@ void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool
 
 			if(!finfo.exists())
 				dir.mkpath(path);
+
+			saveSplitDataDictionary(path, browsable, md_format, incremental);
+			return;
 		}
 
 		getDataDictionary(datadict, browsable, split, md_format);
-		filename = path;
 
 		for(auto &itr : datadict)
 		{
-			if(split)
-				filename = path + GlobalAttributes::DirSeparator + itr.first;
-
 			buffer.append(itr.second.toUtf8());
-			UtilsNs::saveFile(filename, buffer);
+			UtilsNs::saveFile(path, buffer);
 			buffer.clear();
 		}
 	}
@@ -10336,6 +10712,225 @@ void DatabaseModel::saveDataDictionary(const QString &path, bool browsable, bool
 	}
 }
 
+QString DatabaseModel::getDataDictionaryHash(BaseTable *base_tab, const attribs_map &page_attribs, const attribs_map &tab_attribs, bool md_format)
+{
+	QCryptographicHash hash(QCryptographicHash::Sha1);
+
+	/* The SQL code of the table and its children holds everything displayed in the table's page
+	 * (columns, constraints, indexes, triggers, comments, inheritance and partitioning). Since the code
+	 * is held by the code cache, computing the hash is much cheaper than rendering the page */
+	hash.addData(base_tab->getSourceCode(SchemaParser::SqlCode).toUtf8());
+
+	for(auto &child : base_tab->getObjects())
+		hash.addData(child->getSourceCode(SchemaParser::SqlCode).toUtf8());
+
+	// The attributes of the page (neighbour links, sequences, year, date placeholder) are part of the inputs too
+	for(auto attrs : { &page_attribs, &tab_attribs })
+	{
+		for(auto &[attr, value] : *attrs)
+			hash.addData(QString("%1=%2\n").arg(attr, value).toUtf8());
+	}
+
+	hash.addData(QByteArray(md_format ? "md" : "html"));
+
+	return hash.result().toHex();
+}
+
+void DatabaseModel::saveSplitDataDictionary(const QString &path, bool browsable, bool md_format, bool incremental)
+{
+	/* The date is replaced by this placeholder while rendering the files so their hashes
+	 * only change when the tables change and not every time the dictionary is generated */
+	static const QString DatePlaceholder("@@datadict-date@@");
+
+	std::map<QString, BaseTable *> tabs_map;
+	std::vector<BaseTable *> dict_tabs;
+	std::vector<attribs_map> dict_attribs;
+	std::vector<QString> dict_hashes;
+	std::vector<Exception> errors;
+	QStringList dict_index_list;
+	QJsonObject prev_manifest, manifest, files;
+	QString dict_ext = md_format ? ".md" : ".html",
+			dict_sch_file = GlobalAttributes::getDictSchemaFilePath(md_format, GlobalAttributes::DataDictSchemaDir),
+			manifest_file = path + GlobalAttributes::DirSeparator + DataDictManifest,
+			date = QDateTime::currentDateTime().toString(Qt::ISODate),
+			year = QString::number(QDate::currentDate().year());
+	attribs_map attribs;
+	std::atomic<int> gen_count = 0, skip_count = 0;
+	QThreadPool thread_pool;
+	QMutex errors_mtx;
+	int idx = 0, tab_count = 0;
+
+	cancel_saving = false;
+	getDataDictionaryTables(tabs_map, dict_index_list);
+	tab_count = tabs_map.size();
+
+	if(incremental && QFileInfo::exists(manifest_file))
+	{
+		prev_manifest = QJsonDocument::fromJson(UtilsNs::loadFile(manifest_file)).object();
+
+		/* If the previous dictionary was generated by another version or in a different format
+		 * we ignore the manifest forcing all files to be written again */
+		if(prev_manifest.value("version").toString() != GlobalAttributes::PgModelerVersion ||
+			 prev_manifest.value("format").toString() != dict_ext.mid(1))
+			prev_manifest = QJsonObject();
+	}
+
+	files = prev_manifest.value("files").toObject();
+	const QJsonObject prev_files = files;
+
+	/* Object names are cached in a lazy way by getName()/getSignature(). Since tables, schemas and sequences
+	 * can be referenced by the data dictionary of more than one table we fill those caches prior
+	 * to the parallel rendering, avoiding that two threads update the same cached name */
+	auto fill_name_cache = [](BaseObject *obj) {
+		obj->getName();
+		obj->getName(true);
+		obj->getName(true, true);
+	};
+
+	for(auto &obj : schemas)
+		fill_name_cache(obj);
+
+	for(auto &obj : sequences)
+		fill_name_cache(obj);
+
+	for(auto &itr : tabs_map)
+	{
+		fill_name_cache(itr.second);
+
+		for(auto &child : itr.second->getObjects())
+			fill_name_cache(child);
+
+		/* The sequences attached to columns are shared between tables so the attributes
+		 * of each table (which include the sequences data dictionaries) are generated here */
+		dict_tabs.push_back(itr.second);
+		dict_attribs.push_back(getDataDictionaryAttribs(itr.second, browsable, md_format,
+																										idx - 1 >= 0 ? dict_index_list.at(idx - 1) : "",
+																										idx + 1 < dict_index_list.size() ? dict_index_list.at(idx + 1) : ""));
+		idx++;
+	}
+
+	attribs[Attributes::Styles] = "";
+	attribs[Attributes::DataDictIndex] = "";
+	attribs[Attributes::Split] = Attributes::True;
+	attribs[Attributes::Year] = year;
+	attribs[Attributes::Date] = DatePlaceholder;
+	attribs[Attributes::Version] = GlobalAttributes::PgModelerVersion;
+
+	if(!md_format)
+	{
+		UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + Attributes::Styles + ".css",
+											schparser.getSourceCode(GlobalAttributes::getDictSchemaFilePath(md_format, Attributes::Styles), attribs).toUtf8());
+	}
+
+	dict_hashes.resize(dict_tabs.size());
+	thread_pool.setMaxThreadCount(QThread::idealThreadCount());
+
+	/* Each table is rendered by a worker thread that writes the resulting file as soon as it's generated.
+	 * Each worker uses its own schema parser since the one in the database model can't be shared */
+	for(unsigned tab_idx = 0; tab_idx < dict_tabs.size(); tab_idx++)
+	{
+		thread_pool.start([&, tab_idx](){
+			try
+			{
+				SchemaParser parser;
+				attribs_map tab_attribs = attribs;
+				QString filename = dict_index_list.at(tab_idx) + dict_ext, hash;
+				QByteArray buffer;
+
+				if(cancel_saving)
+					return;
+
+				hash = getDataDictionaryHash(dict_tabs[tab_idx], tab_attribs, dict_attribs[tab_idx], md_format);
+
+				/* In incremental mode the table isn't rendered again if the inputs of its page are
+				 * the same as the ones of the previous generation and the file still exists */
+				if(incremental && prev_files.value(filename).toString() == hash &&
+					 QFileInfo::exists(path + GlobalAttributes::DirSeparator + filename))
+				{
+					dict_hashes[tab_idx] = hash;
+					skip_count++;
+					gen_count++;
+					return;
+				}
+
+				tab_attribs[Attributes::Objects] = dict_tabs[tab_idx]->getDataDictionary(true, md_format, dict_attribs[tab_idx]);
+
+				if(!tab_attribs[Attributes::Objects].isEmpty())
+				{
+					parser.ignoreEmptyAttributes(true);
+					buffer = parser.getSourceCode(dict_sch_file, tab_attribs).toUtf8();
+					buffer.replace(DatePlaceholder.toUtf8(), date.toUtf8());
+					UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
+					dict_hashes[tab_idx] = hash;
+				}
+
+				gen_count++;
+			}
+			catch(Exception &e)
+			{
+				QMutexLocker locker(&errors_mtx);
+				errors.push_back(e);
+				cancel_saving = true;
+			}
+		});
+	}
+
+	while(!thread_pool.waitForDone(100))
+	{
+		if(cancel_saving)
+			thread_pool.clear();
+
+		emit s_objectLoaded((gen_count.load() * 100) / (tab_count > 0 ? tab_count : 1),
+												tr("Generating data dictionary of tables (%1/%2)...").arg(gen_count.load()).arg(tab_count),
+												enum_t(ObjectType::Table));
+	}
+
+	if(!errors.empty())
+	{
+		Exception &e = errors.front();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+	}
+
+	if(cancel_saving)
+		return;
+
+	// If the data dictionary is browsable the index goes into a separated file
+	if(browsable)
+	{
+		UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + Attributes::Index + dict_ext,
+											getDataDictionaryIndex(tabs_map, dict_index_list, true, md_format, date, year).toUtf8());
+	}
+
+	// Registering the hashes of the generated files in the manifest
+	for(unsigned tab_idx = 0; tab_idx < dict_tabs.size(); tab_idx++)
+	{
+		QString filename = dict_index_list.at(tab_idx) + dict_ext;
+
+		if(!dict_hashes[tab_idx].isEmpty())
+		{
+			files.remove(filename);
+			manifest[filename] = dict_hashes[tab_idx];
+		}
+	}
+
+	// In incremental mode the files of the tables that don't exist anymore are removed
+	if(incremental)
+	{
+		for(auto &filename : files.keys())
+			QFile::remove(path + GlobalAttributes::DirSeparator + filename);
+	}
+
+	files = manifest;
+	manifest = QJsonObject();
+	manifest["version"] = GlobalAttributes::PgModelerVersion;
+	manifest["format"] = dict_ext.mid(1);
+	manifest["files"] = files;
+	UtilsNs::saveFile(manifest_file, QJsonDocument(manifest).toJson());
+
+	emit s_objectLoaded(100, tr("Data dictionary of %1 table(s) generated, %2 file(s) unchanged.").arg(tab_count).arg(skip_count.load()),
+											enum_t(ObjectType::Table));
+}
+
 QString DatabaseModel::getChangelogDefinition(bool csv_format)
 {
 	try
@@ -10379,6 +10974,38 @@ QString DatabaseModel::getChangelogDefinition(bool csv_format)
 	}
 }
 
+QString DatabaseModel::getCatalogSnapshotDefinition()
+{
+	try
+	{
+		QString buffer;
+		attribs_map attribs;
+
+		if(catalog_snapshot.empty())
+			return "";
+
+		for(auto &[oid, entry] : catalog_snapshot)
+		{
+			attribs[Attributes::Oid] = QString::number(oid);
+			attribs[Attributes::Type] = BaseObject::getSchemaName(std::get<SnapObjectType>(entry));
+			attribs[Attributes::Signature] = std::get<SnapSignature>(entry);
+			attribs[Attributes::Parent] = std::get<SnapParent>(entry);
+			attribs[Attributes::Value] = std::get<SnapFingerprint>(entry);
+			buffer += schparser.getSourceCode(Attributes::Fingerprint, attribs, SchemaParser::XmlCode);
+		}
+
+		attribs.clear();
+		attribs[Attributes::Database] = QString::number(snapshot_db_oid);
+		attribs[Attributes::Fingerprint] = buffer;
+		schparser.ignoreEmptyAttributes(true);
+		return schparser.getSourceCode(Attributes::CatalogSnapshot, attribs, SchemaParser::XmlCode);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+	}
+}
+
 void DatabaseModel::setSceneRect(const QRectF &rect)
 {
 	if(!rect.isValid())
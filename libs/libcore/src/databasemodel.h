@@ -65,6 +65,8 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "transform.h"
 #include "procedure.h"
 #include <algorithm>
+#include <atomic>
+#include <unordered_map>
 #include <locale.h>
 #include "operation.h"
 
@@ -87,6 +89,14 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 * differently from OperationList class, it's data persisted in the database model file. */
 		std::vector<std::tuple<QDateTime,QString,ObjectType,QString>> changelog;
 
+		/*! \brief Stores the catalog fingerprints of the objects imported from a database (see SnapshotFields). The key is the object's oid.
+		 * This structure is persisted in the database model file so the next import of the same database can skip the objects that
+		 * didn't change since the last import (see DatabaseImportHelper::setIncrementalImport()) */
+		std::map<unsigned, std::tuple<ObjectType,QString,QString,QString>> catalog_snapshot;
+
+		//! \brief The oid of the database in which the catalog snapshot was captured
+		unsigned snapshot_db_oid;
+
 		/*! \brief Stores the references to all object lists of each type. This map is used by getObjectList() in order
 		 * to return the list according to the provided type */
 		std::map<ObjectType, std::vector<BaseObject *> *> obj_lists;
@@ -165,11 +175,13 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		/*! \brief Indicates that system schemas (pg_catalog, information_schema, etc) must display their rectangles
 		 *  Since these objects can't have their attributes changes via editing form (except for public schema)
 		 *  this flag helps to persist the visibility state of the rectangles of that schemas */
-		show_sys_sch_rects,
+		show_sys_sch_rects;
 
 		/*! \brief This flag is used to notify the model to break the code generation/saving.
-		 *  This is only used by the export helper to cancel a running export to file process */
-		cancel_saving;
+		 *  This is only used by the export helper to cancel a running export to file process.
+		 *  It's atomic because the workers that render split data dictionaries read it
+		 *  while the export helper (or a failing worker) sets it from other threads */
+		std::atomic<bool> cancel_saving;
 
 		//! \brief Vectors that stores all the objects types
 		std::vector<BaseObject *> textboxes,
@@ -208,6 +220,23 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 when revalidating the relationships */
 		std::map<unsigned, QString> xml_special_objs;
 
+		/*! \brief Indexes the permissions by the object (or column) they are applied to, in the same
+		 *  order they appear in the permissions list. This index avoids scanning all permissions of the model
+		 *  when adding a permission or retrieving the permissions of an object */
+		std::unordered_map<BaseObject *, std::vector<Permission *>> obj_perms;
+
+		//! \brief Indexes the relationships (of all kinds) by the tables they connect
+		std::unordered_map<BaseTable *, std::vector<BaseRelationship *>> table_rels;
+
+		//! \brief Stores the tables connected by each relationship at the moment it was indexed in table_rels
+		std::unordered_map<BaseRelationship *, std::pair<BaseTable *, BaseTable *>> rel_tables;
+
+		//! \brief Indexes the tables, foreign tables and views by the schema they belong to
+		std::unordered_map<BaseObject *, std::vector<BaseObject *>> sch_children;
+
+		//! \brief Stores the schema of each table, foreign table or view at the moment it was indexed in sch_children
+		std::unordered_map<BaseObject *, BaseObject *> obj_schemas;
+
 		/*! \brief Stores the special objects considered invalid after a relationships revalidation.
 		 * This vector is destroyed only when the model is destroyed too in order to avoid segfaults */
 		std::vector<BaseObject *> invalid_special_objs;
@@ -288,6 +317,40 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 *  read from dbm file. At the end of the load process, the flag is reset */
 		bool isModelLoading();
 
+		//! \brief Inserts the object in the adjacency indexes (table_rels or sch_children) when it is a relationship or a table-like object
+		void indexObject(BaseObject *object);
+
+		//! \brief Removes the object from the adjacency indexes (table_rels or sch_children)
+		void unindexObject(BaseObject *object);
+
+		/*! \brief Returns the permission in the model that is a duplicate of the provided one (see getPermissionIndex()).
+		 *  Returns null if there's no duplicate */
+		Permission *getDuplicatedPermission(Permission *perm, bool exact_match);
+
+		/*! \brief Returns in 'tabs_map' the tables, foreign tables, views and tables generated by many-to-many relationships
+		 *  that are part of the data dictionary. The map is indexed by the objects signatures (unquoted) which are also
+		 *  stored, in alphabetical order, in the 'dict_index_list' */
+		void getDataDictionaryTables(std::map<QString, BaseTable *> &tabs_map, QStringList &dict_index_list);
+
+		/*! \brief Returns the extra attributes (navigation and sequences) used to generate the data dictionary of a single table.
+		 *  The 'prev_item' and 'next_item' are the names of the tables around the provided one in the data dictionary index */
+		attribs_map getDataDictionaryAttribs(BaseTable *base_tab, bool browsable, bool md_format, const QString &prev_item, const QString &next_item);
+
+		//! \brief Returns the navigation index of the data dictionary for the tables in 'tabs_map'
+		QString getDataDictionaryIndex(std::map<QString, BaseTable *> &tabs_map, const QStringList &dict_index_list,
+																	 bool split, bool md_format, const QString &date, const QString &year);
+
+		/*! \brief Returns the hash of the inputs of the data dictionary page of a table: the SQL code of the table and its children
+		 *  plus the attributes used to render the page. This hash is computed without rendering the page (see saveSplitDataDictionary()) */
+		QString getDataDictionaryHash(BaseTable *base_tab, const attribs_map &page_attribs, const attribs_map &tab_attribs, bool md_format);
+
+		/*! \brief Saves the data dictionary of each table in a separated file inside the directory 'path'.
+		 *  The tables are rendered in parallel and each file is written as soon as it is generated.
+		 *  A manifest storing the hash of the inputs of each page is written in the directory so, in incremental mode,
+		 *  the tables that didn't change since the previous generation are not rendered again
+		 *  and the files of the tables that don't exist anymore are removed */
+		void saveSplitDataDictionary(const QString &path, bool browsable, bool md_format, bool incremental);
+
 	protected:
 		//! \brief Set the layer names (only to be written in the XML definition)
 		void setLayers(const QStringList &layers);
@@ -333,7 +396,23 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief This convenience method forces the redrawn of the tables of a relationship as well as their respective schemas
 		void setRelTablesModified(BaseRelationship *rel);
 
+		//! \brief Moves the object to the correct positions in the adjacency indexes when its schema or connected tables change
+		void updateObjectIndexes(BaseObject *object) override;
+
 	public:
+		//! \brief The name of the file that stores the hashes of the split data dictionary files
+		static const QString DataDictManifest;
+
+		/*! \brief Constants used to access the tuple columns in the catalog snapshot.
+		 *  SnapSignature holds the name of the object when it is a table child and SnapParent
+		 *  holds the signature of its parent table. For other objects SnapParent is empty */
+		enum SnapshotFields: unsigned {
+			SnapObjectType,
+			SnapSignature,
+			SnapParent,
+			SnapFingerprint
+		};
+
 		/*! \brief Constants used to determine the code generation mode:
 		 *  OriginalSql: generates the SQL for the object only (original behavior)
 		 *  DependenciesSql: generates the original SQL code + dependencies SQL
@@ -784,6 +863,14 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Updates the fk relationships for all table on the model
 		void updateTablesFKRelationships();
 
+		/*! \brief Creates a deep copy of the table with its columns and constraints (foreign keys are not copied).
+		 *  The references to schema, owner, tablespace, tag, sequences, collations and user-defined types are
+		 *  remapped to the objects with the same signature in this model. When incl_rel_added_objs is true the columns
+		 *  added by relationships are copied as ordinary columns. Returns nullptr if some referenced object doesn't
+		 *  exist in this model or if the table has children that can't be cloned directly (exclude constraints or partition keys),
+		 *  in that case the table must be recreated from its XML code. The returned table is not added to the model */
+		Table *cloneTable(Table *table, bool incl_rel_added_objs);
+
 		//! \brief Validates the relationship to reflect the modifications on the column/constraint of the passed table
 		void validateRelationships(TableObject *object, Table *parent_tab);
 
@@ -845,8 +932,10 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the data dictionary of all tables in a single HTML code
 		void getDataDictionary(attribs_map &datadict, bool browsable, bool split, bool md_format);
 
-		//! \brief Saves the data dictionary of all tables in a single HTML file or splitted in several files for each table
-		void saveDataDictionary(const QString &path, bool browsable, bool split, bool md_format);
+		/*! \brief Saves the data dictionary of all tables in a single HTML file or splitted in several files for each table.
+		 *  In split mode, the parameter incremental avoids rewriting the files of the tables that didn't change since the last
+		 *  data dictionary generation in the same directory (see saveSplitDataDictionary()) */
+		void saveDataDictionary(const QString &path, bool browsable, bool split, bool md_format, bool incremental = false);
 
 		/*! \brief Save the graphical objects positions, custom colors and custom points (for relationship lines) to an special file
 				that can be loaded by another model in order to change their objects position */
@@ -878,6 +967,19 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the amount of entries in the changelog
 		unsigned getChangelogLength(Operation::OperType op_type = Operation::NoOperation);
 
+		/*! \brief Replaces the catalog snapshot of the objects imported from the database identified by db_oid.
+		 *  An empty snapshot causes the next import to read all objects again */
+		void setCatalogSnapshot(unsigned db_oid, const std::map<unsigned, std::tuple<ObjectType,QString,QString,QString>> &snapshot);
+
+		//! \brief Returns the catalog snapshot captured in the last import (see SnapshotFields)
+		const std::map<unsigned, std::tuple<ObjectType,QString,QString,QString>> &getCatalogSnapshot();
+
+		//! \brief Returns the oid of the database in which the catalog snapshot was captured
+		unsigned getCatalogSnapshotDatabase();
+
+		//! \brief Clears the catalog snapshot
+		void clearCatalogSnapshot();
+
 		QStringList getLayers();
 		QStringList getLayerNameColors();
 		QList<unsigned> getActiveLayers();
@@ -893,6 +995,9 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns the XML code for the changelog
 		QString getChangelogDefinition(bool csv_format = false);
 
+		//! \brief Returns the XML code for the catalog snapshot
+		QString getCatalogSnapshotDefinition();
+
 		/*! \brief Defines the current scene rectangle in which the model is being rendered
 		 *  This is used to restore the original scene geometry when the model is loaded from file */
 		void setSceneRect(const QRectF &rect);
@@ -368,6 +368,8 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 			throw Exception(ErrorCode::OprObjectInvalidType,PGM_FUNC,PGM_FILE,PGM_LINE);
 		}		
 
+		emit s_objectChanged(object, parent_obj);
+
 		//If the operations list is full makes the automatic cleaning before inserting a new operation
 		if(current_index == static_cast<int>(max_size-1))
 			removeOperations();
@@ -679,6 +681,8 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 		op_type=oper->getOperationType();
 		obj_idx=oper->getObjectIndex();
 
+		emit s_objectChanged(oper->getOriginalObject(), parent_obj);
+
 		/* Converting the parent object, if any, to the correct class according
 			to the type of the parent object. If ObjectType::Table|ObjectType::View, the pointer
 			'parent_tab' get the reference to table/view and will be used as referential
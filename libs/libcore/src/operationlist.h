@@ -186,6 +186,12 @@ class __libcore OperationList: public QObject {
 		 of the object with the new value for the operations which refer the object is not
 		 executed incorrectly using previous index */
 		void updateObjectIndex(BaseObject *object, unsigned new_idx);
+
+	signals:
+		/*! \brief Signal emitted when an object is registered in the list (right before being changed)
+		 * or when an operation over the object is undone/redone. The parent object is the table or
+		 * relationship that owns the object, when it is a table child */
+		void s_objectChanged(BaseObject *object, BaseObject *parent_obj);
 };
 
 #endif
@@ -24,9 +24,13 @@
 #include "coreutilsns.h"
 #include "csvparser.h"
 
+PhysicalTable::InitialDataFormat PhysicalTable::ini_data_fmt = PhysicalTable::InsertPerRow;
+
 PhysicalTable::PhysicalTable()
 {
 	gen_alter_cmds=false;
+	ini_data_rows=0;
+	ini_data_parsed=false;
 	attributes[Attributes::Columns]="";
 	attributes[Attributes::InhColumns]="";
 	attributes[Attributes::Constraints]="";
@@ -1444,6 +1448,7 @@ void PhysicalTable::operator = (PhysicalTable &table)
 	this->constr_indexes=table.constr_indexes;
 	this->partitioning_type=table.partitioning_type;
 	this->initial_data=table.initial_data;
+	this->ini_data_parsed=false;
 	this->partition_keys=table.partition_keys;
 
 	PgSqlType::renameUserType(prev_name, this, this->getName(true));
@@ -1596,6 +1601,10 @@ void PhysicalTable::setCodeInvalidated(bool value)
 void PhysicalTable::setInitialData(const QString &value)
 {
 	setCodeInvalidated(initial_data != value);
+
+	if(initial_data != value)
+		ini_data_parsed = false;
+
 	initial_data = value;
 }
 
@@ -1604,60 +1613,220 @@ QString PhysicalTable::getInitialData()
 	return initial_data;
 }
 
-QString PhysicalTable::getInitialDataCommands()
+void PhysicalTable::setInitialDataFormat(InitialDataFormat fmt)
+{
+	ini_data_fmt = fmt;
+}
+
+PhysicalTable::InitialDataFormat PhysicalTable::getInitialDataFormat()
+{
+	return ini_data_fmt;
+}
+
+QStringView PhysicalTable::InitialDataColumn::getValue(int row) const
 {
-	CsvDocument csv_doc;
+	qsizetype start = (row > 0 ? ends[row - 1] : 0);
+	return QStringView(values).mid(start, ends[row] - start);
+}
+
+void PhysicalTable::parseInitialData()
+{
+	if(ini_data_parsed)
+		return;
+
 	CsvParser csv_parser;
+	QByteArray data = initial_data.toUtf8();
+
+	ini_data_cols.clear();
+	ini_data_rows = 0;
+	ini_data_error.clear();
+	ini_data_parsed = true;
 
 	try
 	{
 		csv_parser.setColumnInFirstRow(true);
-		csv_doc = csv_parser.parseBuffer(initial_data);
+		csv_parser.parseData(data.constData(), data.size(), [this](int row, const QStringList &values) {
+			if(row == CsvParser::HeaderRow)
+			{
+				for(auto &name : values)
+					ini_data_cols.push_back({ name, "", {} });
+
+				return true;
+			}
+
+			if(values.size() != static_cast<qsizetype>(ini_data_cols.size()))
+			{
+				throw Exception(Exception::getErrorMessage(ErrorCode::MalformedCsvInvalidCols)
+												.arg(ini_data_cols.size()).arg(ini_data_rows + 1).arg(values.size()),
+												ErrorCode::MalformedCsvInvalidCols, PGM_FUNC, PGM_FILE, PGM_LINE);
+			}
+
+			for(qsizetype col = 0; col < values.size(); col++)
+			{
+				ini_data_cols[col].values.append(values[col]);
+				ini_data_cols[col].ends.push_back(ini_data_cols[col].values.size());
+			}
+
+			ini_data_rows++;
+			return true;
+		});
 	}
 	catch(Exception &e)
 	{
-		return tr("/* Failed to create initial data commands!\n\n%1 */").arg(e.getErrorMessage());
+		ini_data_cols.clear();
+		ini_data_rows = 0;
+		ini_data_error = e.getErrorMessage();
 	}
+}
 
-	if(csv_doc.isEmpty())
+QString PhysicalTable::getInitialDataCommands()
+{
+	parseInitialData();
+
+	if(!ini_data_error.isEmpty())
+		return tr("/* Failed to create initial data commands!\n\n%1 */").arg(ini_data_error);
+
+	if(ini_data_rows == 0)
 		return "";
 
-	QStringList col_names, col_values, commands, selected_cols;
-	int curr_col=0;
-	QList<int> ignored_cols;
+	QStringList col_names, fmt_col_names, values, commands;
+	std::vector<const InitialDataColumn *> sel_cols;
+	InitialDataFormat fmt = ini_data_fmt;
+	QString value;
+
+	//Separating valid columns (selected) from the invalids and duplicated ones (ignored)
+	for(auto &col : ini_data_cols)
+	{
+		if(!col_names.contains(col.name) && getObjectIndex(col.name, ObjectType::Column) >= 0)
+		{
+			col_names.append(col.name);
+			fmt_col_names.append(BaseObject::formatName(col.name));
+			sel_cols.push_back(&col);
+		}
+	}
 
-	col_names = csv_doc.getColumnNames();
-	col_names.removeDuplicates();
+	if(sel_cols.empty())
+		return "";
 
-	//Separating valid columns (selected) from the invalids (ignored)
-	for(auto &col_name : col_names)
+	if(fmt == CopyFromStdin)
 	{
-		if(getObjectIndex(col_name, ObjectType::Column) >= 0)
-			selected_cols.append(col_name);
-		else
-			ignored_cols.append(curr_col);
+		QString copy_data;
+		bool copy_allowed = true;
 
-		curr_col++;
+		for(int row = 0; row < ini_data_rows && copy_allowed; row++)
+		{
+			values.clear();
+
+			for(auto &col : sel_cols)
+			{
+				value = col->getValue(row).toString();
+				copy_allowed = formatInitialDataCopyValue(value);
+
+				if(!copy_allowed)
+					break;
+
+				values.append(value);
+			}
+
+			copy_data.append(values.join('\t'));
+			copy_data.append('\n');
+		}
+
+		if(copy_allowed)
+		{
+			return QString("COPY %1 (%2) FROM stdin;\n%3\\.\n%4")
+					.arg(getSignature(), fmt_col_names.join(", "), copy_data, Attributes::DdlEndToken);
+		}
+
+		// Data that can't be represented in COPY format is generated as multi-row inserts
+		fmt = MultiRowInsert;
 	}
 
-	for(int row = 0; row < csv_doc.getRowCount(); row++)
+	if(fmt == MultiRowInsert)
 	{
-		//Filtering the invalid columns' values
-		for(int col = 0; col < csv_doc.getColumnCount(); col++)
+		for(int start = 0; start < ini_data_rows; start += InitialDataBatchSize)
 		{
-			if(ignored_cols.contains(col))
-				continue;
+			QStringList tuples;
+
+			for(int row = start; row < qMin(ini_data_rows, start + InitialDataBatchSize); row++)
+			{
+				values.clear();
+
+				for(auto &col : sel_cols)
+					values.append(formatInitialDataValue(col->getValue(row).toString()));
 
-			col_values.append(csv_doc.getValue(row, col));
+				tuples.append(QString("(%1)").arg(values.join(", ")));
+			}
+
+			commands.append(QString("INSERT INTO %1 (%2) VALUES\n%3;\n%4")
+											.arg(getSignature(), fmt_col_names.join(", "), tuples.join(",\n"), Attributes::DdlEndToken));
 		}
+	}
+	else
+	{
+		for(int row = 0; row < ini_data_rows; row++)
+		{
+			values.clear();
 
-		commands.append(createInsertCommand(selected_cols, col_values));
-		col_values.clear();
+			for(auto &col : sel_cols)
+				values.append(col->getValue(row).toString());
+
+			commands.append(createInsertCommand(col_names, values));
+		}
 	}
 
 	return commands.join('\n');
 }
 
+QString PhysicalTable::formatInitialDataValue(QString value)
+{
+	//Empty values as considered as DEFAULT
+	if(value.isEmpty())
+		return "DEFAULT";
+
+	//Unescaped values will not be enclosed in quotes
+	if(value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(UtilsNs::UnescValueEnd))
+	{
+		value.remove(0,1);
+		value.remove(value.length()-1, 1);
+		return value;
+	}
+
+	//Quoting value
+	value.replace(QString("\\") + UtilsNs::UnescValueStart, UtilsNs::UnescValueStart);
+	value.replace(QString("\\") + UtilsNs::UnescValueEnd, UtilsNs::UnescValueEnd);
+	value.replace("\'", "''");
+	value.replace(QChar(QChar::LineFeed), "\\n");
+	return "E'" + value + "'";
+}
+
+bool PhysicalTable::formatInitialDataCopyValue(QString &value)
+{
+	// Default values and expressions have no representation in COPY text format
+	if(value.isEmpty() ||
+		 (value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(UtilsNs::UnescValueEnd)))
+		return false;
+
+	value.replace(QString("\\") + UtilsNs::UnescValueStart, UtilsNs::UnescValueStart);
+	value.replace(QString("\\") + UtilsNs::UnescValueEnd, UtilsNs::UnescValueEnd);
+
+	/* Backslashes are handled slightly different in E'' strings (used by the INSERT commands)
+	 * and in COPY data, so values containing them are only generated as INSERT */
+	if(value.contains('\\'))
+		return false;
+
+	value.replace(QChar(QChar::Tabulation), "\\t");
+	value.replace(QChar(QChar::LineFeed), "\\n");
+	value.replace(QChar(QChar::CarriageReturn), "\\r");
+
+	/* Values containing SQL comment markers have their hyphens escaped (\- is read as - by COPY)
+	 * so the data lines can't be taken as comments when pgModeler runs the script */
+	if(value.contains("--"))
+		value.replace('-', "\\-");
+
+	return true;
+}
+
 QString PhysicalTable::createInsertCommand(const QStringList &col_names, const QStringList &values)
 {
 	QString fmt_cmd, insert_cmd = QString("INSERT INTO %1 (%2) VALUES (%3);\n%4");
@@ -1667,31 +1836,8 @@ QString PhysicalTable::createInsertCommand(const QStringList &col_names, const Q
 	for(auto &col_name : col_names)
 		col_list.push_back(BaseObject::formatName(col_name));
 
-	for(auto value : values)
-	{
-		//Empty values as considered as DEFAULT
-		if(value.isEmpty())
-		{
-			value = "DEFAULT";
-		}
-		//Unescaped values will not be enclosed in quotes
-		else if(value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(UtilsNs::UnescValueEnd))
-		{
-			value.remove(0,1);
-			value.remove(value.length()-1, 1);
-		}
-		//Quoting value
-		else
-		{
-			value.replace(QString("\\") + UtilsNs::UnescValueStart, UtilsNs::UnescValueStart);
-			value.replace(QString("\\") + UtilsNs::UnescValueEnd, UtilsNs::UnescValueEnd);
-			value.replace("\'", "''");
-			value.replace(QChar(QChar::LineFeed), "\\n");
-			value="E'" + value + "'";
-		}
-
-		val_list.push_back(value);
-	}
+	for(auto &value : values)
+		val_list.push_back(formatInitialDataValue(value));
 
 	if(!col_list.isEmpty() && !val_list.isEmpty())
 	{
@@ -38,6 +38,66 @@
 #include "pgsqltypes/partitioningtype.h"
 
 class __libcore PhysicalTable: public BaseTable {
+	public:
+		//! \brief The forms in which the initial data of tables can be generated in the SQL code
+		enum InitialDataFormat: unsigned {
+			//! \brief One INSERT command per row (the default)
+			InsertPerRow,
+
+			//! \brief Batched multi-row INSERT ... VALUES commands (see InitialDataBatchSize)
+			MultiRowInsert,
+
+			/*! \brief A single COPY ... FROM stdin block. Tables which data can't be represented
+			 *  in COPY text format (e.g. default values or expressions) use MultiRowInsert instead */
+			CopyFromStdin
+		};
+
+		//! \brief The maximum amount of rows in each multi-row INSERT command
+		static constexpr int InitialDataBatchSize = 1000;
+
+	private:
+		/*! \brief Stores the values of a single column of the parsed initial data. Instead of one string
+		 *  per cell, the values of all rows are concatenated in a single buffer and located by their end positions */
+		struct InitialDataColumn {
+			//! \brief The column name in the header of the initial data
+			QString name;
+
+			//! \brief The values of the column in all rows concatenated
+			QString values;
+
+			//! \brief The end position of each value in the buffer (row N spans from ends[N-1] to ends[N])
+			std::vector<qsizetype> ends;
+
+			//! \brief Returns a view of the value of the column in the provided row
+			QStringView getValue(int row) const;
+		};
+
+		//! \brief The format used when generating initial data commands (see setInitialDataFormat())
+		static InitialDataFormat ini_data_fmt;
+
+		//! \brief The parsed form of initial_data stored per column (see parseInitialData())
+		std::vector<InitialDataColumn> ini_data_cols;
+
+		//! \brief The amount of rows in the parsed initial data
+		int ini_data_rows;
+
+		//! \brief Indicates that the initial data was parsed and ini_data_cols is up to date
+		bool ini_data_parsed;
+
+		//! \brief Stores the error raised when parsing the initial data for the last time
+		QString ini_data_error;
+
+		/*! \brief Parses the CSV initial data into the columnar storage. The parsing is performed only
+		 *  once per initial data change, so the generation of code doesn't need to parse it every time */
+		void parseInitialData();
+
+		//! \brief Formats a single initial data value to be used in an INSERT command
+		static QString formatInitialDataValue(QString value);
+
+		/*! \brief Formats a single initial data value to be used in COPY text format. Returns false if the value
+		 *  can't be represented in that format (empty values, expressions and values with backslashes) */
+		static bool formatInitialDataCopyValue(QString &value);
+
 	protected:
 		//! \brief Specifies the table from which columns are copied
 		PhysicalTable *copy_table;
@@ -356,10 +416,17 @@ class __libcore PhysicalTable: public BaseTable {
 		//! \brief Returns the table's initial data in raw format
 		QString getInitialData();
 
-		/*! \brief Translate the CSV-like initial data to a set of INSERT commands.
-		In invalid columns exist in the buffer they will be rejected when generating the commands */
+		/*! \brief Translate the CSV-like initial data to a set of INSERT commands (or a COPY block depending on
+		the format set via setInitialDataFormat()). In invalid columns exist in the buffer they will be rejected
+		when generating the commands */
 		QString getInitialDataCommands();
 
+		//! \brief Defines the format of the commands generated from the tables' initial data
+		static void setInitialDataFormat(InitialDataFormat fmt);
+
+		//! \brief Returns the format of the commands generated from the tables' initial data
+		static InitialDataFormat getInitialDataFormat();
+
 		/*! \brief Generates the table's SQL code considering adding the relationship added object or not.
 		 * Note if the method is called with incl_rel_added_objs = true it can produce an SQL/XML code
 		 * that does not reflect the real semantics of the table. So take care to use this method and always
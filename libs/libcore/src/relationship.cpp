@@ -3035,7 +3035,7 @@ QString Relationship::getXmlCode()
 								attributes[Attributes::PartitionBoundExpr].isEmpty());
 
 	if(!reduced_form)
-		cached_reduced_code.clear();
+		CodeCache::remove(this, CodeCache::ReducedXmlCode);
 
 	return this->BaseObject::getSourceCode(SchemaParser::XmlCode, reduced_form);
 }
@@ -244,6 +244,7 @@ void MainWindow::configureMenusActionsWidgets()
 	arrange_menu.addAction(tr("Grid"), this, &MainWindow::arrangeObjects);
 	arrange_menu.addAction(tr("Hierarchical"), this, &MainWindow::arrangeObjects);
 	arrange_menu.addAction(tr("Scattered"), this, &MainWindow::arrangeObjects);
+	arrange_menu.addAction(tr("Force-directed"), this, &MainWindow::arrangeObjects);
 
 	models_tbw->tabBar()->setVisible(false);
 
@@ -1046,6 +1047,10 @@ void MainWindow::closeEvent(QCloseEvent *event)
 		conf_wgt->appendConfigurationSection(Attributes::Configuration, attribs);
 		attribs.clear();
 
+		//Removing the sandbox databases used in the incremental SQL validation of the models
+		for(auto &model : models_tbw->findChildren<ModelWidget *>())
+			model_valid_wgt->dropSandbox(model);
+
 		//Remove the references to old session
 		conf_wgt->removeConfigurationSection(QRegularExpression(QString("(%1)([0-9])+").arg(Attributes::File)));
 
@@ -1711,6 +1716,7 @@ void MainWindow::closeModel(int model_id)
 		if(!model->isModified() ||
 			 (model->isModified() && msg_res == Messagebox::Accepted))
 		{
+			model_valid_wgt->dropSandbox(model);
 			model_nav_wgt->removeModel(model_id);
 			model_tree_states.remove(model);
 			model_tree_v_pos.remove(model);
@@ -2540,11 +2546,25 @@ void MainWindow::arrangeObjects()
 	if(!current_model)
 		return;
 
+	// Triggering the force-directed arrangement while it's running cancels it
+	if(current_model->isForceLayoutRunning())
+	{
+		current_model->cancelForceLayout();
+		return;
+	}
+
 	int res =	Messagebox::confirm(tr("Rearrange objects over the canvas is an irreversible operation! Would like to proceed?"));
 
 	if(!Messagebox::isAccepted(res))
 		return;
 
+	// The force-directed arrangement runs in background updating the canvas incrementally
+	if(sender() == arrange_menu.actions().at(3))
+	{
+		current_model->rearrangeTablesForceDirected();
+		return;
+	}
+
 	qApp->setOverrideCursor(Qt::WaitCursor);
 
 	if(sender() == arrange_menu.actions().at(0))
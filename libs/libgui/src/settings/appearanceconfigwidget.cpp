@@ -244,6 +244,9 @@ CREATE TABLE public.table_b (\n \
 	connect(tab_width_spb, &QSpinBox::textChanged, this, &AppearanceConfigWidget::previewCodeFontStyle);
 	connect(tab_width_chk, &QCheckBox::toggled, tab_width_spb, &QSpinBox::setEnabled);
 	connect(tab_width_chk, &QCheckBox::toggled, this, &AppearanceConfigWidget::previewCodeFontStyle);
+	connect(hl_size_limit_spb, &QSpinBox::textChanged, this, &AppearanceConfigWidget::previewCodeFontStyle);
+	connect(hl_size_limit_chk, &QCheckBox::toggled, hl_size_limit_spb, &QSpinBox::setEnabled);
+	connect(hl_size_limit_chk, &QCheckBox::toggled, this, &AppearanceConfigWidget::previewCodeFontStyle);
 	connect(font_preview_txt, &NumberedTextEditor::cursorPositionChanged, this, &AppearanceConfigWidget::previewCodeFontStyle);
 
 	connect(elem_color_cp, &ColorPickerWidget::s_colorChanged, this, &AppearanceConfigWidget::applyElementColor);
@@ -672,6 +675,11 @@ void AppearanceConfigWidget::applyDesignCodeStyle()
 	tab_width_chk->setChecked(tab_width > 0);
 	tab_width_spb->setEnabled(tab_width_chk->isChecked());
 	tab_width_spb->setValue(tab_width);
+
+	int hl_size_limit = (config_params[Attributes::Code][Attributes::HighlightSizeLimit]).toInt();
+	hl_size_limit_chk->setChecked(hl_size_limit > 0);
+	hl_size_limit_spb->setEnabled(hl_size_limit_chk->isChecked());
+	hl_size_limit_spb->setValue(hl_size_limit);
 }
 
 void AppearanceConfigWidget::applyObjectsStyle()
@@ -776,6 +784,7 @@ void AppearanceConfigWidget::saveConfiguration()
 		attribs[Attributes::LineNumbersBgColor] = line_numbers_bg_cp->getColor(0).name();
 		attribs[Attributes::LineHighlightColor] = line_highlight_cp->getColor(0).name();
 		attribs[Attributes::TabWidth] = QString::number(tab_width_chk->isChecked() ? tab_width_spb->value() : 0);
+		attribs[Attributes::HighlightSizeLimit] = QString::number(hl_size_limit_chk->isChecked() ? hl_size_limit_spb->value() : 0);
 
 		config_params[Attributes::Code] = attribs;
 		attribs.clear();
@@ -1008,6 +1017,7 @@ void AppearanceConfigWidget::previewCodeFontStyle()
 	fnt.setPointSizeF(code_font_size_spb->value());
 
 	SyntaxHighlighter::setDefaultFont(fnt);
+	SyntaxHighlighter::setHighlightSizeLimit(hl_size_limit_chk->isChecked() ? hl_size_limit_spb->value() : 0);
 	NumberedTextEditor::setDefaultFont(fnt);
 	NumberedTextEditor::setLineNumbersVisible(disp_line_numbers_chk->isChecked());
 	NumberedTextEditor::setLineHighlightColor(line_highlight_cp->getColor(0));
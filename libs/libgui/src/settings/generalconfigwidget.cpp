@@ -75,6 +75,10 @@ GeneralConfigWidget::GeneralConfigWidget(QWidget * parent) : BaseConfigWidget(pa
 	check_versions_cmb->setItemData(1, Attributes::StableBeta);
 	check_versions_cmb->setItemData(2, Attributes::StableOnly);
 
+	ini_data_fmt_cmb->setItemData(PhysicalTable::InsertPerRow, "insert");
+	ini_data_fmt_cmb->setItemData(PhysicalTable::MultiRowInsert, "multi-insert");
+	ini_data_fmt_cmb->setItemData(PhysicalTable::CopyFromStdin, "copy");
+
 	connect(check_update_chk, &QCheckBox::toggled, check_versions_cmb, &QComboBox::setEnabled);
 	connect(unity_cmb, &QComboBox::currentIndexChanged, this, &GeneralConfigWidget::convertMarginUnity);
 	connect(autosave_interv_chk, &QCheckBox::toggled, autosave_interv_spb, &QSpinBox::setEnabled);
@@ -308,6 +312,16 @@ void GeneralConfigWidget::loadConfiguration()
 		low_verbosity_chk->setChecked(config_params[Attributes::Configuration][Attributes::LowVerbosity]==Attributes::True);
 		escape_comments_chk->setChecked(config_params[Attributes::Configuration][Attributes::EscapeComment]==Attributes::True);
 
+		idx = ini_data_fmt_cmb->findData(config_params[Attributes::Configuration][Attributes::InitialDataFormat]);
+		ini_data_fmt_cmb->setCurrentIndex(idx < 0 ? 0 : idx);
+
+		if(config_params[Attributes::Configuration][Attributes::CodeCacheSize].isEmpty())
+			code_cache_size_spb->setValue(CodeCache::DefaultBudgetMb);
+		else
+			code_cache_size_spb->setValue(config_params[Attributes::Configuration][Attributes::CodeCacheSize].toInt());
+
+		compress_code_cache_chk->setChecked(config_params[Attributes::Configuration][Attributes::CompressCodeCache]==Attributes::True);
+
 		trunc_columns_data_chk->setChecked(config_params[Attributes::Configuration][Attributes::TruncateColumnData]==Attributes::True);
 		trunc_columns_data_spb->setValue(config_params[Attributes::Configuration][Attributes::ColumnTruncThreshold].toInt());
 
@@ -525,6 +539,9 @@ void GeneralConfigWidget::saveConfiguration()
 		config_params[Attributes::Configuration][Attributes::SaveRestoreGeometry]=(save_restore_geometry_chk->isChecked() ? Attributes::True : "");
 		config_params[Attributes::Configuration][Attributes::LowVerbosity]=(low_verbosity_chk->isChecked() ? Attributes::True : "");
 		config_params[Attributes::Configuration][Attributes::EscapeComment]=(escape_comments_chk->isChecked() ? Attributes::True : "");
+		config_params[Attributes::Configuration][Attributes::InitialDataFormat]=ini_data_fmt_cmb->currentData().toString();
+		config_params[Attributes::Configuration][Attributes::CodeCacheSize]=QString::number(code_cache_size_spb->value());
+		config_params[Attributes::Configuration][Attributes::CompressCodeCache]=(compress_code_cache_chk->isChecked() ? Attributes::True : "");
 		config_params[Attributes::Configuration][Attributes::OldPgSqlVersions]=(old_pgsql_versions_chk->isChecked() ? Attributes::True : "");
 
 		config_params[Attributes::Configuration][Attributes::TruncateColumnData]=(trunc_columns_data_chk->isChecked() ? Attributes::True : "");
@@ -621,6 +638,9 @@ void GeneralConfigWidget::applyConfiguration()
 	  widgets_geom.clear();
 
 	BaseObject::setEscapeComments(escape_comments_chk->isChecked());
+	PhysicalTable::setInitialDataFormat(static_cast<PhysicalTable::InitialDataFormat>(ini_data_fmt_cmb->currentIndex()));
+	CodeCache::setCompressColdEntries(compress_code_cache_chk->isChecked());
+	CodeCache::setBudget(static_cast<qint64>(code_cache_size_spb->value()) * 1024 * 1024);
 	BaseObject::setQuotingDisabled(disable_name_quoting_chk->isChecked());
 
 	QPageLayout page_lt;
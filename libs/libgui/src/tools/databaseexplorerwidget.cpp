@@ -30,7 +30,10 @@
 #include "settings/generalconfigwidget.h"
 #include "tools/datahandlingform.h"
 #include "pgmodelerguiplugin.h"
+#include "messagebox.h"
 #include <QScrollBar>
+#include <QEventLoop>
+#include <QThread>
 
 const QString DatabaseExplorerWidget::DepNotDefined;
 const QString DatabaseExplorerWidget::DepNotFound { QT_TR_NOOP("(not found, OID: %1)") };
@@ -147,6 +150,7 @@ const attribs_map DatabaseExplorerWidget::attribs_i18n {
 	{Attributes::Version, QT_TR_NOOP("Version")},	{Attributes::LcCollateMod, QT_TR_NOOP("LC COLLATE modifier")},
 	{Attributes::LcCtype, QT_TR_NOOP("LC CTYPE modifier")}, {Attributes::Provider, QT_TR_NOOP("Provider")},
 	{Attributes::IsExtType, QT_TR_NOOP("Is extension type")}, {Attributes::RefTables, QT_TR_NOOP("Referenced tables")},
+	{Attributes::PreparedQueries, QT_TR_NOOP("Prepared catalog queries")},
 	{Attributes::NullsNotDistinct, QT_TR_NOOP("Nulls not distinct")}, {Attributes::Constraints, QT_TR_NOOP("Constraints")},
 	{Attributes::Deterministic, QT_TR_NOOP("Deterministic")}, {Attributes::LcCtypeMod, QT_TR_NOOP("LC CTYPE modifier")},
 	{Attributes::TypeClass, QT_TR_NOOP("Type class")}, {Attributes::Locale, QT_TR_NOOP("Locale")}
@@ -166,6 +170,7 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 	curr_scroll_value = 0;
 	filter_parent->setVisible(false);
 	sort_column = 0;
+	catalog_task_running = false;
 	splitter->setSizes({ 80, 20 });
 
 	properties_tbw->setItemDelegate(new PlainTextItemDelegate(this, true));
@@ -279,6 +284,7 @@ DatabaseExplorerWidget::DatabaseExplorerWidget(QWidget *parent): QWidget(parent)
 	connect(sort_by_name_tb, &QToolButton::clicked, this, [this]() {
 			sort_column = sort_by_name_tb->isChecked() ? 0 : DatabaseImportWidget::ObjectId;
 			objects_trw->sortByColumn(sort_column, Qt::AscendingOrder);
+			placeLoadMoreItems();
 	});
 
 	QMenu *refresh_menu=new QMenu(refresh_tb);
@@ -937,7 +943,6 @@ QString DatabaseExplorerWidget::formatObjectName(attribs_map &attribs)
 			return DepNotDefined;
 
 		ObjectType obj_type=static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
-		attribs_map aux_attribs;
 		QString oid=attribs[Attributes::Oid],
 				obj_name=DepNotFound.arg(oid), sch_name;
 
@@ -950,8 +955,7 @@ QString DatabaseExplorerWidget::formatObjectName(attribs_map &attribs)
 		if(!attribs[Attributes::Schema].isEmpty() &&
 				attribs[Attributes::Schema]!="0")
 		{
-			aux_attribs=catalog.getObjectAttributes(ObjectType::Schema, attribs[Attributes::Schema].toUInt());
-			sch_name=BaseObject::formatName(aux_attribs[Attributes::Name], false);
+			sch_name=getObjectName(ObjectType::Schema, attribs[Attributes::Schema]);
 
 			if(!sch_name.isEmpty())
 				obj_name=sch_name + "." + obj_name;
@@ -1019,24 +1023,38 @@ QStringList DatabaseExplorerWidget::getObjectsNames(const std::vector<ObjectType
 		std::vector<attribs_map> attribs_vect;
 		std::vector<unsigned> oids_vect;
 		std::map<QString, attribs_map> attrs_map;
-		QStringList names;
+		QStringList names, missing_oids;
 
-		//Converting the oids to unsigned in order to filter them on Catalog
+		//Only the oids which names aren't cached yet are queried
 		for(auto &oid : oids)
-			oids_vect.push_back(oid.toUInt());
+		{
+			if(!obj_names_cache.count(getNameCacheKey(types, oid, sch_name, tab_name)) &&
+				 !missing_oids.contains(oid))
+				missing_oids.push_back(oid);
+		}
 
-		//Retrieve all the objects by their oids and put them on a auxiliary map in which key is their oids
-		for(auto &type : types)
+		if(!missing_oids.isEmpty())
 		{
-			attribs_vect = catalog.getObjectsAttributes(type, sch_name, tab_name, oids_vect);
+			//Converting the oids to unsigned in order to filter them on Catalog
+			for(auto &oid : missing_oids)
+				oids_vect.push_back(oid.toUInt());
+
+			//Retrieve all the objects by their oids and put them on a auxiliary map in which key is their oids
+			for(auto &type : types)
+			{
+				attribs_vect = catalog.getObjectsAttributes(type, sch_name, tab_name, oids_vect);
 
-			for(auto & attr : attribs_vect)
-				attrs_map[attr[Attributes::Oid]] = attr;
+				for(auto & attr : attribs_vect)
+					attrs_map[attr[Attributes::Oid]] = attr;
+			}
+
+			for(auto &oid : missing_oids)
+				obj_names_cache[getNameCacheKey(types, oid, sch_name, tab_name)] = formatObjectName(attrs_map[oid]);
 		}
 
-		//Retreving the names from the auxiliary map using the provided oids
+		//Retreving the names from the cache using the provided oids
 		for(auto &oid : oids)
-			names.push_back(formatObjectName(attrs_map[oid]));
+			names.push_back(obj_names_cache[getNameCacheKey(types, oid, sch_name, tab_name)]);
 
 		return names;
 	}
@@ -1066,7 +1084,10 @@ QString DatabaseExplorerWidget::getObjectName(const std::vector<ObjectType> &typ
 			return DepNotDefined;
 
 		attribs_map attribs;
-		QString name;
+		QString name, key = getNameCacheKey(types, oid, sch_name, tab_name);
+
+		if(obj_names_cache.count(key))
+			return obj_names_cache[key];
 
 		for(auto &type : types)
 		{
@@ -1074,10 +1095,14 @@ QString DatabaseExplorerWidget::getObjectName(const std::vector<ObjectType> &typ
 			name = formatObjectName(attribs);
 
 			if(!name.isEmpty())
-				return name;
+				break;
 		}
 
-		return DepNotDefined;
+		if(name.isEmpty())
+			name = DepNotDefined;
+
+		obj_names_cache[key] = name;
+		return name;
 	}
 	catch(Exception &e)
 	{
@@ -1085,8 +1110,19 @@ QString DatabaseExplorerWidget::getObjectName(const std::vector<ObjectType> &typ
 	}
 }
 
+QString DatabaseExplorerWidget::getNameCacheKey(const std::vector<ObjectType> &types, const QString &oid, const QString &sch_name, const QString &tab_name)
+{
+	QStringList type_ids;
+
+	for(auto &type : types)
+		type_ids.append(QString::number(enum_t(type)));
+
+	return QString("%1:%2:%3:%4").arg(type_ids.join(','), sch_name, tab_name, oid);
+}
+
 void DatabaseExplorerWidget::setConnection(Connection conn, const QString &default_db)
 {
+	obj_names_cache.clear();
 	this->connection=conn;
 	this->default_db=(default_db.isEmpty() ? "postgres" : default_db);
 }
@@ -1105,59 +1141,91 @@ void DatabaseExplorerWidget::clearObjectProperties()
 
 void DatabaseExplorerWidget::listObjects()
 {
-	try
-	{
-		QAction *act=qobject_cast<QAction *>(sender());
-		bool quick_refresh=(act ? act->data().toBool() : true);
+	QAction *act=qobject_cast<QAction *>(sender());
+	bool quick_refresh=(act ? act->data().toBool() : true);
+	std::shared_ptr<DatabaseImportWidget::ListedObjects> objects = std::make_shared<DatabaseImportWidget::ListedObjects>();
+	std::shared_ptr<bool> server_supported = std::make_shared<bool>(true);
+
+	// A listing or another catalog operation is already in progress
+	if(list_task.isRunning() || catalog_task_running)
+		return;
+
+	setRunningTask(true);
+	qApp->setOverrideCursor(Qt::WaitCursor);
 
+	/* The connection and the retrieval of the objects are done in a worker thread.
+	 * In a full refresh the children of all schemas and tables are retrieved at once,
+	 * in a quick refresh they are retrieved only when their parents are expanded */
+	list_task.start([this, quick_refresh, objects, server_supported](){
 		configureImportHelper();
-		objects_trw->blockSignals(true);
+		*objects = DatabaseImportWidget::retrieveObjects(import_helper, true, !quick_refresh);
+		*server_supported = catalog.isServerSupported();
+		import_helper.closeConnection();
+		catalog.closeConnection();
+	},
+	[this, quick_refresh, objects, server_supported](){
+		try
+		{
+			std::map<QTreeWidgetItem *, std::vector<attribs_map>> pending_objs;
+			QTreeWidgetItem *root = nullptr, *curr_root = nullptr;
 
-		/* If the database version is ignored we display the
-		 * alert message if the current db version is unsupported */
-		pg_version_alert_frm->setVisible(Connection::isDbVersionIgnored() &&
-																		 !catalog.isServerSupported());
+			sortObjects(objects->db_objects);
 
-		saveTreeState();
-		clearObjectProperties();
+			for(auto &[oid, children] : objects->children)
+				sortObjects(children);
 
-		if(quick_refresh)
-			qApp->setOverrideCursor(Qt::WaitCursor);
+			clearPendingObjects(nullptr);
+			obj_names_cache.clear();
+			objects_trw->blockSignals(true);
 
-		DatabaseImportWidget::listObjects(import_helper, objects_trw, false,
-																			GeneralConfigWidget::getConfigurationParam(Attributes::Configuration, Attributes::HideEmptyObjGroups) == Attributes::True ?
-																			DatabaseImportWidget::HideEmptyGrps : DatabaseImportWidget::NoGrpsFlag,
-																			true, quick_refresh, sort_column);
-
-		QTreeWidgetItem *root = new QTreeWidgetItem, *curr_root = nullptr;
-
-		//Changing the root item of the generated tree to be a special item containing info about the connected server
-		curr_root = objects_trw->topLevelItem(0);
-		objects_trw->takeTopLevelItem(0);
-		root->setText(0, connection.getConnectionId(true));
-		root->setIcon(0, GuiUtilsNs::getIcon("server"));
-		root->setData(DatabaseImportWidget::ObjectId, Qt::UserRole, -1);
-		root->setData(DatabaseImportWidget::ObjectTypeId, Qt::UserRole, enum_t(ObjectType::BaseObject));
-		root->setData(DatabaseImportWidget::ObjectSource, Qt::UserRole, tr("-- Source code unavailable for this kind of object --"));
-		root->addChild(curr_root);
-		objects_trw->addTopLevelItem(root);
-		root->setExpanded(true);
-		root->setSelected(true);
-		objects_trw->setCurrentItem(root);
-
-		restoreTreeState();
+			/* If the database version is ignored we display the
+			 * alert message if the current db version is unsupported */
+			pg_version_alert_frm->setVisible(Connection::isDbVersionIgnored() && !(*server_supported));
 
-		qApp->restoreOverrideCursor();
-		objects_trw->blockSignals(false);
+			saveTreeState();
+			clearObjectProperties();
 
-		import_helper.closeConnection();
-		catalog.closeConnection();
-	}
-	catch(Exception &e)
-	{
-		//qApp->restoreOverrideCursor();
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
-	}
+			DatabaseImportWidget::listObjects(import_helper, *objects, objects_trw, false,
+																				GeneralConfigWidget::getConfigurationParam(Attributes::Configuration, Attributes::HideEmptyObjGroups) == Attributes::True ?
+																				DatabaseImportWidget::HideEmptyGrps : DatabaseImportWidget::NoGrpsFlag,
+																				true, quick_refresh, sort_column, ItemsPageSize, &pending_objs);
+
+			//Changing the root item of the generated tree to be a special item containing info about the connected server
+			root = new QTreeWidgetItem;
+			curr_root = objects_trw->topLevelItem(0);
+			objects_trw->takeTopLevelItem(0);
+			root->setText(0, connection.getConnectionId(true));
+			root->setIcon(0, GuiUtilsNs::getIcon("server"));
+			root->setData(DatabaseImportWidget::ObjectId, Qt::UserRole, -1);
+			root->setData(DatabaseImportWidget::ObjectTypeId, Qt::UserRole, enum_t(ObjectType::BaseObject));
+			root->setData(DatabaseImportWidget::ObjectSource, Qt::UserRole, tr("-- Source code unavailable for this kind of object --"));
+			root->addChild(curr_root);
+			objects_trw->addTopLevelItem(root);
+			root->setExpanded(true);
+			root->setSelected(true);
+			objects_trw->setCurrentItem(root);
+
+			createLoadMoreItems(pending_objs);
+			placeLoadMoreItems();
+			restoreTreeState();
+
+			objects_trw->blockSignals(false);
+			qApp->restoreOverrideCursor();
+			setRunningTask(false);
+		}
+		catch(Exception &e)
+		{
+			objects_trw->blockSignals(false);
+			qApp->restoreOverrideCursor();
+			setRunningTask(false);
+			Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+		}
+	},
+	[this](Exception &e){
+		qApp->restoreOverrideCursor();
+		setRunningTask(false);
+		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+	});
 }
 
 void DatabaseExplorerWidget::configureImportHelper()
@@ -1170,12 +1238,17 @@ void DatabaseExplorerWidget::configureImportHelper()
 
 	catalog.closeConnection();
 	catalog.setQueryFilter(Catalog::ListAllObjects);
+	catalog.setPreparedQueries(true);
 	catalog.setConnection(connection);
 }
 
 void DatabaseExplorerWidget::handleObject(QTreeWidgetItem *item, int)
 {
-	if(item->data(DatabaseImportWidget::ObjectOtherData, Qt::UserRole).toInt() < 0)
+	if(item->data(DatabaseImportWidget::ObjectOtherData, Qt::UserRole).toInt() == LoadMoreItem)
+	{
+		loadMoreItems(item);
+	}
+	else if(item->data(DatabaseImportWidget::ObjectOtherData, Qt::UserRole).toInt() < 0)
 	{
 		updateItem(item->parent(), true);
 	}
@@ -1456,6 +1529,9 @@ void DatabaseExplorerWidget::dropObject(QTreeWidgetItem *item, bool cascade)
 					parent->setData(DatabaseImportWidget::ObjectCount, Qt::UserRole, QVariant::fromValue<unsigned>(cnt));
 				}
 
+				clearPendingObjects(item);
+				obj_names_cache.clear();
+
 				if(parent)
 					parent->takeChild(parent->indexOfChild(item));
 				else
@@ -1647,6 +1723,9 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 		QTreeWidgetItem *root=nullptr, *parent=nullptr, *aux_item=nullptr;
 		unsigned obj_id=item->data(DatabaseImportWidget::ObjectId, Qt::UserRole).toUInt();
 		std::vector<QTreeWidgetItem *> gen_items;
+		std::vector<ObjectType> types;
+		std::vector<attribs_map> objects;
+		std::map<QTreeWidgetItem *, std::vector<attribs_map>> pending_objs;
 		QString sch_name, tab_name;
 
 		qApp->setOverrideCursor(Qt::WaitCursor);
@@ -1659,6 +1738,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 		else
 		{
 			clearObjectProperties();
+			obj_names_cache.clear();
 			parent=item->parent();
 			sch_name=item->data(DatabaseImportWidget::ObjectSchema, Qt::UserRole).toString();
 			tab_name=item->data(DatabaseImportWidget::ObjectTable, Qt::UserRole).toString();
@@ -1668,6 +1748,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 				if(obj_id==0)
 				{
 					root=parent;
+					clearPendingObjects(item);
 					parent->takeChild(parent->indexOfChild(item));
 				}
 				else
@@ -1675,6 +1756,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 					if(obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type))
 					{
 						root=item;
+						clearPendingObjects(item);
 						root->takeChildren();
 
 						if(obj_type == ObjectType::Schema)
@@ -1685,6 +1767,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 					else
 					{
 						root=parent->parent();
+						clearPendingObjects(parent);
 						root->takeChild(root->indexOfChild(parent));
 					}
 				}
@@ -1696,17 +1779,25 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 			if(!sch_name.isEmpty())
 				signature.prepend(sch_name + ".");
 
-			configureImportHelper();
-
 			//Updates the group type only
 			if(obj_id == 0 || (!BaseTable::isBaseTable(obj_type) && obj_type!=ObjectType::Schema))
-				gen_items = DatabaseImportWidget::updateObjectsTree(import_helper, objects_trw, { obj_type }, false,
-																														DatabaseImportWidget::HideEmptyGrps, root, sch_name, tab_name);
+				types = { obj_type };
 			else
 				//Updates all child objcts when the selected object is a schema or table or view
-				gen_items = DatabaseImportWidget::updateObjectsTree(import_helper, objects_trw,
-																														BaseObject::getChildObjectTypes(obj_type), false,
-																														DatabaseImportWidget::HideEmptyGrps, root, sch_name, tab_name);
+				types = BaseObject::getChildObjectTypes(obj_type);
+
+			// The connection and the retrieval of the objects are done in a worker thread
+			runCatalogTask([this, &types, &objects, &sch_name, &tab_name](){
+				configureImportHelper();
+				objects = import_helper.getObjects(types, sch_name, tab_name, {{ Attributes::FilterTableTypes, Attributes::True }});
+				import_helper.closeConnection();
+			});
+
+			sortObjects(objects);
+
+			gen_items = DatabaseImportWidget::updateObjectsTree(import_helper, objects_trw, types, objects, false,
+																													DatabaseImportWidget::HideEmptyGrps, root, sch_name, tab_name,
+																													ItemsPageSize, &pending_objs);
 
 			//Creating dummy items for schemas and tables
 			if(obj_type == ObjectType::Schema || BaseTable::isBaseTable(obj_type))
@@ -1719,8 +1810,9 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 				}
 			}
 
-			import_helper.closeConnection();
+			createLoadMoreItems(pending_objs);
 			objects_trw->sortItems(sort_column, Qt::AscendingOrder);
+			placeLoadMoreItems();
 			objects_trw->setCurrentItem(nullptr);
 
 			if(BaseTable::isBaseTable(obj_type))
@@ -1750,6 +1842,169 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item, bool restore_tree
 	}
 }
 
+void DatabaseExplorerWidget::runCatalogTask(const std::function<void()> &task)
+{
+	/* The nested event loop below keeps delivering the application events so we avoid
+	 * running another catalog operation over the same import helper and catalog meanwhile */
+	if(catalog_task_running || list_task.isRunning())
+		throw Exception(tr("Another operation over the database is still running! Wait for it to finish and try again."),
+										ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+
+	QEventLoop event_loop;
+	Exception error;
+	bool failed = false;
+	QThread *task_thread = QThread::create([&task, &error, &failed](){
+		try
+		{
+			task();
+		}
+		catch(Exception &e)
+		{
+			error = Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+			failed = true;
+		}
+	});
+
+	/* The finished signal is delivered in a queued way to the event loop
+	 * so it can't be missed even if the task finishes before exec() is called */
+	connect(task_thread, &QThread::finished, &event_loop, &QEventLoop::quit);
+	catalog_task_running = true;
+	task_thread->start();
+	event_loop.exec(QEventLoop::ExcludeUserInputEvents);
+	task_thread->wait();
+	delete task_thread;
+	catalog_task_running = false;
+
+	if(failed)
+		throw Exception(error.getErrorMessage(), error.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &error);
+}
+
+void DatabaseExplorerWidget::setRunningTask(bool running)
+{
+	objects_trw->setEnabled(!running);
+	refresh_tb->setEnabled(!running);
+	toggle_display_tb->setEnabled(!running);
+	sort_by_name_tb->setEnabled(!running);
+	drop_db_tb->setEnabled(!running);
+	filter_parent->setEnabled(!running);
+	raw_attrib_names_chk->setEnabled(!running);
+}
+
+void DatabaseExplorerWidget::sortObjects(std::vector<attribs_map> &objects)
+{
+	std::stable_sort(objects.begin(), objects.end(), [this](attribs_map &attr1, attribs_map &attr2) {
+		if(sort_column == 0)
+			return attr1[Attributes::Name] < attr2[Attributes::Name];
+
+		return attr1[Attributes::Oid].toUInt() < attr2[Attributes::Oid].toUInt();
+	});
+}
+
+void DatabaseExplorerWidget::createLoadMoreItems(std::map<QTreeWidgetItem *, std::vector<attribs_map>> &pending_objs)
+{
+	QTreeWidgetItem *item = nullptr;
+	QFont fnt = objects_trw->font();
+
+	fnt.setItalic(true);
+
+	for(auto &[group, objects] : pending_objs)
+	{
+		item = new QTreeWidgetItem(group);
+		item->setFont(0, fnt);
+		item->setText(0, tr("Load more... (%1 remaining)").arg(objects.size()));
+		item->setToolTip(0, tr("Click to list the next %1 objects").arg(ItemsPageSize));
+		item->setData(DatabaseImportWidget::ObjectId, Qt::UserRole, -1);
+		item->setData(DatabaseImportWidget::ObjectOtherData, Qt::UserRole, QVariant::fromValue<int>(LoadMoreItem));
+		pending_objects[item] = std::move(objects);
+	}
+
+	pending_objs.clear();
+}
+
+void DatabaseExplorerWidget::loadMoreItems(QTreeWidgetItem *load_more_item)
+{
+	if(!load_more_item || !pending_objects.count(load_more_item))
+		return;
+
+	QTreeWidgetItem *group = load_more_item->parent(), *item = nullptr, *aux_item = nullptr;
+	std::vector<attribs_map> &objects = pending_objects[load_more_item];
+	QString sch_name = group->data(DatabaseImportWidget::ObjectSchema, Qt::UserRole).toString(),
+			tab_name = group->data(DatabaseImportWidget::ObjectTable, Qt::UserRole).toString();
+	ObjectType obj_type;
+	unsigned count = std::min<unsigned>(ItemsPageSize, objects.size());
+
+	objects_trw->blockSignals(true);
+	objects_trw->setUpdatesEnabled(false);
+
+	for(unsigned idx = 0; idx < count; idx++)
+	{
+		item = DatabaseImportWidget::createObjectItem(import_helper, objects[idx], group, false, group->parent(), sch_name, tab_name);
+		obj_type = static_cast<ObjectType>(item->data(DatabaseImportWidget::ObjectTypeId, Qt::UserRole).toUInt());
+
+		//Creating dummy items for schemas and tables so their children are retrieved on expansion
+		if(obj_type == ObjectType::Schema || BaseTable::isBaseTable(obj_type))
+		{
+			aux_item=new QTreeWidgetItem(item);
+			aux_item->setText(0, "...");
+			aux_item->setData(DatabaseImportWidget::ObjectOtherData, Qt::UserRole, QVariant::fromValue<int>(-1));
+		}
+	}
+
+	objects.erase(objects.begin(), objects.begin() + count);
+
+	if(objects.empty())
+	{
+		pending_objects.erase(load_more_item);
+		delete load_more_item;
+	}
+	else
+	{
+		load_more_item->setText(0, tr("Load more... (%1 remaining)").arg(objects.size()));
+		group->removeChild(load_more_item);
+		group->addChild(load_more_item);
+	}
+
+	group->sortChildren(sort_column, Qt::AscendingOrder);
+	placeLoadMoreItems();
+
+	objects_trw->setUpdatesEnabled(true);
+	objects_trw->blockSignals(false);
+}
+
+void DatabaseExplorerWidget::clearPendingObjects(QTreeWidgetItem *root)
+{
+	QTreeWidgetItem *parent = nullptr;
+
+	for(auto itr = pending_objects.begin(); itr != pending_objects.end();)
+	{
+		parent = itr->first->parent();
+
+		while(root && parent && parent != root)
+			parent = parent->parent();
+
+		if(!root || parent == root)
+			itr = pending_objects.erase(itr);
+		else
+			itr++;
+	}
+}
+
+void DatabaseExplorerWidget::placeLoadMoreItems()
+{
+	QTreeWidgetItem *group = nullptr;
+
+	for(auto &[item, objects] : pending_objects)
+	{
+		group = item->parent();
+
+		if(group && group->indexOfChild(item) != group->childCount() - 1)
+		{
+			group->removeChild(item);
+			group->addChild(item);
+		}
+	}
+}
+
 void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 {
 	try
@@ -1768,49 +2023,63 @@ void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 			//In case of the cached attributes are empty
 			if(orig_attribs.empty() || force_reload)
 			{
+				bool is_server_item = (item == objects_trw->topLevelItem(0));
+				QString tab_name=item->data(DatabaseImportWidget::ObjectTable, Qt::UserRole).toString(),
+						sch_name=item->data(DatabaseImportWidget::ObjectSchema, Qt::UserRole).toString();
+
 				qApp->setOverrideCursor(Qt::WaitCursor);
-				catalog.setConnection(connection);
 
-				//Loading the server properties
-				if(item == objects_trw->topLevelItem(0))
-					orig_attribs=catalog.getServerAttributes();
-				//Retrieve them from the catalog
-				else if(obj_type!=ObjectType::Column)
-				{
-					orig_attribs=catalog.getObjectAttributes(obj_type, oid);
+				// The attributes are retrieved and formatted in a worker thread
+				runCatalogTask([&](){
+					catalog.setConnection(connection);
 
-					if(obj_type == ObjectType::Table)
+					//Loading the server properties
+					if(is_server_item)
 					{
-						std::vector<attribs_map> ref_fks;
-						attribs_map ref_table, ref_schema;
-						QStringList tab_list;
+						Catalog::PreparedQueryStats stats = Catalog::getPreparedQueryStats();
 
-						ref_fks = catalog.getObjectsAttributes(ObjectType::Constraint, "", "", {}, {{ Attributes::CustomFilter, QString("contype='f' AND cs.confrelid=%1").arg(orig_attribs[Attributes::Oid])}});
+						orig_attribs=catalog.getServerAttributes();
+						orig_attribs[Attributes::PreparedQueries] = tr("%1 prepared, %2 reused, %3 not preparable, ~%4 ms of server planning saved")
+																												.arg(stats.prepared_count).arg(stats.reused_count)
+																												.arg(stats.unprepared_count).arg(stats.planning_time_saved, 0, 'f', 2);
+					}
+					//Retrieve them from the catalog
+					else if(obj_type!=ObjectType::Column)
+					{
+						orig_attribs=catalog.getObjectAttributes(obj_type, oid);
 
-						for(auto &fk : ref_fks)
+						if(obj_type == ObjectType::Table)
 						{
-							ref_table = catalog.getObjectAttributes(ObjectType::Table, fk[Attributes::Table].toUInt());
-							ref_schema = catalog.getObjectAttributes(ObjectType::Schema, ref_table[Attributes::Schema].toUInt());
-							tab_list.push_back(QString("%1.%2").arg(ref_schema[Attributes::Name]).arg(ref_table[Attributes::Name]));
-						}
+							std::vector<attribs_map> ref_fks;
+							attribs_map ref_table, ref_schema;
+							QStringList tab_list;
+
+							ref_fks = catalog.getObjectsAttributes(ObjectType::Constraint, "", "", {}, {{ Attributes::CustomFilter, QString("contype='f' AND cs.confrelid=%1").arg(orig_attribs[Attributes::Oid])}});
+
+							for(auto &fk : ref_fks)
+							{
+								ref_table = catalog.getObjectAttributes(ObjectType::Table, fk[Attributes::Table].toUInt());
+								ref_schema = catalog.getObjectAttributes(ObjectType::Schema, ref_table[Attributes::Schema].toUInt());
+								tab_list.push_back(QString("%1.%2").arg(ref_schema[Attributes::Name]).arg(ref_table[Attributes::Name]));
+							}
 
-						if(!tab_list.isEmpty())
-							orig_attribs[Attributes::Referrers] = tab_list.join(UtilsNs::DataSeparator);
+							if(!tab_list.isEmpty())
+								orig_attribs[Attributes::Referrers] = tab_list.join(UtilsNs::DataSeparator);
+						}
 					}
-				}
-				else
-				{
-					QString tab_name=item->data(DatabaseImportWidget::ObjectTable, Qt::UserRole).toString(),
-							sch_name=item->data(DatabaseImportWidget::ObjectSchema, Qt::UserRole).toString();
-					std::vector<attribs_map> vect_attribs=catalog.getObjectsAttributes(obj_type, sch_name, tab_name, { oid });
+					else
+					{
+						std::vector<attribs_map> vect_attribs=catalog.getObjectsAttributes(obj_type, sch_name, tab_name, { oid });
 
-					if(!vect_attribs.empty())
-						orig_attribs=vect_attribs[0];
-				}
+						if(!vect_attribs.empty())
+							orig_attribs=vect_attribs[0];
+					}
 
-				//Format values and translate the attribute names
-				fmt_attribs=formatObjectAttribs(orig_attribs);
-				fmt_attribs.erase(Attributes::Signature);
+					//Format values and translate the attribute names
+					fmt_attribs=formatObjectAttribs(orig_attribs);
+					fmt_attribs.erase(Attributes::Signature);
+					catalog.closeConnection();
+				});
 
 				//Store the original attributes on the item to permit value replacements when using code snippets
 				item->setData(DatabaseImportWidget::ObjectOtherData, Qt::UserRole, QVariant::fromValue<attribs_map>(orig_attribs));
@@ -1818,10 +2087,9 @@ void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 				//Store the attributes on the item to avoid repeatedly query the database
 				item->setData(DatabaseImportWidget::ObjectAttribs, Qt::UserRole, QVariant::fromValue<attribs_map>(fmt_attribs));
 
-				if(item != objects_trw->topLevelItem(0))
+				if(!is_server_item)
 					item->setData(DatabaseImportWidget::ObjectSource, Qt::UserRole, DefaultSourceCode);
 
-				catalog.closeConnection();
 				qApp->restoreOverrideCursor();
 			}
 		}
@@ -31,7 +31,9 @@
 #include "ui_databaseexplorerwidget.h"
 #include "databaseimporthelper.h"
 #include "schemaparser.h"
+#include "utils/backgroundtask.h"
 #include <QMenu>
+#include <functional>
 
 class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplorerWidget {
 	Q_OBJECT
@@ -54,6 +56,22 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		
 		//! \brief Stores the translations of all used attributes at properties panel
 		static const attribs_map attribs_i18n;
+
+		/*! \brief Maximum amount of items created at once in an object group. The remaining objects
+		 * of the group have their items created on demand by activating the "load more" item */
+		static constexpr unsigned ItemsPageSize = 1000;
+
+		//! \brief Value of the ObjectOtherData field that identifies the "load more" items
+		static constexpr int LoadMoreItem = -2;
+
+		/*! \brief Stores the objects retrieved from the database which items were not created yet.
+		 * The key is the "load more" item placed at the end of the group of those objects */
+		std::map<QTreeWidgetItem *, std::vector<attribs_map>> pending_objects;
+
+		/*! \brief Stores the object names already resolved from their oids (see getObjectName() and getObjectsNames()).
+		 * This cache avoids querying the catalog repeatedly while formatting objects properties and is cleared
+		 * every time the tree or part of it is refreshed */
+		attribs_map obj_names_cache;
 		
 		/*! \brief Connection used to handle objects on database. This connection is copied
 		whenever a new operation must be performed on database */
@@ -67,6 +85,13 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		//! \brief Catalog instance used to retrieve object's attributes
 		Catalog catalog;
 		
+		/*! \brief Runs the listing of the database objects in a worker thread. This attribute must be declared after
+		 * the import helper and the catalog so it is destroyed (waiting for the running listing) before them */
+		BackgroundTask list_task;
+
+		//! \brief Indicates that a catalog operation is running in runCatalogTask() so it can't be started again meanwhile
+		bool catalog_task_running;
+
 		SchemaParser schparser;
 		
 		//! \brief Stores the actions to be performed over the object
@@ -115,6 +140,35 @@ class __libgui DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplor
 		 * Optional schema and table names can be specified to filter the results */
 		QStringList getObjectsNames(ObjectType obj_type, const QStringList &oids, const QString &sch_name="", const QString tab_name="");
 		
+		//! \brief Returns the key used to store in the cache the name of the object with the provided oid
+		QString getNameCacheKey(const std::vector<ObjectType> &types, const QString &oid, const QString &sch_name, const QString &tab_name);
+
+		/*! \brief Runs the provided catalog operation in a worker thread. While the operation runs the application keeps processing
+		 * its events, except the user input ones, so the UI is not frozen by slow catalog queries. Errors raised in the worker thread
+		 * are rethrown in the caller's thread */
+		void runCatalogTask(const std::function<void()> &task);
+
+		//! \brief Disables the widgets that trigger catalog operations while the objects listing is running (and enables them again afterwards)
+		void setRunningTask(bool running);
+
+		/*! \brief Sorts the objects retrieved from the catalog by the current sorting column. Since the items are
+		 * created in pages the pages must follow the order of the tree otherwise the items of the next pages
+		 * would be placed amid the current ones */
+		void sortObjects(std::vector<attribs_map> &objects);
+
+		/*! \brief Creates a "load more" item at the end of each group which objects were not all created and
+		 * stores the pending objects so they can be created later (see loadMoreItems()) */
+		void createLoadMoreItems(std::map<QTreeWidgetItem *, std::vector<attribs_map>> &pending_objs);
+
+		//! \brief Creates the items of the next page of pending objects associated to the provided "load more" item
+		void loadMoreItems(QTreeWidgetItem *load_more_item);
+
+		//! \brief Discards the pending objects of the groups that are descendants of the provided item (or all of them if root is null)
+		void clearPendingObjects(QTreeWidgetItem *root);
+
+		//! \brief Moves the "load more" items to the end of their groups after sorting the tree
+		void placeLoadMoreItems();
+
 		//! \brief Format the object's name based upon the passed attributes
 		QString formatObjectName(attribs_map &attribs);
 		
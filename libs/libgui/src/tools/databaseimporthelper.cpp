@@ -23,8 +23,10 @@
 #include "defaultlanguages.h"
 #include "utilsns.h"
 #include "coreutilsns.h"
+#include <set>
 
 const QString DatabaseImportHelper::UnkownObjectOidXml {"\t<!--[ unknown object OID=%1 ]-->\n"};
+QMutex DatabaseImportHelper::build_mutex;
 
 DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 {
@@ -33,10 +35,12 @@ DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 
 	import_canceled=ignore_errors=import_sys_objs=import_ext_objs=false;
 	comments_as_aliases=rand_rel_colors=update_fk_rels=is_working_model=false;
+	incremental_import=false;
 	auto_resolve_deps=true;
 	import_filter=Catalog::ListAllObjects | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 	xmlparser=nullptr;
 	dbmodel=nullptr;
+	catalog=&own_catalog;
 
 	//Binding create methods
 	create_methods = {
@@ -79,7 +83,9 @@ void DatabaseImportHelper::setConnection(Connection &conn)
 	try
 	{
 		connection.setConnectionParams(conn.getConnectionParams());
-		catalog.setConnection(connection);
+
+		if(catalog == &own_catalog)
+			catalog->setConnection(connection);
 	}
 	catch(Exception &e)
 	{
@@ -90,7 +96,17 @@ void DatabaseImportHelper::setConnection(Connection &conn)
 void DatabaseImportHelper::closeConnection()
 {
 	connection.close();
-	catalog.closeConnection();
+
+	if(catalog == &own_catalog)
+		catalog->closeConnection();
+}
+
+void DatabaseImportHelper::setCatalog(Catalog *ext_catalog)
+{
+	if(catalog == &own_catalog && ext_catalog)
+		own_catalog.closeConnection();
+
+	catalog = ext_catalog ? ext_catalog : &own_catalog;
 }
 
 void DatabaseImportHelper::setCurrentDatabase(const QString &dbname)
@@ -98,7 +114,7 @@ void DatabaseImportHelper::setCurrentDatabase(const QString &dbname)
 	try
 	{
 		connection.switchToDatabase(dbname);
-		catalog.setConnection(connection);
+		catalog->setConnection(connection);
 	}
 	catch(Exception &e)
 	{
@@ -155,9 +171,14 @@ void DatabaseImportHelper::setImportOptions(bool import_sys_objs, bool import_ex
 		import_filter = Catalog::ListAllObjects | Catalog::ExclBuiltinArrayTypes | Catalog::ExclExtensionObjs | Catalog::ExclSystemObjs;
 }
 
+void DatabaseImportHelper::setIncrementalImport(bool value)
+{
+	incremental_import = value;
+}
+
 unsigned DatabaseImportHelper::getLastSystemOID()
 {
-	return catalog.getLastSysObjectOID();
+	return catalog->getLastSysObjectOID();
 }
 
 QString DatabaseImportHelper::getCurrentDatabase()
@@ -167,15 +188,15 @@ QString DatabaseImportHelper::getCurrentDatabase()
 
 Catalog DatabaseImportHelper::getCatalog()
 {
-	return catalog;
+	return *catalog;
 }
 
 attribs_map DatabaseImportHelper::getObjects(ObjectType obj_type, const QString &schema, const QString &table, attribs_map extra_attribs)
 {
 	try
 	{
-		catalog.setQueryFilter(import_filter);
-		return catalog.getObjectsNames(obj_type, schema, table, extra_attribs);
+		catalog->setQueryFilter(import_filter);
+		return catalog->getObjectsNames(obj_type, schema, table, extra_attribs);
 	}
 	catch(Exception &e)
 	{
@@ -187,8 +208,8 @@ std::vector<attribs_map> DatabaseImportHelper::getObjects(std::vector<ObjectType
 {
 	try
 	{
-		catalog.setQueryFilter(import_filter);
-		return catalog.getObjectsNames(obj_types, schema, table, extra_attribs);
+		catalog->setQueryFilter(import_filter);
+		return catalog->getObjectsNames(obj_types, schema, table, extra_attribs);
 	}
 	catch(Exception &e)
 	{
@@ -234,9 +255,9 @@ void DatabaseImportHelper::retrieveSystemObjects()
 			obj_map=&system_objs;
 
 			if(sys_objs[i] != ObjectType::Language)
-				catalog.setQueryFilter(Catalog::ListOnlySystemObjs);
+				catalog->setQueryFilter(Catalog::ListOnlySystemObjs);
 			else
-				catalog.setQueryFilter(Catalog::ListAllObjects);
+				catalog->setQueryFilter(Catalog::ListAllObjects);
 		}
 		else
 		{
@@ -244,11 +265,11 @@ void DatabaseImportHelper::retrieveSystemObjects()
 
 			/* Only system built in types are loaded initially.
 			 * User defined types attributes are retrived only on demand (see getType()) */
-			catalog.setQueryFilter(Catalog::ListOnlySystemObjs);
+			catalog->setQueryFilter(Catalog::ListOnlySystemObjs);
 		}
 
 		//Query the objects on the catalog and put them on the map
-		objects=catalog.getObjectsAttributes(sys_objs[i]);
+		objects=catalog->getObjectsAttributes(sys_objs[i]);
 		itr=objects.begin();
 
 		while(itr!=objects.end() && !import_canceled)
@@ -270,7 +291,7 @@ void DatabaseImportHelper::retrieveUserObjects()
 	std::map<unsigned, std::vector<unsigned>>::iterator col_itr;
 	QStringList names;
 
-	catalog.setQueryFilter(import_filter);
+	catalog->setQueryFilter(import_filter);
 
 	//Retrieving selected database level objects and table children objects (except columns)
 	for(auto &[obj_type, obj_oids] : object_oids)
@@ -282,7 +303,7 @@ void DatabaseImportHelper::retrieveUserObjects()
 													 tr("Retrieving objects... `%1'").arg(BaseObject::getTypeName(obj_type)),
 													 obj_type);
 
-		obj_attribs = catalog.getObjectsAttributes(obj_type, "", "", obj_oids);
+		obj_attribs = catalog->getObjectsAttributes(obj_type, "", "", obj_oids);
 
 		for(auto &attrs : obj_attribs)
 		{
@@ -328,7 +349,7 @@ void DatabaseImportHelper::retrieveTableColumns(const QString &sch_name, const Q
 		std::vector<attribs_map> cols;
 		unsigned tab_oid=0, col_oid;
 
-		cols=catalog.getObjectsAttributes(ObjectType::Column, sch_name, tab_name, col_ids);
+		cols=catalog->getObjectsAttributes(ObjectType::Column, sch_name, tab_name, col_ids);
 
 		for(auto &itr : cols)
 		{
@@ -613,19 +634,29 @@ void DatabaseImportHelper::updateFKRelationships()
 
 void DatabaseImportHelper::importDatabase()
 {
+	bool building = false;
+
 	try
 	{
 		if(!dbmodel)
 			throw Exception(ErrorCode::OprNotAllocatedObject ,PGM_FUNC,PGM_FILE,PGM_LINE);
 
-		BaseGraphicObject::setUpdatesEnabled(false);
-		dbmodel->setObjectListsCapacity(creation_order.size());
-
 		cached_names.clear();
 		cached_signatures.clear();
 
+		if(incremental_import)
+			filterUnchangedObjects();
+
 		retrieveSystemObjects();
 		retrieveUserObjects();
+
+		// From here the model is changed so other imports in progress must wait their turn
+		QMutexLocker build_locker(&build_mutex);
+
+		building = true;
+		BaseGraphicObject::setUpdatesEnabled(false);
+		removeOutdatedObjects();
+		dbmodel->setObjectListsCapacity(creation_order.size());
 		createObjects();
 		createTableInheritances();
 		createTablePartitionings();
@@ -649,6 +680,7 @@ void DatabaseImportHelper::importDatabase()
 		}
 
 		BaseGraphicObject::setUpdatesEnabled(true);
+		building = false;
 		dbmodel->setObjectsModified();
 
 		if(!import_canceled)
@@ -656,6 +688,9 @@ void DatabaseImportHelper::importDatabase()
 			swapSequencesTablesIds();
 			assignSequencesToColumns();
 
+			if(incremental_import)
+				updateCatalogSnapshot();
+
 			if(!errors.empty())
 			{
 				QString log_name;
@@ -708,8 +743,19 @@ void DatabaseImportHelper::importDatabase()
 	}
 	catch(Exception &e)
 	{
-		BaseGraphicObject::setUpdatesEnabled(true);
-		dbmodel->setObjectsModified();
+		/* The build mutex was released during the stack unwinding, so we take it again
+		 * before restoring the global updates flag. This way a concurrent import which
+		 * is still creating its objects isn't affected. The flag is only restored if
+		 * this import had disabled it */
+		if(building)
+		{
+			QMutexLocker build_locker(&build_mutex);
+			BaseGraphicObject::setUpdatesEnabled(true);
+		}
+
+		if(dbmodel)
+			dbmodel->setObjectsModified();
+
 		resetImportParameters();
 
 		/* When running in a separated thread (other than the main application thread)
@@ -724,12 +770,12 @@ void DatabaseImportHelper::importDatabase()
 
 void DatabaseImportHelper::setObjectFilters(QStringList filter, bool only_matching, bool match_signature, QStringList force_tab_obj_types)
 {
-	catalog.setObjectFilters(filter, only_matching, match_signature, force_tab_obj_types);
+	catalog->setObjectFilters(filter, only_matching, match_signature, force_tab_obj_types);
 }
 
 std::map<ObjectType, QString> DatabaseImportHelper::getObjectFilters()
 {
-	return catalog.getObjectFilters();
+	return catalog->getObjectFilters();
 }
 
 void DatabaseImportHelper::cancelImport()
@@ -759,12 +805,13 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 	 * Languages: C, SQL, PlPgsql, Internal
 	 * Tablespaces: pg_global, pg_default */
 
-	if(catalog.isSystemObject(oid) &&
+	if(catalog->isSystemObject(oid) &&
 			(obj_type == ObjectType::Schema || obj_type == ObjectType::Role ||
 			 obj_type == ObjectType::Collation || obj_type == ObjectType::Tablespace ||
 			 obj_type == ObjectType::Language) &&
 			dbmodel->getObjectIndex(obj_name, obj_type) >= 0)
 	{
+		imported_objs[oid] = dbmodel->getObject(obj_name, obj_type);
 		created_objs.push_back(oid);
 		return;
 	}
@@ -773,7 +820,7 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 	 * we just mark it as created */
 	if(is_working_model && obj_type != ObjectType::Database)
 	{
-		bool obj_exists = false;
+		BaseObject *existing_obj = nullptr;
 
 		/* If the object is a table-child one, we retrieve the parent table from the model
 		 * and then check if the object exists in it */
@@ -783,12 +830,12 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 																																		{ ObjectType::Table,
 																																			ObjectType::ForeignTable,
 																																			ObjectType::View }));
-			obj_exists = (tab && tab->getObjectIndex(attribs[Attributes::Name], obj_type) >= 0);
+			existing_obj = (tab ? tab->getObject(attribs[Attributes::Name], obj_type) : nullptr);
 		}
 		else
 		{
 			// Checking if the object exists in the database model
-			obj_exists = dbmodel->getObjectIndex(getObjectName(attribs[Attributes::Oid], true), obj_type) >= 0;
+			existing_obj = dbmodel->getObject(getObjectName(attribs[Attributes::Oid], true), obj_type);
 
 			/* If the object is a table/view/foreign table, we need to retrieve the column attributes
 			 * from the database so constraints and other objects to be created can find them */
@@ -796,8 +843,9 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 				retrieveTableColumns(getObjectName(attribs[Attributes::Schema]), attribs[Attributes::Name]);
 		}
 
-		if(obj_exists)
+		if(existing_obj)
 		{
+			imported_objs[oid] = existing_obj;
 			created_objs.push_back(oid);
 			return;
 		}
@@ -811,7 +859,7 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 				attribs[Attributes::DeclInTable]="";
 
 			//System objects will have the sql disabled by default
-			attribs[Attributes::SqlDisabled]=(catalog.isSystemObject(oid) || catalog.isExtensionObject(oid) ? Attributes::True : "");
+			attribs[Attributes::SqlDisabled]=(catalog->isSystemObject(oid) || catalog->isExtensionObject(oid) ? Attributes::True : "");
 
 			if(comments_as_aliases &&
 					(BaseGraphicObject::isGraphicObject(obj_type) || TableObject::isTableObject(obj_type)))
@@ -848,13 +896,17 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 			{
 				configureDatabase(attribs);
 				dbmodel->setPgOid(oid);
+				imported_objs[oid] = dbmodel;
 			}
 			else if(create_methods.count(obj_type))
 			{
 				BaseObject *obj = create_methods[obj_type](attribs);
 
 				if(obj)
+				{
 					obj->setPgOid(oid);
+					imported_objs[oid] = obj;
+				}
 
 				/* Register that the object was successfully created in order to avoid
 				 * creating it again on the recursive object creation. (see getDependencyObject()) */
@@ -912,16 +964,16 @@ QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType
 		/* If the attributes for the dependency does not exists and the automatic dependency
 		resolution is enable, the object's attributes will be retrieved from catalog */
 		if(auto_resolve_deps && obj_attr.empty() &&
-				((import_ext_objs && catalog.isExtensionObject(obj_oid)) ||
-				 (import_sys_objs  && obj_oid <= catalog.getLastSysObjectOID()) ||
-				 (obj_oid > catalog.getLastSysObjectOID() && !catalog.isExtensionObject(obj_oid))))
+				((import_ext_objs && catalog->isExtensionObject(obj_oid)) ||
+				 (import_sys_objs  && obj_oid <= catalog->getLastSysObjectOID()) ||
+				 (obj_oid > catalog->getLastSysObjectOID() && !catalog->isExtensionObject(obj_oid))))
 		{
-			catalog.setQueryFilter(Catalog::ListAllObjects);
-			std::vector<attribs_map> attribs_vect=catalog.getObjectsAttributes(obj_type,"","", { obj_oid });
+			catalog->setQueryFilter(Catalog::ListAllObjects);
+			std::vector<attribs_map> attribs_vect=catalog->getObjectsAttributes(obj_type,"","", { obj_oid });
 
 			if(!attribs_vect.empty())
 			{
-				if(obj_oid <= catalog.getLastSysObjectOID())
+				if(obj_oid <= catalog->getLastSysObjectOID())
 					system_objs[obj_oid]=attribs_vect[0];
 				else
 					user_objs[obj_oid]=attribs_vect[0];
@@ -1017,11 +1069,356 @@ void DatabaseImportHelper::resetImportParameters()
 	constraints.clear();
 	obj_perms.clear();
 	col_perms.clear();
-	connection.close();
-	catalog.closeConnection();
+	closeConnection();
 	inherited_cols.clear();
 	imported_tables.clear();
 	created_objs.clear();
+	obj_fingerprints.clear();
+	outdated_objs.clear();
+	imported_objs.clear();
+}
+
+QString DatabaseImportHelper::getSnapshotKey(ObjectType obj_type, const QString &signature, const QString &parent)
+{
+	return QString("%1:%2:%3").arg(BaseObject::getSchemaName(obj_type), parent, signature);
+}
+
+QString DatabaseImportHelper::getSnapshotKey(BaseObject *object)
+{
+	if(!object)
+		return "";
+
+	TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+
+	if(tab_obj && tab_obj->getParentTable())
+		return getSnapshotKey(object->getObjectType(), object->getName(), tab_obj->getParentTable()->getSignature());
+
+	return getSnapshotKey(object->getObjectType(), object->getSignature(), "");
+}
+
+BaseObject *DatabaseImportHelper::getSnapshotObject(const std::tuple<ObjectType, QString, QString, QString> &entry)
+{
+	ObjectType obj_type = std::get<DatabaseModel::SnapObjectType>(entry);
+	const QString &signature = std::get<DatabaseModel::SnapSignature>(entry),
+			&parent = std::get<DatabaseModel::SnapParent>(entry);
+
+	if(obj_type == ObjectType::Database)
+		return dbmodel;
+
+	if(!parent.isEmpty())
+	{
+		BaseTable *table = dynamic_cast<BaseTable *>(dbmodel->getObject(parent, { ObjectType::Table,
+																																							ObjectType::ForeignTable,
+																																							ObjectType::View }));
+		return table ? table->getObject(signature, obj_type) : nullptr;
+	}
+
+	return dbmodel->getObject(signature, obj_type);
+}
+
+void DatabaseImportHelper::filterUnchangedObjects()
+{
+	try
+	{
+		unsigned db_oid = 0;
+
+		catalog->setQueryFilter(Catalog::ListAllObjects);
+		db_oid = catalog->getObjectOID(getCurrentDatabase(), ObjectType::Database).toUInt();
+
+		emit s_progressUpdated(0, tr("Computing the catalog fingerprints of the selected objects..."), ObjectType::Database);
+		selectOutdatedObjects(db_oid, catalog->getObjectsFingerprints(object_oids));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void DatabaseImportHelper::selectOutdatedObjects(unsigned db_oid, const std::map<unsigned, QString> &fingerprints)
+{
+	if(!dbmodel)
+		throw Exception(ErrorCode::OprNotAllocatedObject ,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	try
+	{
+		obj_fingerprints = fingerprints;
+		outdated_objs.clear();
+
+		const auto &snapshot = dbmodel->getCatalogSnapshot();
+
+		/* All selected objects are imported when the model has no snapshot of the current database.
+		 * The same happens when the model isn't the working one since the objects that didn't change
+		 * in the database must already exist in the model in order to be reused */
+		if(!is_working_model || snapshot.empty() || dbmodel->getCatalogSnapshotDatabase() != db_oid)
+			return;
+
+		std::map<QString, unsigned> snap_oids;
+		std::set<BaseObject *> visited;
+		std::set<unsigned> reimport_oids;
+		std::vector<BaseObject *> pending;
+		std::vector<unsigned> changed_oids, dropped_oids, added_oids;
+		BaseObject *obj = nullptr;
+		TableObject *tab_obj = nullptr;
+		BaseRelationship *rel = nullptr;
+		QString key;
+
+		diffCatalogSnapshot(snapshot, obj_fingerprints, changed_oids, dropped_oids, added_oids);
+
+		for(auto &[oid, entry] : snapshot)
+		{
+			snap_oids[getSnapshotKey(std::get<DatabaseModel::SnapObjectType>(entry),
+															 std::get<DatabaseModel::SnapSignature>(entry),
+															 std::get<DatabaseModel::SnapParent>(entry))] = oid;
+		}
+
+		/* Changed objects that don't exist in the model anymore are imported again,
+		 * the ones that exist are removed and then imported again */
+		for(auto &oid : changed_oids)
+		{
+			obj = getSnapshotObject(snapshot.at(oid));
+
+			if(obj)
+				pending.push_back(obj);
+			else
+				reimport_oids.insert(oid);
+		}
+
+		// Dropped objects are only removed from the model
+		for(auto &oid : dropped_oids)
+		{
+			obj = getSnapshotObject(snapshot.at(oid));
+
+			if(obj)
+				pending.push_back(obj);
+		}
+
+		/* Every imported object that references an outdated one is removed and imported again too,
+		 * otherwise it would keep references to objects destroyed from the model */
+		while(!pending.empty())
+		{
+			obj = pending.back();
+			pending.pop_back();
+			tab_obj = dynamic_cast<TableObject *>(obj);
+			rel = dynamic_cast<BaseRelationship *>(obj);
+
+			// Table children not tracked in the snapshot (e.g. columns) are imported again together with their tables
+			if(tab_obj && !snap_oids.count(getSnapshotKey(obj)))
+				obj = tab_obj->getParentTable();
+
+			if(!obj || visited.count(obj))
+				continue;
+
+			visited.insert(obj);
+
+			/* Relationships are removed as well as the tables connected by them, this way the inheritance, partitioning
+			 * and FK relationships are recreated when the tables are imported again */
+			if(rel)
+			{
+				outdated_objs.push_back(rel);
+
+				if(rel->getObjectType() == ObjectType::Relationship)
+				{
+					pending.push_back(rel->getTable(BaseRelationship::SrcTable));
+					pending.push_back(rel->getTable(BaseRelationship::DstTable));
+				}
+
+				continue;
+			}
+
+			key = getSnapshotKey(obj);
+
+			// Objects not created by an import (e.g. created by the user) are preserved
+			if(!snap_oids.count(key))
+				continue;
+
+			if(obj_fingerprints.count(snap_oids[key]))
+				reimport_oids.insert(snap_oids[key]);
+
+			// The database object itself is never removed, only its attributes are imported again
+			if(obj == dbmodel)
+				continue;
+
+			outdated_objs.push_back(obj);
+
+			for(auto &ref_obj : obj->getReferences())
+				pending.push_back(ref_obj);
+
+			if(BaseTable::isBaseTable(obj->getObjectType()))
+			{
+				for(auto &child : dynamic_cast<BaseTable *>(obj)->getObjects({ ObjectType::Column }))
+					pending.push_back(child);
+			}
+		}
+
+		// Restricting the selection to the objects that are new or need to be imported again
+		for(auto &[obj_type, oids] : object_oids)
+		{
+			oids.erase(std::remove_if(oids.begin(), oids.end(), [&](unsigned oid) {
+				if(!obj_fingerprints.count(oid) || !snapshot.count(oid))
+					return false;
+
+				return reimport_oids.count(oid) == 0 &&
+							 std::get<DatabaseModel::SnapFingerprint>(snapshot.at(oid)) == obj_fingerprints.at(oid);
+			}), oids.end());
+		}
+
+		for(auto itr = column_oids.begin(); itr != column_oids.end();)
+		{
+			if(!reimport_oids.count(itr->first) &&
+				 obj_fingerprints.count(itr->first) && snapshot.count(itr->first))
+				itr = column_oids.erase(itr);
+			else
+				itr++;
+		}
+
+		creation_order.clear();
+
+		for(auto &itr : object_oids)
+			creation_order.insert(creation_order.end(), itr.second.begin(), itr.second.end());
+
+		std::sort(creation_order.begin(), creation_order.end());
+
+		emit s_progressUpdated(0, tr("Incremental import: %1 new, %2 changed and %3 dropped object(s) detected, %4 model object(s) to be refreshed.")
+													 .arg(added_oids.size()).arg(changed_oids.size()).arg(dropped_oids.size()).arg(outdated_objs.size()),
+													 ObjectType::Database);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+std::vector<unsigned> DatabaseImportHelper::getSelectedOIDs()
+{
+	return creation_order;
+}
+
+void DatabaseImportHelper::diffCatalogSnapshot(const std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>> &snapshot,
+																							 const std::map<unsigned, QString> &fingerprints, std::vector<unsigned> &changed_oids,
+																							 std::vector<unsigned> &dropped_oids, std::vector<unsigned> &added_oids)
+{
+	changed_oids.clear();
+	dropped_oids.clear();
+	added_oids.clear();
+
+	/* Objects absent in the current fingerprints were dropped in the database (or aren't selected anymore)
+	 * and the ones which fingerprints differ from the snapshot were changed */
+	for(auto &[oid, entry] : snapshot)
+	{
+		auto fp_itr = fingerprints.find(oid);
+
+		if(fp_itr == fingerprints.end())
+			dropped_oids.push_back(oid);
+		else if(fp_itr->second != std::get<DatabaseModel::SnapFingerprint>(entry))
+			changed_oids.push_back(oid);
+	}
+
+	for(auto &[oid, fingerprint] : fingerprints)
+	{
+		if(!snapshot.count(oid))
+			added_oids.push_back(oid);
+	}
+}
+
+void DatabaseImportHelper::removeOutdatedObjects()
+{
+	if(outdated_objs.empty())
+		return;
+
+	TableObject *tab_obj = nullptr;
+	BaseTable *table = nullptr;
+	int obj_idx = -1;
+
+	/* Removing the objects in the reverse order of their creation so the
+	 * ones that reference others are removed before their references */
+	std::sort(outdated_objs.begin(), outdated_objs.end(), [](BaseObject *obj1, BaseObject *obj2) {
+		return obj1->getObjectId() > obj2->getObjectId();
+	});
+
+	emit s_progressUpdated(0, tr("Removing outdated objects from the model..."), ObjectType::Database);
+
+	/* The removed objects aren't destroyed since the model widget (if any) keeps their graphical representations
+	 * alive until the scene is cleared, the same way it happens when the user removes objects */
+	for(auto &obj : outdated_objs)
+	{
+		try
+		{
+			tab_obj = dynamic_cast<TableObject *>(obj);
+
+			if(tab_obj)
+			{
+				table = tab_obj->getParentTable();
+				obj_idx = table ? table->getObjectIndex(tab_obj) : -1;
+
+				if(obj_idx >= 0)
+				{
+					table->removeObject(tab_obj);
+					dbmodel->removePermissions(tab_obj);
+				}
+			}
+			else
+			{
+				obj_idx = dbmodel->getObjectIndex(obj);
+
+				if(obj_idx >= 0)
+					dbmodel->removeObject(obj, obj_idx);
+			}
+		}
+		catch(Exception &e)
+		{
+			errors.push_back(Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e));
+		}
+	}
+
+	outdated_objs.clear();
+}
+
+void DatabaseImportHelper::updateCatalogSnapshot()
+{
+	try
+	{
+		std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>> snapshot;
+		const auto &curr_snapshot = dbmodel->getCatalogSnapshot();
+		TableObject *tab_obj = nullptr;
+		unsigned db_oid = 0;
+		bool keep_entries = false;
+
+		catalog->setQueryFilter(Catalog::ListAllObjects);
+		db_oid = catalog->getObjectOID(getCurrentDatabase(), ObjectType::Database).toUInt();
+		keep_entries = is_working_model && dbmodel->getCatalogSnapshotDatabase() == db_oid;
+
+		for(auto &[oid, fingerprint] : obj_fingerprints)
+		{
+			auto obj_itr = imported_objs.find(oid);
+
+			if(obj_itr != imported_objs.end() && obj_itr->second)
+			{
+				tab_obj = dynamic_cast<TableObject *>(obj_itr->second);
+
+				if(tab_obj && tab_obj->getParentTable())
+				{
+					snapshot[oid] = std::make_tuple(tab_obj->getObjectType(), tab_obj->getName(),
+																					tab_obj->getParentTable()->getSignature(), fingerprint);
+				}
+				else
+				{
+					snapshot[oid] = std::make_tuple(obj_itr->second->getObjectType(), obj_itr->second->getSignature(),
+																					"", fingerprint);
+				}
+			}
+			/* Objects skipped due to the lack of changes keep their entries. Objects that failed to be imported
+			 * have no entry so they are treated as new ones in the next import */
+			else if(keep_entries && curr_snapshot.count(oid) &&
+							std::get<DatabaseModel::SnapFingerprint>(curr_snapshot.at(oid)) == fingerprint)
+				snapshot[oid] = curr_snapshot.at(oid);
+		}
+
+		dbmodel->setCatalogSnapshot(db_oid, snapshot);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
 }
 
 QString DatabaseImportHelper::dumpObjectAttributes(attribs_map &attribs)
@@ -1900,7 +2297,7 @@ Type *DatabaseImportHelper::createType(attribs_map &attribs)
 
 			/* Workaround: if importing a datatype that is part of an extension we avoid the importing of
 			 * its supporting functions (since they will not be necessary here because the type will be sql-disabled)*/
-			if(!catalog.isExtensionObject(attribs[Attributes::Oid].toUInt()))
+			if(!catalog->isExtensionObject(attribs[Attributes::Oid].toUInt()))
 			{
 				for(i=0; i < count; i++)
 				{
@@ -2094,7 +2491,7 @@ View *DatabaseImportHelper::createView(attribs_map &attribs)
 			/* If the type has an entry on the types map and its OID is greater than system object oids,
 			 * means that it's a user defined type, thus, there is the need to check if the type
 			 * is registered. */
-			if(types.count(type_oid)!=0 && type_oid > catalog.getLastSysObjectOID())
+			if(types.count(type_oid)!=0 && type_oid > catalog->getLastSysObjectOID())
 			{
 				/* Building the type name prepending the schema name in order to search it on
 				 * the user defined types list at PgSQLType class */
@@ -2745,7 +3142,7 @@ void DatabaseImportHelper::createPermission(attribs_map &attribs)
 			{
 				try
 				{
-					QString oid = catalog.getObjectOID(role_name, ObjectType::Role);
+					QString oid = catalog->getObjectOID(role_name, ObjectType::Role);
 					getDependencyObject(oid, ObjectType::Role);
 					role = dynamic_cast<Role *>(dbmodel->getObject(role_name, ObjectType::Role));
 
@@ -3040,7 +3437,7 @@ QStringList DatabaseImportHelper::createColumns(attribs_map &attribs, std::vecto
 		/* If the type has an entry on the types map and its OID is greater than system object oids,
 		 * means that it's a user defined type, thus, there is the need to check if the type
 		 * is registered. */
-		if(types.count(type_oid) !=0 && type_oid > catalog.getLastSysObjectOID())
+		if(types.count(type_oid) !=0 && type_oid > catalog->getLastSysObjectOID())
 		{
 			/* Building the type name prepending the schema name in order to search it on
 			 * the user defined types list at PgSQLType class */
@@ -3085,7 +3482,7 @@ QStringList DatabaseImportHelper::createColumns(attribs_map &attribs, std::vecto
 		/* Checking if the type used by the column exists (is registered),
 		 * if not it'll be created when auto_resolve_deps is checked. */
 		if(auto_resolve_deps && !is_type_registered &&
-			 type_oid > catalog.getLastSysObjectOID())
+			 type_oid > catalog->getLastSysObjectOID())
 		{
 			// Try to create the missing data type
 			getType(itr->second[Attributes::TypeOid], false);
@@ -3212,8 +3609,8 @@ void DatabaseImportHelper::assignSequencesToColumns()
 					{
 						QString seq_oid;
 
-						catalog.clearObjectFilter(ObjectType::Sequence);
-						seq_oid = catalog.getObjectOID(names[1], ObjectType::Sequence, names[0]);
+						catalog->clearObjectFilter(ObjectType::Sequence);
+						seq_oid = catalog->getObjectOID(names[1], ObjectType::Sequence, names[0]);
 						seq_name = getDependencyObject(seq_oid, ObjectType::Sequence, true, true, false);
 						seq = dbmodel->getSequence(seq_name);
 					}
@@ -3515,11 +3912,11 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 			/* If the type was not found is more likely that is a user-defined type which was not listed
 				 * while retrieving system types (see retrieveSystemObjects()).User defined types are created on demand,
 				 * this way pgModeler will import its attributes so it can be created correctly below. */
-			Catalog::QueryFilter curr_filter = catalog.getQueryFilter();
+			Catalog::QueryFilter curr_filter = catalog->getQueryFilter();
 
-			catalog.setQueryFilter(Catalog::ListAllObjects);
-			type_attr = catalog.getObjectAttributes(ObjectType::Type, type_oid);
-			catalog.setQueryFilter(curr_filter);
+			catalog->setQueryFilter(Catalog::ListAllObjects);
+			type_attr = catalog->getObjectAttributes(ObjectType::Type, type_oid);
+			catalog->setQueryFilter(curr_filter);
 
 			/* Formatting/Quoting the name of the type (if necessary) in order to avoid
 				 * breaking the importing if there are user defined types in CamelCase for example.
@@ -3542,7 +3939,7 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 				 * and store its attributes in the types map, so the original type can be also
 				 * created if needed */
 				elem_tp_oid = type_attr[Attributes::Element].toUInt();
-				types[elem_tp_oid] = catalog.getObjectAttributes(ObjectType::Type, elem_tp_oid);
+				types[elem_tp_oid] = catalog->getObjectAttributes(ObjectType::Type, elem_tp_oid);
 			}
 			else
 				type_attr[Attributes::Name] = BaseObject::formatName(type_attr[Attributes::Name]);
@@ -3616,13 +4013,13 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 			 * if the schema's names is already present in the type's name (in case of table types) or if the type being
 			 * retrieved is not a PostGiS one (because, despite the type being from extension PostGiS, it is considered
 			 * a built-in type in pgModeler so there's no need to use schema qualified name) */
-		is_postgis_type = catalog.isExtensionObject(type_oid, "postgis");
+		is_postgis_type = catalog->isExtensionObject(type_oid, "postgis");
 		sch_name = getObjectName(type_attr[Attributes::Schema]);
 
 		if(!sch_name.isEmpty() && !is_postgis_type &&
 			 (is_derivated_from_obj ||
 				(sch_name != "pg_catalog" && sch_name != "information_schema") ||
-				type_oid > catalog.getLastSysObjectOID()) &&
+				type_oid > catalog->getLastSysObjectOID()) &&
 			 !obj_name.contains(QRegularExpression(QString("^(\\\")?(%1)(\\\")?(\\.)").arg(sch_name))))
 		{
 			/* To format an array data type name we need first remove the brackets
@@ -3642,14 +4039,14 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 		aux_name.remove(brackets);
 
 		if(auto_resolve_deps && !type_attr.empty() && !is_derivated_from_obj && !is_postgis_type &&
-			 type_oid > catalog.getLastSysObjectOID() && !dbmodel->getType(aux_name))
+			 type_oid > catalog->getLastSysObjectOID() && !dbmodel->getType(aux_name))
 		{
 			//If the type is not an array one we simply use the current type attributes map
 			if(type_attr[Attributes::Category] != "A")
 				createObject(type_attr);
 			/* In case the type is an array one we should use the oid held by "element" attribute to
 				 create the type related to current one */
-			else if(elem_tp_oid > catalog.getLastSysObjectOID() &&	types.count(elem_tp_oid))
+			else if(elem_tp_oid > catalog->getLastSysObjectOID() &&	types.count(elem_tp_oid))
 				createObject(types[elem_tp_oid]);
 		}
 
@@ -32,6 +32,7 @@
 #include <guiglobal.h>
 #include <QObject>
 #include <QThread>
+#include <QMutex>
 #include "catalog.h"
 #include "databasemodel.h"
 #include <random>
@@ -44,6 +45,12 @@ class __libgui DatabaseImportHelper: public QObject {
 		std::default_random_engine rand_num_engine;
 		
 		static const QString UnkownObjectOidXml;
+
+		/*! \brief Serializes the model building step of the imports running at the same time.
+		 * Retrieving the objects from the catalog only touches the helper's own data so it can
+		 * run in parallel (e.g. when diffing two databases), but the creation of the model objects
+		 * relies on resources shared by all models (object ids, user types, graphical updates flag) */
+		static QMutex build_mutex;
 		
 		/*! \brief File handle to log the import process. This file is opened for writing only when
 		the 'ignore_errors' is true */
@@ -52,8 +59,12 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief Stores the errors generated during the import
 		std::vector<Exception> errors;
 		
-		//! \brief Instance of catalog class to query system catalogs
-		Catalog catalog;
+		//! \brief Instance of catalog class owned by the helper to query system catalogs
+		Catalog own_catalog;
+
+		/*! \brief The catalog in use to query system catalogs. By default it points to own_catalog
+		 *  but it can be replaced by an external one (see setCatalog()) */
+		Catalog *catalog;
 		
 		//! \brief Instance of a connection to work on
 		Connection connection;
@@ -91,7 +102,12 @@ class __libgui DatabaseImportHelper: public QObject {
 		/*! \brief Indicates to the importer that the database model in which the objects must be created
 		 * is the working one. This flag changes the behavior of the importer, causing duplicated objects
 		 * to be ignored. See createObjects() */
-		is_working_model;
+		is_working_model,
+
+		/*! \brief Indicates to the importer that the catalog fingerprints of the imported objects must be stored in the model
+		 * and that, when importing again to a working model that holds a snapshot of the same database, only the objects
+		 * that were added or changed since the last import are retrieved (see filterUnchangedObjects()) */
+		incremental_import;
 		
 		//! \brief Stores the selected objects oids to be imported
 		std::map<ObjectType, std::vector<unsigned>> object_oids;
@@ -121,6 +137,16 @@ class __libgui DatabaseImportHelper: public QObject {
 		//! \brief Stores all selected columns attributes
 		std::map<unsigned, std::map<unsigned, attribs_map>> columns;
 		
+		//! \brief Stores the catalog fingerprints of the selected objects (only in incremental import)
+		std::map<unsigned, QString> obj_fingerprints;
+
+		/*! \brief Stores the model objects that changed or were dropped in the database as well the imported objects
+		 * that reference them. These objects are removed from the model before the incremental import (see removeOutdatedObjects()) */
+		std::vector<BaseObject *> outdated_objs;
+
+		//! \brief Stores the model objects created (or reused when importing to a working model) from each oid
+		std::map<unsigned, BaseObject *> imported_objs;
+
 		//! \brief Stores the oids of all objects that has permissions to be created
 		std::vector<unsigned> obj_perms;
 		
@@ -256,6 +282,20 @@ class __libgui DatabaseImportHelper: public QObject {
 		
 		//! \brief Clears the vectors and maps used in the import process
 		void resetImportParameters();
+
+		/*! \brief Computes the catalog fingerprints of the selected objects and, if the model holds a snapshot of the same database,
+		 * restricts the selection to the objects that were added or changed since the last import (see selectOutdatedObjects()) */
+		void filterUnchangedObjects();
+
+		//! \brief Stores in the model the catalog fingerprints of the objects imported so far and the ones that didn't change
+		void updateCatalogSnapshot();
+
+		//! \brief Returns the model object related to a catalog snapshot entry (see DatabaseModel::SnapshotFields)
+		BaseObject *getSnapshotObject(const std::tuple<ObjectType, QString, QString, QString> &entry);
+
+		//! \brief Returns the key that identifies the object in the catalog snapshot
+		static QString getSnapshotKey(ObjectType obj_type, const QString &signature, const QString &parent);
+		static QString getSnapshotKey(BaseObject *object);
 		
 		//! \brief Return a string containing all attributes and their values in a formatted way
 		QString dumpObjectAttributes(attribs_map &attribs);
@@ -275,6 +315,12 @@ class __libgui DatabaseImportHelper: public QObject {
 	Once this method is called the user must call setConnection() again or the import will fail */
 		void closeConnection();
 		
+		/*! \brief Makes the helper query the system catalogs through an external catalog which connection
+		 *  is kept opened by its owner, so several imports on the same server can reuse it. Since the external
+		 *  catalog is already connected, setConnection() only stores the connection params and closeConnection()
+		 *  leaves the external catalog untouched. Passing nullptr restores the helper's own catalog */
+		void setCatalog(Catalog *ext_catalog);
+
 		//! \brief Set the current database to work on
 		void setCurrentDatabase(const QString &dbname);
 		
@@ -285,6 +331,30 @@ class __libgui DatabaseImportHelper: public QObject {
 		void setImportOptions(bool import_sys_objs, bool import_ext_objs, bool auto_resolve_deps, bool ignore_errors, bool debug_mode,
 													bool rand_rel_colors, bool update_rels, bool comments_as_aliases, bool is_working_model = false);
 		
+		/*! \brief Compares the catalog snapshot of a previous import (see DatabaseModel::SnapshotFields) with the current catalog
+		 *  fingerprints of the objects returning the oids of the objects changed, dropped and added since the snapshot was captured */
+		static void diffCatalogSnapshot(const std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>> &snapshot,
+																		const std::map<unsigned, QString> &fingerprints, std::vector<unsigned> &changed_oids,
+																		std::vector<unsigned> &dropped_oids, std::vector<unsigned> &added_oids);
+
+		/*! \brief Compares the catalog snapshot held by the model with the provided fingerprints of the selected objects of the
+		 * database db_oid. The model objects changed or dropped in the database are marked as outdated, as well as the imported objects
+		 * which reference them since they are removed from the model together (see removeOutdatedObjects()). The selection is then
+		 * restricted to the objects that were added or must be imported again. This method doesn't query the catalog and does
+		 * nothing when the model isn't the working one or holds no snapshot of the database db_oid */
+		void selectOutdatedObjects(unsigned db_oid, const std::map<unsigned, QString> &fingerprints);
+
+		/*! \brief Removes the outdated objects from the model so they can be imported again. Objects that can't be removed
+		 * (e.g. when referenced by objects not created by the import) are kept and the errors are registered in the import log */
+		void removeOutdatedObjects();
+
+		//! \brief Returns the oids of the objects selected to be imported in their creation order
+		std::vector<unsigned> getSelectedOIDs();
+
+		/*! \brief Enables the incremental import. The objects must be imported to a working model (see setImportOptions())
+		 *  so the ones that didn't change in the database since the previous import are preserved */
+		void setIncrementalImport(bool value);
+
 		//! \brief Returns the last system OID value for the current database
 		unsigned getLastSystemOID();
 		
@@ -21,7 +21,6 @@
 
 #include "databaseimportwidget.h"
 #include "customuistyle.h"
-#include "widgets/taskprogresswidget.h"
 #include "guiutilsns.h"
 #include "utilsns.h"
 #include "defaultlanguages.h"
@@ -181,6 +180,7 @@ DatabaseImportWidget::DatabaseImportWidget(QWidget *parent) : QWidget(parent)
 
 DatabaseImportWidget::~DatabaseImportWidget()
 {
+	list_task.wait();
 	destroyThread();
 }
 
@@ -242,11 +242,6 @@ void DatabaseImportWidget::destroyThread()
 	}
 }
 
-void DatabaseImportWidget::listFilteredObjects()
-{
-	listFilteredObjects(*import_helper, filtered_objs_view);
-}
-
 void DatabaseImportWidget::listFilteredObjects(DatabaseImportHelper &import_hlp, QTableView *flt_objects_view)
 {
 	if(!flt_objects_view)
@@ -524,83 +519,148 @@ void DatabaseImportWidget::getObjectToImport(std::map<ObjectType, std::vector<un
 
 void DatabaseImportWidget::listObjects()
 {
-	try
+	// A listing is already in progress, the controls that trigger it are disabled until it finishes
+	if(list_task.isRunning())
+		return;
+
+	if(database_cmb->currentIndex() <= 0)
 	{
-		if(database_cmb->currentIndex() > 0)
-		{
-			Connection *conn = reinterpret_cast<Connection *>(connections_cmb->itemData(connections_cmb->currentIndex()).value<void *>());
-			QStringList obj_filter = objs_filter_wgt->getObjectFilters();
+		enableImportControls(true);
+		return;
+	}
 
-			qApp->setOverrideCursor(Qt::WaitCursor);
+	Connection conn = *reinterpret_cast<Connection *>(connections_cmb->itemData(connections_cmb->currentIndex()).value<void *>());
+	QString db_name = database_cmb->currentText();
+	QStringList obj_filter = objs_filter_wgt->getObjectFilters(),
+			force_tab_types = objs_filter_wgt->getForceObjectsFilter();
+	bool only_matching = objs_filter_wgt->isOnlyMatching(),
+			match_signature = objs_filter_wgt->isMatchBySignature();
+	std::shared_ptr<unsigned> obj_count = std::make_shared<unsigned>(0);
 
-			dbg_output_wgt->showActionButtons(false);
-			dbg_output_wgt->clear();
+	dbg_output_wgt->showActionButtons(false);
+	dbg_output_wgt->clear();
 
-			//Set the working database on import helper
-			import_helper->closeConnection();
-			import_helper->setConnection(*conn);
-			import_helper->setCurrentDatabase(database_cmb->currentText());
-			import_helper->setImportOptions(import_sys_objs_chk->isChecked(), import_ext_objs_chk->isChecked(),
-																			resolve_deps_chk->isChecked(), ignore_errors_chk->isChecked(),
-																			debug_mode_chk->isChecked(), rand_rel_color_chk->isChecked(), true,
-																			comments_as_aliases_chk->isChecked());
-
-			import_helper->setObjectFilters(obj_filter,
-																			objs_filter_wgt->isOnlyMatching(),
-																			objs_filter_wgt->isMatchBySignature(),
-																			objs_filter_wgt->getForceObjectsFilter());
-			if(obj_filter.isEmpty() &&
-				 import_helper->getCatalog().getObjectsCount({ ObjectType::Table, ObjectType::ForeignTable,
-																											 ObjectType::View, ObjectType::Index,
-																											 ObjectType::Type, ObjectType::Function,
-																											 ObjectType::Procedure }, false) > ObjectCountThreshould)
-			{
-				Messagebox msgbox;
-				msgbox.show(tr("The selected database seems to have a huge amount of objects! \
+	import_helper->closeConnection();
+	import_helper->setImportOptions(import_sys_objs_chk->isChecked(), import_ext_objs_chk->isChecked(),
+																	resolve_deps_chk->isChecked(), ignore_errors_chk->isChecked(),
+																	debug_mode_chk->isChecked(), rand_rel_color_chk->isChecked(), true,
+																	comments_as_aliases_chk->isChecked());
+
+	setListingObjects(true);
+
+	// Connecting to the database and counting its objects are done in a worker thread
+	list_task.start([this, conn, db_name, obj_filter, only_matching, match_signature, force_tab_types, obj_count]() mutable {
+		//Set the working database on import helper
+		import_helper->setConnection(conn);
+		import_helper->setCurrentDatabase(db_name);
+		import_helper->setObjectFilters(obj_filter, only_matching, match_signature, force_tab_types);
+
+		if(obj_filter.isEmpty())
+		{
+			*obj_count = import_helper->getCatalog().getObjectsCount({ ObjectType::Table, ObjectType::ForeignTable,
+																																 ObjectType::View, ObjectType::Index,
+																																 ObjectType::Type, ObjectType::Function,
+																																 ObjectType::Procedure }, false);
+		}
+	},
+	[this, obj_filter, only_matching, obj_count](){
+		if(*obj_count > ObjectCountThreshould)
+		{
+			Messagebox msgbox;
+			msgbox.show(tr("The selected database seems to have a huge amount of objects! \
 Trying to import such database can take minutes or even hours and, in extreme cases, crash the application. \
 Please, consider using the <strong>Filter</strong> tab in order to refine the set of objects to be imported. \
 Do you really want to proceed?"),
-										Messagebox::Alert, Messagebox::YesNoButtons);
+									Messagebox::Alert, Messagebox::YesNoButtons);
 
-				if(msgbox.isRejected())
-				{
-					database_cmb->setCurrentIndex(0);
-					return;
-				}
+			if(msgbox.isRejected())
+			{
+				setListingObjects(false);
+				database_cmb->setCurrentIndex(0);
+				return;
 			}
+		}
+
+		listRetrievedObjects(!obj_filter.isEmpty() && only_matching);
+	},
+	[this](Exception &e){
+		setListingObjects(false);
+		db_objects_tw->clear();
+		enableImportControls(false);
+		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+	});
+}
 
-			/* If the filter is set and the non matches need to be ignored
-			 * switches to the strict view of listing filtered objects */
-			if(!obj_filter.isEmpty() && objs_filter_wgt->isOnlyMatching())
+void DatabaseImportWidget::listRetrievedObjects(bool only_matching)
+{
+	std::shared_ptr<ListedObjects> objects = std::make_shared<ListedObjects>();
+	std::shared_ptr<std::vector<attribs_map>> flt_objects = std::make_shared<std::vector<attribs_map>>();
+
+	list_task.start([this, only_matching, objects, flt_objects](){
+		/* If the filter is set and the non matches need to be ignored
+		 * retrieves only the objects for the strict view of filtered objects */
+		if(only_matching)
+			*flt_objects = import_helper->getObjects(import_helper->getCatalog().getFilteredObjectTypes());
+		else
+			*objects = retrieveObjects(*import_helper, false, true);
+	},
+	[this, only_matching, objects, flt_objects](){
+		try
+		{
+			db_objects_tw->clear();
+
+			if(only_matching)
 			{
-				db_objects_tw->clear();
 				db_objects_stw->setCurrentIndex(1);
-				listFilteredObjects();
+				GuiUtilsNs::populateObjectsTable(filtered_objs_view, *flt_objects);
+				filtered_objs_view->setEnabled(filtered_objs_view->model() && filtered_objs_view->model()->rowCount() > 0);
 			}
 			else
 			{
-				//List the objects using the static helper method
-				db_objects_tw->clear();
 				GuiUtilsNs::populateObjectsTable(filtered_objs_view, std::vector<attribs_map>());
 				db_objects_stw->setCurrentIndex(0);
-				DatabaseImportWidget::listObjects(*import_helper, db_objects_tw, true,
+				DatabaseImportWidget::listObjects(*import_helper, *objects, db_objects_tw, true,
 																					GeneralConfigWidget::getConfigurationParam(Attributes::Configuration, Attributes::HideEmptyObjGroups) == Attributes::True ?
 																					DatabaseImportWidget::HideDisableEmptyGrps : DatabaseImportWidget::DisableEmptyGrps,
 																					false);
-				objs_parent_wgt->setEnabled(db_objects_tw->topLevelItemCount() > 0);
 			}
+
+			setListingObjects(false);
+			enableImportControls(true);
 		}
+		catch(Exception &e)
+		{
+			setListingObjects(false);
+			db_objects_tw->clear();
+			enableImportControls(false);
+			Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+		}
+	},
+	[this](Exception &e){
+		setListingObjects(false);
+		db_objects_tw->clear();
+		enableImportControls(false);
+		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+	});
+}
 
-		enableImportControls(true);
+void DatabaseImportWidget::setListingObjects(bool listing)
+{
+	connections_cmb->setEnabled(!listing);
+	database_cmb->setEnabled(!listing && database_cmb->count() > 1);
+	import_sys_objs_chk->setEnabled(!listing);
+	import_ext_objs_chk->setEnabled(!listing);
+	objs_filter_wgt->setEnabled(!listing);
 
-		qApp->restoreOverrideCursor();
-	}
-	catch(Exception &e)
+	if(listing)
 	{
-		db_objects_tw->clear();
-		enableImportControls(false);
-		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+		buttons_wgt->setEnabled(false);
+		objs_parent_wgt->setEnabled(false);
+		import_btn->setEnabled(false);
+		qApp->setOverrideCursor(Qt::WaitCursor);
 	}
+	else
+		qApp->restoreOverrideCursor();
 }
 
 void DatabaseImportWidget::enableImportControls(bool enable)
@@ -674,7 +734,7 @@ void DatabaseImportWidget::closeEvent(QCloseEvent *event)
 {
 	/* Ignore the close event when the thread is running this avoid
 	close the form and make thread execute in background */
-	if(import_thread->isRunning())
+	if(import_thread->isRunning() || list_task.isRunning())
 		event->ignore();
 	else
 	{
@@ -967,128 +1027,139 @@ void DatabaseImportWidget::listDatabases(DatabaseImportHelper &import_helper, QC
 	}
 }
 
-void DatabaseImportWidget::listObjects(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, bool checkable_items,
-																			 ObjGroupsFlag group_flags, bool create_db_item, bool create_dummy_item, int sort_by)
+DatabaseImportWidget::ListedObjects DatabaseImportWidget::retrieveObjects(DatabaseImportHelper &import_helper, bool retrieve_db, bool retrieve_children)
 {
-	TaskProgressWidget task_prog_wgt;
+	ListedObjects objects;
 
 	try
 	{
-		if(tree_wgt)
-		{
-			QTreeWidgetItem *db_item = nullptr, *item = nullptr;
-			std::vector<QTreeWidgetItem *> sch_items, tab_items;
-			double inc = 0, inc1 = 0, aux_prog = 0;
+		attribs_map filter_attr = {{ Attributes::FilterTableTypes, Attributes::True }};
+		std::vector<attribs_map> *sch_objects = nullptr;
+		ObjectType obj_type;
 
-			if(!create_dummy_item)
-			{
-				task_prog_wgt.setWindowTitle(tr("Retrieving objects from database..."));
-				task_prog_wgt.show();
-				task_prog_wgt.updateProgress(1, tr("Retrieving cluster level objects..."), enum_t(ObjectType::Database));
-			}
-
-			tree_wgt->clear();
-			tree_wgt->setColumnHidden(1, true);
+		if(retrieve_db)
+		{
+			Catalog catalog = import_helper.getCatalog();
+			std::vector<attribs_map> attribs = catalog.getObjectsAttributes(ObjectType::Database, "", "", {},
+																																			{{ Attributes::Name, import_helper.getCurrentDatabase() }});
 
-			if(create_db_item)
-			{
-				Catalog catalog = import_helper.getCatalog();
-				std::vector<attribs_map> attribs;
+			if(!attribs.empty())
+				objects.db_attribs = attribs[0];
+		}
 
-				//Creating database item
-				db_item=new QTreeWidgetItem;
-				db_item->setText(0, import_helper.getCurrentDatabase());
-				db_item->setIcon(0, GuiUtilsNs::getIcon(ObjectType::Database));
-				attribs = catalog.getObjectsAttributes(ObjectType::Database, "", "", {}, {{Attributes::Name, import_helper.getCurrentDatabase()}});
+		//Retrieving the cluster scoped objects
+		objects.db_objects = import_helper.getObjects(BaseObject::getChildObjectTypes(ObjectType::Database), "", "", filter_attr);
 
-				db_item->setData(ObjectId, Qt::UserRole, attribs[0].at(Attributes::Oid).toUInt());
-				db_item->setData(ObjectTypeId, Qt::UserRole, enum_t(ObjectType::Database));
+		if(!retrieve_children)
+			return objects;
 
-				db_item->setToolTip(0, QString("OID: %1").arg(attribs[0].at(Attributes::Oid)));
-				tree_wgt->addTopLevelItem(db_item);
-			}
-			else
-				/* If the database item is not created we use the invisible root item in the tree widget
-				 * so we can correctly apply the disabled/hidden statuses in database level object items */
-				db_item = tree_wgt->invisibleRootItem();
+		for(auto &sch_attr : objects.db_objects)
+		{
+			if(static_cast<ObjectType>(sch_attr[Attributes::ObjectType].toUInt()) != ObjectType::Schema)
+				continue;
 
-			//Retrieving and listing the cluster scoped objects
-			sch_items = DatabaseImportWidget::updateObjectsTree(import_helper, tree_wgt,
-																													BaseObject::getChildObjectTypes(ObjectType::Database),
-																													checkable_items, group_flags, db_item);
+			//Retrieving the schema scoped objects
+			sch_objects = &objects.children[sch_attr[Attributes::Oid].toUInt()];
+			*sch_objects = import_helper.getObjects(BaseObject::getChildObjectTypes(ObjectType::Schema), sch_attr[Attributes::Name], "", filter_attr);
 
-			if(create_dummy_item)
-			{
-				for(auto &sch_item : sch_items)
-				{
-					item = new QTreeWidgetItem(sch_item);
-					item->setText(0, "...");
-					item->setData(ObjectOtherData, Qt::UserRole, QVariant::fromValue<int>(-1));
-				}
-			}
-			else
+			for(auto &tab_attr : *sch_objects)
 			{
-				ObjectType obj_type = ObjectType::BaseObject;
-				aux_prog = task_prog_wgt.progress_pb->value();
-				inc = 40/static_cast<double>(sch_items.size());
-
-				for(auto &sch_item : sch_items)
-				{
-					task_prog_wgt.updateProgress(static_cast<int>(aux_prog),
-																			 tr("Retrieving objects of schema `%1'...")
-																			 .arg(sch_item->text(0)), enum_t(ObjectType::Schema));
+				obj_type = static_cast<ObjectType>(tab_attr[Attributes::ObjectType].toUInt());
 
-					//Retrieving and listing the schema scoped objects
-					tab_items = DatabaseImportWidget::updateObjectsTree(import_helper, tree_wgt,
-																															BaseObject::getChildObjectTypes(ObjectType::Schema),
-																															checkable_items, group_flags, sch_item, sch_item->text(0));
+				if(!BaseTable::isBaseTable(obj_type))
+					continue;
 
-					inc1 = (60 /static_cast<double>(tab_items.size()))/static_cast<double>(sch_items.size());
+				//Retrieving the table's children
+				objects.children[tab_attr[Attributes::Oid].toUInt()] =
+						import_helper.getObjects(BaseObject::getChildObjectTypes(obj_type), sch_attr[Attributes::Name], tab_attr[Attributes::Name], filter_attr);
+			}
+		}
 
-					for(auto &tab_item : tab_items)
-					{
-						aux_prog += inc1;
+		return objects;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
 
-						if(aux_prog > 99)
-							aux_prog = 99;
+void DatabaseImportWidget::listObjects(DatabaseImportHelper &import_helper, ListedObjects &objects, QTreeWidget *tree_wgt, bool checkable_items,
+																			 ObjGroupsFlag group_flags, bool create_db_item, bool create_dummy_item, int sort_by,
+																			 unsigned page_size, std::map<QTreeWidgetItem *, std::vector<attribs_map>> *pending_objs)
+{
+	if(!tree_wgt)
+		return;
 
-						obj_type = static_cast<ObjectType>(tab_item->data(ObjectTypeId, Qt::UserRole).toUInt());
+	try
+	{
+		QTreeWidgetItem *db_item = nullptr, *item = nullptr;
+		std::vector<QTreeWidgetItem *> sch_items, tab_items;
+		QString sch_name;
+		unsigned oid = 0;
+		ObjectType obj_type;
 
-						task_prog_wgt.updateProgress(static_cast<int>(aux_prog),
-																				 tr("Retrieving objects of `%1' (%2)...")
-																				 .arg(tab_item->text(0), BaseObject::getTypeName(obj_type)), enum_t(obj_type));
+		tree_wgt->clear();
+		tree_wgt->setColumnHidden(1, true);
 
-						DatabaseImportWidget::updateObjectsTree(import_helper, tree_wgt,
-																										BaseObject::getChildObjectTypes(obj_type), checkable_items, group_flags,
-																										tab_item, sch_item->text(0), tab_item->text(0));
-					}
+		if(create_db_item)
+		{
+			//Creating database item
+			db_item=new QTreeWidgetItem;
+			db_item->setText(0, import_helper.getCurrentDatabase());
+			db_item->setIcon(0, GuiUtilsNs::getIcon(ObjectType::Database));
+			db_item->setData(ObjectId, Qt::UserRole, objects.db_attribs[Attributes::Oid].toUInt());
+			db_item->setData(ObjectTypeId, Qt::UserRole, enum_t(ObjectType::Database));
+			db_item->setToolTip(0, QString("OID: %1").arg(objects.db_attribs[Attributes::Oid]));
+			tree_wgt->addTopLevelItem(db_item);
+		}
+		else
+			/* If the database item is not created we use the invisible root item in the tree widget
+			 * so we can correctly apply the disabled/hidden statuses in database level object items */
+			db_item = tree_wgt->invisibleRootItem();
 
-					aux_prog += inc;
+		//Listing the cluster scoped objects
+		sch_items = DatabaseImportWidget::updateObjectsTree(import_helper, tree_wgt, BaseObject::getChildObjectTypes(ObjectType::Database),
+																												objects.db_objects, checkable_items, group_flags, db_item, "", "",
+																												page_size, pending_objs);
 
-					if(aux_prog > 99)
-						aux_prog = 99;
+		for(auto &sch_item : sch_items)
+		{
+			oid = sch_item->data(ObjectId, Qt::UserRole).toUInt();
 
-					task_prog_wgt.progress_pb->setValue(static_cast<int>(aux_prog));
-					sch_items.pop_back();
-				}
+			/* When the schema's children were not retrieved we create a dummy
+			 * item so they can be retrieved later when the schema is expanded */
+			if(create_dummy_item || !objects.children.count(oid))
+			{
+				item = new QTreeWidgetItem(sch_item);
+				item->setText(0, "...");
+				item->setData(ObjectOtherData, Qt::UserRole, QVariant::fromValue<int>(-1));
+				continue;
 			}
 
-			tree_wgt->sortItems(sort_by, Qt::AscendingOrder);
+			//Listing the schema scoped objects
+			sch_name = sch_item->text(0);
+			tab_items = DatabaseImportWidget::updateObjectsTree(import_helper, tree_wgt, BaseObject::getChildObjectTypes(ObjectType::Schema),
+																													objects.children[oid], checkable_items, group_flags, sch_item, sch_name, "",
+																													page_size, pending_objs);
 
-			if(db_item)
-				db_item->setExpanded(true);
-
-			if(!create_dummy_item)
+			for(auto &tab_item : tab_items)
 			{
-				task_prog_wgt.progress_pb->setValue(100);
-				task_prog_wgt.close();
+				oid = tab_item->data(ObjectId, Qt::UserRole).toUInt();
+				obj_type = static_cast<ObjectType>(tab_item->data(ObjectTypeId, Qt::UserRole).toUInt());
+
+				DatabaseImportWidget::updateObjectsTree(import_helper, tree_wgt, BaseObject::getChildObjectTypes(obj_type),
+																								objects.children[oid], checkable_items, group_flags, tab_item, sch_name, tab_item->text(0),
+																								page_size, pending_objs);
 			}
 		}
 
+		tree_wgt->sortItems(sort_by, Qt::AscendingOrder);
+
+		if(db_item)
+			db_item->setExpanded(true);
 	}
 	catch(Exception &e)
 	{
-		task_prog_wgt.close();
 		tree_wgt->clear();
 		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
 	}
@@ -1100,25 +1171,36 @@ std::vector<QTreeWidgetItem *> DatabaseImportWidget::updateObjectsTree(DatabaseI
 	if(!tree_wgt)
 		return {};
 
+	try
+	{
+		std::vector<attribs_map> objects_vect = import_helper.getObjects(types, schema, table, {{ Attributes::FilterTableTypes, Attributes::True }});
+
+		return updateObjectsTree(import_helper, tree_wgt, types, objects_vect, checkable_items, group_flags, root, schema, table);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+std::vector<QTreeWidgetItem *> DatabaseImportWidget::updateObjectsTree(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, std::vector<ObjectType> types,
+																																			 std::vector<attribs_map> &objects_vect, bool checkable_items, ObjGroupsFlag group_flags,
+																																			 QTreeWidgetItem *root, const QString &schema, const QString &table,
+																																			 unsigned page_size, std::map<QTreeWidgetItem *, std::vector<attribs_map>> *pending_objs)
+{
+	if(!tree_wgt)
+		return {};
+
 	std::vector<QTreeWidgetItem *> items_vect;
 	QTreeWidgetItem *group = nullptr, *item = nullptr;
 	QFont grp_fnt = tree_wgt->font();
-	attribs_map extra_attribs = {{Attributes::FilterTableTypes, Attributes::True}};
-	QString tooltip = QString("OID: %1"), name, label;
 	bool child_checked = false,
 			disable_empty_grps = (group_flags & DisableEmptyGrps) == DisableEmptyGrps,
 			hide_empty_grps = (group_flags & HideEmptyGrps) == HideEmptyGrps;
-	std::vector<attribs_map> objects_vect;
 	std::map<ObjectType, QTreeWidgetItem *> gen_groups;
 	ObjectType obj_type;
 	QList<QTreeWidgetItem*> groups_list;
-	unsigned oid=0;
-	int start=-1, end=-1;
-	std::map<QString, QString> constr_icons = { { Attributes::PkConstr, "constraint_pk" },
-																							{ Attributes::FkConstr, "constraint_fk" },
-																							{ Attributes::UqConstr, "constraint_uq" },
-																							{ Attributes::CkConstr, "constraint_ck" },
-																							{ Attributes::ExConstr, "constraint_ex" } };
+	unsigned item_cnt = 0;
 
 	grp_fnt.setItalic(true);
 	tree_wgt->blockSignals(true);
@@ -1147,99 +1229,31 @@ std::vector<QTreeWidgetItem *> DatabaseImportWidget::updateObjectsTree(DatabaseI
 			groups_list.push_back(group);
 		}
 
-		objects_vect = import_helper.getObjects(types, schema, table, extra_attribs);
-
 		for(attribs_map &attribs : objects_vect)
 		{
 			obj_type = static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
 			group = gen_groups[obj_type];
-			group->setData(ObjectCount, Qt::UserRole,
-										 group->data(ObjectCount, Qt::UserRole).toUInt() + 1);
-
-			//Creates individual items for each object of the current type
-			oid = attribs[Attributes::Oid].toUInt();
+			item_cnt = group->data(ObjectCount, Qt::UserRole).toUInt() + 1;
+			group->setData(ObjectCount, Qt::UserRole, item_cnt);
 
-			attribs[Attributes::Name].remove(QRegularExpression("( )(without)( time zone)"));
-			label = name = attribs[Attributes::Name];
-
-			//Removing the trailing type string from op. families or op. classes names
-			if(obj_type == ObjectType::OpFamily || obj_type == ObjectType::OpClass)
+			/* Objects that exceed the page size are only counted in the group,
+			 * their items are created later by the caller on demand */
+			if(pending_objs && page_size > 0 && item_cnt > page_size)
 			{
-				start = name.indexOf(QChar('['));
-				end = name.lastIndexOf(QChar(']'));
-				name.remove(start, (end-start)+1);
-				name = name.trimmed();
+				(*pending_objs)[group].push_back(attribs);
+				continue;
 			}
 
-			item = new QTreeWidgetItem(group);
-
-			if(obj_type == ObjectType::Constraint)
-				item->setIcon(0, GuiUtilsNs::getIcon(constr_icons[attribs[Attributes::ExtraInfo]]));
-			else
-				item->setIcon(0, GuiUtilsNs::getIcon(obj_type));
+			item = createObjectItem(import_helper, attribs, group, checkable_items, root, schema, table);
 
-			item->setText(0, label);
-			item->setText(ObjectId, attribs[Attributes::Oid].rightJustified(10, '0'));
-			item->setData(ObjectId, Qt::UserRole, attribs[Attributes::Oid].toUInt());
-			item->setData(ObjectName, Qt::UserRole, name);
-
-			if(checkable_items)
-			{
-				/* If the current import helper has objects filter we will not mark the items in the tree as check
-				 * since only the ones matching the object types are checked in the final step of the tree creation */
-				if(/*!has_obj_filters &&*/
-					 ((oid > import_helper.getLastSystemOID()) ||
-						(obj_type == ObjectType::Schema && name == "public") ||
-						(obj_type == ObjectType::Column && root && root->data(0, Qt::UserRole).toUInt() > import_helper.getLastSystemOID())))
-				{
-					item->setCheckState(0, Qt::Checked);
-					child_checked=true;
-				}
-				else
-					item->setCheckState(0, Qt::Unchecked);
-
-				//Disabling items that refers to PostgreSQL's built-in data types
-				if(obj_type == ObjectType::Type && oid <= import_helper.getLastSystemOID())
-				{
-					item->setDisabled(true);
-					item->setToolTip(0, tr("This is a PostgreSQL built-in data type and cannot be imported."));
-				}
-				//Disabling items that refers to pgModeler's built-in system objects
-				else if((obj_type == ObjectType::Tablespace && (name == "pg_default" || name == "pg_global")) ||
-								(obj_type == ObjectType::Role && (name == "postgres")) ||
-								(obj_type == ObjectType::Schema && (name == "pg_catalog" || name == "public")) ||
-								(obj_type == ObjectType::Language && (name.toLower() == DefaultLanguages::C ||
-																										name.toLower() == DefaultLanguages::Sql ||
-																										name.toLower() == DefaultLanguages::PlPgsql)))
-				{
-					item->setFont(0, grp_fnt);
-					item->setForeground(0, BaseObjectView::getFontStyle(Attributes::ProtColumn).foreground());
-					item->setToolTip(0, tr("This is a pgModeler's built-in object. It will be ignored if checked by user."));
-				}
-			}
-
-			//Stores the object's OID as the first data of the item
-			item->setData(ObjectId, Qt::UserRole, oid);
-
-			if(!item->toolTip(0).isEmpty())
-				item->setToolTip(0,item->toolTip(0) + "\n" + tooltip.arg(oid));
-			else
-				item->setToolTip(0,tooltip.arg(oid));
-
-			//Stores the object's type as the second data of the item
-			item->setData(ObjectTypeId, Qt::UserRole, enum_t(obj_type));
-
-			//Stores the schema and the table's name of the object
-			item->setData(ObjectSchema, Qt::UserRole, schema);
-			item->setData(ObjectTable, Qt::UserRole, table);
+			if(checkable_items && item->checkState(0) == Qt::Checked)
+				child_checked = true;
 
 			if(obj_type==ObjectType::Schema || BaseTable::isBaseTable(obj_type))
 				items_vect.push_back(item);
 		}
 
 		//Updating the object count in each group
-		unsigned item_cnt = 0;
-
 		for(auto &grp_type : types)
 		{
 			group = gen_groups[grp_type];
@@ -1272,6 +1286,98 @@ std::vector<QTreeWidgetItem *> DatabaseImportWidget::updateObjectsTree(DatabaseI
 	}
 }
 
+QTreeWidgetItem *DatabaseImportWidget::createObjectItem(DatabaseImportHelper &import_helper, attribs_map &attribs, QTreeWidgetItem *group,
+																												bool checkable_items, QTreeWidgetItem *root, const QString &schema, const QString &table)
+{
+	static const std::map<QString, QString> constr_icons = { { Attributes::PkConstr, "constraint_pk" },
+																														{ Attributes::FkConstr, "constraint_fk" },
+																														{ Attributes::UqConstr, "constraint_uq" },
+																														{ Attributes::CkConstr, "constraint_ck" },
+																														{ Attributes::ExConstr, "constraint_ex" } };
+	QTreeWidgetItem *item = nullptr;
+	QFont grp_fnt = group->font(0);
+	QString tooltip = QString("OID: %1"), name, label;
+	ObjectType obj_type = static_cast<ObjectType>(attribs[Attributes::ObjectType].toUInt());
+	unsigned oid = 0;
+	int start = -1, end = -1;
+
+	//Creates individual items for each object of the current type
+	oid = attribs[Attributes::Oid].toUInt();
+
+	attribs[Attributes::Name].remove(QRegularExpression("( )(without)( time zone)"));
+	label = name = attribs[Attributes::Name];
+
+	//Removing the trailing type string from op. families or op. classes names
+	if(obj_type == ObjectType::OpFamily || obj_type == ObjectType::OpClass)
+	{
+		start = name.indexOf(QChar('['));
+		end = name.lastIndexOf(QChar(']'));
+		name.remove(start, (end-start)+1);
+		name = name.trimmed();
+	}
+
+	item = new QTreeWidgetItem(group);
+
+	if(obj_type == ObjectType::Constraint && constr_icons.count(attribs[Attributes::ExtraInfo]))
+		item->setIcon(0, GuiUtilsNs::getIcon(constr_icons.at(attribs[Attributes::ExtraInfo])));
+	else
+		item->setIcon(0, GuiUtilsNs::getIcon(obj_type));
+
+	item->setText(0, label);
+	item->setText(ObjectId, attribs[Attributes::Oid].rightJustified(10, '0'));
+	item->setData(ObjectId, Qt::UserRole, attribs[Attributes::Oid].toUInt());
+	item->setData(ObjectName, Qt::UserRole, name);
+
+	if(checkable_items)
+	{
+		/* If the current import helper has objects filter we will not mark the items in the tree as check
+		 * since only the ones matching the object types are checked in the final step of the tree creation */
+		if(/*!has_obj_filters &&*/
+			 ((oid > import_helper.getLastSystemOID()) ||
+				(obj_type == ObjectType::Schema && name == "public") ||
+				(obj_type == ObjectType::Column && root && root->data(0, Qt::UserRole).toUInt() > import_helper.getLastSystemOID())))
+			item->setCheckState(0, Qt::Checked);
+		else
+			item->setCheckState(0, Qt::Unchecked);
+
+		//Disabling items that refers to PostgreSQL's built-in data types
+		if(obj_type == ObjectType::Type && oid <= import_helper.getLastSystemOID())
+		{
+			item->setDisabled(true);
+			item->setToolTip(0, tr("This is a PostgreSQL built-in data type and cannot be imported."));
+		}
+		//Disabling items that refers to pgModeler's built-in system objects
+		else if((obj_type == ObjectType::Tablespace && (name == "pg_default" || name == "pg_global")) ||
+						(obj_type == ObjectType::Role && (name == "postgres")) ||
+						(obj_type == ObjectType::Schema && (name == "pg_catalog" || name == "public")) ||
+						(obj_type == ObjectType::Language && (name.toLower() == DefaultLanguages::C ||
+																								name.toLower() == DefaultLanguages::Sql ||
+																								name.toLower() == DefaultLanguages::PlPgsql)))
+		{
+			item->setFont(0, grp_fnt);
+			item->setForeground(0, BaseObjectView::getFontStyle(Attributes::ProtColumn).foreground());
+			item->setToolTip(0, tr("This is a pgModeler's built-in object. It will be ignored if checked by user."));
+		}
+	}
+
+	//Stores the object's OID as the first data of the item
+	item->setData(ObjectId, Qt::UserRole, oid);
+
+	if(!item->toolTip(0).isEmpty())
+		item->setToolTip(0,item->toolTip(0) + "\n" + tooltip.arg(oid));
+	else
+		item->setToolTip(0,tooltip.arg(oid));
+
+	//Stores the object's type as the second data of the item
+	item->setData(ObjectTypeId, Qt::UserRole, enum_t(obj_type));
+
+	//Stores the schema and the table's name of the object
+	item->setData(ObjectSchema, Qt::UserRole, schema);
+	item->setData(ObjectTable, Qt::UserRole, table);
+
+	return item;
+}
+
 void DatabaseImportWidget::updateConnections()
 {
 	ConnectionsConfigWidget::fillConnectionsComboBox(connections_cmb, true, Connection::OpImport);
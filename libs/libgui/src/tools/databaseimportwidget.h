@@ -35,6 +35,7 @@
 #include "widgets/objectsfilterwidget.h"
 #include "widgets/debugoutputwidget.h"
 #include "modeldbselectorwidget.h"
+#include "utils/backgroundtask.h"
 #include <QTimer>
 #include <random>
 
@@ -72,6 +73,9 @@ class __libgui DatabaseImportWidget: public QWidget, public Ui::DatabaseImportWi
 		DebugOutputWidget *dbg_output_wgt;
 
 		ModelDbSelectorWidget *model_sel_wgt;
+
+		//! \brief Retrieves the objects to be listed in the tree in a worker thread (see listObjects())
+		BackgroundTask list_task;
 		
 		/*! \brief Toggles the checked state for the specified item. This method recursively
 		changes the check state for the children items */
@@ -98,8 +102,13 @@ class __libgui DatabaseImportWidget: public QWidget, public Ui::DatabaseImportWi
 		//! \brief Destroys both import thread and helper
 		void destroyThread();
 
-		//! \brief Filters and list in a different way the objects that matches the user provided filters
-		void listFilteredObjects();
+		/*! \brief Lists the objects retrieved by the list task in the objects tree or, when the filter
+		 *  is set to only matching objects, in the filtered objects view */
+		void listRetrievedObjects(bool only_matching);
+
+		/*! \brief Enables/disables the controls that trigger the objects listing while the list task runs.
+		 *  This avoids starting a new listing (or an import) while the current one is in progress */
+		void setListingObjects(bool listing);
 
 	public:
 		//! \brief Constants used to access the tree widget items data
@@ -128,6 +137,18 @@ class __libgui DatabaseImportWidget: public QWidget, public Ui::DatabaseImportWi
 			HideDisableEmptyGrps = 3
 		};
 
+		//! \brief Stores the attributes of the objects retrieved from a database to be listed in a tree widget (see retrieveObjects())
+		struct ListedObjects {
+			//! \brief The attributes of the database itself
+			attribs_map db_attribs;
+
+			//! \brief The database level objects
+			std::vector<attribs_map> db_objects;
+
+			//! \brief The children of schemas and tables (including views and foreign tables) indexed by the parent's oid
+			std::map<unsigned, std::vector<attribs_map>> children;
+		};
+
 		/*! \brief This constant holds the maximum amount of objects in a database to be imported
 		 * which will not generate an alert message about the possible slowdowns in the process
 		 * if all objects are imported without using filters */
@@ -152,13 +173,20 @@ class __libgui DatabaseImportWidget: public QWidget, public Ui::DatabaseImportWi
 		//! \brief Fills a combo box with all available databases by using the provided connection to retrieve information from catalogs
 		static void listDatabases(Connection conn, QComboBox *dbcombo);
 		
-		/*! \brief Fills a tree widget with all available database objects according to the configurations of the specified import helper.
-		The parameter 'disable_empty_grps' will make empty group items disabled. The parameter 'create_db_item' will create the root
+		/*! \brief Retrieves the objects to be listed by listObjects() according to the configurations of the specified import helper.
+		The parameter 'retrieve_db' retrieves the attributes of the database itself and 'retrieve_children' retrieves the children of
+		all schemas and tables, otherwise only the database level objects are retrieved. This method doesn't touch any widget so it
+		can be executed in a worker thread */
+		static ListedObjects retrieveObjects(DatabaseImportHelper &import_helper, bool retrieve_db, bool retrieve_children);
+
+		/*! \brief Fills a tree widget with the database objects previously retrieved by retrieveObjects().
+		The parameter 'group_flags' will make empty group items disabled and/or hidden. The parameter 'create_db_item' will create the root
 		item representing the database itself. The parameter 'create_dummy_item' create an empty child item that represent schema or table
-		child. In this case the generation of schema's or table's children need to be done manually. */
-		static void listObjects(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, bool checkable_items,
-														ObjGroupsFlag group_flags, bool create_db_item, bool create_dummy_item = false,
-														int sort_by = 0);
+		child. In this case the generation of schema's or table's children need to be done manually. The page_size and pending_objs
+		are passed to updateObjectsTree() in order to create only the first page of items of each group */
+		static void listObjects(DatabaseImportHelper &import_helper, ListedObjects &objects, QTreeWidget *tree_wgt, bool checkable_items,
+														ObjGroupsFlag group_flags, bool create_db_item, bool create_dummy_item = false, int sort_by = 0,
+														unsigned page_size = 0, std::map<QTreeWidgetItem *, std::vector<attribs_map>> *pending_objs = nullptr);
 
 		/*! \brief Fills a table widget by searching only objects matching the filters configured in the provided import helper
 		 * This method will force the first item of each row to be checkable also it'll adjust the column count to fit all info retrieved from catalog */
@@ -177,6 +205,20 @@ class __libgui DatabaseImportWidget: public QWidget, public Ui::DatabaseImportWi
 																											 bool checkable_items = false, ObjGroupsFlag group_flags = NoGrpsFlag, QTreeWidgetItem *root = nullptr,
 																											 const QString &schema = "", const QString &table = "");
 
+		/*! \brief Inserts onto the tree view the objects previously retrieved from the database (see updateObjectsTree()).
+		 * When page_size is greater than zero and pending_objs is provided, only the first page_size objects of each group have
+		 * their items created, the remaining ones are counted in the group and stored in pending_objs (indexed by group item) so
+		 * the caller can create their items on demand by using createObjectItem() */
+		static std::vector<QTreeWidgetItem *> updateObjectsTree(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, std::vector<ObjectType> types,
+																											 std::vector<attribs_map> &objects_vect, bool checkable_items, ObjGroupsFlag group_flags,
+																											 QTreeWidgetItem *root, const QString &schema, const QString &table,
+																											 unsigned page_size = 0, std::map<QTreeWidgetItem *, std::vector<attribs_map>> *pending_objs = nullptr);
+
+		/*! \brief Creates the item of the object described by the attributes (retrieved by DatabaseImportHelper::getObjects())
+		 * as a child of the provided group item */
+		static QTreeWidgetItem *createObjectItem(DatabaseImportHelper &import_helper, attribs_map &attribs, QTreeWidgetItem *group,
+																						 bool checkable_items, QTreeWidgetItem *root, const QString &schema, const QString &table);
+
 		//! \brief Updates the connections combo with the latest loaded connection settings
 		void updateConnections();
 
@@ -234,7 +234,7 @@ DataGridWidget::DataGridWidget(const QString &sch_name, const QString &tab_name,
 
 	connect(results_tbw, &QTableWidget::itemSelectionChanged, this, &DataGridWidget::enableRowControlButtons);
 
-	connect(csv_load_wgt, &CsvLoadWidget::s_csvFileLoaded, this, [this](){
+	connect(csv_load_wgt, &CsvLoadWidget::s_csvFileLoadRequested, this, [this](){
 		loadDataFromCsv();
 	});
 
@@ -618,44 +618,19 @@ void DataGridWidget::swapColumns()
 
 void DataGridWidget::loadDataFromCsv(bool load_from_clipboard, bool force_csv_parsing)
 {
+	if(load_from_clipboard && qApp->clipboard()->text().isEmpty())
+		return;
+
+	int first_row = 0;
+
 	try
 	{
 		QStringList csv_cols;
 		int row_id = 0, col_id = 0;
-		CsvDocument csv_doc;
 
 		qApp->setOverrideCursor(Qt::WaitCursor);
 		results_tbw->setUpdatesEnabled(false);
 
-		if(load_from_clipboard)
-		{
-			if(qApp->clipboard()->text().isEmpty())
-				return;
-
-			QString csv_pattern = "(%1)(.)*(%1)(%2)";
-			QChar separator = QChar::Tabulation, delimiter;
-			QString text = qApp->clipboard()->text();
-
-			if(force_csv_parsing)
-			{
-				if(text.contains(QRegularExpression(csv_pattern.arg("\"").arg(CsvDocument::Separator))))
-					delimiter = '\"';
-				else if(text.contains(QRegularExpression(csv_pattern.arg("'").arg(CsvDocument::Separator))))
-					delimiter='\'';
-
-							 // If one of the patterns matched the buffer we configure the right delimiter for csv buffer
-				if(!delimiter.isNull())
-					separator = CsvDocument::Separator;
-			}
-
-			csv_doc = CsvLoadWidget::loadCsvFromBuffer(text, separator, delimiter, false);
-		}
-		else
-		{
-			csv_doc = csv_load_wgt->getCsvDocument();
-			csv_cols = csv_doc.getColumnNames();
-		}
-
 		// If there is only one empty row in the grid, this one will
 		// be removed prior the csv loading
 		if(results_tbw->rowCount()==1)
@@ -675,18 +650,30 @@ void DataGridWidget::loadDataFromCsv(bool load_from_clipboard, bool force_csv_pa
 				removeNewRows({0});
 		}
 
-		for(int csv_row = 0; csv_row < csv_doc.getRowCount(); csv_row++)
-		{
-			addRow();
-			row_id = results_tbw->rowCount() - 1;
+		first_row = results_tbw->rowCount();
 
-			for(int csv_col = 0; csv_col < csv_doc.getColumnCount(); csv_col++)
+		/* Each parsed row is inserted directly in the grid so the csv document
+		 * doesn't need to be entirely stored in memory before the loading */
+		CsvParser::RowHandler add_csv_row = [&](int csv_row, const QStringList &values) {
+			if(csv_row == CsvParser::HeaderRow)
 			{
-				if(csv_col > csv_doc.getColumnCount())
-					break;
+				csv_cols = values;
+				return true;
+			}
+
+			if(!csv_cols.isEmpty() && values.size() != csv_cols.size())
+			{
+				throw Exception(Exception::getErrorMessage(ErrorCode::MalformedCsvInvalidCols)
+												.arg(csv_cols.size()).arg(csv_row + 1).arg(values.size()),
+												ErrorCode::MalformedCsvInvalidCols, PGM_FUNC, PGM_FILE, PGM_LINE);
+			}
+
+			addRow(false);
+			row_id = results_tbw->rowCount() - 1;
 
-				if((!load_from_clipboard && csv_load_wgt->isColumnsInFirstRow()) ||
-						(load_from_clipboard && !csv_cols.isEmpty()))
+			for(int csv_col = 0; csv_col < values.size(); csv_col++)
+			{
+				if(!csv_cols.isEmpty())
 				{
 					//First we need to get the index of the column by its name
 					col_id = col_names.indexOf(csv_cols[csv_col]);
@@ -696,15 +683,40 @@ void DataGridWidget::loadDataFromCsv(bool load_from_clipboard, bool force_csv_pa
 						col_id = csv_col;
 
 					if(col_id >= 0 && col_id < results_tbw->columnCount())
-						results_tbw->item(row_id, col_id)->setText(csv_doc.getValue(csv_row, csv_col));
+						results_tbw->item(row_id, col_id)->setText(values[csv_col]);
 				}
 				else if(csv_col < results_tbw->columnCount())
 				{
 					//Insert the value to the cell in order of appearance
-					results_tbw->item(row_id, csv_col)->setText(csv_doc.getValue(csv_row, csv_col));
+					results_tbw->item(row_id, csv_col)->setText(values[csv_col]);
 				}
 			}
+
+			return true;
+		};
+
+		if(load_from_clipboard)
+		{
+			QString csv_pattern = "(%1)(.)*(%1)(%2)";
+			QChar separator = QChar::Tabulation, delimiter;
+			QString text = qApp->clipboard()->text();
+
+			if(force_csv_parsing)
+			{
+				if(text.contains(QRegularExpression(csv_pattern.arg("\"").arg(CsvDocument::Separator))))
+					delimiter = '\"';
+				else if(text.contains(QRegularExpression(csv_pattern.arg("'").arg(CsvDocument::Separator))))
+					delimiter='\'';
+
+							 // If one of the patterns matched the buffer we configure the right delimiter for csv buffer
+				if(!delimiter.isNull())
+					separator = CsvDocument::Separator;
+			}
+
+			CsvLoadWidget::loadCsvFromBuffer(text, separator, delimiter, false, add_csv_row);
 		}
+		else
+			csv_load_wgt->loadCsvFile(add_csv_row);
 
 		results_tbw->setUpdatesEnabled(true);
 		updateRowOperationsInfo();
@@ -712,7 +724,16 @@ void DataGridWidget::loadDataFromCsv(bool load_from_clipboard, bool force_csv_pa
 	}
 	catch(Exception &e)
 	{
-		//qApp->restoreOverrideCursor();
+		std::vector<int> csv_rows;
+
+		// Discarding the rows inserted before the parsing error
+		for(int row = first_row; row < results_tbw->rowCount(); row++)
+			csv_rows.push_back(row);
+
+		removeNewRows(csv_rows);
+		results_tbw->setUpdatesEnabled(true);
+		updateRowOperationsInfo();
+		qApp->restoreOverrideCursor();
 		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
 	}
 }
@@ -1002,19 +1023,21 @@ void DataGridWidget::markOperationOnRow(OperationId operation, int row)
 
 		if(marked_cols > 0)
 		{
-			auto itr = std::find(changed_rows.begin(), changed_rows.end(), row);
+			/* The changed rows list is always kept sorted so a binary search can be used
+			 * avoiding quadratic costs when thousands of rows are marked (e.g. CSV loading) */
+			auto itr = std::lower_bound(changed_rows.begin(), changed_rows.end(), row);
+			bool found = itr != changed_rows.end() && *itr == row;
 
-			if(operation == NoOperation && itr != changed_rows.end())
+			if(operation == NoOperation && found)
 			{
-				changed_rows.erase(std::find(changed_rows.begin(), changed_rows.end(), row));
+				changed_rows.erase(itr);
 				prev_bg_colors.erase(row);
 				prev_fg_colors.erase(row);
 			}
-			else if(operation!=NoOperation && itr==changed_rows.end())
-				changed_rows.push_back(row);
+			else if(operation!=NoOperation && !found)
+				changed_rows.insert(itr, row);
 
 			header_item->setData(Qt::UserRole, operation);
-			std::sort(changed_rows.begin(), changed_rows.end());
 
 			emit s_saveEnabled(!changed_rows.empty());
 			emit s_undoEnabled(!changed_rows.empty());
@@ -1307,11 +1330,12 @@ void DataGridWidget::saveChanges()
 				 Messagebox::Alert, Messagebox::OkButton);
 #else
 	int row = 0;
+	bool cancel_requested = false;
 	Connection conn_sql { conn_params };
+	TaskProgressWidget task_prog_wgt(this);
 
 	try
 	{
-		QString cmd;
 		Messagebox msg_box;
 
 		msg_box.show(tr("<strong>WARNING:</strong> Once commited its not possible to undo the changes! Proceed with saving?"),
@@ -1323,20 +1347,29 @@ void DataGridWidget::saveChanges()
 			//Forcing the cell editor to be closed by selecting an unexistent cell and clearing the selection
 			results_tbw->setCurrentCell(-1,-1, QItemSelectionModel::Clear);
 
+			task_prog_wgt.setWindowTitle(tr("Saving changes..."));
+			task_prog_wgt.setCancelEnabled(true);
+			connect(&task_prog_wgt, &TaskProgressWidget::s_cancelRequested, this, [&cancel_requested](){
+				cancel_requested = true;
+			});
+			task_prog_wgt.show();
+
 			conn_sql.connect();
 			conn_sql.executeDDLCommand("START TRANSACTION");
 
-			for(const auto &changed_row : changed_rows)
+			/* If the user cancels the operation nothing is persisted and the
+			 * changed rows are kept in the grid so they can be saved later */
+			if(!applyChangesInBatches(conn_sql, task_prog_wgt, cancel_requested, row))
 			{
-				/* We make a copy of the row id so in case of exception (see in the catch block)
-				 * we can highlight the problematic row data */
-				row = changed_row;
-				cmd = getDMLCommand(row);
-				conn_sql.executeDDLCommand(cmd);
+				conn_sql.executeDDLCommand("ROLLBACK");
+				conn_sql.close();
+				task_prog_wgt.close();
+				return;
 			}
 
 			conn_sql.executeDDLCommand("COMMIT");
 			conn_sql.close();
+			task_prog_wgt.close();
 
 			changed_rows.clear();
 			retrieveData();
@@ -1355,6 +1388,11 @@ void DataGridWidget::saveChanges()
 		QString fmt_tb_name = QString("%1.%2").arg(sch_name, tab_name);
 		unsigned op_type = results_tbw->verticalHeaderItem(row)->data(Qt::UserRole).toUInt();
 
+		task_prog_wgt.close();
+
+		if(conn_sql.isCopyInProgress())
+			conn_sql.endCopy(tr("Data saving aborted due to errors!"));
+
 		conn_sql.executeDDLCommand("ROLLBACK");
 		conn_sql.close();
 
@@ -1368,6 +1406,387 @@ void DataGridWidget::saveChanges()
 #endif
 }
 
+bool DataGridWidget::isBatchableValue(OperationId op_type, ValueKind kind, const QString &value)
+{
+	if(op_type == OpUpdate)
+		return kind == PlainValue;
+
+	if(op_type == OpInsert)
+		return kind == DefaultValue || (kind == PlainValue && !value.contains('\\'));
+
+	return true;
+}
+
+bool DataGridWidget::applyChangesInBatches(Connection &conn, TaskProgressWidget &task_prog_wgt, const bool &cancel_requested, int &row)
+{
+	QString fmt_tb_name = QString("\"%1\".\"%2\"").arg(sch_name, tab_name),
+			col_name, value, cmd;
+	std::map<QString, QString> col_types = getColumnsTypes(conn);
+	std::map<QString, std::vector<int>> upd_batches, copy_batches;
+	std::vector<int> del_rows, ins_rows, single_rows;
+	QStringList key_types, key_aliases, key_filter, cols;
+	QTableWidgetItem *item = nullptr;
+	unsigned op_type = NoOperation;
+	int total_rows = changed_rows.size(), saved_rows = 0;
+	size_t end = 0;
+	bool batchable = false;
+	ValueKind kind = PlainValue;
+
+	/* Updates the progress every time a batch is sent giving the user the chance to
+	 * cancel the operation. Returns false if the cancel was requested */
+	auto updateProgress = [&](int row_cnt, const QString &msg) {
+		saved_rows += row_cnt;
+		task_prog_wgt.updateProgress((saved_rows * 100) / total_rows,
+																 msg.arg(saved_rows).arg(total_rows), enum_t(ObjectType::Table));
+		qApp->processEvents();
+		return !cancel_requested;
+	};
+
+	// Returns the original values of the key columns of a row casted to their types
+	auto getKeyValues = [&](int key_row) {
+		QStringList values;
+		QString key_val;
+
+		for(int idx = 0; idx < pk_col_names.size(); idx++)
+		{
+			key_val = results_tbw->item(key_row, col_names.indexOf(pk_col_names[idx]))->data(Qt::UserRole).toString();
+			values.append(QString("CAST('%1' AS %2)").arg(key_val.replace("\'","''"), key_types[idx]));
+		}
+
+		return values;
+	};
+
+	configureFilterColumns();
+
+	for(int idx = 0; idx < pk_col_names.size(); idx++)
+	{
+		key_types.append(col_types[pk_col_names[idx]]);
+		key_aliases.append(QString("_k%1").arg(idx));
+		key_filter.append(QString("_t.\"%1\" = _d._k%2").arg(pk_col_names[idx]).arg(idx));
+	}
+
+	/* Separating the changed rows in batches. Rows are only batched when they are identified
+	 * by non null key values (a multi-row filter can't match nulls using equality), and in case of
+	 * updates, when the changed columns have no default values or expressions (see isBatchableValue()) */
+	for(auto &changed_row : changed_rows)
+	{
+		row = changed_row;
+		op_type = results_tbw->verticalHeaderItem(row)->data(Qt::UserRole).toUInt();
+		batchable = !pk_col_names.isEmpty() && !key_types.contains("");
+
+		if(op_type == OpDelete || op_type == OpUpdate)
+		{
+			for(auto &pk_col : pk_col_names)
+			{
+				if(results_tbw->item(row, col_names.indexOf(pk_col))->data(Qt::UserRole).toString() == SQLExecutionWidget::ColumnNullValue)
+				{
+					batchable = false;
+					break;
+				}
+			}
+		}
+
+		if(op_type == OpDelete)
+		{
+			if(batchable)
+				del_rows.push_back(row);
+			else
+				single_rows.push_back(row);
+		}
+		else if(op_type == OpUpdate)
+		{
+			cols.clear();
+
+			for(int col = 0; col < results_tbw->columnCount(); col++)
+			{
+				item = results_tbw->item(row, col);
+
+				if(item->text() == item->data(Qt::UserRole))
+					continue;
+
+				kind = getColumnValue(row, col, value);
+				col_name = results_tbw->horizontalHeaderItem(col)->data(Qt::UserRole).toString();
+
+				if(!isBatchableValue(OpUpdate, kind, value) || col_types[col_name].isEmpty())
+					batchable = false;
+
+				cols.append(QString::number(col));
+			}
+
+			// Rows without changed values don't generate commands (see getDMLCommand())
+			if(cols.isEmpty())
+				total_rows--;
+			else if(batchable)
+				upd_batches[cols.join(',')].push_back(row);
+			else
+				single_rows.push_back(row);
+		}
+		else if(op_type == OpInsert)
+		{
+			cols.clear();
+
+			/* COPY can't be used on views (even auto-updatable ones) and it has no way to represent
+			 * expressions or default values in a row, so the columns with default values are omitted
+			 * and the rows are grouped by the columns that are filled. Values containing backslashes
+			 * are also inserted via INSERT since COPY handles escape sequences slightly different from E'' strings */
+			batchable = obj_type != ObjectType::View;
+
+			for(int col = 0; col < results_tbw->columnCount() && batchable; col++)
+			{
+				kind = getColumnValue(row, col, value);
+
+				if(!isBatchableValue(OpInsert, kind, value))
+					batchable = false;
+				else if(kind == PlainValue)
+					cols.append(QString::number(col));
+			}
+
+			if(batchable && !cols.isEmpty())
+				copy_batches[cols.join(',')].push_back(row);
+			else
+				ins_rows.push_back(row);
+		}
+	}
+
+	if(total_rows == 0)
+		return true;
+
+	//Deleting rows
+	for(size_t start = 0; start < del_rows.size(); start += SaveBatchSize)
+	{
+		QStringList tuples;
+
+		end = std::min(del_rows.size(), start + SaveBatchSize);
+		row = del_rows[start];
+
+		for(size_t idx = start; idx < end; idx++)
+			tuples.append(QString("(%1)").arg(getKeyValues(del_rows[idx]).join(", ")));
+
+		conn.executeDDLCommand(QString("DELETE FROM %1 AS _t USING (VALUES %2) AS _d(%3) WHERE %4")
+													 .arg(fmt_tb_name, tuples.join(",\n"), key_aliases.join(", "), key_filter.join(" AND ")));
+
+		if(!updateProgress(end - start, tr("Deleting rows (%1/%2)...")))
+			return false;
+	}
+
+	//Updating rows grouped by the set of changed columns
+	for(auto &[upd_cols, rows] : upd_batches)
+	{
+		QStringList set_list, val_aliases, col_ids = upd_cols.split(',');
+
+		for(auto &col_id : col_ids)
+		{
+			col_name = results_tbw->horizontalHeaderItem(col_id.toInt())->data(Qt::UserRole).toString();
+			set_list.append(QString("\"%1\" = _d._v%2").arg(col_name, col_id));
+			val_aliases.append(QString("_v%1").arg(col_id));
+		}
+
+		for(size_t start = 0; start < rows.size(); start += SaveBatchSize)
+		{
+			QStringList tuples;
+
+			end = std::min(rows.size(), start + SaveBatchSize);
+			row = rows[start];
+
+			for(size_t idx = start; idx < end; idx++)
+			{
+				QStringList values = getKeyValues(rows[idx]);
+
+				for(auto &col_id : col_ids)
+				{
+					col_name = results_tbw->horizontalHeaderItem(col_id.toInt())->data(Qt::UserRole).toString();
+					kind = getColumnValue(rows[idx], col_id.toInt(), value);
+					values.append(QString("CAST(%1 AS %2)").arg(formatColumnValue(kind, value), col_types[col_name]));
+				}
+
+				tuples.append(QString("(%1)").arg(values.join(", ")));
+			}
+
+			conn.executeDDLCommand(QString("UPDATE %1 AS _t SET %2 FROM (VALUES %3) AS _d(%4) WHERE %5")
+														 .arg(fmt_tb_name, set_list.join(", "), tuples.join(",\n"),
+																	(key_aliases + val_aliases).join(", "), key_filter.join(" AND ")));
+
+			if(!updateProgress(end - start, tr("Updating rows (%1/%2)...")))
+				return false;
+		}
+	}
+
+	//Deletes and updates that couldn't be batched are applied one by one
+	for(size_t idx = 0; idx < single_rows.size(); idx++)
+	{
+		row = single_rows[idx];
+		cmd = getDMLCommand(row);
+
+		if(!cmd.isEmpty())
+			conn.executeDDLCommand(cmd);
+
+		if(((idx + 1) % SaveBatchSize == 0 || idx == single_rows.size() - 1) &&
+			 !updateProgress((idx % SaveBatchSize) + 1, tr("Saving rows (%1/%2)...")))
+			return false;
+	}
+
+	//Streaming the new rows grouped by the filled columns via COPY
+	for(auto &[ins_cols, rows] : copy_batches)
+	{
+		QStringList copy_cols, fields, col_ids = ins_cols.split(',');
+		QByteArray buffer;
+
+		for(auto &col_id : col_ids)
+			copy_cols.append(QString("\"%1\"").arg(results_tbw->horizontalHeaderItem(col_id.toInt())->data(Qt::UserRole).toString()));
+
+		row = rows[0];
+		conn.startCopy(QString("COPY %1(%2) FROM STDIN").arg(fmt_tb_name, copy_cols.join(", ")));
+
+		for(size_t idx = 0; idx < rows.size(); idx++)
+		{
+			fields.clear();
+
+			for(auto &col_id : col_ids)
+			{
+				getColumnValue(rows[idx], col_id.toInt(), value);
+
+				// Values in COPY text format can't contain raw tabs and line breaks
+				value.replace('\t', "\\t");
+				value.replace('\n', "\\n");
+				value.replace('\r', "\\r");
+				fields.append(value);
+			}
+
+			buffer.append(fields.join('\t').toUtf8());
+			buffer.append('\n');
+
+			if((idx + 1) % SaveBatchSize == 0 || idx == rows.size() - 1)
+			{
+				conn.putCopyData(buffer);
+				buffer.clear();
+
+				if(!updateProgress((idx % SaveBatchSize) + 1, tr("Inserting rows (%1/%2)...")))
+				{
+					conn.endCopy(tr("Data saving cancelled by the user!"));
+					return false;
+				}
+			}
+		}
+
+		conn.endCopy();
+	}
+
+	//Inserting the rows that can't be copied using multi-row INSERT commands
+	if(!ins_rows.empty())
+	{
+		cols.clear();
+
+		for(int col = 0; col < results_tbw->columnCount(); col++)
+			cols.append(QString("\"%1\"").arg(results_tbw->horizontalHeaderItem(col)->data(Qt::UserRole).toString()));
+
+		for(size_t start = 0; start < ins_rows.size(); start += SaveBatchSize)
+		{
+			QStringList tuples;
+
+			end = std::min(ins_rows.size(), start + SaveBatchSize);
+			row = ins_rows[start];
+
+			for(size_t idx = start; idx < end; idx++)
+			{
+				QStringList values;
+
+				for(int col = 0; col < results_tbw->columnCount(); col++)
+				{
+					kind = getColumnValue(ins_rows[idx], col, value);
+					values.append(formatColumnValue(kind, value));
+				}
+
+				tuples.append(QString("(%1)").arg(values.join(", ")));
+			}
+
+			conn.executeDDLCommand(QString("INSERT INTO %1(%2) VALUES %3")
+														 .arg(fmt_tb_name, cols.join(", "), tuples.join(",\n")));
+
+			if(!updateProgress(end - start, tr("Inserting rows (%1/%2)...")))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+std::map<QString, QString> DataGridWidget::getColumnsTypes(Connection &conn)
+{
+	std::map<QString, QString> col_types;
+	ResultSet res;
+	QString rel_name = QString("\"%1\".\"%2\"").arg(sch_name, tab_name);
+
+	conn.executeDMLCommand(QString("SELECT attname, format_type(atttypid, atttypmod) AS typname FROM pg_attribute \
+WHERE attrelid = '%1'::regclass AND attnum > 0 AND NOT attisdropped").arg(rel_name.replace("\'", "''")), res);
+
+	if(res.accessTuple(ResultSet::FirstTuple))
+	{
+		do
+		{
+			col_types[res.getColumnValue("attname")] = res.getColumnValue("typname");
+		}
+		while(res.accessTuple(ResultSet::NextTuple));
+	}
+
+	return col_types;
+}
+
+void DataGridWidget::configureFilterColumns()
+{
+	if(!pk_col_names.isEmpty())
+		return;
+
+	//Considering all columns as pk when the tables doesn't has one (except bytea columns)
+	for(int col = 0; col < results_tbw->columnCount(); col++)
+	{
+		if(results_tbw->horizontalHeaderItem(col)->data(Qt::ToolTipRole) != "bytea")
+			pk_col_names.push_back(results_tbw->horizontalHeaderItem(col)->data(Qt::UserRole).toString());
+	}
+}
+
+DataGridWidget::ValueKind DataGridWidget::getColumnValue(int row, int col, QString &value)
+{
+	value = results_tbw->item(row, col)->text();
+
+	//Checking if the value is a malformed unescaped value, e.g., {value, value}, {value\}
+	if((value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(QString("\\") + UtilsNs::UnescValueEnd)) ||
+			(value.startsWith(UtilsNs::UnescValueStart) && !value.endsWith(UtilsNs::UnescValueEnd)) ||
+			(!value.startsWith(UtilsNs::UnescValueStart) && !value.endsWith(QString("\\") + UtilsNs::UnescValueEnd) && value.endsWith(UtilsNs::UnescValueEnd)))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::MalformedUnescapedValue)
+										.arg(row + 1).arg(results_tbw->horizontalHeaderItem(col)->data(Qt::UserRole).toString()),
+										ErrorCode::MalformedUnescapedValue, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	//Empty values as considered as DEFAULT
+	if(value.isEmpty())
+		return DefaultValue;
+
+	//Unescaped values will not be enclosed in quotes
+	if(value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(UtilsNs::UnescValueEnd))
+	{
+		value.remove(0, 1);
+		value.remove(value.length()-1, 1);
+		return ExpressionValue;
+	}
+
+	value.replace(QString("\\") + UtilsNs::UnescValueStart, UtilsNs::UnescValueStart);
+	value.replace(QString("\\") + UtilsNs::UnescValueEnd, UtilsNs::UnescValueEnd);
+	return PlainValue;
+}
+
+QString DataGridWidget::formatColumnValue(ValueKind kind, const QString &value)
+{
+	if(kind == DefaultValue)
+		return "DEFAULT";
+
+	if(kind == ExpressionValue)
+		return value;
+
+	//Quoting value
+	return "E'" + QString(value).replace("\'","''") + "'";
+}
+
 QString DataGridWidget::getDMLCommand(int row)
 {
 	if(row < 0 || row >= results_tbw->rowCount())
@@ -1383,18 +1802,11 @@ QString DataGridWidget::getDMLCommand(int row)
 	QStringList val_list, col_list, flt_list;
 	QString col_name, value;
 	QVariant data;
+	ValueKind kind = PlainValue;
 
 	if(op_type == OpDelete || op_type == OpUpdate)
 	{
-		if(pk_col_names.isEmpty())
-		{
-			//Considering all columns as pk when the tables doesn't has one (except bytea columns)
-			for(int col = 0; col < results_tbw->columnCount(); col++)
-			{
-				if(results_tbw->horizontalHeaderItem(col)->data(Qt::ToolTipRole) != "bytea")
-					pk_col_names.push_back(results_tbw->horizontalHeaderItem(col)->data(Qt::UserRole).toString());
-			}
-		}
+		configureFilterColumns();
 
 		//Creating the where clause with original column's values
 		for(auto &pk_col : pk_col_names)
@@ -1419,43 +1831,14 @@ QString DataGridWidget::getDMLCommand(int row)
 		for(int col=0; col < results_tbw->columnCount(); col++)
 		{
 			item = results_tbw->item(row, col);
-			value = item->text();
 			col_name = results_tbw->horizontalHeaderItem(col)->data(Qt::UserRole).toString();
 
-			if(op_type==OpInsert || (op_type==OpUpdate && value != item->data(Qt::UserRole)))
+			if(op_type==OpInsert || (op_type==OpUpdate && item->text() != item->data(Qt::UserRole)))
 			{
-				//Checking if the value is a malformed unescaped value, e.g., {value, value}, {value\}
-				if((value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(QString("\\") + UtilsNs::UnescValueEnd)) ||
-						(value.startsWith(UtilsNs::UnescValueStart) && !value.endsWith(UtilsNs::UnescValueEnd)) ||
-						(!value.startsWith(UtilsNs::UnescValueStart) && !value.endsWith(QString("\\") + UtilsNs::UnescValueEnd) && value.endsWith(UtilsNs::UnescValueEnd)))
-				{
-					throw Exception(Exception::getErrorMessage(ErrorCode::MalformedUnescapedValue)
-													.arg(row + 1).arg(col_name),
-													ErrorCode::MalformedUnescapedValue, PGM_FUNC, PGM_FILE, PGM_LINE);
-				}
-
+				kind = getColumnValue(row, col, value);
+				value = formatColumnValue(kind, value);
 				col_list.push_back(QString("\"%1\"").arg(col_name));
 
-				//Empty values as considered as DEFAULT
-				if(value.isEmpty())
-				{
-					value = "DEFAULT";
-				}
-				//Unescaped values will not be enclosed in quotes
-				else if(value.startsWith(UtilsNs::UnescValueStart) && value.endsWith(UtilsNs::UnescValueEnd))
-				{
-					value.remove(0, 1);
-					value.remove(value.length()-1, 1);
-				}
-				//Quoting value
-				else
-				{
-					value.replace(QString("\\") + UtilsNs::UnescValueStart, UtilsNs::UnescValueStart);
-					value.replace(QString("\\") + UtilsNs::UnescValueEnd, UtilsNs::UnescValueEnd);
-					value.replace("\'","''");
-					value = "E'" + value + "'";
-				}
-
 				if(op_type == OpInsert)
 					val_list.push_back(value);
 				else
@@ -34,18 +34,15 @@
 #include "utils/syntaxhighlighter.h"
 #include "widgets/codecompletionwidget.h"
 #include "widgets/csvloadwidget.h"
+#include "widgets/taskprogresswidget.h"
 
 class __libgui DataGridWidget: public QWidget, public Ui::DataGridWidget {
 	Q_OBJECT
 
 	private:	
-		//! \brief Constants used to mark the type of operation performed on rows
-		enum OperationId: unsigned {
-			NoOperation,
-			OpInsert,
-			OpUpdate,
-			OpDelete
-		};
+		/*! \brief The maximum amount of rows handled by a single batched command (or sent in a single
+		 *  COPY chunk) when saving the changes (see saveChanges()) */
+		static constexpr int SaveBatchSize = 1000;
 
 		//! \brief A CSV loader widget that loads data from CSV to the data grid
 		CsvLoadWidget *csv_load_wgt;
@@ -122,6 +119,33 @@ class __libgui DataGridWidget: public QWidget, public Ui::DataGridWidget {
 		
 		//! \brief Generates a DML command for the row depending on the it's operation type
 		QString getDMLCommand(int row);
+
+		/*! \brief Uses all the columns of the table (except the bytea ones) as the columns that identify
+		 *  the rows in update/delete commands when the table has no primary key */
+		void configureFilterColumns();
+
+		/*! \brief Returns the kind of the value of the cell at (row, col) and stores in the value parameter
+		 *  the text to be used in DML commands: the unescaped literal text for plain values (without quotes),
+		 *  the raw SQL expression for unescaped values ({expr}) or an empty string for default values.
+		 *  Raises an error in case of malformed unescaped values */
+		ValueKind getColumnValue(int row, int col, QString &value);
+
+		//! \brief Formats a value returned by getColumnValue() to be used in a DML command
+		QString formatColumnValue(ValueKind kind, const QString &value);
+
+		/*! \brief Returns the data types (as formatted by the server) of the columns of the browsed table.
+		 *  These types are used to cast the values in the batched commands created by saveChanges() */
+		std::map<QString, QString> getColumnsTypes(Connection &conn);
+
+		/*! \brief Applies all the pending changes in the provided connection (which must be in a transaction).
+		 *  Deleted rows are removed first, then updated rows are changed and finally new rows are inserted.
+		 *  Rows of the same kind are handled in batches: deletes and updates use multi-row commands keyed by the
+		 *  primary key (DELETE ... USING (VALUES ...) and UPDATE ... FROM (VALUES ...)) and inserts are streamed
+		 *  through COPY ... FROM STDIN. Rows that can't be batched (e.g. null key values, default values in
+		 *  updates) fallback to the command generated by getDMLCommand(). The parameter row receives the first
+		 *  row of the batch being handled so it can be highlighted in case of errors. Returns false if the
+		 *  cancel_requested flag was set (via progress widget) before all changes were applied */
+		bool applyChangesInBatches(Connection &conn, TaskProgressWidget &task_prog_wgt, const bool &cancel_requested, int &row);
 		
 		//! \brief Remove the rows marked as OP_INSERT which ids are specified on the parameter vector
 		void removeNewRows(std::vector<int> ins_rows);
@@ -143,9 +167,30 @@ class __libgui DataGridWidget: public QWidget, public Ui::DataGridWidget {
 		void updateRowOperationsInfo();
 
 	public:
+		//! \brief Constants used to mark the type of operation performed on rows
+		enum OperationId: unsigned {
+			NoOperation,
+			OpInsert,
+			OpUpdate,
+			OpDelete
+		};
+
+		//! \brief Constants used to identify how a cell value must be handled in DML commands (see getColumnValue())
+		enum ValueKind: unsigned {
+			PlainValue,
+			DefaultValue,
+			ExpressionValue
+		};
+
 		DataGridWidget(const QString &sch_name, const QString &tab_name,
 									 ObjectType obj_type, const attribs_map &conn_params,
 									 QWidget * parent = nullptr, Qt::WindowFlags f = Qt::Widget);
+
+		/*! \brief Returns whether a changed cell value can be applied through a batched command of the provided operation
+		 *  (see applyChangesInBatches()). Default values and expressions can't be used in the VALUES lists of batched updates
+		 *  (an expression may reference the row's own columns) and COPY has no way to represent expressions nor the escape
+		 *  sequences of values with backslashes. Default values in inserts are batchable since their columns are omitted */
+		static bool isBatchableValue(OperationId op_type, ValueKind kind, const QString &value);
 		
 		//! \brief Returns whether the filter widget is toggled
 		bool isFilterToggled();
@@ -114,6 +114,7 @@ DiffToolWidget::DiffToolWidget(QWidget *parent) : BaseConfigWidget (parent)
 	export_conn = nullptr;
 	process_paused = false;
 	diff_progress = curr_step = total_steps = 0;
+	imp_progress[InputImpThread] = imp_progress[ComparedImpThread] = 0;
 
 	sqlcode_hl = new SyntaxHighlighter(sqlcode_txt);
 	sqlcode_hl->loadConfiguration(GlobalAttributes::getSQLHighlightConfPath());
@@ -329,10 +330,12 @@ void DiffToolWidget::createThread(ThreadId thread_id)
 
 		connect(input_imp_helper, &DatabaseImportHelper::s_progressUpdated, this,
 				[this](int progress, QString msg, ObjectType obj_type) {
-					updateProgress(progress, msg, obj_type);
+					updateImportProgress(InputImpThread, progress, msg, obj_type);
 		}, Qt::BlockingQueuedConnection);
 
-		connect(input_imp_helper, &DatabaseImportHelper::s_importFinished, this, __slot_n(this, DiffToolWidget::handleImportFinished));
+		connect(input_imp_helper, &DatabaseImportHelper::s_importFinished, this, [this](Exception e) {
+			__trycatch( handleImportFinished(InputImpThread, e); )
+		});
 		connect(input_imp_helper, &DatabaseImportHelper::s_importAborted, this, &DiffToolWidget::captureThreadError);
 	}
 	else if(thread_id == ComparedImpThread)
@@ -347,10 +350,12 @@ void DiffToolWidget::createThread(ThreadId thread_id)
 
 		connect(compared_imp_helper, &DatabaseImportHelper::s_progressUpdated, this,
 						[this](int progress, QString msg, ObjectType obj_type) {
-			updateProgress(progress, msg, obj_type);
+			updateImportProgress(ComparedImpThread, progress, msg, obj_type);
 		}, Qt::BlockingQueuedConnection);
 
-		connect(compared_imp_helper, &DatabaseImportHelper::s_importFinished, this, __slot_n(this, DiffToolWidget::handleImportFinished));
+		connect(compared_imp_helper, &DatabaseImportHelper::s_importFinished, this, [this](Exception e) {
+			__trycatch( handleImportFinished(ComparedImpThread, e); )
+		});
 		connect(compared_imp_helper, &DatabaseImportHelper::s_importAborted, this, &DiffToolWidget::captureThreadError);
 	}
 	else if(thread_id == DiffThread)
@@ -562,6 +567,7 @@ void DiffToolWidget::startDiff()
 
 	dbg_output_wgt->setLogMessages(debug_mode_chk->isChecked());
 	settings_tbw->setTabVisible(3, debug_mode_chk->isChecked());
+	CodeCache::resetStatistics();
 
 	buttons_wgt->setEnabled(false);
 	cancel_btn->setEnabled(true);
@@ -576,7 +582,24 @@ void DiffToolWidget::startDiff()
 	 * We need to import the involved databases, otherwise we use
 	 * the ones selected by the user in the comparison */
 	if(!model_to_model_tb->isChecked())
-		importDatabase(db_to_db_tb->isChecked() ? InputImpThread : ComparedImpThread);
+	{
+		imp_progress[InputImpThread] = imp_progress[ComparedImpThread] = 0;
+
+		/* When comparing two databases both imports are configured before starting
+		 * their threads so the two catalogs are retrieved at the same time */
+		if(db_to_db_tb->isChecked())
+		{
+			importDatabase(InputImpThread);
+			curr_step++;
+		}
+
+		importDatabase(ComparedImpThread);
+
+		if(input_imp_thread)
+			input_imp_thread->start();
+
+		compared_imp_thread->start();
+	}
 	else
 		diffModels();
 }
@@ -591,7 +614,6 @@ void DiffToolWidget::importDatabase(ThreadId thread_id)
 		qApp->setOverrideCursor(Qt::WaitCursor);
 		createThread(thread_id);
 
-		QThread *thread = (thread_id == InputImpThread ? input_imp_thread : compared_imp_thread);
 		DatabaseImportHelper *import_hlp = (thread_id == InputImpThread ? input_imp_helper : compared_imp_helper);
 		ModelDbSelectorWidget *model_db_sel = (thread_id == InputImpThread ? input_sel_wgt : compared_sel_wgt);
 		Connection cat_conn = model_db_sel->getSelectedConnection(), hlp_conn;
@@ -667,7 +689,6 @@ void DiffToolWidget::importDatabase(ThreadId thread_id)
 		import_hlp->setCurrentDatabase(db_name);
 		import_hlp->setImportOptions(import_sys_objs_chk->isChecked(), import_ext_objs_chk->isChecked(), true,
 																 ignore_errors_chk->isChecked(), debug_mode_chk->isChecked(), false, false, false);
-		thread->start();
 		qApp->restoreOverrideCursor();
 	}
 	catch(Exception &e)
@@ -868,6 +889,10 @@ void DiffToolWidget::finishDiff()
 	step_pb->setValue(100);
 	progress_pb->setValue(100);
 
+	//Logging the code cache usage during the diff process so the memory budget can be tuned
+	if(debug_mode_chk->isChecked())
+		dbg_output_wgt->logMessage(CodeCache::getStatisticsSummary(), Qt::cyan);
+
 	qApp->alert(this);
 }
 
@@ -936,27 +961,29 @@ void DiffToolWidget::captureThreadError(Exception e)
 	Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
 }
 
-void DiffToolWidget::handleImportFinished(Exception e)
+void DiffToolWidget::handleImportFinished(ThreadId thread_id, Exception e)
 {
+	QThread *thread = (thread_id == InputImpThread ? input_imp_thread : compared_imp_thread),
+			*other_thread = (thread_id == InputImpThread ? compared_imp_thread : input_imp_thread);
+
 	if(!e.getErrorMessage().isEmpty())
 	{
 		Messagebox msgbox;
 		msgbox.show(e, e.getErrorMessage(), Messagebox::Alert);
 	}
 
-	curr_step++;
+	thread->quit();
+	thread->wait();
 
-	if(input_imp_thread && input_imp_thread->isRunning())
-	{
-		input_imp_thread->quit();
+	if(thread_id == InputImpThread)
 		input_imp_item->setExpanded(false);
-		importDatabase(ComparedImpThread);
-	}
-	else
-	{
-		compared_imp_thread->quit();
-		diffModels();
-	}
+
+	// The diff is started only when the other import (if any) has finished too
+	if(other_thread && other_thread->isRunning())
+		return;
+
+	curr_step++;
+	diffModels();
 }
 
 void DiffToolWidget::handleDiffFinished()
@@ -1027,32 +1054,7 @@ void DiffToolWidget::updateProgress(int progress, QString msg, ObjectType obj_ty
 
 	msg = UtilsNs::formatMessage(msg);
 
-	if(input_imp_thread && input_imp_thread->isRunning())
-	{
-		progress_aux = progress/5;
-
-		if(!low_verbosity)
-		{
-			GuiUtilsNs::createOutputTreeItem(output_trw, msg,
-												GuiUtilsNs::getPixmap(obj_type),
-												input_imp_item);
-		}
-	}
-	else if(compared_imp_thread && compared_imp_thread->isRunning())
-	{
-		if(input_sel_wgt->isModelSelected())
-			progress_aux = progress/4;
-		else
-			progress_aux = 20 + (progress/5);
-
-		if(!low_verbosity)
-		{
-			GuiUtilsNs::createOutputTreeItem(output_trw, msg,
-												GuiUtilsNs::getPixmap(obj_type),
-												compared_imp_item);
-		}
-	}
-	else if(diff_thread && diff_thread->isRunning())
+	if(diff_thread && diff_thread->isRunning())
 	{
 		if((progress == 0 || progress == 100) && obj_type==ObjectType::BaseObject)
 		{
@@ -1101,6 +1103,30 @@ void DiffToolWidget::updateProgress(int progress, QString msg, ObjectType obj_ty
 		progress_ico_lbl->setPixmap(GuiUtilsNs::getPixmap("info"));
 }
 
+void DiffToolWidget::updateImportProgress(ThreadId thread_id, int progress, QString msg, ObjectType obj_type)
+{
+	int progress_aux = 0;
+
+	imp_progress[thread_id] = progress;
+
+	if(input_sel_wgt->isModelSelected())
+		progress_aux = progress/4;
+	else
+		progress_aux = (imp_progress[InputImpThread] + imp_progress[ComparedImpThread])/5;
+
+	if(!low_verbosity)
+	{
+		GuiUtilsNs::createOutputTreeItem(output_trw, UtilsNs::formatMessage(msg),
+											GuiUtilsNs::getPixmap(obj_type),
+											thread_id == InputImpThread ? input_imp_item : compared_imp_item);
+	}
+
+	if(progress_aux > step_pb->value())
+		step_pb->setValue(progress_aux);
+
+	updateProgress(progress, msg, obj_type);
+}
+
 void DiffToolWidget::updateDiffInfo(ObjectsDiffInfo diff_info)
 {
 	std::map<unsigned, QToolButton *> buttons={ {ObjectsDiffInfo::CreateObject, create_tb},
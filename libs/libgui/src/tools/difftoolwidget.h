@@ -125,6 +125,9 @@ class __libgui DiffToolWidget: public BaseConfigWidget, public Ui::DiffToolWidge
 
 		int diff_progress, curr_step, total_steps;
 
+		//! \brief Current progress of the input and compared database imports (indexed by ThreadId)
+		int imp_progress[2];
+
 		bool process_paused;
 
 		void showEvent(QShowEvent *event) override;
@@ -190,7 +193,11 @@ class __libgui DiffToolWidget: public BaseConfigWidget, public Ui::DiffToolWidge
 		void updateProgress(int progress, QString msg, ObjectType obj_type, QString cmd="");
 		void updateDiffInfo(ObjectsDiffInfo diff_info);
 		void captureThreadError(Exception e);
-		void handleImportFinished(Exception e);
+		void updateImportProgress(ThreadId thread_id, int progress, QString msg, ObjectType obj_type);
+
+		/*! \brief Finishes the import executed by the provided thread. When comparing two databases the
+		 * imports run at the same time so the diff only starts when both of them are done */
+		void handleImportFinished(ThreadId thread_id, Exception e);
 		void handleDiffFinished();
 		void handleExportFinished();
 		void handleErrorIgnored(QString err_code, QString err_msg, QString cmd);
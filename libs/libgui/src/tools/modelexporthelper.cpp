@@ -2,6 +2,10 @@
 #include "utilsns.h"
 #include <QSvgGenerator>
 #include "pgsqlversions.h"
+#include "pngstreamwriter.h"
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <set>
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
@@ -15,10 +19,13 @@ void ModelExportHelper::resetExportParams()
 	simulate = use_tmp_names = db_sql_reenabled = override_bg_color = false;
 	force_db_drop = gen_drop_file = md_format = false;
 	show_grid = show_delim = page_by_page = split = browsable = false;
-	transactional = false;
+	transactional = tile_pyramid = false;
+	prev_show_grid = prev_show_delim = bg_color_overridden = false;
+	tile_size = DefaultTileSize;
 	created_objs[ObjectType::Role] = created_objs[ObjectType::Tablespace] = -1;
 	db_model = nullptr;
 	connection = nullptr;
+	sandbox = nullptr;
 	scene = nullptr;
 	zoom = 100;
 	viewp = nullptr;
@@ -125,6 +132,14 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 	if(!scene)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
 
+	/* If the whole model rendered in the provided zoom factor doesn't fit in a single
+	 * pixmap we switch to the tiled export which streams the image to the file */
+	if(!page_by_page && isImageTooLarge(getSceneExportRect(scene), zoom))
+	{
+		exportToTiledPNG(scene, filename, zoom, show_grid, show_delim, override_bg_color);
+		return;
+	}
+
 	try
 	{
 		bool prev_show_grd = false, prev_show_dlm = false;
@@ -176,14 +191,7 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		}
 		else
 		{
-			QRectF rect = scene->itemsBoundingRect(true, false, true);
-
-			//Give some margin to the resulting image
-			QSizeF margin = QSizeF(5 * BaseObjectView::HorizSpacing, 5 * BaseObjectView::VertSpacing);
-			rect.setTopLeft(rect.topLeft() - QPointF(margin.width(), margin.height()));
-			rect.setSize(rect.size() + margin);
-
-			pages.push_back(rect);
+			pages.push_back(getSceneExportRect(scene));
 			file = filename;
 		}
 
@@ -263,6 +271,260 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 	}
 }
 
+void ModelExportHelper::exportToTiledPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool override_bg_color, int tile_size)
+{
+	if(!scene)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	PngStreamWriter png_writer;
+
+	configureSceneOptions(scene, show_grid, show_delim, override_bg_color);
+
+	try
+	{
+		QRectF scene_rect = getSceneExportRect(scene);
+
+		/* We consider the device pixel ratio when scaling the tiles so the
+		 * resulting image has the same size as the one generated by exportToPNG() */
+		double factor = zoom * qApp->devicePixelRatio();
+		int img_w = std::ceil(scene_rect.width() * factor),
+				img_h = std::ceil(scene_rect.height() * factor),
+				band_cnt = 0, band_idx = 1, band_h = 0, tile_w = 0;
+		QList<QImage> tiles;
+
+		tile_size = std::clamp(tile_size, MinimumTileSize, MaximumTileSize);
+		band_cnt = std::ceil(img_h / static_cast<double>(tile_size));
+
+		png_writer.open(filename, img_w, img_h);
+
+		/* The image is rendered in horizontal bands of tiles. Each band is written to
+		 * the file as soon as all of its tiles are rendered and then discarded, so at most
+		 * img_w x tile_size pixels are held in memory at a time */
+		for(int y = 0; y < img_h && !export_canceled; y += tile_size, band_idx++)
+		{
+			band_h = std::min(tile_size, img_h - y);
+			tiles.clear();
+
+			emit s_progressUpdated((band_idx/static_cast<double>(band_cnt)) * 90,
+														 tr("Rendering objects to image band %1/%2.").arg(band_idx).arg(band_cnt), ObjectType::BaseObject);
+
+			for(int x = 0; x < img_w && !export_canceled; x += tile_size)
+			{
+				tile_w = std::min(tile_size, img_w - x);
+				tiles.append(renderSceneTile(scene,
+																		 QRectF(scene_rect.left() + (x / factor), scene_rect.top() + (y / factor),
+																						tile_w / factor, band_h / factor),
+																		 QSize(tile_w, band_h)));
+			}
+
+			if(!export_canceled)
+				png_writer.writeRows(tiles);
+		}
+
+		if(export_canceled)
+			png_writer.abort();
+		else
+			png_writer.close();
+
+		restoreSceneOptions(scene);
+
+		if(!export_canceled)
+			emit s_progressUpdated(100, tr("Output image `%1' successfully written.").arg(filename), ObjectType::BaseObject);
+
+		finishExport();
+	}
+	catch(Exception &e)
+	{
+		png_writer.abort();
+		restoreSceneOptions(scene);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void ModelExportHelper::exportToPNGTilePyramid(ObjectsScene *scene, const QString &path, double zoom, bool show_grid, bool show_delim, bool override_bg_color, int tile_size)
+{
+	if(!scene)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	QDir dir;
+
+	if(!dir.mkpath(path))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(path),
+										ErrorCode::FileDirectoryNotWritten,PGM_FUNC,PGM_FILE,PGM_LINE);
+	}
+
+	configureSceneOptions(scene, show_grid, show_delim, override_bg_color);
+
+	try
+	{
+		QRectF scene_rect = getSceneExportRect(scene);
+		double factor = zoom * qApp->devicePixelRatio(), lvl_factor = 0, tile_scn_size = 0;
+		int img_w = 0, img_h = 0, max_level = 0, cols = 0, rows = 0,
+				tile_cnt = 0, tile_idx = 1;
+		QString tile_dir, tile_file;
+		QImage tile;
+
+		tile_size = std::clamp(tile_size, MinimumTileSize, MaximumTileSize);
+		img_w = std::ceil(scene_rect.width() * factor);
+		img_h = std::ceil(scene_rect.height() * factor);
+
+		/* The deepest level is the one in which the image has the full resolution,
+		 * the level 0 is the one in which the whole image fits in a single tile */
+		max_level = std::max(0, static_cast<int>(std::ceil(std::log2(std::max(img_w, img_h) / static_cast<double>(tile_size)))));
+
+		for(int level = 0; level <= max_level; level++)
+		{
+			lvl_factor = factor / std::pow(2, max_level - level);
+			tile_cnt += std::ceil((scene_rect.width() * lvl_factor) / tile_size) *
+									std::ceil((scene_rect.height() * lvl_factor) / tile_size);
+		}
+
+		for(int level = 0; level <= max_level && !export_canceled; level++)
+		{
+			lvl_factor = factor / std::pow(2, max_level - level);
+			tile_scn_size = tile_size / lvl_factor;
+			cols = std::ceil((scene_rect.width() * lvl_factor) / tile_size);
+			rows = std::ceil((scene_rect.height() * lvl_factor) / tile_size);
+
+			for(int x = 0; x < cols && !export_canceled; x++)
+			{
+				tile_dir = QString("%1/%2/%3").arg(path).arg(level).arg(x);
+
+				if(!dir.mkpath(tile_dir))
+				{
+					throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(tile_dir),
+													ErrorCode::FileDirectoryNotWritten,PGM_FUNC,PGM_FILE,PGM_LINE);
+				}
+
+				for(int y = 0; y < rows && !export_canceled; y++, tile_idx++)
+				{
+					emit s_progressUpdated((tile_idx/static_cast<double>(tile_cnt)) * 90,
+																 tr("Rendering tile %1/%2 (zoom level %3).").arg(tile_idx).arg(tile_cnt).arg(level),
+																 ObjectType::BaseObject);
+
+					/* Tiles in the right/bottom borders are rendered in full size, the exceeding
+					 * area is filled with the canvas color, so all tiles have the same dimensions */
+					tile = renderSceneTile(scene,
+																 QRectF(scene_rect.left() + (x * tile_scn_size),
+																				scene_rect.top() + (y * tile_scn_size),
+																				tile_scn_size, tile_scn_size),
+																 QSize(tile_size, tile_size));
+
+					tile_file = QString("%1/%2.png").arg(tile_dir).arg(y);
+
+					if(!tile.save(tile_file))
+					{
+						throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(tile_file),
+														ErrorCode::FileDirectoryNotWritten,PGM_FUNC,PGM_FILE,PGM_LINE);
+					}
+				}
+			}
+		}
+
+		if(!export_canceled)
+		{
+			QJsonObject tiles_info;
+			QString info_file = path + GlobalAttributes::DirSeparator + "tiles.json";
+
+			tiles_info["width"] = img_w;
+			tiles_info["height"] = img_h;
+			tiles_info["tileSize"] = tile_size;
+			tiles_info["minZoom"] = 0;
+			tiles_info["maxZoom"] = max_level;
+			tiles_info["format"] = "png";
+			tiles_info["layout"] = "{z}/{x}/{y}.png";
+
+			UtilsNs::saveFile(info_file, QJsonDocument(tiles_info).toJson());
+		}
+
+		restoreSceneOptions(scene);
+
+		if(!export_canceled)
+			emit s_progressUpdated(100, tr("Tile pyramid successfully written in `%1'.").arg(path), ObjectType::BaseObject);
+
+		finishExport();
+	}
+	catch(Exception &e)
+	{
+		restoreSceneOptions(scene);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+void ModelExportHelper::configureSceneOptions(ObjectsScene *scene, bool show_grid, bool show_delim, bool override_bg_color)
+{
+	//Clear the object scene selection to avoid drawing the selection rectangle of the objects
+	scene->clearSelection();
+
+	//Make a backup of the current scene options
+	prev_show_grid = ObjectsScene::isShowGrid();
+	prev_show_delim = ObjectsScene::isShowPageDelimiters();
+	prev_bg_color = ObjectsScene::getCanvasColor();
+	bg_color_overridden = override_bg_color;
+
+	if(override_bg_color)
+		ObjectsScene::setCanvasColor(QColor(255,255,255));
+
+	ObjectsScene::setShowGrid(show_grid);
+	ObjectsScene::setShowPageDelimiters(show_delim);
+	scene->setShowSceneLimits(false);
+	scene->update();
+}
+
+void ModelExportHelper::restoreSceneOptions(ObjectsScene *scene)
+{
+	if(bg_color_overridden)
+		ObjectsScene::setCanvasColor(prev_bg_color);
+
+	ObjectsScene::setShowGrid(prev_show_grid);
+	ObjectsScene::setShowPageDelimiters(prev_show_delim);
+	scene->setShowSceneLimits(true);
+	scene->update();
+	bg_color_overridden = false;
+}
+
+QRectF ModelExportHelper::getSceneExportRect(ObjectsScene *scene)
+{
+	QRectF rect = scene->itemsBoundingRect(true, false, true);
+
+	//Give some margin to the resulting image
+	QSizeF margin = QSizeF(5 * BaseObjectView::HorizSpacing, 5 * BaseObjectView::VertSpacing);
+	rect.setTopLeft(rect.topLeft() - QPointF(margin.width(), margin.height()));
+	rect.setSize(rect.size() + margin);
+
+	return rect;
+}
+
+QImage ModelExportHelper::renderSceneTile(ObjectsScene *scene, const QRectF &src_rect, const QSize &size)
+{
+	QImage tile(size, QImage::Format_RGB32);
+	QPainter painter;
+
+	tile.fill(ObjectsScene::getCanvasColor());
+
+	//Setting optimizations on the painter
+	painter.begin(&tile);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.setRenderHint(QPainter::TextAntialiasing, true);
+	painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+	scene->render(&painter, QRectF(QPointF(0, 0), size), src_rect, Qt::IgnoreAspectRatio);
+	painter.end();
+
+	return tile;
+}
+
+bool ModelExportHelper::isImageTooLarge(const QRectF &rect, double zoom)
+{
+	double factor = zoom * qApp->devicePixelRatio(),
+			width = rect.width() * factor,
+			height = rect.height() * factor;
+
+	// A single pixmap is limited in both dimensions and in the amount of bytes (32bpp) it can address
+	return width > MaximumImageSize || height > MaximumImageSize ||
+				 (width * height * 4) > std::numeric_limits<int>::max();
+}
+
 void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim)
 {
 	if(!scene)
@@ -356,15 +618,8 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, const QString &pgsql_ver, bool ignore_dup, bool drop_db, bool drop_objs, bool simulate,
 																		 bool use_tmp_names, bool forced_db_drop, bool transactional)
 {
-	int type_id = 0, pos = -1;
-	QString  version, sql_cmd, buf, sql_cmd_comment;
+	QString  version, sql_cmd, buf;
 	Connection new_db_conn;
-	unsigned i, count;
-	ObjectType types[]={ObjectType::Role, ObjectType::Tablespace};
-	BaseObject *object=nullptr;
-	QString tmpl_comm_regexp = QString("(COMMENT)( )+(ON)( )+(%1)(.)+(\n)(") + Attributes::DdlEndToken + ")";
-	QRegularExpression comm_regexp;
-	QRegularExpressionMatch match;
 
 	try
 	{
@@ -463,91 +718,7 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 		if(simulate)
 			emit s_progressUpdated(progress, tr("Simulation mode activated."));
 
-		//Creates the roles and tablespaces separately from the other objects
-		for(type_id=0; type_id < 2 && !export_canceled; type_id++)
-		{
-			count=db_model->getObjectCount(types[type_id]);
-
-			for(i=0; i < count && !export_canceled; i++)
-			{
-				object=db_model->getObject(i, types[type_id]);
-				progress=((10 * (type_id+1)) + ((i/static_cast<double>(count)) * 10));
-
-				try
-				{
-					if(!object->isSQLDisabled())
-					{
-						sql_cmd=object->getSourceCode(SchemaParser::SqlCode);
-
-						//Emits a signal indicating that the object is being exported
-						emit s_progressUpdated(progress,
-																	 tr("Creating object `%1' (%2)").arg(object->getName()).arg(object->getTypeName()),
-																	 object->getObjectType(), sql_cmd);
-
-						if(types[type_id] == ObjectType::Tablespace)
-						{
-							comm_regexp = QRegularExpression(tmpl_comm_regexp.arg(object->getSQLName()));
-							match = comm_regexp.match(sql_cmd);
-							pos = match.capturedStart();
-
-							/* If we find a comment on statement we should strip it from the tablespace definition in
-							 * order to execute it after creating the db */
-							if(pos >= 0)
-							{
-								sql_cmd_comment = sql_cmd.mid(pos, match.capturedLength());
-								sql_cmd.remove(pos, match.capturedLength());
-								//pos = -1;
-							}
-						}
-
-						conn.executeDDLCommand(sql_cmd);
-
-						if(!sql_cmd_comment.isEmpty())
-							conn.executeDDLCommand(sql_cmd_comment);
-					}
-				}
-				catch(Exception &e)
-				{
-					handleSQLError(e, sql_cmd, ignore_dup);
-				}
-
-				created_objs[types[type_id]]++;
-			}
-		}
-
-		try
-		{
-			if(!db_model->isSQLDisabled() && !export_canceled)
-			{
-				comm_regexp = QRegularExpression(tmpl_comm_regexp.arg(db_model->getSQLName()));
-				sql_cmd = db_model->__getSourceCode(SchemaParser::SqlCode);
-				match = comm_regexp.match(sql_cmd);
-				pos = match.capturedStart();
-
-				/* If we find a comment on statment we should strip it from the DB definition in
-				 * order to execute it after creating the db */
-				if(pos >= 0)
-				{
-					sql_cmd_comment = sql_cmd.mid(pos, match.capturedLength());
-					sql_cmd.remove(pos, match.capturedLength());
-				}
-
-				//Creating the database on the DBMS
-				emit s_progressUpdated(progress,
-															 tr("Creating database `%1'").arg(db_model->getName()),
-															 ObjectType::Database, sql_cmd);
-
-				conn.executeDDLCommand(sql_cmd);
-				db_created=true;
-
-				if(!sql_cmd_comment.isEmpty())
-					conn.executeDDLCommand(sql_cmd_comment);
-			}
-		}
-		catch(Exception &e)
-		{
-			handleSQLError(e, sql_cmd, ignore_dup);
-		}
+		createClusterObjects(db_model, conn, ignore_dup);
 
 		if(!export_canceled)
 		{
@@ -625,7 +796,482 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 	}
 }
 
-void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, bool md_format)
+void ModelExportHelper::exportToSandbox(DatabaseModel *db_model, Connection conn, SandboxDatabase *sandbox, const QString &pgsql_ver)
+{
+	QString version, base_hash;
+	Connection sandbox_conn;
+	std::map<unsigned, BaseObject *> objects;
+	std::map<BaseObject *, QString> codes, hashes;
+	bool rebuild = false;
+
+	try
+	{
+		if(!db_model || !sandbox)
+			throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+		connect(db_model, &DatabaseModel::s_objectLoaded, this, &ModelExportHelper::updateProgress, Qt::DirectConnection);
+
+		export_canceled=false;
+		db_created=false;
+		progress=sql_gen_progress=0;
+		created_objs[ObjectType::Role]=created_objs[ObjectType::Tablespace]=-1;
+		errors.clear();
+
+		conn.connect();
+		version=conn.getPgSQLVersion(true);
+
+		emit s_progressUpdated(progress, tr("Starting incremental SQL validation."));
+
+		if(!pgsql_ver.isEmpty())
+		{
+			BaseObject::setPgSQLVersion(pgsql_ver);
+			emit s_progressUpdated(progress, tr("PostgreSQL version detection overridden. Using version `%1'.").arg(pgsql_ver));
+		}
+		else
+		{
+			BaseObject::setPgSQLVersion(version);
+			emit s_progressUpdated(progress, tr("PostgreSQL `%1' server detected.").arg(version));
+		}
+
+		emit s_progressUpdated(progress, tr("Generating temporary names for database, roles and tablespaces."));
+		generateTempObjectNames(db_model, sandbox);
+
+		if(db_model->isSQLDisabled())
+		{
+			db_model->setSQLDisabled(false);
+			db_sql_reenabled=true;
+			emit s_progressUpdated(progress, tr("Enabling the SQL code for database `%1' to avoid errors.").arg(db_model->getName()));
+		}
+
+		progress=10;
+		emit s_progressUpdated(progress, tr("Generating SQL for `%1' objects...").arg(db_model->getObjectCount()));
+		base_hash = getSandboxBaseHash(db_model);
+		objects = getSandboxObjects(db_model, codes, hashes);
+		progress=20;
+
+		if(!sandbox->isReusable(conn, base_hash))
+			rebuild = true;
+		else
+		{
+			sandbox_conn=conn;
+			sandbox_conn.setConnectionParam(Connection::ParamDbName, sandbox->getDatabaseName());
+			emit s_progressUpdated(progress, tr("Connecting to sandbox database `%1'").arg(sandbox->getDatabaseName()));
+
+			try
+			{
+				sandbox_conn.connect();
+			}
+			catch(Exception &)
+			{
+				//The sandbox database was removed from the server by someone else
+				rebuild = true;
+			}
+
+			if(!rebuild)
+			{
+				progress=30;
+				rebuild = !updateSandbox(sandbox_conn, sandbox, objects, codes, hashes);
+			}
+
+			sandbox_conn.close();
+		}
+
+		if(rebuild && !export_canceled)
+			createSandbox(db_model, conn, sandbox, base_hash, objects, hashes);
+
+		disconnect(db_model, nullptr, this, nullptr);
+		restoreObjectNames();
+
+		if(db_sql_reenabled)
+		{
+			db_model->setSQLDisabled(true);
+			db_sql_reenabled=false;
+		}
+
+		conn.close();
+		finishExport();
+	}
+	catch(Exception &e)
+	{
+		disconnect(db_model, nullptr, this, nullptr);
+		restoreObjectNames();
+
+		if(db_sql_reenabled)
+		{
+			db_model->setSQLDisabled(true);
+			db_sql_reenabled=false;
+		}
+
+		sandbox_conn.close();
+		conn.close();
+
+		/* When running in a separated thread (other than the main application thread)
+		 * redirects the error in form of signal */
+		if(this->thread() && this->thread()!=qApp->thread())
+		{
+			errors.push_back(e);
+			emit s_exportAborted(Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, errors));
+		}
+		else
+		{
+			if(errors.empty())
+				throw Exception(e.getErrorMessage(),e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+
+			errors.push_back(e);
+			throw Exception(e.getErrorMessage(),PGM_FUNC,PGM_FILE,PGM_LINE, errors);
+		}
+	}
+}
+
+void ModelExportHelper::dropSandbox(SandboxDatabase *sandbox)
+{
+	if(!sandbox || !sandbox->isCreated())
+		return;
+
+	Connection conn = sandbox->getConnection();
+	std::vector<std::pair<ObjectType, QString>> cluster_objs = sandbox->getClusterObjects();
+
+	try
+	{
+		conn.connect();
+		conn.executeDDLCommand(QString("DROP DATABASE IF EXISTS %1;").arg(sandbox->getDatabaseName()));
+
+		//Tablespaces are dropped first since they can be owned by the created roles
+		for(auto itr = cluster_objs.rbegin(); itr != cluster_objs.rend(); itr++)
+		{
+			try
+			{
+				conn.executeDDLCommand(QString("DROP %1 IF EXISTS %2;").arg(BaseObject::getSQLName(itr->first), itr->second));
+			}
+			catch(Exception &){}
+		}
+
+		conn.close();
+		sandbox->reset();
+	}
+	catch(Exception &e)
+	{
+		conn.close();
+		sandbox->reset();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+QString ModelExportHelper::getSandboxBaseHash(DatabaseModel *db_model)
+{
+	QString code = BaseObject::getPgSQLVersion() + db_model->__getSourceCode(SchemaParser::SqlCode);
+
+	for(auto &obj_type : { ObjectType::Role, ObjectType::Tablespace })
+	{
+		for(auto &object : *db_model->getObjectList(obj_type))
+		{
+			if(!object->isSQLDisabled())
+				code += object->getSourceCode(SchemaParser::SqlCode);
+		}
+	}
+
+	code += db_model->getPrependedSQL() + db_model->getAppendedSQL();
+	return UtilsNs::getStringHash(code);
+}
+
+std::map<unsigned, BaseObject *> ModelExportHelper::getSandboxObjects(DatabaseModel *db_model, std::map<BaseObject *, QString> &codes,
+																																		 std::map<BaseObject *, QString> &hashes)
+{
+	std::map<unsigned, BaseObject *> objects;
+	ObjectType obj_type;
+	QString code;
+
+	codes.clear();
+	hashes.clear();
+
+	/* Relationships have their generated tables and constraints listed separately so they can be
+	 * handled as the other objects, while the database and cluster level objects make part of the base code */
+	for(auto &[order, object] : db_model->getCreationOrder(SchemaParser::SqlCode, true, true))
+	{
+		obj_type = object->getObjectType();
+
+		if(export_canceled)
+			break;
+
+		if(object->isSystemObject() || object->isSQLDisabled() ||
+			 obj_type == ObjectType::Database || obj_type == ObjectType::Role ||
+			 obj_type == ObjectType::Tablespace || obj_type == ObjectType::Relationship ||
+			 obj_type == ObjectType::BaseRelationship)
+			continue;
+
+		if(obj_type == ObjectType::Constraint)
+			code = dynamic_cast<Constraint *>(object)->getSourceCode(SchemaParser::SqlCode, true);
+		else
+			code = object->getSourceCode(SchemaParser::SqlCode);
+
+		if(code.isEmpty())
+			continue;
+
+		objects[order] = object;
+		codes[object] = code;
+		hashes[object] = UtilsNs::getStringHash(code);
+	}
+
+	return objects;
+}
+
+void ModelExportHelper::createSandbox(DatabaseModel *db_model, Connection &conn, SandboxDatabase *sandbox, const QString &base_hash,
+																			const std::map<unsigned, BaseObject *> &objects, const std::map<BaseObject *, QString> &hashes)
+{
+	Connection sandbox_conn;
+	ObjectType types[]={ObjectType::Role, ObjectType::Tablespace};
+	std::vector<std::pair<ObjectType, QString>> cluster_objs;
+	std::map<unsigned, SandboxDatabase::SandboxObject> sb_objects;
+
+	if(sandbox->isCreated())
+	{
+		QString old_db_name = sandbox->getDatabaseName();
+
+		emit s_progressUpdated(progress, tr("Dropping the outdated sandbox database `%1'.").arg(old_db_name));
+
+		try
+		{
+			dropSandbox(sandbox);
+		}
+		catch(Exception &)
+		{
+			//The server in which the outdated sandbox was created may not be reachable anymore
+			emit s_progressUpdated(progress, tr("Failed to drop the outdated sandbox database `%1'!").arg(old_db_name));
+		}
+	}
+
+	for(auto &type : types)
+	{
+		for(auto &obj : *db_model->getObjectList(type))
+		{
+			if(!obj->isSQLDisabled() && !obj->isSystemObject())
+				cluster_objs.push_back({ type, obj->getName(true) });
+		}
+	}
+
+	/* Removes any leftover of a sandbox created previously with the same names
+	 * (e.g. when its removal failed) so the objects can be created again */
+	sandbox->setCreated(conn, db_model->getName(), base_hash, cluster_objs);
+	dropSandbox(sandbox);
+
+	try
+	{
+		emit s_progressUpdated(progress, tr("Creating the sandbox database `%1'.").arg(db_model->getName()));
+		createClusterObjects(db_model, conn, false);
+
+		if(!export_canceled)
+		{
+			progress=30;
+			sandbox_conn=conn;
+			sandbox_conn.setConnectionParam(Connection::ParamDbName, db_model->getName());
+			sandbox_conn.connect();
+
+			progress=40;
+			exportBufferToDBMS(db_model->getSourceCode(SchemaParser::SqlCode, false), sandbox_conn);
+			sandbox_conn.close();
+		}
+
+		if(export_canceled)
+		{
+			undoDBMSExport(db_model, conn, false);
+			return;
+		}
+	}
+	catch(Exception &e)
+	{
+		try
+		{
+			sandbox_conn.close();
+			undoDBMSExport(db_model, conn, false);
+		}
+		catch(Exception &){}
+
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+
+	for(auto &[order, object] : objects)
+		sb_objects[object->getObjectId()] = { order, hashes.at(object), object->getDropCode(false) };
+
+	//The created objects now belong to the sandbox so they must not be removed in the end of the process
+	db_created = false;
+	created_objs[ObjectType::Role] = created_objs[ObjectType::Tablespace] = -1;
+
+	sandbox->setCreated(conn, db_model->getName(), base_hash, cluster_objs);
+	sandbox->setObjects(sb_objects);
+}
+
+bool ModelExportHelper::updateSandbox(Connection &conn, SandboxDatabase *sandbox, const std::map<unsigned, BaseObject *> &objects,
+																			const std::map<BaseObject *, QString> &codes, const std::map<BaseObject *, QString> &hashes)
+{
+	const std::map<unsigned, SandboxDatabase::SandboxObject> &sb_objects = sandbox->getObjects();
+	std::map<unsigned, SandboxDatabase::SandboxObject> new_sb_objects;
+	std::map<BaseObject *, std::vector<BaseObject *>> attached_objs;
+	std::map<unsigned, QString> drop_cmds;
+	std::set<BaseObject *> affected_objs;
+	std::set<unsigned> curr_ids;
+	std::vector<BaseObject *> pending_objs, refs, child_refs;
+	QString create_buf, drop_buf;
+	BaseObject *object = nullptr, *owner = nullptr;
+	TableObject *tab_obj = nullptr;
+	BaseTable *table = nullptr;
+	Permission *perm = nullptr;
+	Type *type = nullptr;
+	unsigned changed_cnt = 0, removed_cnt = 0;
+
+	for(auto &[order, obj] : objects)
+	{
+		/* Table children and permissions are removed by the server together with
+		 * the objects they belong to, so they're attached to them in order to be created again */
+		perm = dynamic_cast<Permission *>(obj);
+		tab_obj = dynamic_cast<TableObject *>(perm ? perm->getObject() : obj);
+		owner = (tab_obj && tab_obj->getParentTable() ? tab_obj->getParentTable() : (perm ? perm->getObject() : nullptr));
+
+		if(owner && owner != obj)
+			attached_objs[owner].push_back(obj);
+
+		curr_ids.insert(obj->getObjectId());
+		auto itr = sb_objects.find(obj->getObjectId());
+
+		if(itr == sb_objects.end() || itr->second.code_hash != hashes.at(obj))
+		{
+			pending_objs.push_back(obj);
+			changed_cnt++;
+		}
+	}
+
+	//Objects removed from the model (or that had their ids changed) are dropped using the commands stored on their creation
+	for(auto &[id, sb_obj] : sb_objects)
+	{
+		if(curr_ids.count(id))
+			continue;
+
+		if(sb_obj.drop_cmd.isEmpty())
+			return false;
+
+		drop_cmds[sb_obj.order] = sb_obj.drop_cmd;
+		removed_cnt++;
+	}
+
+	if(changed_cnt == 0 && removed_cnt == 0)
+	{
+		emit s_progressUpdated(progress, tr("The sandbox database is up to date. No object changed since the last validation."));
+		return true;
+	}
+
+	//Gathering the objects which must be created again because they depend on the changed ones
+	while(!pending_objs.empty() && !export_canceled)
+	{
+		object = pending_objs.back();
+		pending_objs.pop_back();
+
+		if(!affected_objs.insert(object).second)
+			continue;
+
+		/* Base types are created in two steps (via shell types) along with their functions
+		 * which can't be reproduced when creating the objects incrementally */
+		type = dynamic_cast<Type *>(object);
+
+		if(type && type->getConfiguration() == Type::BaseType)
+			return false;
+
+		refs = object->getReferences();
+		table = dynamic_cast<BaseTable *>(object);
+
+		if(table)
+		{
+			for(auto &child : table->getObjects())
+			{
+				child_refs = child->getReferences();
+				refs.insert(refs.end(), child_refs.begin(), child_refs.end());
+			}
+		}
+
+		refs.insert(refs.end(), attached_objs[object].begin(), attached_objs[object].end());
+
+		for(auto &ref : refs)
+		{
+			tab_obj = dynamic_cast<TableObject *>(ref);
+			owner = ref;
+
+			//Table children which aren't created separately are handled by their parent tables
+			if(codes.count(ref) == 0 && tab_obj && tab_obj->getParentTable())
+				owner = tab_obj->getParentTable();
+
+			if(codes.count(owner) && affected_objs.count(owner) == 0)
+				pending_objs.push_back(owner);
+		}
+	}
+
+	if(export_canceled)
+		return true;
+
+	for(auto &obj : affected_objs)
+	{
+		auto itr = sb_objects.find(obj->getObjectId());
+
+		if(itr == sb_objects.end())
+			continue;
+
+		if(itr->second.drop_cmd.isEmpty())
+			return false;
+
+		drop_cmds[itr->second.order] = itr->second.drop_cmd;
+	}
+
+	//The objects are dropped in the inverse order of their creation
+	for(auto itr = drop_cmds.rbegin(); itr != drop_cmds.rend(); itr++)
+		drop_buf += itr->second;
+
+	for(auto &[order, obj] : objects)
+	{
+		if(affected_objs.count(obj))
+			create_buf += codes.at(obj);
+	}
+
+	emit s_progressUpdated(progress, tr("Updating the sandbox database: %1 object(s) changed, %2 removed and %3 being created again.")
+												 .arg(changed_cnt).arg(removed_cnt).arg(affected_objs.size()));
+
+	try
+	{
+		exportBufferToDBMS(drop_buf + create_buf, conn, false, true);
+	}
+	catch(Exception &e)
+	{
+		std::vector<Exception> errs;
+		e.getExceptionsList(errs);
+
+		/* Dependencies not tracked by the model (2BP01) and commands that can't run in a transaction block (25001)
+		 * prevent the incremental update. In that case the whole sandbox is created again */
+		for(auto &err : errs)
+		{
+			if(err.getExtraInfo() == "2BP01" || err.getExtraInfo() == "25001")
+			{
+				emit s_progressUpdated(progress, tr("The changes can't be applied incrementally. The sandbox database will be created again."));
+				return false;
+			}
+		}
+
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+
+	//When the update is canceled the transaction is discarded once the connection is closed
+	if(export_canceled)
+		return true;
+
+	for(auto &[order, obj] : objects)
+	{
+		auto itr = sb_objects.find(obj->getObjectId());
+
+		new_sb_objects[obj->getObjectId()] = { order, hashes.at(obj),
+																					 affected_objs.count(obj) || itr == sb_objects.end() ?
+																					 obj->getDropCode(false) : itr->second.drop_cmd };
+	}
+
+	sandbox->setObjects(new_sb_objects);
+	return true;
+}
+
+void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, bool md_format, bool incremental)
 {
 	if(!db_model)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
@@ -639,7 +1285,7 @@ void ModelExportHelper::exportToDataDict(DatabaseModel *db_model, const QString
 													 tr("Starting data dictionary generation..."),
 													 ObjectType::BaseObject);
 		progress=1;
-		db_model->saveDataDictionary(path, browsable, split, md_format);
+		db_model->saveDataDictionary(path, browsable, split, md_format, incremental);
 
 		emit s_progressUpdated(100, tr("Data dictionary successfully saved into `%1'.").arg(path), ObjectType::BaseObject);
 		emit s_exportFinished();
@@ -702,6 +1348,104 @@ void ModelExportHelper::restoreGenAtlerCmdsStatus()
 	alter_cmds_status.clear();
 }
 
+void ModelExportHelper::createClusterObjects(DatabaseModel *db_model, Connection &conn, bool ignore_dup)
+{
+	int type_id = 0, pos = -1;
+	QString sql_cmd, sql_cmd_comment;
+	unsigned i, count;
+	ObjectType types[]={ObjectType::Role, ObjectType::Tablespace};
+	BaseObject *object=nullptr;
+	QString tmpl_comm_regexp = QString("(COMMENT)( )+(ON)( )+(%1)(.)+(\n)(") + Attributes::DdlEndToken + ")";
+	QRegularExpression comm_regexp;
+	QRegularExpressionMatch match;
+
+	//Creates the roles and tablespaces separately from the other objects
+	for(type_id=0; type_id < 2 && !export_canceled; type_id++)
+	{
+		count=db_model->getObjectCount(types[type_id]);
+
+		for(i=0; i < count && !export_canceled; i++)
+		{
+			object=db_model->getObject(i, types[type_id]);
+			progress=((10 * (type_id+1)) + ((i/static_cast<double>(count)) * 10));
+
+			try
+			{
+				if(!object->isSQLDisabled())
+				{
+					sql_cmd=object->getSourceCode(SchemaParser::SqlCode);
+
+					//Emits a signal indicating that the object is being exported
+					emit s_progressUpdated(progress,
+																 tr("Creating object `%1' (%2)").arg(object->getName()).arg(object->getTypeName()),
+																 object->getObjectType(), sql_cmd);
+
+					if(types[type_id] == ObjectType::Tablespace)
+					{
+						comm_regexp = QRegularExpression(tmpl_comm_regexp.arg(object->getSQLName()));
+						match = comm_regexp.match(sql_cmd);
+						pos = match.capturedStart();
+
+						/* If we find a comment on statement we should strip it from the tablespace definition in
+						 * order to execute it after creating the db */
+						if(pos >= 0)
+						{
+							sql_cmd_comment = sql_cmd.mid(pos, match.capturedLength());
+							sql_cmd.remove(pos, match.capturedLength());
+							//pos = -1;
+						}
+					}
+
+					conn.executeDDLCommand(sql_cmd);
+
+					if(!sql_cmd_comment.isEmpty())
+						conn.executeDDLCommand(sql_cmd_comment);
+				}
+			}
+			catch(Exception &e)
+			{
+				handleSQLError(e, sql_cmd, ignore_dup);
+			}
+
+			created_objs[types[type_id]]++;
+		}
+	}
+
+	try
+	{
+		if(!db_model->isSQLDisabled() && !export_canceled)
+		{
+			comm_regexp = QRegularExpression(tmpl_comm_regexp.arg(db_model->getSQLName()));
+			sql_cmd = db_model->__getSourceCode(SchemaParser::SqlCode);
+			match = comm_regexp.match(sql_cmd);
+			pos = match.capturedStart();
+
+			/* If we find a comment on statment we should strip it from the DB definition in
+			 * order to execute it after creating the db */
+			if(pos >= 0)
+			{
+				sql_cmd_comment = sql_cmd.mid(pos, match.capturedLength());
+				sql_cmd.remove(pos, match.capturedLength());
+			}
+
+			//Creating the database on the DBMS
+			emit s_progressUpdated(progress,
+														 tr("Creating database `%1'").arg(db_model->getName()),
+														 ObjectType::Database, sql_cmd);
+
+			conn.executeDDLCommand(sql_cmd);
+			db_created=true;
+
+			if(!sql_cmd_comment.isEmpty())
+				conn.executeDDLCommand(sql_cmd_comment);
+		}
+	}
+	catch(Exception &e)
+	{
+		handleSQLError(e, sql_cmd, ignore_dup);
+	}
+}
+
 void ModelExportHelper::undoDBMSExport(DatabaseModel *db_model, Connection &conn, bool use_tmp_names)
 {
 	QString drop_cmd=QString("DROP %1 %2;");
@@ -750,7 +1494,7 @@ void ModelExportHelper::undoDBMSExport(DatabaseModel *db_model, Connection &conn
 	}
 }
 
-void ModelExportHelper::generateTempObjectNames(DatabaseModel *db_model)
+void ModelExportHelper::generateTempObjectNames(DatabaseModel *db_model, SandboxDatabase *sandbox)
 {
 	QString tmp_name, old_name;
 	QTextStream stream(&tmp_name);
@@ -776,10 +1520,15 @@ void ModelExportHelper::generateTempObjectNames(DatabaseModel *db_model)
 
 	for(auto &obj : orig_obj_names)
 	{
-		stream << reinterpret_cast<unsigned *>(obj.first) << "_" << dt.toMSecsSinceEpoch();
+		if(sandbox)
+			tmp_name = sandbox->getTempObjectName(obj_suffixes[obj.first->getObjectType()], obj.second);
+		else
+		{
+			stream << reinterpret_cast<unsigned *>(obj.first) << "_" << dt.toMSecsSinceEpoch();
 
-		//Generates an unique name for the object through md5 hash
-		tmp_name = obj_suffixes[obj.first->getObjectType()] + UtilsNs::getStringHash(tmp_name);
+			//Generates an unique name for the object through md5 hash
+			tmp_name = obj_suffixes[obj.first->getObjectType()] + UtilsNs::getStringHash(tmp_name);
+		}
 
 		old_name=obj.first->getName();
 		obj.first->setName(tmp_name.mid(0,15));
@@ -801,6 +1550,8 @@ void ModelExportHelper::restoreObjectNames()
 	for(auto &obj : orig_obj_names)
 		obj.first->setName(obj.second);
 
+	orig_obj_names.clear();
+
 	/* Invalidates the codes of all objects on database model in order to generate the SQL referencing the
 		 object's with their original names */
 	if(db_model)
@@ -827,6 +1578,30 @@ bool ModelExportHelper::isDuplicationError(const QString &error_code)
 	return err_codes.contains(error_code);
 }
 
+void ModelExportHelper::copyDataToDBMS(const QString &copy_cmd, Connection &conn)
+{
+	int lb_idx = copy_cmd.indexOf('\n');
+	QString data = copy_cmd.mid(lb_idx + 1);
+
+	// The end-of-data marker is not needed when sending the rows through the COPY protocol
+	if(data.endsWith("\\.\n"))
+		data.chop(3);
+
+	try
+	{
+		conn.startCopy(copy_cmd.left(lb_idx));
+		conn.putCopyData(data.toUtf8());
+		conn.endCopy();
+	}
+	catch(Exception &e)
+	{
+		if(conn.isCopyInProgress())
+			conn.endCopy(e.getErrorMessage());
+
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
 void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs, bool transactional)
 {
 	Connection aux_conn;
@@ -836,7 +1611,7 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 	std::vector<QString> db_sql_cmds;
 	QTextStream ts;
 	ObjectType obj_type=ObjectType::BaseObject;
-	bool ddl_tk_found=false, is_create=false, is_drop=false, in_transaction = false;
+	bool ddl_tk_found=false, is_create=false, is_drop=false, is_copy=false, in_transaction = false;
 	unsigned aux_prog=0, curr_size=0, buf_size=sql_buf.size(),
 			factor=(db_name.isEmpty() ? 70 : 90);
 	int pos=0, pos1=0, comm_cnt=0;
@@ -852,6 +1627,8 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 
 			drop_tab_obj_reg(QString("^((\\-\\-)+( )*)+(%1)(.)+(DROP)(.)+").arg(alter_tab),
 											 QRegularExpression::DontCaptureOption),
+
+			copy_reg("^(COPY)( )(.)+( )(FROM)( )(stdin);\n", QRegularExpression::DontCaptureOption),
 			reg_aux,
 
 			name_rx("^((\".+\")|(\\w|_|\\d)+)(\\.((\".+\")|(\\w|_|\\d)+))*"),
@@ -924,8 +1701,20 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 			{
 				//Checking if the command is a column or constraint creation via ALTER TABLE
 				aux_cmd = sql_cmd;
+				is_copy = copy_reg.match(sql_cmd).hasMatch();
+
+				/* Initial data generated as COPY ... FROM stdin is checked first since its data lines
+				 * could be wrongly taken as object creation commands by the regexps below */
+				if(is_copy)
+				{
+					lin = sql_cmd.mid(5, sql_cmd.indexOf('\n') - 5);
+					match = name_rx.match(lin);
+					obj_name = lin.mid(match.capturedStart(), match.capturedLength());
+					obj_type = ObjectType::Table;
 
-				if(tab_obj_reg.match(aux_cmd).hasMatch())
+					emit s_progressUpdated(aux_prog, tr("Loading initial data of `%1' (%2)").arg(obj_name, BaseObject::getTypeName(obj_type)), obj_type, sql_cmd);
+				}
+				else if(tab_obj_reg.match(aux_cmd).hasMatch())
 				{
 					aux_cmd.remove("IF EXISTS ");
 					obj_type=(aux_cmd.contains("COLUMN") ? ObjectType::Column : ObjectType::Constraint);
@@ -1107,7 +1896,10 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 							in_transaction = true;
 						}
 
-						conn.executeDDLCommand(sql_cmd);
+						if(is_copy)
+							copyDataToDBMS(sql_cmd, conn);
+						else
+							conn.executeDDLCommand(sql_cmd);
 					}
 					else
 						//If it's a database level command (e.g. ALTER DATABASE ... RENAME TO ...)
@@ -1115,7 +1907,7 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 				}
 
 				sql_cmd.clear();
-				ddl_tk_found=false;
+				ddl_tk_found=is_copy=false;
 			}
 
 			if(ts.atEnd() && in_transaction)
@@ -1197,6 +1989,7 @@ void ModelExportHelper::setExportToDBMSParams(DatabaseModel *db_model, Connectio
 	this->sql_buffer.clear();
 	this->db_name.clear();
 	this->errors.clear();
+	this->sandbox = nullptr;
 }
 
 void ModelExportHelper::setExportToDBMSParams(const QString &sql_buffer, Connection *conn, const QString &db_name, bool ignore_dup, bool transactional)
@@ -1210,6 +2003,13 @@ void ModelExportHelper::setExportToDBMSParams(const QString &sql_buffer, Connect
 	this->transactional = transactional;
 	this->use_tmp_names = false;
 	this->errors.clear();
+	this->sandbox = nullptr;
+}
+
+void ModelExportHelper::setExportToSandboxParams(DatabaseModel *db_model, Connection *conn, SandboxDatabase *sandbox, const QString &pgsql_ver)
+{
+	setExportToDBMSParams(db_model, conn, pgsql_ver, false, false, false, true, true);
+	this->sandbox = sandbox;
 }
 
 void ModelExportHelper::setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool gen_drop_file)
@@ -1236,6 +2036,21 @@ void ModelExportHelper::setExportToPNGParams(ObjectsScene *scene, QGraphicsView
 	this->override_bg_color = override_bg_color;
 }
 
+void ModelExportHelper::setExportToTiledPNGParams(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid,
+																									bool show_delim, bool override_bg_color, bool tile_pyramid, int tile_size)
+{
+	this->scene = scene;
+	this->viewp = nullptr;
+	this->filename = filename;
+	this->zoom = zoom;
+	this->show_grid = show_grid;
+	this->show_delim = show_delim;
+	this->page_by_page = false;
+	this->override_bg_color = override_bg_color;
+	this->tile_pyramid = tile_pyramid;
+	this->tile_size = tile_size;
+}
+
 void ModelExportHelper::setExportToSVGParams(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim)
 {
 	this->scene = scene;
@@ -1257,7 +2072,9 @@ void ModelExportHelper::exportToDBMS()
 {
 	if(connection)
 	{
-		if(sql_buffer.isEmpty())
+		if(sandbox)
+			exportToSandbox(db_model, *connection, sandbox, pgsql_ver);
+		else if(sql_buffer.isEmpty())
 		{
 			exportToDBMS(db_model, *connection, pgsql_ver, ignore_dup, drop_db,
 									 drop_objs, simulate, use_tmp_names, force_db_drop, transactional);
@@ -1291,6 +2108,23 @@ void ModelExportHelper::exportToPNG()
 	}
 }
 
+void ModelExportHelper::exportToTiledPNG()
+{
+	try
+	{
+		if(tile_pyramid)
+			exportToPNGTilePyramid(scene, filename, zoom, show_grid, show_delim, override_bg_color, tile_size);
+		else
+			exportToTiledPNG(scene, filename, zoom, show_grid, show_delim, override_bg_color, tile_size);
+
+		resetExportParams();
+	}
+	catch(Exception &e)
+	{
+		abortExport(e);
+	}
+}
+
 void ModelExportHelper::exportToSVG()
 {
 	try
@@ -33,6 +33,7 @@
 #include "objectsscene.h"
 #include "databasemodel.h"
 #include "connection.h"
+#include "sandboxdatabase.h"
 
 class __libgui ModelExportHelper: public QObject {
 	Q_OBJECT
@@ -87,6 +88,18 @@ class __libgui ModelExportHelper: public QObject {
 		//! \brief Indicates if the export to png should be done pageby page
 		page_by_page,
 
+		//! \brief Indicates if the tiled export to png should generate a deep-zoom tile pyramid instead of a single image
+		tile_pyramid,
+
+		//! \brief Stores the grid exhibition state before the scene is configured to export a graphics file
+		prev_show_grid,
+
+		//! \brief Stores the page delimiters exhibition state before the scene is configured to export a graphics file
+		prev_show_delim,
+
+		//! \brief Indicates if the canvas color was overridden while configuring the scene to export a graphics file
+		bg_color_overridden,
+
 		//! \brief Indicates if the data dictionary or sql export should be split into separated files
 		split,
 
@@ -112,6 +125,9 @@ class __libgui ModelExportHelper: public QObject {
 		//! \brief Database connection used to export data to DBMS (only in thread mode)
 		Connection *connection;
 
+		//! \brief The sandbox database updated by the incremental SQL validation (only in thread mode)
+		SandboxDatabase *sandbox;
+
 		QString sql_buffer, db_name;
 
 		//! \brief List of ignored error codes
@@ -137,23 +153,57 @@ class __libgui ModelExportHelper: public QObject {
 
 		double zoom;
 
+		//! \brief The size (width and height) of the tiles rendered in tiled export to png
+		int tile_size;
+
+		//! \brief Stores the canvas color before the scene is configured to export a graphics file
+		QColor prev_bg_color;
+
 		//! \brief Saves the current state of ALTER command generaton for table columns/constraints
 		void saveGenAtlerCmdsStatus(DatabaseModel *db_model);
 
 		//! \brief Retores the previous ALTER command generation state for table columns/constraints
 		void restoreGenAtlerCmdsStatus();
 
+		//! \brief Creates the roles, tablespaces and the database itself through the provided connection
+		void createClusterObjects(DatabaseModel *db_model, Connection &conn, bool ignore_dup);
+
 		//! \brief Revert the dbms export process, removing the created database, roles and tablespaces
 		void undoDBMSExport(DatabaseModel *db_model, Connection &conn, bool use_tmp_names);
 
 		/*! \brief Cause the names of the database, roles and tablespaces to be replaced by a temporary name in order
 		to avoid duplicity error when exporting. This feature is only useful when validating the model against a
-		server which some of the objects (at cluster level) still exists */
-		void generateTempObjectNames(DatabaseModel *db_model);
+		server which some of the objects (at cluster level) still exists. When a sandbox is provided the
+		temporary names are derived from its id instead of the current time so they are the same in every run */
+		void generateTempObjectNames(DatabaseModel *db_model, SandboxDatabase *sandbox = nullptr);
 
 		//! \brief Restore the original name of the database, roles and tablespaces
 		void restoreObjectNames();
 
+		/*! \brief Returns the hash of the code that can't be handled incrementally in the sandbox database:
+		the database, roles and tablespaces definitions and the SQL prepended/appended to the model */
+		QString getSandboxBaseHash(DatabaseModel *db_model);
+
+		/*! \brief Returns, in creation order, the objects that are created inside the sandbox database
+		storing their SQL code and the hash of it in the provided maps */
+		std::map<unsigned, BaseObject *> getSandboxObjects(DatabaseModel *db_model, std::map<BaseObject *, QString> &codes,
+																											 std::map<BaseObject *, QString> &hashes);
+
+		/*! \brief Creates the sandbox database from scratch running the whole model's code on it. Any
+		previously created sandbox database is dropped */
+		void createSandbox(DatabaseModel *db_model, Connection &conn, SandboxDatabase *sandbox, const QString &base_hash,
+											 const std::map<unsigned, BaseObject *> &objects, const std::map<BaseObject *, QString> &hashes);
+
+		/*! \brief Drops and creates again, in a single transaction, the objects that changed since the sandbox
+		was last updated as well as the ones depending on them. The provided connection must be opened on the sandbox
+		database. Returns false when the changes can't be applied incrementally and the sandbox must be created again */
+		bool updateSandbox(Connection &conn, SandboxDatabase *sandbox, const std::map<unsigned, BaseObject *> &objects,
+											 const std::map<BaseObject *, QString> &codes, const std::map<BaseObject *, QString> &hashes);
+
+		/*! \brief Runs a COPY ... FROM stdin command (table's initial data) whose rows follow the command line
+		 * in the provided buffer, sending them through the COPY protocol of the connection */
+		void copyDataToDBMS(const QString &copy_cmd, Connection &conn);
+
 		//! \brief Exports the contents of the buffer to a previously opened connection
 		void exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs=false, bool transactional = false);
 
@@ -175,7 +225,32 @@ class __libgui ModelExportHelper: public QObject {
 		3) abort the export by immediatelly redirecting the error to the user */
 		void handleSQLError(Exception &e, const QString &sql_cmd, bool ignore_dup);
 
+		/*! \brief Applies the grid, page delimiters and canvas color options on the scene before exporting it to
+		 *  a graphics file. The current scene options are saved so they can be restored by restoreSceneOptions() */
+		void configureSceneOptions(ObjectsScene *scene, bool show_grid, bool show_delim, bool override_bg_color);
+
+		//! \brief Restores the scene options saved by configureSceneOptions()
+		void restoreSceneOptions(ObjectsScene *scene);
+
+		//! \brief Returns the scene area (items bounding rect plus a margin) that is exported to a graphics file
+		QRectF getSceneExportRect(ObjectsScene *scene);
+
+		//! \brief Renders the scene area src_rect into a new image with the provided size
+		QImage renderSceneTile(ObjectsScene *scene, const QRectF &src_rect, const QSize &size);
+
+		/*! \brief Returns true when the image generated from the rect with the provided zoom factor exceeds the limits
+		 *  of a single QPixmap so the export to png must be done in tiled mode */
+		static bool isImageTooLarge(const QRectF &rect, double zoom);
+
 	public:
+		//! \brief Default, minimum and maximum size of the tiles used in tiled export to png
+		static constexpr int DefaultTileSize = 512,
+		MinimumTileSize = 64,
+		MaximumTileSize = 4096,
+
+		//! \brief Maximum width/height of an image exported to png without tiling
+		MaximumImageSize = 32767;
+
 		ModelExportHelper(QObject *parent = nullptr);
 
 		/*! \brief Determines which error codes must be ignored during the export process.
@@ -195,6 +270,20 @@ class __libgui ModelExportHelper: public QObject {
 		void exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim,
 										 bool page_by_page, bool override_bg_color, QGraphicsView *viewp=nullptr);
 
+		/*! \brief Exports the model to a named PNG image by rendering the scene in tiles of tile_size x tile_size pixels
+		which are streamed, band by band, into the output file. Since the whole image is never held in memory this method
+		is suitable for huge canvases and/or high zoom factors. When exportToPNG() detects that the resulting image exceeds
+		the limits of a single pixmap it falls back to this method automatically */
+		void exportToTiledPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim,
+													bool override_bg_color, int tile_size = DefaultTileSize);
+
+		/*! \brief Exports the model to a deep-zoom tile pyramid under the provided directory. Each zoom level is written
+		as a set of PNG tiles named [path]/[z]/[x]/[y].png, where the deepest level matches the provided zoom factor and
+		each level above it halves the resolution until the whole model fits in a single tile. A file tiles.json describing
+		the pyramid (image size, tile size and zoom levels) is also written so the tiles can be browsed in static web viewers */
+		void exportToPNGTilePyramid(ObjectsScene *scene, const QString &path, double zoom, bool show_grid, bool show_delim,
+																bool override_bg_color, int tile_size = DefaultTileSize);
+
 		//! \brief Exports the model to a named SVG file.
 		void exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim);
 
@@ -206,10 +295,19 @@ class __libgui ModelExportHelper: public QObject {
 											bool drop_db=false, bool drop_objs=false, bool simulate=false, bool use_tmp_names=false,
 											bool forced_db_drop = false, bool transactional = false);
 
+		/*! \brief Validates the model's SQL code against a sandbox database kept on the server between runs.
+		In the first run (or when the database, roles or tablespaces change) the sandbox is created from the
+		whole model. In the next ones only the objects changed since the last successful run, and the
+		ones depending on them, are dropped and created again inside a transaction which is rolled back on error */
+		void exportToSandbox(DatabaseModel *db_model, Connection conn, SandboxDatabase *sandbox, const QString &pgsql_ver="");
+
+		//! \brief Removes from the server the database, roles and tablespaces created for the sandbox
+		static void dropSandbox(SandboxDatabase *sandbox);
+
 		/*! \brief Exports the model to a named data dictionary. The options browsable and splitted indicate,
 		 * respectively, that the data dictionary should have an object index and the dictionary should be split
-		 * in different files per table */
-		void exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, bool md_format);
+		 * in different files per table. The incremental option avoids rewriting the files of unchanged tables (split mode only) */
+		void exportToDataDict(DatabaseModel *db_model, const QString &path, bool browsable, bool split, bool md_format, bool incremental = false);
 
 		/*! \brief Configures the DBMS export params before start the export thread (when in thread mode).
 		This form receive a database model as input and the sql code to be exported will be generated from it.
@@ -222,6 +320,10 @@ class __libgui ModelExportHelper: public QObject {
 		This form receive a previously generated sql buffer to be exported the the helper */
 		void setExportToDBMSParams(const QString &sql_buffer, Connection *conn, const QString &db_name, bool ignore_dup=false, bool transactional = false);
 
+		/*! \brief Configures the incremental SQL validation params before start the export thread (when in thread mode).
+		This form receive the database model and the sandbox database to be updated */
+		void setExportToSandboxParams(DatabaseModel *db_model, Connection *conn, SandboxDatabase *sandbox, const QString &pgsql_ver="");
+
 		/*! \brief Configures the SQL export params before start the export thread (when in thread mode).
 		This form receive the model, output filename and pgsql version to be used */
 		void setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool gen_drop_file);
@@ -231,6 +333,11 @@ class __libgui ModelExportHelper: public QObject {
 		void setExportToPNGParams(ObjectsScene *scene, QGraphicsView *viewp, const QString &filename, double zoom,
 															bool show_grid, bool show_delim, bool page_by_page, bool override_bg_color);
 
+		/*! \brief Configures the tiled PNG export params before start the export thread (when in thread mode).
+		When tile_pyramid is true the filename is treated as the output directory of the deep-zoom tile pyramid */
+		void setExportToTiledPNGParams(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid,
+																	 bool show_delim, bool override_bg_color, bool tile_pyramid, int tile_size = DefaultTileSize);
+
 		/*! \brief Configures the SVG export params before start the export thread (when in thread mode).
 		This form receive the objects scene, the output filename, grid options. */
 		void setExportToSVGParams(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim);
@@ -258,6 +365,7 @@ class __libgui ModelExportHelper: public QObject {
 	public slots:
 		void exportToDBMS();
 		void exportToPNG();
+		void exportToTiledPNG();
 		void exportToSVG();
 		void exportToSQL();
 		void exportToDataDict();
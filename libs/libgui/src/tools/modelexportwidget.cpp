@@ -138,10 +138,12 @@ ModelExportWidget::ModelExportWidget(QWidget *parent) : QWidget(parent)
 			export_hlp.exportToDBMS();
 		else if(export_to_img_tb->isChecked())
 		{
-			if(img_fmt_cmb->currentIndex() == 0)
+			if(img_fmt_cmb->currentIndex() == PngFormat)
 				export_hlp.exportToPNG();
-			else
+			else if(img_fmt_cmb->currentIndex() == SvgFormat)
 				export_hlp.exportToSVG();
+			else
+				export_hlp.exportToTiledPNG();
 		}
 		else if(export_to_dict_tb->isChecked())
 			export_hlp.exportToDataDict();
@@ -302,11 +304,18 @@ void ModelExportWidget::exportModel()
 		{
 			viewp=new QGraphicsView(model_wgt->scene);
 
-			if(img_fmt_cmb->currentIndex() == 0)
+			if(img_fmt_cmb->currentIndex() == PngFormat)
 				export_hlp.setExportToPNGParams(model_wgt->scene, viewp, img_file_sel->getSelectedFile(),
 																				zoom_cmb->itemData(zoom_cmb->currentIndex()).toDouble(),
 																				show_grid_chk->isChecked(), show_delim_chk->isChecked(),
 																				 page_by_page_chk->isChecked(), override_bg_color_chk->isChecked());
+			else if(img_fmt_cmb->currentIndex() == TiledPngFormat ||
+							img_fmt_cmb->currentIndex() == PngTilePyramidFormat)
+				export_hlp.setExportToTiledPNGParams(model_wgt->scene, img_file_sel->getSelectedFile(),
+																						 zoom_cmb->itemData(zoom_cmb->currentIndex()).toDouble(),
+																						 show_grid_chk->isChecked(), show_delim_chk->isChecked(),
+																						 override_bg_color_chk->isChecked(),
+																						 img_fmt_cmb->currentIndex() == PngTilePyramidFormat);
 			else
 				export_hlp.setExportToSVGParams(model_wgt->scene, img_file_sel->getSelectedFile(),
 																				show_grid_chk->isChecked(),
@@ -490,24 +499,38 @@ void ModelExportWidget::enableExport()
 
 void ModelExportWidget::selectImageFormat()
 {
-	bool is_png = img_fmt_cmb->currentIndex() == 0;
+	int fmt_idx = img_fmt_cmb->currentIndex();
+	bool is_png = fmt_idx != SvgFormat;
 
-	if(is_png)
+	// The tile pyramid is written as a directory of z/x/y tiles so a folder is selected instead of a file
+	if(fmt_idx == PngTilePyramidFormat)
 	{
-		img_file_sel->setMimeTypeFilters({"image/png", "application/octet-stream"});
-		img_file_sel->setDefaultSuffix("png");
-		override_bg_color_chk->setEnabled(true);
+		img_file_sel->setDefaultSuffix("");
+		img_file_sel->setMimeTypeFilters({});
+		img_file_sel->setDirectoryMode(true);
+		img_file_sel->setAcceptMode(QFileDialog::AcceptOpen);
 	}
 	else
 	{
-		img_file_sel->setMimeTypeFilters({"image/svg+xml", "application/octet-stream"});
-		img_file_sel->setDefaultSuffix("svg");
-		override_bg_color_chk->setEnabled(false);
+		img_file_sel->setDirectoryMode(false);
+		img_file_sel->setAcceptMode(QFileDialog::AcceptSave);
+
+		if(is_png)
+		{
+			img_file_sel->setMimeTypeFilters({"image/png", "application/octet-stream"});
+			img_file_sel->setDefaultSuffix("png");
+		}
+		else
+		{
+			img_file_sel->setMimeTypeFilters({"image/svg+xml", "application/octet-stream"});
+			img_file_sel->setDefaultSuffix("svg");
+		}
 	}
 
+	override_bg_color_chk->setEnabled(is_png);
 	zoom_cmb->setEnabled(is_png);
 	zoom_lbl->setEnabled(is_png);
-	page_by_page_chk->setEnabled(is_png);
+	page_by_page_chk->setEnabled(fmt_idx == PngFormat);
 }
 
 void ModelExportWidget::selectDataDictMode()
@@ -43,6 +43,12 @@ class __libgui ModelExportWidget: public QWidget, public Ui::ModelExportWidget {
 		static constexpr int StandaloneFile = 0,
 		SplitFiles = 1;
 
+		//! \brief Indexes of the image formats in the format combo
+		static constexpr int PngFormat = 0,
+		SvgFormat = 1,
+		TiledPngFormat = 2,
+		PngTilePyramidFormat = 3;
+
 		/*! \brief Indicates if the full output generated during the process should be displayed
 		 * When this attribute is true, only errors and some key info messages are displayed. */
 		static bool low_verbosity;
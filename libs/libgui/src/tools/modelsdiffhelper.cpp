@@ -23,6 +23,7 @@
 #include <QThread>
 #include "utilsns.h"
 #include <QDate>
+#include <QElapsedTimer>
 #include "connection.h"
 #include "pgsqlversions.h"
 
@@ -49,6 +50,7 @@ ModelsDiffHelper::ModelsDiffHelper()
 	diff_canceled=false;
 	pgsql_version=PgSqlVersions::DefaulVersion;
 	source_model=imported_model=nullptr;
+	compare_time = code_gen_time = 0;
 	resetDiffCounter();
 
 	diff_opts[OptKeepClusterObjs]=true;
@@ -149,6 +151,16 @@ QString ModelsDiffHelper::getDiffDefinition()
 	return diff_def;
 }
 
+qint64 ModelsDiffHelper::getCompareTime()
+{
+	return compare_time;
+}
+
+qint64 ModelsDiffHelper::getCodeGenerationTime()
+{
+	return code_gen_time;
+}
+
 void ModelsDiffHelper::setModels(DatabaseModel *src_model, DatabaseModel *imp_model)
 {
 	source_model=src_model;
@@ -292,16 +304,24 @@ void ModelsDiffHelper::diffModels()
 		if(!source_model || !imported_model)
 			throw Exception(ErrorCode::OprNotAllocatedObject ,PGM_FUNC,PGM_FILE,PGM_LINE);
 
+		QElapsedTimer timer;
+
+		compare_time = code_gen_time = 0;
+		timer.start();
+
 		//First, we need to detect the objects to be dropped
 		diffModels(ObjectsDiffInfo::DropObject);
 		//Second, we will check the objects to be created or modified
 		diffModels(ObjectsDiffInfo::CreateObject);
 
+		compare_time = timer.restart();
+
 		if(diff_canceled)
 			emit s_diffCanceled();
 		else
 		{
 			processDiffInfos();
+			code_gen_time = timer.elapsed();
 			emit s_diffFinished();
 		}
 	}
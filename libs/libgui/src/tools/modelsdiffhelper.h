@@ -65,6 +65,9 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Stores the count of objects to be dropped, changed or created
 		unsigned diffs_counter[4];
 
+		//! \brief Time spent (in ms) comparing the models and generating the SQL code in the last diff
+		qint64 compare_time, code_gen_time;
+
 		//! \brief Reference model from which all changes are generated
 		DatabaseModel *source_model,
 
@@ -209,6 +212,12 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Returns the diff containing all the SQL commands needed to synchronize the model and database
 		QString getDiffDefinition();
 
+		//! \brief Returns the time (in ms) spent comparing the objects of both models in the last diff
+		qint64 getCompareTime();
+
+		//! \brief Returns the time (in ms) spent generating the diff SQL code in the last diff
+		qint64 getCodeGenerationTime();
+
 	public slots:
 		void diffModels();
 		void cancelDiff();
@@ -0,0 +1,252 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "modelvalidationcache.h"
+
+ModelValidationCache::ModelValidationCache(DatabaseModel *model, OperationList *op_list, QObject *parent) : QObject(parent)
+{
+	if(!model)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
+
+	db_model = model;
+
+	/* Direct connections are used so the objects are marked at the moment they are changed
+	 * even if this happens in the validation thread (e.g. when applying fixes) */
+	connect(db_model, &DatabaseModel::s_objectAdded, this, [this](BaseObject *object) {
+		markObjectChanged(object);
+	}, Qt::DirectConnection);
+
+	connect(db_model, &DatabaseModel::s_objectRemoved, this, &ModelValidationCache::removeObject, Qt::DirectConnection);
+
+	if(op_list)
+		connect(op_list, &OperationList::s_objectChanged, this, &ModelValidationCache::markObjectChanged, Qt::DirectConnection);
+}
+
+bool ModelValidationCache::hasCachedInfos()
+{
+	for(auto &infos : cached_infos)
+	{
+		if(!infos.empty())
+			return true;
+	}
+
+	return false;
+}
+
+BaseObject *ModelValidationCache::getOwnerObject(BaseObject *object, BaseObject *parent_obj)
+{
+	TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+
+	if(!tab_obj)
+		return object;
+
+	if(tab_obj->getParentTable())
+		return tab_obj->getParentTable();
+
+	Column *col = dynamic_cast<Column *>(tab_obj);
+
+	if(col && col->getParentRelationship())
+		return col->getParentRelationship();
+
+	return parent_obj;
+}
+
+void ModelValidationCache::addDependencyOwners(BaseObject *object, std::set<BaseObject *> &objects)
+{
+	BaseObject *owner = nullptr;
+
+	for(auto &dep : object->getDependencies())
+	{
+		owner = getOwnerObject(dep);
+
+		if(owner)
+			objects.insert(owner);
+	}
+}
+
+void ModelValidationCache::markObjectChanged(BaseObject *object, BaseObject *parent_obj)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	/* While there's nothing cached the whole model is validated anyway,
+	 * so there's no need to track the changes */
+	if(!object || !hasCachedInfos())
+		return;
+
+	BaseObject *owner = getOwnerObject(object, parent_obj);
+
+	if(owner)
+		changed_objs.insert(owner);
+
+	if(parent_obj)
+		changed_objs.insert(getOwnerObject(parent_obj));
+
+	/* The dependencies are marked at this moment too since the validation
+	 * infos generated by them refer to the object, which may be about to change */
+	addDependencyOwners(object, changed_objs);
+}
+
+void ModelValidationCache::removeObject(BaseObject *object)
+{
+	markObjectChanged(object);
+
+	QMutexLocker locker(&cache_mutex);
+
+	changed_objs.erase(object);
+
+	for(auto &infos : cached_infos)
+		infos.erase(object);
+}
+
+void ModelValidationCache::invalidate()
+{
+	QMutexLocker locker(&cache_mutex);
+
+	changed_objs.clear();
+
+	for(auto &infos : cached_infos)
+		infos.clear();
+}
+
+void ModelValidationCache::expandChangedObject(BaseObject *object, std::set<BaseObject *> &affected_objs, std::set<BaseTable *> &visited_tabs)
+{
+	std::vector<BaseTable *> tables;
+	BaseTable *table = dynamic_cast<BaseTable *>(object);
+	BaseRelationship *base_rel = dynamic_cast<BaseRelationship *>(object);
+	ObjectType ref_type;
+
+	affected_objs.insert(object);
+	addDependencyOwners(object, affected_objs);
+
+	if(table)
+		tables.push_back(table);
+	else if(base_rel)
+	{
+		tables.push_back(base_rel->getTable(BaseRelationship::SrcTable));
+		tables.push_back(base_rel->getTable(BaseRelationship::DstTable));
+	}
+
+	/* Walking through the relationships connected to the tables since changes on a table
+	 * may be propagated to other ones (e.g. columns added by relationships) */
+	while(!tables.empty())
+	{
+		table = tables.back();
+		tables.pop_back();
+
+		if(!table || visited_tabs.count(table))
+			continue;
+
+		visited_tabs.insert(table);
+		affected_objs.insert(table);
+		addDependencyOwners(table, affected_objs);
+
+		for(auto &child : table->getObjects())
+		{
+			addDependencyOwners(child, affected_objs);
+
+			if(child->getObjectType() != ObjectType::Column)
+				continue;
+
+			/* Views and generic SQL objects referencing the columns are validated again
+			 * since they may be referencing columns created by the relationships */
+			for(auto &ref : child->getReferences())
+			{
+				ref_type = ref->getObjectType();
+
+				if(ref_type == ObjectType::View || ref_type == ObjectType::GenericSql)
+					affected_objs.insert(ref);
+			}
+		}
+
+		for(auto &rel : db_model->getRelationships(table))
+		{
+			affected_objs.insert(rel);
+			tables.push_back(rel->getTable(BaseRelationship::SrcTable));
+			tables.push_back(rel->getTable(BaseRelationship::DstTable));
+		}
+	}
+}
+
+void ModelValidationCache::prepareValidation(const std::vector<ObjectType> &types)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	if(changed_objs.empty())
+		return;
+
+	std::set<BaseObject *> affected_objs;
+	std::set<BaseTable *> visited_tabs;
+	std::vector<BaseObject *> *obj_list = nullptr;
+
+	/* The changed objects are dereferenced only if they are still in the model,
+	 * the ones removed meanwhile have their cached infos simply discarded */
+	for(auto &type : types)
+	{
+		obj_list = db_model->getObjectList(type);
+
+		if(!obj_list)
+			continue;
+
+		for(auto &object : *obj_list)
+		{
+			if(changed_objs.count(object))
+				expandChangedObject(object, affected_objs, visited_tabs);
+		}
+	}
+
+	affected_objs.insert(changed_objs.begin(), changed_objs.end());
+	changed_objs.clear();
+
+	for(auto &infos : cached_infos)
+	{
+		for(auto &object : affected_objs)
+			infos.erase(object);
+	}
+}
+
+bool ModelValidationCache::getCachedInfos(BaseObject *object, CachedStep step, std::vector<ValidationInfo> &infos)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	if(step >= StepCount)
+		return false;
+
+	auto itr = cached_infos[step].find(object);
+
+	if(itr == cached_infos[step].end())
+		return false;
+
+	infos = itr->second;
+	return true;
+}
+
+void ModelValidationCache::storeInfos(BaseObject *object, CachedStep step, const std::vector<ValidationInfo> &infos)
+{
+	QMutexLocker locker(&cache_mutex);
+
+	if(object && step < StepCount)
+		cached_infos[step][object] = infos;
+}
+
+SandboxDatabase *ModelValidationCache::getSandbox()
+{
+	return &sandbox;
+}
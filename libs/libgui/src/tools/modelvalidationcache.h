@@ -0,0 +1,117 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class ModelValidationCache
+\brief Keeps the validation infos generated for each object of a database model between
+validation runs and tracks the objects changed since then (via the model's add/remove signals and
+the operations registered in the operation list). This way, ModelValidationHelper needs to check again
+only the changed objects and the ones affected by them, reusing the cached results for the rest of the model.
+*/
+
+#ifndef MODEL_VALIDATION_CACHE_H
+#define MODEL_VALIDATION_CACHE_H
+
+#include <QObject>
+#include <QMutex>
+#include <set>
+#include "validationinfo.h"
+#include "databasemodel.h"
+#include "operationlist.h"
+#include "sandboxdatabase.h"
+
+class __libgui ModelValidationCache: public QObject {
+	Q_OBJECT
+
+	public:
+		//! \brief The per-object validation steps which results can be cached
+		enum CachedStep: unsigned {
+			BrokenRefsStep,
+			ConstrSemanticsStep,
+			StepCount
+		};
+
+	private:
+		//! \brief Reference database model
+		DatabaseModel *db_model;
+
+		/*! \brief Controls the access to the cache since the validation runs in a separated thread
+		 * and the objects may be marked as changed from the main thread */
+		QMutex cache_mutex;
+
+		/*! \brief Stores the validation infos generated by each object in each cached step.
+		 * An object without an entry in the map (not the same as an empty list) needs to be validated */
+		std::map<BaseObject *, std::vector<ValidationInfo>> cached_infos[StepCount];
+
+		/*! \brief Stores the model level objects (never table children) changed since the last validation.
+		 * The pointers in this set are only dereferenced when they are found in the model (see prepareValidation()) */
+		std::set<BaseObject *> changed_objs;
+
+		//! \brief The state of the sandbox database used to validate the model's SQL code incrementally
+		SandboxDatabase sandbox;
+
+		//! \brief Returns true when there's at least one object with cached validation infos
+		bool hasCachedInfos();
+
+		/*! \brief Returns the model level object which validation is affected by the provided object.
+		 * For table children this is the parent table (or relationship), for any other object is the object itself */
+		BaseObject *getOwnerObject(BaseObject *object, BaseObject *parent_obj = nullptr);
+
+		//! \brief Inserts in the provided set the owner objects of all dependencies of the object
+		void addDependencyOwners(BaseObject *object, std::set<BaseObject *> &objects);
+
+		/*! \brief Inserts in the affected_objs set the changed object and all the objects that
+		 * need to be validated again due to its changes: the owners of its dependencies (and of its children's dependencies),
+		 * the relationships and tables connected to it (transitively) and the special objects referencing columns of those tables */
+		void expandChangedObject(BaseObject *object, std::set<BaseObject *> &affected_objs, std::set<BaseTable *> &visited_tabs);
+
+	public:
+		ModelValidationCache(DatabaseModel *model, OperationList *op_list, QObject *parent = nullptr);
+
+		/*! \brief Discards the cached validation infos of all the objects changed since the last call
+		 * and of the objects affected by them. This method must be called before a validation run starts.
+		 * The types are the ones of the model level objects handled by the validation */
+		void prepareValidation(const std::vector<ObjectType> &types);
+
+		/*! \brief Copies to infos the cached validation infos of the object in the provided step returning true.
+		 * If the object has no cached results false is returned, meaning that it must be validated */
+		bool getCachedInfos(BaseObject *object, CachedStep step, std::vector<ValidationInfo> &infos);
+
+		//! \brief Stores the validation infos generated by the object in the provided step
+		void storeInfos(BaseObject *object, CachedStep step, const std::vector<ValidationInfo> &infos);
+
+		//! \brief Returns the sandbox database used to validate the model's SQL code incrementally
+		SandboxDatabase *getSandbox();
+
+	public slots:
+		/*! \brief Marks the object (and the objects it depends on) as changed. The parent object
+		 * must be provided for table children detached from their parents */
+		void markObjectChanged(BaseObject *object, BaseObject *parent_obj = nullptr);
+
+		//! \brief Marks the dependencies of the removed object as changed and discards its cached infos
+		void removeObject(BaseObject *object);
+
+		//! \brief Discards all cached validation infos forcing the next validation to check the whole model
+		void invalidate();
+};
+
+#endif
@@ -22,6 +22,7 @@
 #include "modelvalidationhelper.h"
 #include "messagebox.h"
 #include <QThread>
+#include <QThreadPool>
 
 const QString ModelValidationHelper::SignalMsg { "`%1' (%2)" };
 
@@ -31,7 +32,8 @@ ModelValidationHelper::ModelValidationHelper()
 	handled_objs = total_objs = 0;
 	db_model = nullptr;
 	conn = nullptr;
-	valid_canceled = fix_mode = use_tmp_names = false;
+	valid_cache = nullptr;
+	valid_canceled = fix_mode = use_tmp_names = incremental_sql = false;
 
 	export_thread=new QThread;
 	export_helper.moveToThread(export_thread);
@@ -75,6 +77,29 @@ void ModelValidationHelper::generateValidationInfo(ValidationInfo::ValType val_t
 	}
 }
 
+bool ModelValidationHelper::restoreCachedInfos(BaseObject *object, ModelValidationCache::CachedStep step)
+{
+	std::vector<ValidationInfo> infos;
+
+	if(!valid_cache || !valid_cache->getCachedInfos(object, step, infos))
+		return false;
+
+	for(auto &info : infos)
+		generateValidationInfo(info.getValidationType(), info.getObject(), info.getReferences());
+
+	return true;
+}
+
+void ModelValidationHelper::cacheValidationInfos(BaseObject *object, ModelValidationCache::CachedStep step, size_t first_info)
+{
+	/* Partial results of an object which validation was interrupted
+	 * are not cached, so it'll be checked again in the next run */
+	if(!valid_cache || valid_canceled)
+		return;
+
+	valid_cache->storeInfos(object, step, std::vector<ValidationInfo>(val_infos.begin() + first_info, val_infos.end()));
+}
+
 void ModelValidationHelper::resolveConflict(ValidationInfo &info)
 {
 	try
@@ -237,7 +262,7 @@ unsigned ModelValidationHelper::getErrorCount()
 	return error_count;
 }
 
-void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection *conn, const QString &pgsql_ver, bool use_tmp_names)
+void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection *conn, const QString &pgsql_ver, bool use_tmp_names, bool incremental_sql)
 {
 	if(!model)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
@@ -250,9 +275,15 @@ void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection
 	this->conn=conn;
 	this->pgsql_ver=pgsql_ver;
 	this->use_tmp_names=use_tmp_names;
+	this->incremental_sql=incremental_sql;
 	export_helper.setExportToDBMSParams(this->db_model, conn, pgsql_ver, false, false, false, true, use_tmp_names);
 }
 
+void ModelValidationHelper::setValidationCache(ModelValidationCache *cache)
+{
+	valid_cache = cache;
+}
+
 void ModelValidationHelper::switchToFixMode(bool value)
 {
 	fix_mode=value;
@@ -282,6 +313,10 @@ void ModelValidationHelper::validateModel()
 		std::vector<BaseObject *>::iterator itr;
 		std::map<QString, std::vector<BaseObject *> > dup_objects;
 		std::map<QString, std::vector<BaseObject *> >::iterator mitr;
+		std::vector<BaseObject *> val_objs, chk_objs;
+		std::vector<ValidationInfo> obj_infos;
+		std::vector<std::vector<ValidationInfo>> chk_infos;
+		size_t first_info = 0, chk_idx = 0;
 
 		warn_count = error_count = 0;
 		handled_objs = total_objs = 0;
@@ -290,48 +325,57 @@ void ModelValidationHelper::validateModel()
 
 		total_objs = db_model->getObjectsCount(types);
 
+		if(valid_cache)
+			valid_cache->prepareValidation(types);
+
 		/* Step 1: Validating broken references. This situation happens when a object references another
 		 which id is smaller than the id of the first one. */
 
 		for(auto &tp : types)
 		{
-			if(valid_canceled)
-				break;
-
 			obj_list = db_model->getObjectList(tp);
-			itr = obj_list->begin();
+			handled_objs += obj_list->size();
 
 			for(auto &object : *obj_list)
 			{
-				if(valid_canceled)
-					break;
-
-				//prog++;
-				handled_objs++;
-
 				//Excluding the validation of system objects (created automatically)
 				if(object->isSystemObject())
 					continue;
 
-				emit s_objectProcessed(SignalMsg.arg(object->getName(), object->getTypeName()), object->getObjectType());
+				val_objs.push_back(object);
 
-				/* Special validation case: For generalization and copy relationships validates the ids of participant tables.
-					 Reference table cannot own an id greater thant receiver table */
-				checkRelationshipTablesIds(object);
+				//Objects not changed since the last validation have their previous results reused
+				if(!valid_cache || !valid_cache->getCachedInfos(object, ModelValidationCache::BrokenRefsStep, obj_infos))
+					chk_objs.push_back(object);
+			}
+		}
 
-				// Validating broken references to the object
-				checkObjectBrokenRefs(object);
+		/* The checkings are read-only over the model so the objects are split in chunks checked
+		 * by worker threads. Each object has its own list of generated infos which are merged
+		 * below in the same order of the objects in the model, so the output is always the same */
+		chk_infos.resize(chk_objs.size());
+		checkBrokenRefsInParallel(chk_objs, chk_infos);
 
-				/* Validating a special object. The validation made here is to check if the special object
-				 * (constraint/index/trigger/view) references a column added by a relationship and
-				 *  that relationship is being created after the creation of the special object */
-				checkSpObjectBrokenRefs(object);
-			}
+		for(auto &object : val_objs)
+		{
+			if(valid_canceled)
+				break;
+
+			if(restoreCachedInfos(object, ModelValidationCache::BrokenRefsStep))
+				continue;
 
-			//Emit a signal containing the validation progress
-			emit s_progressUpdated((handled_objs / static_cast<double>(total_objs)) * (!conn ? 40 : 20), "");
+			first_info = val_infos.size();
+
+			for(auto &info : chk_infos[chk_idx])
+				generateValidationInfo(info.getValidationType(), info.getObject(), info.getReferences());
+
+			cacheValidationInfos(object, ModelValidationCache::BrokenRefsStep, first_info);
+			chk_idx++;
 		}
 
+		//Emit a signal containing the validation progress
+		emit s_progressUpdated((!conn ? 40 : 20), "");
+
 		/* Step 2: Validating name conflitcs between primary keys, unique keys, exclude constraints
 		and indexs of all tables/foreign talbes/views. The tables/views names are checked too. */
 		checkConstrNameConflicts();
@@ -376,6 +420,9 @@ void ModelValidationHelper::validateModel()
 				//If there is no errors start the dbms export thread
 				if(error_count==0)
 				{
+					if(incremental_sql && valid_cache)
+						export_helper.setExportToSandboxParams(db_model, conn, valid_cache->getSandbox(), pgsql_ver);
+
 					export_thread->start();
 					emit s_sqlValidationStarted();
 				}
@@ -394,7 +441,74 @@ void ModelValidationHelper::validateModel()
 	}
 }
 
-void ModelValidationHelper::checkRelationshipTablesIds(BaseObject *object)
+void ModelValidationHelper::addValidationInfo(std::vector<ValidationInfo> &infos, ValidationInfo::ValType val_type, BaseObject *object, const std::vector<BaseObject *> &refs)
+{
+	if(!refs.empty())
+		infos.push_back(ValidationInfo(val_type, object, refs));
+}
+
+void ModelValidationHelper::checkBrokenRefs(BaseObject *object, std::vector<ValidationInfo> &infos)
+{
+	/* Special validation case: For generalization and copy relationships validates the ids of participant tables.
+		 Reference table cannot own an id greater thant receiver table */
+	checkRelationshipTablesIds(object, infos);
+
+	// Validating broken references to the object
+	checkObjectBrokenRefs(object, infos);
+
+	/* Validating a special object. The validation made here is to check if the special object
+	 * (constraint/index/trigger/view) references a column added by a relationship and
+	 *  that relationship is being created after the creation of the special object */
+	checkSpObjectBrokenRefs(object, infos);
+}
+
+void ModelValidationHelper::checkBrokenRefsInParallel(const std::vector<BaseObject *> &objects, std::vector<std::vector<ValidationInfo>> &infos)
+{
+	int obj_count = objects.size(), num_chunks = 0, chunk_sz = 0;
+	std::atomic<int> checked_objs = 0;
+	QThreadPool thread_pool;
+
+	auto check_objects = [this, &objects, &infos, &checked_objs](int start, int end) {
+		for(int idx = start; idx < end && !valid_canceled; idx++)
+		{
+			checkBrokenRefs(objects[idx], infos[idx]);
+			checked_objs++;
+		}
+	};
+
+	// Small sets of objects are checked in the current thread since the threads overhead doesn't pay off
+	if(obj_count < MinParallelObjects)
+	{
+		check_objects(0, obj_count);
+		return;
+	}
+
+	thread_pool.setMaxThreadCount(QThread::idealThreadCount());
+
+	/* Creating more chunks than threads so the load is balanced even when some
+	 * objects (e.g. tables with lots of children) take longer to be checked */
+	num_chunks = std::max(thread_pool.maxThreadCount(), 1) * 4;
+	chunk_sz = std::max((obj_count + num_chunks - 1) / num_chunks, 1);
+
+	for(int start = 0; start < obj_count; start += chunk_sz)
+	{
+		int end = std::min(start + chunk_sz, obj_count);
+		thread_pool.start([&check_objects, start, end](){ check_objects(start, end); });
+	}
+
+	/* While the workers run, the progress is updated from the current thread which is the only one
+	 * allowed to retrieve the objects' names (they are cached lazily, so they can't be accessed concurrently) */
+	while(!thread_pool.waitForDone(100))
+	{
+		int curr_obj = std::min<int>(checked_objs, obj_count - 1);
+
+		emit s_objectProcessed(SignalMsg.arg(objects[curr_obj]->getName(), objects[curr_obj]->getTypeName()),
+													 objects[curr_obj]->getObjectType());
+		emit s_progressUpdated((checked_objs / static_cast<double>(obj_count)) * (!conn ? 40 : 20), "");
+	}
+}
+
+void ModelValidationHelper::checkRelationshipTablesIds(BaseObject *object, std::vector<ValidationInfo> &infos)
 {
 	Relationship *rel = dynamic_cast<Relationship *>(object);
 
@@ -406,11 +520,11 @@ void ModelValidationHelper::checkRelationshipTablesIds(BaseObject *object)
 				*ref_tab = rel->getReferenceTable();
 
 		if(ref_tab->getObjectId() > recv_tab->getObjectId())
-			generateValidationInfo(ValidationInfo::BrokenReference, ref_tab, { recv_tab });
+			addValidationInfo(infos, ValidationInfo::BrokenReference, ref_tab, { recv_tab });
 	}
 }
 
-void ModelValidationHelper::checkObjectBrokenRefs(BaseObject *object)
+void ModelValidationHelper::checkObjectBrokenRefs(BaseObject *object, std::vector<ValidationInfo> &infos)
 {
 	std::vector<BaseObject *> refs_aux;
 	BaseObject *refer_obj=nullptr;
@@ -457,10 +571,10 @@ void ModelValidationHelper::checkObjectBrokenRefs(BaseObject *object)
 		}
 	}
 
-	generateValidationInfo(ValidationInfo::BrokenReference, object, refs_aux);
+	addValidationInfo(infos, ValidationInfo::BrokenReference, object, refs_aux);
 }
 
-void ModelValidationHelper::checkSpObjectBrokenRefs(BaseObject *object)
+void ModelValidationHelper::checkSpObjectBrokenRefs(BaseObject *object, std::vector<ValidationInfo> &infos)
 {
 	if(!BaseTable::isBaseTable(object->getObjectType()) &&
 		 object->getObjectType() != ObjectType::GenericSql)
@@ -522,7 +636,7 @@ void ModelValidationHelper::checkSpObjectBrokenRefs(BaseObject *object)
 						rels.push_back(rel);
 				}
 
-				generateValidationInfo(ValidationInfo::SpObjBrokenReference, tab_obj, rels);
+				addValidationInfo(infos, ValidationInfo::SpObjBrokenReference, tab_obj, rels);
 			}
 		}
 	}
@@ -540,7 +654,7 @@ void ModelValidationHelper::checkSpObjectBrokenRefs(BaseObject *object)
 				rels.push_back(rel);
 		}
 
-		generateValidationInfo(ValidationInfo::SpObjBrokenReference, object, rels);
+		addValidationInfo(infos, ValidationInfo::SpObjBrokenReference, object, rels);
 	}
 	else
 	{
@@ -558,7 +672,7 @@ void ModelValidationHelper::checkSpObjectBrokenRefs(BaseObject *object)
 				rels.push_back(rel);
 		}
 
-		generateValidationInfo(ValidationInfo::SpObjBrokenReference, object, rels);
+		addValidationInfo(infos, ValidationInfo::SpObjBrokenReference, object, rels);
 	}
 }
 
@@ -729,6 +843,7 @@ void ModelValidationHelper::checkConstraintSemantics()
 	Constraint *pk = nullptr;
 	Constraint *constr = nullptr;
 	std::vector<BaseObject *> tabs;
+	size_t first_info = 0;
 
 	tabs.assign(db_model->getObjectList(ObjectType::Table)->begin(),
 							db_model->getObjectList(ObjectType::Table)->end());
@@ -742,6 +857,10 @@ void ModelValidationHelper::checkConstraintSemantics()
 		if(valid_canceled)
 			break;
 
+		if(restoreCachedInfos(tab, ModelValidationCache::ConstrSemanticsStep))
+			continue;
+
+		first_info = val_infos.size();
 		table = dynamic_cast<PhysicalTable *>(tab);
 		pk = table->getPrimaryKey();
 
@@ -773,6 +892,8 @@ void ModelValidationHelper::checkConstraintSemantics()
 				}
 			}
 		}
+
+		cacheValidationInfos(tab, ModelValidationCache::ConstrSemanticsStep, first_info);
 	}
 }
 
@@ -823,6 +944,16 @@ void ModelValidationHelper::applyFixes()
 				if(!found_broken_rels)
 					found_broken_rels = (val_info_type == ValidationInfo::BrokenRelConfig);
 
+				/* The objects involved in the conflict are marked as changed so they
+				 * (and the ones affected by them) are checked again in the next validation */
+				if(valid_cache)
+				{
+					valid_cache->markObjectChanged(val_info.getObject());
+
+					for(auto &ref : val_info.getReferences())
+						valid_cache->markObjectChanged(ref);
+				}
+
 				try
 				{
 					if(!valid_canceled)
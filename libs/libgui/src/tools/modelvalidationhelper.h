@@ -29,7 +29,9 @@
 #define MODEL_VALIDATION_HELPER_H
 
 #include <QObject>
+#include <atomic>
 #include "validationinfo.h"
+#include "modelvalidationcache.h"
 #include "databasemodel.h"
 #include "connection.h"
 #include "tools/modelexporthelper.h"
@@ -40,6 +42,9 @@ class __libgui ModelValidationHelper: public QObject {
 	private:
 		static const QString SignalMsg;
 
+		//! \brief Minimum amount of objects to be checked so the broken references validation runs in parallel
+		static constexpr int MinParallelObjects = 256;
+
 		//! \brief Reference database model
 		DatabaseModel *db_model;
 
@@ -60,13 +65,18 @@ class __libgui ModelValidationHelper: public QObject {
 		//! \brief Validation progress variables
 		int handled_objs, total_objs;
 
-		//! \brief Indicates if the validation was canceled by the user
-		bool  valid_canceled,
+		/*! \brief Indicates if the validation was canceled by the user.
+		 * This one is atomic since it is read by the worker threads while checking the objects */
+		std::atomic<bool> valid_canceled;
 
 		//! \brief Indicates if the validation is on fix mode.
-		fix_mode,
+		bool fix_mode,
+
+		use_tmp_names,
 
-		use_tmp_names;
+		/*! \brief Indicates that the SQL validation must update the sandbox database stored in
+		 * the validation cache instead of creating (and dropping) a temporary database */
+		incremental_sql;
 
 		/*! \brief Stores the validation infos generated during validation steps.
 		This vector is read when applying fixes */
@@ -75,13 +85,37 @@ class __libgui ModelValidationHelper: public QObject {
 		//! \brief Stores the analyzed relationship marked as invalidated
 		std::vector<BaseObject *> inv_rels;
 
+		/*! \brief Cache of the validation infos of the model's objects. When set, only the objects
+		 * changed since the last validation (and the ones affected by them) are checked again */
+		ModelValidationCache *valid_cache;
+
+		/*! \brief Emits again the validation infos cached for the object in the provided step.
+		 * Returns false when the object has no cached infos and need to be validated */
+		bool restoreCachedInfos(BaseObject *object, ModelValidationCache::CachedStep step);
+
+		//! \brief Stores in the cache the validation infos generated by the object starting from the index first_info
+		void cacheValidationInfos(BaseObject *object, ModelValidationCache::CachedStep step, size_t first_info);
+
 		void generateValidationInfo(ValidationInfo::ValType val_type, BaseObject *object, std::vector<BaseObject *> refs);
 
-		void checkRelationshipTablesIds(BaseObject *object);
+		//! \brief Appends to infos a validation info of the provided type only if there are references to be reported
+		static void addValidationInfo(std::vector<ValidationInfo> &infos, ValidationInfo::ValType val_type, BaseObject *object, const std::vector<BaseObject *> &refs);
 
-		void checkObjectBrokenRefs(BaseObject *object);
+		/*! \brief The methods below perform the broken references checkings over a single object storing the
+		 * generated validation infos in the provided list. They only read the model so they can be called by several
+		 * threads at once as long as the model is not changed and the objects' names are not retrieved */
+		void checkRelationshipTablesIds(BaseObject *object, std::vector<ValidationInfo> &infos);
 
-		void checkSpObjectBrokenRefs(BaseObject *object);
+		void checkObjectBrokenRefs(BaseObject *object, std::vector<ValidationInfo> &infos);
+
+		void checkSpObjectBrokenRefs(BaseObject *object, std::vector<ValidationInfo> &infos);
+
+		//! \brief Runs all the broken references checkings over the object
+		void checkBrokenRefs(BaseObject *object, std::vector<ValidationInfo> &infos);
+
+		/*! \brief Runs the broken references checkings over the objects splitting them in chunks handled by
+		 * a thread pool. The infos generated by each object are stored in the element of infos at the same index */
+		void checkBrokenRefsInParallel(const std::vector<BaseObject *> &objects, std::vector<std::vector<ValidationInfo>> &infos);
 
 		void checkConstrNameConflicts();
 
@@ -96,8 +130,12 @@ class __libgui ModelValidationHelper: public QObject {
 		~ModelValidationHelper() override;
 
 		/*! \brief Validates the specified model. If a connection is specifies executes the
-		SQL validation directly on DBMS */
-		void setValidationParams(DatabaseModel *model, Connection *conn=nullptr, const QString &pgsql_ver="", bool use_tmp_names=false);
+		SQL validation directly on DBMS. The incremental SQL validation takes effect only
+		when a validation cache is defined (see setValidationCache()) */
+		void setValidationParams(DatabaseModel *model, Connection *conn=nullptr, const QString &pgsql_ver="", bool use_tmp_names=false, bool incremental_sql=false);
+
+		//! \brief Defines the cache used to validate the model incrementally (nullptr validates the whole model every time)
+		void setValidationCache(ModelValidationCache *cache);
 
 		//! \brief Switch the validator to fix mode
 		void switchToFixMode(bool value);
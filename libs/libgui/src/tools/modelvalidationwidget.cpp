@@ -71,6 +71,16 @@ ModelValidationWidget::ModelValidationWidget(QWidget *parent): QWidget(parent)
 		clearOutput();
 	});
 
+	connect(incremental_sql_chk, &QCheckBox::toggled, this, [this](bool checked){
+		//The sandbox is not needed anymore when the incremental validation is turned off
+		if(!checked)
+			dropSandbox(model_wgt);
+
+		use_tmp_names_chk->setDisabled(checked);
+		configureValidation();
+		clearOutput();
+	});
+
 	connect(connections_cmb, &QComboBox::currentTextChanged, this, [this](){
 		configureValidation();
 		clearOutput();
@@ -253,6 +263,21 @@ void ModelValidationWidget::setModel(ModelWidget *model_wgt)
 	destroyThread(true);
 }
 
+void ModelValidationWidget::dropSandbox(ModelWidget *model_wgt)
+{
+	if(!model_wgt || isThreadRunning())
+		return;
+
+	try
+	{
+		ModelExportHelper::dropSandbox(model_wgt->getValidationCache()->getSandbox());
+	}
+	catch(Exception &e)
+	{
+		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+}
+
 bool ModelValidationWidget::isThreadRunning()
 {
 	return (validation_thread && validation_thread->isRunning());
@@ -628,7 +653,9 @@ void ModelValidationWidget::configureValidation()
 			ver=(version_cmb->currentIndex() > 0 ? version_cmb->currentText() : "");
 		}
 
-		validation_helper->setValidationParams(model_wgt->getDatabaseModel(), conn, ver, use_tmp_names_chk->isChecked());
+		validation_helper->setValidationParams(model_wgt->getDatabaseModel(), conn, ver,
+																					 use_tmp_names_chk->isChecked(), incremental_sql_chk->isChecked());
+		validation_helper->setValidationCache(model_wgt->getValidationCache());
 	}
 }
 
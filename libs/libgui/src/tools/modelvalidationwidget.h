@@ -86,6 +86,9 @@ class __libgui ModelValidationWidget: public QWidget, public Ui::ModelValidation
 		//! \brief Returns if there is a validation in progress
 		bool isThreadRunning();
 
+		//! \brief Removes from the server the sandbox database used in the incremental SQL validation of the model
+		void dropSandbox(ModelWidget *model_wgt);
+
 		//! \brief Updates the connections combo with the latest loaded connection settings
 		void updateConnections();
 
@@ -0,0 +1,96 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sandboxdatabase.h"
+#include "utilsns.h"
+#include <QDateTime>
+
+SandboxDatabase::SandboxDatabase()
+{
+	sandbox_id = UtilsNs::getStringHash(QString("%1_%2")
+																			.arg(reinterpret_cast<quintptr>(this))
+																			.arg(QDateTime::currentDateTime().toMSecsSinceEpoch()));
+}
+
+QString SandboxDatabase::getId()
+{
+	return sandbox_id;
+}
+
+QString SandboxDatabase::getTempObjectName(const QString &prefix, const QString &orig_name)
+{
+	return (prefix + UtilsNs::getStringHash(sandbox_id + orig_name)).mid(0, 15);
+}
+
+bool SandboxDatabase::isReusable(Connection &conn, const QString &base_hash)
+{
+	return isCreated() && this->base_hash == base_hash &&
+				 connection.getConnectionId(true) == conn.getConnectionId(true) &&
+				 connection.getConnectionParam(Connection::ParamUser) == conn.getConnectionParam(Connection::ParamUser);
+}
+
+bool SandboxDatabase::isCreated()
+{
+	return !db_name.isEmpty();
+}
+
+void SandboxDatabase::setCreated(Connection &conn, const QString &db_name, const QString &base_hash,
+																 const std::vector<std::pair<ObjectType, QString>> &cluster_objs)
+{
+	this->connection = conn;
+	this->db_name = db_name;
+	this->base_hash = base_hash;
+	this->cluster_objs = cluster_objs;
+}
+
+QString SandboxDatabase::getDatabaseName()
+{
+	return db_name;
+}
+
+Connection SandboxDatabase::getConnection()
+{
+	return connection;
+}
+
+std::vector<std::pair<ObjectType, QString>> SandboxDatabase::getClusterObjects()
+{
+	return cluster_objs;
+}
+
+const std::map<unsigned, SandboxDatabase::SandboxObject> &SandboxDatabase::getObjects()
+{
+	return objects;
+}
+
+void SandboxDatabase::setObjects(const std::map<unsigned, SandboxObject> &objs)
+{
+	objects = objs;
+}
+
+void SandboxDatabase::reset()
+{
+	db_name.clear();
+	base_hash.clear();
+	cluster_objs.clear();
+	objects.clear();
+	connection = Connection();
+}
@@ -0,0 +1,113 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class SandboxDatabase
+\brief Stores the state of the database kept on the server to validate the SQL code of a model incrementally.
+The sandbox remembers the hash of the SQL code of each object created in it, so in the next validations only
+the objects changed since the last successful one (and the objects depending on them) need to be dropped and
+created again. The cluster level objects (database, roles and tablespaces) are created with temporary names
+derived from the sandbox id, which keeps their names (and the code of the objects referencing them) stable between runs.
+*/
+
+#ifndef SANDBOX_DATABASE_H
+#define SANDBOX_DATABASE_H
+
+#include "guiglobal.h"
+#include "connection.h"
+#include "baseobject.h"
+
+class __libgui SandboxDatabase {
+	public:
+		//! \brief Describes an object created in the sandbox database
+		struct SandboxObject {
+			//! \brief The position of the object in the creation order used when it was created
+			unsigned order;
+
+			//! \brief The hash of the SQL code used to create the object
+			QString code_hash,
+
+			//! \brief The command that removes the object from the sandbox (empty if the object can't be dropped)
+			drop_cmd;
+		};
+
+	private:
+		//! \brief Unique id of the sandbox used to generate the names of the cluster level objects
+		QString sandbox_id,
+
+		//! \brief The name of the database created on the server
+		db_name,
+
+		/*! \brief The hash of the code which can't be validated incrementally (database, roles, tablespaces
+		 * and the SQL prepended/appended to the model). Any change on it causes the sandbox to be rebuilt */
+		base_hash;
+
+		//! \brief The connection to the server in which the sandbox was created
+		Connection connection;
+
+		//! \brief The roles and tablespaces (and their names) created on the server for the sandbox
+		std::vector<std::pair<ObjectType, QString>> cluster_objs;
+
+		//! \brief The objects created in the sandbox database indexed by their ids
+		std::map<unsigned, SandboxObject> objects;
+
+	public:
+		SandboxDatabase();
+
+		//! \brief Returns the unique id of the sandbox
+		QString getId();
+
+		/*! \brief Returns the temporary name of a cluster level object in the sandbox. The name
+		 * is derived from the sandbox id and the original name so it's the same in every run */
+		QString getTempObjectName(const QString &prefix, const QString &orig_name);
+
+		/*! \brief Returns true if the sandbox database exists on the server of the provided connection
+		 * and was created with the provided base code hash, meaning it can be updated incrementally */
+		bool isReusable(Connection &conn, const QString &base_hash);
+
+		//! \brief Returns true if the sandbox database was created on a server
+		bool isCreated();
+
+		//! \brief Registers the database and cluster objects created on the server for the sandbox
+		void setCreated(Connection &conn, const QString &db_name, const QString &base_hash,
+										const std::vector<std::pair<ObjectType, QString>> &cluster_objs);
+
+		//! \brief Returns the name of the sandbox database on the server
+		QString getDatabaseName();
+
+		//! \brief Returns the connection to the server in which the sandbox was created
+		Connection getConnection();
+
+		//! \brief Returns the cluster level objects created for the sandbox
+		std::vector<std::pair<ObjectType, QString>> getClusterObjects();
+
+		//! \brief Returns the objects currently created in the sandbox database
+		const std::map<unsigned, SandboxObject> &getObjects();
+
+		//! \brief Replaces the objects currently created in the sandbox database
+		void setObjects(const std::map<unsigned, SandboxObject> &objs);
+
+		//! \brief Forgets the sandbox database (the cluster objects must be dropped from the server prior the call)
+		void reset();
+};
+
+#endif
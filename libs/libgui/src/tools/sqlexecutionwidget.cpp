@@ -34,6 +34,7 @@
 
 std::map<QString, QString> SQLExecutionWidget::cmd_history;
 int SQLExecutionWidget::cmd_history_max_len {1000};
+SQLHistoryStore SQLExecutionWidget::history_store;
 const QString SQLExecutionWidget::ColumnNullValue {"␀"};
 
 SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
@@ -173,6 +174,7 @@ SQLExecutionWidget::SQLExecutionWidget(QWidget * parent) : QWidget(parent)
 	connect(action_search, &QAction::toggled, search_wgt_parent, &QWidget::setVisible);
 	connect(find_replace_wgt, &SearchReplaceWidget::s_hideRequested, action_search, &QAction::toggle);
 	connect(search_history_wgt, &SearchReplaceWidget::s_hideRequested, search_history_parent, &QWidget::hide);
+	connect(search_history_wgt, &SearchReplaceWidget::s_textNotFound, this, &SQLExecutionWidget::searchOlderHistory);
 
 	connect(results_tbw, &QTableView::doubleClicked, this, [](const QModelIndex &index){
 		if(PlainTextItemDelegate::getMaxDisplayLength() > 0 &&
@@ -543,6 +545,11 @@ void SQLExecutionWidget::finishExecution(int rows_affected)
 
 		addToSQLHistory(sql_exec_hlp.getCommand(), rows_affected);
 
+		/* Commands that don't return results may have created, renamed or dropped objects,
+		 * so the completion index is refreshed (only the changed schemas are retrieved again) */
+		if(!res_model)
+			code_compl_wgt->refreshSymbolIndex();
+
 		empty = (!res_model || res_model->rowCount() == 0);
 		output_tbw->setTabEnabled(0, !empty);
 		results_parent->setVisible(!empty);
@@ -662,6 +669,17 @@ void SQLExecutionWidget::addToSQLHistory(const QString &cmd, unsigned rows, cons
 			fmt_cmd += Attributes::DdlEndToken + QChar('\n');
 
 		SQLExecutionWidget::validateSQLHistoryLength(sql_cmd_conn.getConnectionId(true,true), fmt_cmd, cmd_history_txt);
+
+		try
+		{
+			// The separator line break is not stored since it depends on the contents of the history widget
+			history_store.append(sql_cmd_conn.getConnectionId(true,true),
+													 fmt_cmd.startsWith(QChar('\n')) ? fmt_cmd.mid(1) : fmt_cmd);
+		}
+		catch(Exception &e)
+		{
+			Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+		}
 	}
 }
 
@@ -1081,29 +1099,8 @@ void SQLExecutionWidget::saveSQLHistory()
 {
 	try
 	{
-		SchemaParser schparser;
-		attribs_map attribs;
-		QString commands;
-
-		for(auto hist : cmd_history)
-		{
-			attribs[Attributes::Connection] = hist.first;
-			attribs[Attributes::Commands] = hist.second;
-			schparser.ignoreEmptyAttributes(true);
-			commands += schparser.getSourceCode(GlobalAttributes::getTmplConfigurationFilePath(GlobalAttributes::SchemasDir,
-																																														 Attributes::Commands +
-																																														 GlobalAttributes::SchemaExt), attribs);
-		}
-
-		schparser.loadFile(GlobalAttributes::getTmplConfigurationFilePath(GlobalAttributes::SchemasDir,
-																																			GlobalAttributes::SQLHistoryConf +
-																																			GlobalAttributes::SchemaExt));
-
-		attribs.clear();
-		attribs[Attributes::Commands] = commands;
-
-		UtilsNs::saveFile(GlobalAttributes::getConfigurationFilePath(GlobalAttributes::SQLHistoryConf),
-											schparser.getSourceCode(attribs).toUtf8());
+		for(auto &conn_id : history_store.getConnections())
+			history_store.compact(conn_id, cmd_history_max_len * HistoryRetentionFactor);
 	}
 	catch(Exception &e)
 	{
@@ -1111,21 +1108,26 @@ void SQLExecutionWidget::saveSQLHistory()
 	}
 }
 
-void SQLExecutionWidget::loadSQLHistory()
+void SQLExecutionWidget::migrateSQLHistory()
 {
+	QString legacy_file = GlobalAttributes::getConfigurationFilePath(GlobalAttributes::SQLHistoryConf);
+
+	if(!history_store.isEmpty() || !QFileInfo::exists(legacy_file))
+		return;
+
 	try
 	{
 		XmlParser xmlparser;
 		attribs_map attribs;
+		std::map<QString, QString> legacy_hist;
+		QStringList cmds;
 
 		xmlparser.setDTDFile(GlobalAttributes::getTmplConfigurationFilePath(GlobalAttributes::ObjectDTDDir,
 																																				GlobalAttributes::SQLHistoryConf +
 																																				GlobalAttributes::ObjectDTDExt),
 												 GlobalAttributes::SQLHistoryConf);
 
-		xmlparser.loadXMLFile(GlobalAttributes::getConfigurationFilePath(GlobalAttributes::SQLHistoryConf));
-
-		cmd_history.clear();
+		xmlparser.loadXMLFile(legacy_file);
 
 		if(xmlparser.accessElement(XmlParser::ChildElement))
 		{
@@ -1137,13 +1139,47 @@ void SQLExecutionWidget::loadSQLHistory()
 					xmlparser.savePosition();
 
 					if(xmlparser.accessElement(XmlParser::ChildElement))
-						cmd_history[attribs[Attributes::Connection]].append(xmlparser.getElementContent());
+						legacy_hist[attribs[Attributes::Connection]].append(xmlparser.getElementContent());
 
 					xmlparser.restorePosition();
 				}
 			}
 			while(xmlparser.accessElement(XmlParser::NextElement));
 		}
+
+		// Each command in the legacy history is terminated by the ddl end token
+		for(auto &[conn_id, hist] : legacy_hist)
+		{
+			cmds.clear();
+
+			for(auto &cmd : hist.split(Attributes::DdlEndToken, Qt::SkipEmptyParts))
+			{
+				if(!cmd.trimmed().isEmpty())
+					cmds.append(cmd.trimmed() + QChar('\n') + Attributes::DdlEndToken + QChar('\n'));
+			}
+
+			history_store.append(conn_id, cmds);
+		}
+
+		QFile::remove(legacy_file);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+	}
+}
+
+void SQLExecutionWidget::loadSQLHistory()
+{
+	try
+	{
+		history_store.setDirectory(GlobalAttributes::getConfigurationsPath() +
+															 GlobalAttributes::DirSeparator + GlobalAttributes::SQLHistoryConf);
+		migrateSQLHistory();
+		cmd_history.clear();
+
+		for(auto &conn_id : history_store.getConnections())
+			cmd_history[conn_id] = history_store.loadTail(conn_id, cmd_history_max_len).join(QChar('\n'));
 	}
 	catch(Exception &e)
 	{
@@ -1158,6 +1194,7 @@ void SQLExecutionWidget::destroySQLHistory()
 	if(Messagebox::isAccepted(res))
 	{
 		QFile::remove(GlobalAttributes::getConfigurationFilePath(GlobalAttributes::SQLHistoryConf));
+		SQLExecutionWidget::history_store.clearAll();
 		SQLExecutionWidget::cmd_history.clear();
 	}
 }
@@ -1194,7 +1231,6 @@ void SQLExecutionWidget::showHistoryContextMenu()
 {
 	QMenu *ctx_menu=cmd_history_txt->createStandardContextMenu();
 	QAction *action_clear = new QAction(GuiUtilsNs::getIcon("cleartext"), tr("Clear history"), ctx_menu),
-			*action_save = new QAction(GuiUtilsNs::getIcon("save"), tr("Save history"), ctx_menu),
 			*action_reload = new QAction(GuiUtilsNs::getIcon("refresh"), tr("Reload history"), ctx_menu),
 			*action_toggle_find = nullptr,
 			*exec_act = nullptr;
@@ -1207,7 +1243,6 @@ void SQLExecutionWidget::showHistoryContextMenu()
 	ctx_menu->addSeparator();
 	ctx_menu->addAction(action_toggle_find);
 	ctx_menu->addAction(action_reload);
-	ctx_menu->addAction(action_save);
 	ctx_menu->addSeparator();
 	ctx_menu->addAction(action_clear);
 
@@ -1221,10 +1256,9 @@ void SQLExecutionWidget::showHistoryContextMenu()
 		{
 			cmd_history_txt->clear();
 			cmd_history[sql_cmd_conn.getConnectionId(true,true)].clear();
+			history_store.clear(sql_cmd_conn.getConnectionId(true,true));
 		}
 	}
-	else if(exec_act == action_save)
-		SQLExecutionWidget::saveSQLHistory();
 	else if(exec_act == action_reload)
 	{
 		SQLExecutionWidget::loadSQLHistory();
@@ -1237,3 +1271,42 @@ void SQLExecutionWidget::showHistoryContextMenu()
 
 	delete ctx_menu;
 }
+
+void SQLExecutionWidget::searchOlderHistory(const QString &text)
+{
+	// Regular expressions can't be resolved using the words index of the history store
+	if(search_history_wgt->regexp_tb->isChecked())
+		return;
+
+	try
+	{
+		QString older_cmds, curr_hist = cmd_history_txt->toPlainText();
+		Qt::CaseSensitivity case_sens = search_history_wgt->case_sensitive_tb->isChecked() ?
+																			Qt::CaseSensitive : Qt::CaseInsensitive;
+		QTextCursor cursor;
+
+		for(auto &cmd : history_store.search(sql_cmd_conn.getConnectionId(true,true), text, MaxHistorySearchResults))
+		{
+			// Ignoring the commands already displayed and the ones that only match the words of the text
+			if(!cmd.contains(text, case_sens) || curr_hist.contains(cmd))
+				continue;
+
+			older_cmds += cmd + QChar('\n');
+		}
+
+		if(older_cmds.isEmpty())
+			return;
+
+		cursor = cmd_history_txt->textCursor();
+		cursor.setPosition(0);
+		cursor.insertText(older_cmds);
+		cursor.setPosition(0);
+		cmd_history_txt->setTextCursor(cursor);
+		cmd_history_txt->updateLineNumbers();
+		search_history_wgt->next_tb->click();
+	}
+	catch(Exception &e)
+	{
+		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+}
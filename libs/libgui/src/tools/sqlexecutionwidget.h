@@ -37,15 +37,27 @@
 #include "widgets/codecompletionwidget.h"
 #include "widgets/numberedtexteditor.h"
 #include "sqlexecutionhelper.h"
+#include "utils/sqlhistorystore.h"
 
 class __libgui SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget {
 	Q_OBJECT
 
 	private:
+		/*! \brief Amount of times the history max length that is kept in the history store
+		 *  for each connection. The extra commands are not loaded but can be reached by the history search */
+		static constexpr int HistoryRetentionFactor = 10,
+
+		//! \brief Maximum amount of older commands retrieved from the history store in a search
+		MaxHistorySearchResults = 100;
+
+		//! \brief Holds the tail of the commands history of each connection (the ones displayed in the history widget)
 		static std::map<QString, QString> cmd_history;
 
 		static int cmd_history_max_len;
 
+		//! \brief Persistent storage of the commands history of all connections
+		static SQLHistoryStore history_store;
+
 		qint64 start_exec, end_exec, total_exec;
 
 		SchemaParser schparser;
@@ -92,6 +104,10 @@ class __libgui SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget
 
 		static void validateSQLHistoryLength(const QString &conn_id, const QString &fmt_cmd = "", NumberedTextEditor *cmd_history_txt = nullptr);
 
+		/*! \brief Moves the commands in the legacy history file (sql-history.conf) to the history store.
+		 *  This is done only when the store is empty, and the legacy file is removed afterwards */
+		static void migrateSQLHistory();
+
 		void switchToExecutionMode(bool value);
 
 		void destroyResultModel();
@@ -152,10 +168,11 @@ class __libgui SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget
 		//! \brief Exports the results to csv file
 		static void exportResults(QTableView *results_tbw, bool csv_format);
 
-		//! \brief Save the history of all connections open in the SQL Execution to the sql-history.conf
+		/*! \brief Compacts the history of all connections in the history store. Since the commands are
+		 *  appended to the store as soon as they are executed there's no need to rewrite the history in full */
 		static void saveSQLHistory();
 
-		//! \brief Load the history from the file sql-history.conf
+		//! \brief Loads the tail of the history of all connections from the history store
 		static void loadSQLHistory();
 
 		static void destroySQLHistory();
@@ -194,6 +211,10 @@ class __libgui SQLExecutionWidget: public QWidget, public Ui::SQLExecutionWidget
 
 		void showHistoryContextMenu();
 
+		/*! \brief Searches the history store for commands containing the provided text that are not
+		 *  loaded in the history widget, prepending the ones found to the widget */
+		void searchOlderHistory(const QString &text);
+
 		void finishExecution(int rows_affected = 0);
 
 		void filterResults();
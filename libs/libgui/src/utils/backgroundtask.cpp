@@ -0,0 +1,119 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "backgroundtask.h"
+
+BackgroundTask::BackgroundTask(QObject *parent) : QObject(parent)
+{
+	thread = nullptr;
+	task_id = 0;
+	failed = false;
+}
+
+BackgroundTask::~BackgroundTask()
+{
+	wait();
+}
+
+void BackgroundTask::start(const std::function<void()> &task, const std::function<void()> &on_finished,
+													 const std::function<void(Exception &)> &on_error)
+{
+	if(isRunning())
+	{
+		throw Exception(tr("A background operation is already running, wait until it finishes to start a new one!"),
+										ErrorCode::Custom, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	unsigned id = ++task_id;
+
+	failed = false;
+	error = Exception();
+	finished_cb = on_finished;
+	error_cb = on_error;
+
+	thread = QThread::create([this, task](){
+		try
+		{
+			task();
+		}
+		catch(Exception &e)
+		{
+			error = Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
+			failed = true;
+		}
+	});
+
+	/* The finished signal is emitted from the worker thread, so it's queued
+	 * and the callbacks are executed in the thread that owns this object */
+	connect(thread, &QThread::finished, this, [this, id](){
+		handleTaskFinished(id);
+	});
+
+	thread->start();
+}
+
+void BackgroundTask::handleTaskFinished(unsigned id)
+{
+	// Ignoring the notification of an operation discarded by wait()
+	if(id != task_id || !thread)
+		return;
+
+	std::function<void()> on_finished = finished_cb;
+	std::function<void(Exception &)> on_error = error_cb;
+	Exception task_error = error;
+	bool task_failed = failed;
+
+	/* The thread is released before running the callbacks
+	 * so they are able to start a new operation */
+	releaseThread();
+
+	if(task_failed)
+	{
+		if(on_error)
+			on_error(task_error);
+	}
+	else if(on_finished)
+		on_finished();
+}
+
+void BackgroundTask::releaseThread()
+{
+	if(!thread)
+		return;
+
+	thread->wait();
+	delete thread;
+	thread = nullptr;
+	finished_cb = nullptr;
+	error_cb = nullptr;
+}
+
+bool BackgroundTask::isRunning()
+{
+	return thread != nullptr;
+}
+
+void BackgroundTask::wait()
+{
+	// Changing the id discards the finish notification already queued, if any
+	task_id++;
+	releaseThread();
+}
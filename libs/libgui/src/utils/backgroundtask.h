@@ -0,0 +1,86 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class BackgroundTask
+\brief Runs an operation, usually a set of catalog queries, in a worker thread so the UI isn't blocked while it runs.
+When the operation finishes, the provided callbacks are executed in the thread that owns the task object, so they can
+safely update widgets. Errors raised by the operation are delivered to the error callback. A task object runs only one
+operation at a time, so the callers must disable the controls that start new operations while isRunning() is true.
+*/
+
+#ifndef BACKGROUND_TASK_H
+#define BACKGROUND_TASK_H
+
+#include "guiglobal.h"
+#include "exception.h"
+#include <QObject>
+#include <QThread>
+#include <functional>
+
+class __libgui BackgroundTask: public QObject {
+	Q_OBJECT
+
+	private:
+		//! \brief The thread in which the current operation runs
+		QThread *thread;
+
+		//! \brief Identifies the current operation so finish notifications of discarded operations are ignored
+		unsigned task_id;
+
+		//! \brief Indicates that the current operation raised an error
+		bool failed;
+
+		//! \brief Stores the error raised by the current operation
+		Exception error;
+
+		//! \brief The callbacks executed when the operation finishes successfully or with error
+		std::function<void()> finished_cb;
+
+		std::function<void(Exception &)> error_cb;
+
+		//! \brief Destroys the finished thread and executes the callback related to the operation result
+		void handleTaskFinished(unsigned id);
+
+		//! \brief Waits the thread to finish and destroys it
+		void releaseThread();
+
+	public:
+		BackgroundTask(QObject *parent = nullptr);
+
+		//! \brief Waits for the running operation before destroying the task
+		~BackgroundTask() override;
+
+		/*! \brief Runs the operation in a worker thread. The on_finished or the on_error callback is executed in the task's thread
+		 *  when the operation finishes. An error is raised if another operation is still running */
+		void start(const std::function<void()> &task, const std::function<void()> &on_finished,
+							 const std::function<void(Exception &)> &on_error);
+
+		//! \brief Returns true while the operation runs and its callbacks weren't executed yet
+		bool isRunning();
+
+		/*! \brief Blocks until the running operation finishes discarding its callbacks.
+		 *  This must be called before destroying the objects used by the operation */
+		void wait();
+};
+
+#endif
@@ -0,0 +1,272 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "pngstreamwriter.h"
+#include "exception.h"
+#include <QtEndian>
+#include <zlib.h>
+
+PngStreamWriter::PngStreamWriter()
+{
+	zstream = nullptr;
+	width = height = rows_written = 0;
+}
+
+PngStreamWriter::~PngStreamWriter()
+{
+	if(isOpen())
+		abort();
+}
+
+bool PngStreamWriter::isOpen() const
+{
+	return output.isOpen();
+}
+
+int PngStreamWriter::getRowsWritten() const
+{
+	return rows_written;
+}
+
+void PngStreamWriter::open(const QString &filename, int width, int height)
+{
+	if(isOpen())
+		abort();
+
+	if(width <= 0 || height <= 0)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::InvImageTileDimensions).arg(filename),
+										ErrorCode::InvImageTileDimensions, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	output.setFileName(filename);
+
+	if(!output.open(QFile::WriteOnly | QFile::Truncate))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, output.errorString());
+	}
+
+	zstream = new z_stream;
+	zstream->zalloc = Z_NULL;
+	zstream->zfree = Z_NULL;
+	zstream->opaque = Z_NULL;
+
+	if(deflateInit(zstream, Z_DEFAULT_COMPRESSION) != Z_OK)
+	{
+		abort();
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	this->width = width;
+	this->height = height;
+	rows_written = 0;
+	idat_buffer.clear();
+
+	// Each scanline starts with the filter type byte (0 = none) followed by the RGB triplets
+	scanline.resize(1 + (static_cast<qsizetype>(width) * 3));
+	scanline[0] = 0;
+
+	static const char signature[] = { '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n' };
+	QByteArray ihdr(13, 0);
+
+	qToBigEndian<quint32>(width, ihdr.data());
+	qToBigEndian<quint32>(height, ihdr.data() + 4);
+	ihdr[8] = 8;  // Bit depth
+	ihdr[9] = 2;  // Color type: truecolor (RGB)
+	ihdr[10] = 0; // Compression method: deflate
+	ihdr[11] = 0; // Filter method: adaptive (we use only filter type none)
+	ihdr[12] = 0; // Interlace method: none
+
+	output.write(signature, sizeof(signature));
+	writeChunk("IHDR", ihdr);
+}
+
+void PngStreamWriter::writeRows(const QList<QImage> &tiles)
+{
+	if(!isOpen() || tiles.isEmpty())
+		return;
+
+	int band_h = tiles.first().height(), band_w = 0;
+	QList<QImage> rgb_tiles;
+
+	for(auto &tile : tiles)
+	{
+		band_w += tile.width();
+
+		if(tile.height() != band_h)
+			band_w = -1;
+
+		if(tile.format() == QImage::Format_RGB32 || tile.format() == QImage::Format_ARGB32)
+			rgb_tiles.append(tile);
+		else
+			rgb_tiles.append(tile.convertToFormat(QImage::Format_RGB32));
+	}
+
+	if(band_w != width || band_h <= 0 || rows_written + band_h > height)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::InvImageTileDimensions).arg(output.fileName()),
+										ErrorCode::InvImageTileDimensions, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	uchar *pixel = nullptr;
+	const QRgb *src = nullptr;
+
+	for(int row = 0; row < band_h; row++)
+	{
+		pixel = reinterpret_cast<uchar *>(scanline.data()) + 1;
+
+		for(auto &tile : rgb_tiles)
+		{
+			src = reinterpret_cast<const QRgb *>(tile.constScanLine(row));
+
+			for(int col = 0; col < tile.width(); col++)
+			{
+				*pixel++ = qRed(src[col]);
+				*pixel++ = qGreen(src[col]);
+				*pixel++ = qBlue(src[col]);
+			}
+		}
+
+		deflateData(reinterpret_cast<const uchar *>(scanline.constData()), scanline.size(), false);
+	}
+
+	rows_written += band_h;
+	flushIdatBuffer(false);
+}
+
+void PngStreamWriter::close()
+{
+	if(!isOpen())
+		return;
+
+	if(rows_written != height)
+	{
+		QString filename = output.fileName();
+
+		abort();
+		throw Exception(Exception::getErrorMessage(ErrorCode::InvImageTileDimensions).arg(filename),
+										ErrorCode::InvImageTileDimensions, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	deflateData(nullptr, 0, true);
+	flushIdatBuffer(true);
+	writeChunk("IEND", QByteArray());
+	releaseStream();
+
+	bool flushed = output.flush();
+	output.close();
+
+	if(!flushed || output.error() != QFile::NoError)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, output.errorString());
+	}
+}
+
+void PngStreamWriter::abort()
+{
+	releaseStream();
+	idat_buffer.clear();
+
+	if(output.isOpen())
+	{
+		output.close();
+		output.remove();
+	}
+
+	rows_written = 0;
+}
+
+void PngStreamWriter::releaseStream()
+{
+	if(!zstream)
+		return;
+
+	deflateEnd(zstream);
+	delete zstream;
+	zstream = nullptr;
+}
+
+void PngStreamWriter::writeChunk(const char *type, const QByteArray &data)
+{
+	uchar be_value[4];
+	uLong crc = crc32(0L, reinterpret_cast<const Bytef *>(type), 4);
+
+	if(!data.isEmpty())
+		crc = crc32(crc, reinterpret_cast<const Bytef *>(data.constData()), data.size());
+
+	qToBigEndian<quint32>(data.size(), be_value);
+	output.write(reinterpret_cast<const char *>(be_value), 4);
+	output.write(type, 4);
+	output.write(data);
+
+	qToBigEndian<quint32>(crc, be_value);
+
+	if(output.write(reinterpret_cast<const char *>(be_value), 4) != 4)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, output.errorString());
+	}
+}
+
+void PngStreamWriter::deflateData(const uchar *data, qsizetype size, bool finish)
+{
+	static constexpr unsigned OutSize = 65536;
+	uchar out[OutSize];
+	int res = Z_OK;
+
+	zstream->next_in = const_cast<Bytef *>(data);
+	zstream->avail_in = static_cast<uInt>(size);
+
+	do
+	{
+		zstream->next_out = out;
+		zstream->avail_out = OutSize;
+		res = deflate(zstream, finish ? Z_FINISH : Z_NO_FLUSH);
+
+		if(res == Z_STREAM_ERROR)
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+											ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr,
+											zstream->msg ? QString(zstream->msg) : QString());
+		}
+
+		idat_buffer.append(reinterpret_cast<const char *>(out), OutSize - zstream->avail_out);
+	}
+	while(zstream->avail_out == 0 || (finish && res != Z_STREAM_END));
+}
+
+void PngStreamWriter::flushIdatBuffer(bool force)
+{
+	while(idat_buffer.size() >= ChunkSize)
+	{
+		writeChunk("IDAT", idat_buffer.left(ChunkSize));
+		idat_buffer.remove(0, ChunkSize);
+	}
+
+	if(force && !idat_buffer.isEmpty())
+	{
+		writeChunk("IDAT", idat_buffer);
+		idat_buffer.clear();
+	}
+}
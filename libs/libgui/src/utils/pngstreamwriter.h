@@ -0,0 +1,100 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class PngStreamWriter
+\brief Writes a PNG image incrementally, band of rows by band of rows, without holding the whole
+image in memory. The pixels are deflated on the fly (zlib) and flushed to the file as IDAT chunks,
+so the memory usage depends only on the width of the image and the height of the bands written.
+This class is used to export huge canvases that can't be rendered in a single QPixmap/QImage.
+*/
+
+#ifndef PNG_STREAM_WRITER_H
+#define PNG_STREAM_WRITER_H
+
+#include "guiglobal.h"
+#include <QFile>
+#include <QImage>
+
+struct z_stream_s;
+
+class __libgui PngStreamWriter {
+	private:
+		//! \brief The maximum amount of compressed bytes held before emitting an IDAT chunk
+		static constexpr qsizetype ChunkSize = 1048576;
+
+		//! \brief The output file
+		QFile output;
+
+		//! \brief The deflate stream used to compress the image rows
+		z_stream_s *zstream;
+
+		//! \brief Holds the compressed data not yet written as an IDAT chunk
+		QByteArray idat_buffer,
+
+		//! \brief Holds a single filtered scanline (filter byte + RGB pixels)
+		scanline;
+
+		//! \brief Dimensions of the output image
+		int width, height,
+
+		//! \brief Amount of rows already written to the stream
+		rows_written;
+
+		//! \brief Writes a PNG chunk (length, type, data and CRC) to the output file
+		void writeChunk(const char *type, const QByteArray &data);
+
+		/*! \brief Compresses the provided data appending the result to the IDAT buffer.
+		 *  When finish is true the deflate stream is finalized */
+		void deflateData(const uchar *data, qsizetype size, bool finish);
+
+		//! \brief Writes the contents of the IDAT buffer as one or more IDAT chunks
+		void flushIdatBuffer(bool force);
+
+		//! \brief Releases the deflate stream
+		void releaseStream();
+
+	public:
+		PngStreamWriter();
+		~PngStreamWriter();
+
+		//! \brief Creates the output file and writes the PNG header (signature + IHDR)
+		void open(const QString &filename, int width, int height);
+
+		/*! \brief Writes a band of rows composed by the provided tiles. The tiles must be
+		 *  horizontally adjacent (from left to right), have the same height and the sum of
+		 *  their widths must match the image's width */
+		void writeRows(const QList<QImage> &tiles);
+
+		/*! \brief Finishes the image by flushing the pending compressed data and writing the IEND chunk.
+		 *  An error is raised if the amount of rows written differs from the image's height */
+		void close();
+
+		//! \brief Aborts the writing process removing the incomplete output file
+		void abort();
+
+		bool isOpen() const;
+
+		int getRowsWritten() const;
+};
+
+#endif
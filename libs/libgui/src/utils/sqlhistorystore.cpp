@@ -0,0 +1,578 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sqlhistorystore.h"
+#include "exception.h"
+#include "globalattributes.h"
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QCryptographicHash>
+#include <QtEndian>
+#include <algorithm>
+
+const QString SQLHistoryStore::LogExt {".log"};
+const QString SQLHistoryStore::IndexExt {".idx"};
+
+void SQLHistoryStore::setDirectory(const QString &dir)
+{
+	if(!dir.isEmpty() && !QDir().mkpath(dir))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(dir),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+
+	hist_dir = dir;
+	seg_tokens.clear();
+}
+
+QString SQLHistoryStore::getDirectory() const
+{
+	return hist_dir;
+}
+
+QString SQLHistoryStore::getSegmentId(const QString &conn_id)
+{
+	return QCryptographicHash::hash(conn_id.toUtf8(), QCryptographicHash::Sha1).toHex();
+}
+
+QString SQLHistoryStore::getSegmentFile(const QString &conn_id, const QString &ext) const
+{
+	return hist_dir + GlobalAttributes::DirSeparator + getSegmentId(conn_id) + ext;
+}
+
+QByteArray SQLHistoryStore::encodeRecord(const QString &text)
+{
+	QByteArray data = text.toUtf8(), record(RecordHeaderSize, 0);
+
+	qToBigEndian<quint32>(data.size(), record.data());
+	record.append(data);
+	return record;
+}
+
+QStringList SQLHistoryStore::getTokens(const QString &text)
+{
+	QStringList tokens;
+	QString word;
+
+	auto flush_word = [&tokens, &word]() {
+		if(word.length() >= MinTokenLength)
+			tokens.append(word);
+
+		word.clear();
+	};
+
+	for(auto &chr : text)
+	{
+		if(chr.isLetterOrNumber() || chr == QChar('_'))
+			word.append(chr.toLower());
+		else
+			flush_word();
+	}
+
+	flush_word();
+	tokens.removeDuplicates();
+	return tokens;
+}
+
+QString SQLHistoryStore::readLogHeader(const QString &log_file)
+{
+	QFile log(log_file);
+	QByteArray buf;
+	quint32 len = 0;
+
+	if(!log.open(QFile::ReadOnly))
+		return "";
+
+	buf = log.read(RecordHeaderSize);
+
+	if(buf.size() < RecordHeaderSize)
+		return "";
+
+	len = qFromBigEndian<quint32>(buf.constData());
+
+	if(len > log.size() - RecordHeaderSize)
+		return "";
+
+	return QString::fromUtf8(log.read(len));
+}
+
+bool SQLHistoryStore::isEmpty() const
+{
+	if(hist_dir.isEmpty())
+		return true;
+
+	return QDir(hist_dir).entryList({ "*" + LogExt }, QDir::Files).isEmpty();
+}
+
+QStringList SQLHistoryStore::getConnections() const
+{
+	QStringList conns;
+	QString conn_id;
+
+	if(hist_dir.isEmpty())
+		return conns;
+
+	for(auto &fi : QDir(hist_dir).entryInfoList({ "*" + LogExt }, QDir::Files, QDir::Name))
+	{
+		conn_id = readLogHeader(fi.absoluteFilePath());
+
+		if(!conn_id.isEmpty())
+			conns.append(conn_id);
+	}
+
+	return conns;
+}
+
+void SQLHistoryStore::append(const QString &conn_id, const QString &cmd)
+{
+	append(conn_id, QStringList { cmd });
+}
+
+void SQLHistoryStore::append(const QString &conn_id, const QStringList &cmds)
+{
+	if(hist_dir.isEmpty() || conn_id.isEmpty() || cmds.isEmpty())
+		return;
+
+	QFile log(getSegmentFile(conn_id, LogExt)), idx(getSegmentFile(conn_id, IndexExt));
+	QByteArray log_buf, idx_buf, record;
+	char entry[IndexEntrySize];
+	bool new_seg = false;
+	qint64 offset = 0;
+
+	validateSegment(conn_id);
+	new_seg = !log.exists();
+
+	if(!log.open(QFile::WriteOnly | QFile::Append) ||
+		 !idx.open(QFile::WriteOnly | (new_seg ? QFile::Truncate : QFile::Append)))
+	{
+		QFile &file = log.isOpen() ? idx : log;
+
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(file.fileName()),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE,
+										nullptr, file.errorString());
+	}
+
+	offset = log.size();
+
+	// The first record of a new segment identifies its connection
+	if(new_seg)
+	{
+		log_buf = encodeRecord(conn_id);
+		offset += log_buf.size();
+	}
+
+	for(auto &cmd : cmds)
+	{
+		record = encodeRecord(cmd);
+
+		qToBigEndian<qint64>(offset + RecordHeaderSize, entry);
+		qToBigEndian<qint32>(record.size() - RecordHeaderSize, entry + 8);
+		qToBigEndian<qint32>(cmd.count(QChar('\n')), entry + 12);
+
+		idx_buf.append(entry, IndexEntrySize);
+		log_buf.append(record);
+		offset += record.size();
+	}
+
+	/* The log is written before the index so an interrupted append leaves the index
+	 * behind the log, which is detected and fixed by validateSegment() */
+	if(log.write(log_buf) != log_buf.size() || !log.flush() ||
+		 idx.write(idx_buf) != idx_buf.size())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(log.fileName()),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE,
+										nullptr, log.errorString());
+	}
+}
+
+qint64 SQLHistoryStore::validateSegment(const QString &conn_id)
+{
+	QString log_file = getSegmentFile(conn_id, LogExt),
+			idx_file = getSegmentFile(conn_id, IndexExt);
+	QFileInfo log_fi(log_file), idx_fi(idx_file);
+
+	if(!log_fi.exists())
+	{
+		QFile::remove(idx_file);
+		return 0;
+	}
+
+	if(idx_fi.exists() && idx_fi.size() % IndexEntrySize == 0)
+	{
+		qint64 count = idx_fi.size() / IndexEntrySize;
+
+		if(count == 0)
+		{
+			if(log_fi.size() == RecordHeaderSize + conn_id.toUtf8().size())
+				return 0;
+		}
+		else
+		{
+			std::vector<IndexEntry> last = readIndex(conn_id, count - 1, 1);
+
+			if(!last.empty() && last[0].offset + last[0].length == log_fi.size())
+				return count;
+		}
+	}
+
+	rebuildIndex(conn_id);
+	return QFileInfo(idx_file).size() / IndexEntrySize;
+}
+
+void SQLHistoryStore::rebuildIndex(const QString &conn_id)
+{
+	QFile log(getSegmentFile(conn_id, LogExt));
+	QSaveFile idx(getSegmentFile(conn_id, IndexExt));
+	QByteArray buf, idx_buf;
+	char entry[IndexEntrySize];
+	qint64 pos = 0, len = 0;
+	const char *data = nullptr;
+
+	seg_tokens.erase(getSegmentId(conn_id));
+
+	if(!log.open(QFile::ReadWrite))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(log.fileName()),
+										ErrorCode::FileDirectoryNotAccessed, PGM_FUNC, PGM_FILE, PGM_LINE,
+										nullptr, log.errorString());
+	}
+
+	buf = log.readAll();
+	data = buf.constData();
+
+	// Skipping the header record
+	if(buf.size() >= RecordHeaderSize)
+	{
+		len = qFromBigEndian<quint32>(data);
+		pos = RecordHeaderSize + len;
+	}
+
+	// A log without a valid header can't be associated to a connection so it is discarded
+	if(buf.size() < RecordHeaderSize || pos > buf.size())
+	{
+		log.close();
+		log.remove();
+		QFile::remove(idx.fileName());
+		return;
+	}
+
+	while(pos + RecordHeaderSize <= buf.size())
+	{
+		len = qFromBigEndian<quint32>(data + pos);
+
+		if(pos + RecordHeaderSize + len > buf.size())
+			break;
+
+		qToBigEndian<qint64>(pos + RecordHeaderSize, entry);
+		qToBigEndian<qint32>(len, entry + 8);
+		qToBigEndian<qint32>(std::count(data + pos + RecordHeaderSize,
+																		data + pos + RecordHeaderSize + len, '\n'), entry + 12);
+		idx_buf.append(entry, IndexEntrySize);
+		pos += RecordHeaderSize + len;
+	}
+
+	// Discarding a partially written record at the end of the log
+	if(pos < buf.size())
+		log.resize(pos);
+
+	log.close();
+
+	if(!idx.open(QFile::WriteOnly) || idx.write(idx_buf) != idx_buf.size() || !idx.commit())
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(idx.fileName()),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE,
+										nullptr, idx.errorString());
+	}
+}
+
+std::vector<SQLHistoryStore::IndexEntry> SQLHistoryStore::readIndex(const QString &conn_id, qint64 first, qint64 count) const
+{
+	std::vector<IndexEntry> entries;
+	QFile idx(getSegmentFile(conn_id, IndexExt));
+	QByteArray buf;
+	const char *data = nullptr;
+
+	if(count <= 0)
+		return entries;
+
+	if(!idx.open(QFile::ReadOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(idx.fileName()),
+										ErrorCode::FileDirectoryNotAccessed, PGM_FUNC, PGM_FILE, PGM_LINE,
+										nullptr, idx.errorString());
+	}
+
+	idx.seek(first * IndexEntrySize);
+	buf = idx.read(count * IndexEntrySize);
+	data = buf.constData();
+	entries.reserve(buf.size() / IndexEntrySize);
+
+	for(qint64 pos = 0; pos + IndexEntrySize <= buf.size(); pos += IndexEntrySize)
+	{
+		IndexEntry entry;
+
+		entry.offset = qFromBigEndian<qint64>(data + pos);
+		entry.length = qFromBigEndian<qint32>(data + pos + 8);
+		entry.lines = qFromBigEndian<qint32>(data + pos + 12);
+		entries.push_back(entry);
+	}
+
+	return entries;
+}
+
+QStringList SQLHistoryStore::readEntries(const QString &conn_id, const std::vector<IndexEntry> &entries) const
+{
+	QStringList texts;
+	QFile log(getSegmentFile(conn_id, LogExt));
+	qint64 span = 0, total_len = 0;
+
+	if(entries.empty())
+		return texts;
+
+	if(!log.open(QFile::ReadOnly))
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(log.fileName()),
+										ErrorCode::FileDirectoryNotAccessed, PGM_FUNC, PGM_FILE, PGM_LINE,
+										nullptr, log.errorString());
+	}
+
+	for(auto &entry : entries)
+		total_len += entry.length + RecordHeaderSize;
+
+	span = entries.back().offset + entries.back().length - entries.front().offset;
+
+	// Consecutive entries (e.g. the tail of the history) are read at once
+	if(span <= total_len)
+	{
+		QByteArray buf;
+
+		log.seek(entries.front().offset);
+		buf = log.read(span);
+
+		for(auto &entry : entries)
+			texts.append(QString::fromUtf8(buf.constData() + (entry.offset - entries.front().offset), entry.length));
+	}
+	else
+	{
+		for(auto &entry : entries)
+		{
+			log.seek(entry.offset);
+			texts.append(QString::fromUtf8(log.read(entry.length)));
+		}
+	}
+
+	return texts;
+}
+
+qint64 SQLHistoryStore::getEntriesCount(const QString &conn_id)
+{
+	if(hist_dir.isEmpty())
+		return 0;
+
+	return validateSegment(conn_id);
+}
+
+qint64 SQLHistoryStore::getLinesCount(const QString &conn_id)
+{
+	qint64 count = getEntriesCount(conn_id), lines = 0;
+
+	for(auto &entry : readIndex(conn_id, 0, count))
+		lines += entry.lines;
+
+	return lines;
+}
+
+QStringList SQLHistoryStore::loadTail(const QString &conn_id, int max_lines)
+{
+	std::vector<IndexEntry> tail, block;
+	qint64 first = getEntriesCount(conn_id), blk_start = 0, lines = 0;
+	bool stop = false;
+
+	// Walking the index backwards until the lines limit is reached
+	while(first > 0 && !stop)
+	{
+		blk_start = std::max<qint64>(0, first - IndexBlockSize);
+		block = readIndex(conn_id, blk_start, first - blk_start);
+
+		for(auto itr = block.rbegin(); itr != block.rend(); itr++)
+		{
+			if(!tail.empty() && lines + itr->lines > max_lines)
+			{
+				stop = true;
+				break;
+			}
+
+			lines += itr->lines;
+			tail.push_back(*itr);
+		}
+
+		first = blk_start;
+	}
+
+	std::reverse(tail.begin(), tail.end());
+	return readEntries(conn_id, tail);
+}
+
+SQLHistoryStore::SegmentTokens &SQLHistoryStore::updateTokens(const QString &conn_id)
+{
+	qint64 count = validateSegment(conn_id), blk_count = 0;
+	SegmentTokens &tokens = seg_tokens[getSegmentId(conn_id)];
+	std::vector<IndexEntry> entries;
+	QStringList texts;
+
+	// The segment was rewritten in the meantime so the index is built from scratch
+	if(tokens.entries_count > count)
+		tokens = SegmentTokens();
+
+	while(tokens.entries_count < count)
+	{
+		blk_count = std::min<qint64>(IndexBlockSize, count - tokens.entries_count);
+		entries = readIndex(conn_id, tokens.entries_count, blk_count);
+		texts = readEntries(conn_id, entries);
+
+		for(auto &text : texts)
+		{
+			for(auto &token : getTokens(text))
+				tokens.postings[token].push_back(tokens.entries_count);
+
+			tokens.entries_count++;
+		}
+	}
+
+	return tokens;
+}
+
+QStringList SQLHistoryStore::search(const QString &conn_id, const QString &text, int max_results)
+{
+	QStringList terms = getTokens(text);
+	std::vector<qint64> result, matches, aux;
+	std::vector<IndexEntry> entries;
+	bool first_term = true;
+
+	if(hist_dir.isEmpty() || terms.isEmpty() || max_results <= 0 ||
+		 !QFileInfo::exists(getSegmentFile(conn_id, LogExt)))
+		return QStringList();
+
+	SegmentTokens &tokens = updateTokens(conn_id);
+
+	for(auto &term : terms)
+	{
+		matches.clear();
+
+		// Since the words are sorted, all the ones prefixed by the term are adjacent
+		for(auto itr = tokens.postings.lower_bound(term);
+				itr != tokens.postings.end() && itr->first.startsWith(term); itr++)
+			matches.insert(matches.end(), itr->second.begin(), itr->second.end());
+
+		std::sort(matches.begin(), matches.end());
+		matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+		if(first_term)
+			result.swap(matches);
+		else
+		{
+			aux.clear();
+			std::set_intersection(result.begin(), result.end(), matches.begin(), matches.end(), std::back_inserter(aux));
+			result.swap(aux);
+		}
+
+		first_term = false;
+
+		if(result.empty())
+			return QStringList();
+	}
+
+	if(result.size() > static_cast<size_t>(max_results))
+		result.erase(result.begin(), result.end() - max_results);
+
+	for(auto &entry_no : result)
+	{
+		std::vector<IndexEntry> entry = readIndex(conn_id, entry_no, 1);
+		entries.insert(entries.end(), entry.begin(), entry.end());
+	}
+
+	return readEntries(conn_id, entries);
+}
+
+void SQLHistoryStore::compact(const QString &conn_id, int keep_lines)
+{
+	if(getEntriesCount(conn_id) == 0 ||
+		 getLinesCount(conn_id) < 2 * static_cast<qint64>(keep_lines))
+		return;
+
+	QStringList cmds = loadTail(conn_id, keep_lines);
+	QSaveFile log(getSegmentFile(conn_id, LogExt)), idx(getSegmentFile(conn_id, IndexExt));
+	QByteArray log_buf = encodeRecord(conn_id), idx_buf, record;
+	char entry[IndexEntrySize];
+
+	for(auto &cmd : cmds)
+	{
+		record = encodeRecord(cmd);
+
+		qToBigEndian<qint64>(log_buf.size() + RecordHeaderSize, entry);
+		qToBigEndian<qint32>(record.size() - RecordHeaderSize, entry + 8);
+		qToBigEndian<qint32>(cmd.count(QChar('\n')), entry + 12);
+
+		idx_buf.append(entry, IndexEntrySize);
+		log_buf.append(record);
+	}
+
+	seg_tokens.erase(getSegmentId(conn_id));
+
+	/* Both files are replaced atomically. If the index replacement fails
+	 * it is rebuilt from the new log in the next access to the segment */
+	for(auto *file : { &log, &idx })
+	{
+		QByteArray &buf = (file == &log ? log_buf : idx_buf);
+
+		if(!file->open(QFile::WriteOnly) || file->write(buf) != buf.size() || !file->commit())
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(file->fileName()),
+											ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE,
+											nullptr, file->errorString());
+		}
+	}
+}
+
+void SQLHistoryStore::clear(const QString &conn_id)
+{
+	if(hist_dir.isEmpty())
+		return;
+
+	QFile::remove(getSegmentFile(conn_id, LogExt));
+	QFile::remove(getSegmentFile(conn_id, IndexExt));
+	seg_tokens.erase(getSegmentId(conn_id));
+}
+
+void SQLHistoryStore::clearAll()
+{
+	if(hist_dir.isEmpty())
+		return;
+
+	QDir dir(hist_dir);
+
+	for(auto &file : dir.entryList({ "*" + LogExt, "*" + IndexExt }, QDir::Files))
+		dir.remove(file);
+
+	seg_tokens.clear();
+}
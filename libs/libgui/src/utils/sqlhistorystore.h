@@ -0,0 +1,169 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class SQLHistoryStore
+\brief Implements a log-structured storage for the SQL commands history of the SQL execution widgets.
+Each connection has its own segment in the history directory, made of two files:
+
+ - A log file (.log) where the commands are only appended. The file starts with a record holding the
+   connection id followed by one record per command. Each record is a 32 bits big-endian length
+   followed by the UTF-8 encoded text.
+
+ - An offset index (.idx) with one fixed size entry per command (payload offset, payload length and
+   amount of lines of the command) which allows reading only the tail of a long history.
+
+The segments are never rewritten when a command is added, only during compaction, which keeps the most
+recent commands of a segment. The store also maintains a lazily built, in-memory inverted index of the
+words in the commands of each segment that is used to search commands not loaded in the history widget.
+*/
+
+#ifndef SQL_HISTORY_STORE_H
+#define SQL_HISTORY_STORE_H
+
+#include "guiglobal.h"
+#include <QStringList>
+#include <map>
+#include <vector>
+
+class __libgui SQLHistoryStore {
+	private:
+		//! \brief Stores the location of a command in the log file
+		struct IndexEntry {
+			qint64 offset = 0;
+			qint32 length = 0,
+
+			//! \brief The amount of line breaks in the command
+			lines = 0;
+		};
+
+		//! \brief The in-memory inverted index of a segment
+		struct SegmentTokens {
+			//! \brief The amount of commands already indexed
+			qint64 entries_count = 0;
+
+			//! \brief Maps each word (lowercased) to the (ascending) numbers of the commands containing it
+			std::map<QString, std::vector<qint64>> postings;
+		};
+
+		//! \brief Size in bytes of an offset index entry in the .idx file
+		static constexpr qint64 IndexEntrySize = 16,
+
+		//! \brief Size in bytes of the length prefix of each record in the .log file
+		RecordHeaderSize = 4,
+
+		//! \brief Amount of index entries read at once when walking the index backwards
+		IndexBlockSize = 256;
+
+		//! \brief The minimum length of a word to be stored in the inverted index
+		static constexpr int MinTokenLength = 2;
+
+		static const QString LogExt, IndexExt;
+
+		//! \brief The directory where the segments are stored
+		QString hist_dir;
+
+		//! \brief The inverted index of each segment already searched (the key is the segment id)
+		std::map<QString, SegmentTokens> seg_tokens;
+
+		//! \brief Returns the segment id (file basename) of a connection
+		static QString getSegmentId(const QString &conn_id);
+
+		//! \brief Returns the full path to a segment file of a connection
+		QString getSegmentFile(const QString &conn_id, const QString &ext) const;
+
+		//! \brief Encodes a text into a log record
+		static QByteArray encodeRecord(const QString &text);
+
+		//! \brief Returns the words in the text that are used as keys in the inverted index
+		static QStringList getTokens(const QString &text);
+
+		//! \brief Reads the connection id stored in the first record of a log file. Returns an empty string if the file is invalid
+		static QString readLogHeader(const QString &log_file);
+
+		/*! \brief Checks if the offset index of the connection's segment is consistent with its log file.
+		 *  If not, the index is rebuilt from the log file and a partially written record
+		 *  at the end of the log (e.g. an append interrupted by a crash) is discarded.
+		 *  Returns the amount of commands in the segment */
+		qint64 validateSegment(const QString &conn_id);
+
+		//! \brief Rebuilds the offset index of the connection's segment by scanning its log file
+		void rebuildIndex(const QString &conn_id);
+
+		//! \brief Reads count offset index entries starting from the entry number first
+		std::vector<IndexEntry> readIndex(const QString &conn_id, qint64 first, qint64 count) const;
+
+		//! \brief Reads the commands whose locations are described by the provided offset index entries
+		QStringList readEntries(const QString &conn_id, const std::vector<IndexEntry> &entries) const;
+
+		//! \brief Updates the inverted index of the connection's segment so it includes all the commands in the log file
+		SegmentTokens &updateTokens(const QString &conn_id);
+
+	public:
+		SQLHistoryStore() {}
+
+		//! \brief Configures the directory where the segments are stored. The directory is created if it doesn't exist
+		void setDirectory(const QString &dir);
+
+		QString getDirectory() const;
+
+		//! \brief Returns true when the store has no directory configured or no segment stored
+		bool isEmpty() const;
+
+		//! \brief Returns the ids of the connections that have a segment in the store
+		QStringList getConnections() const;
+
+		//! \brief Appends a command to the segment of the connection, creating the segment if needed
+		void append(const QString &conn_id, const QString &cmd);
+
+		//! \brief Appends a set of commands to the segment of the connection
+		void append(const QString &conn_id, const QStringList &cmds);
+
+		//! \brief Returns the amount of commands stored in the segment of the connection
+		qint64 getEntriesCount(const QString &conn_id);
+
+		//! \brief Returns the total amount of lines of the commands stored in the segment of the connection
+		qint64 getLinesCount(const QString &conn_id);
+
+		/*! \brief Returns the most recent commands of the connection whose amount of lines doesn't exceed max_lines.
+		 *  The last command is always returned even if it alone exceeds max_lines. Only the tail
+		 *  of the offset index and of the log file is read */
+		QStringList loadTail(const QString &conn_id, int max_lines);
+
+		/*! \brief Returns the most recent commands (at most max_results) of the connection containing all
+		 *  the words in the provided text. Each word in text is matched as a prefix of the words in the commands
+		 *  and in a case insensitive way. The commands are returned in the order they were executed */
+		QStringList search(const QString &conn_id, const QString &text, int max_results);
+
+		/*! \brief Rewrites the segment of the connection keeping only the most recent commands whose
+		 *  amount of lines doesn't exceed keep_lines. The segment is rewritten only when its total amount
+		 *  of lines is at least twice keep_lines, so compaction is amortized over several sessions */
+		void compact(const QString &conn_id, int keep_lines);
+
+		//! \brief Removes the segment of the connection
+		void clear(const QString &conn_id);
+
+		//! \brief Removes all the segments in the store
+		void clearAll();
+};
+
+#endif
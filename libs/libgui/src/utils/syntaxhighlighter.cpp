@@ -26,15 +26,22 @@
 #include "globalattributes.h"
 #include <QClipboard>
 #include <QMimeData>
+#include <QScrollBar>
 
 QFont SyntaxHighlighter::default_font {"Source Code Pro", 12};
 
+qint64 SyntaxHighlighter::hl_chars_limit {0};
+
 SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mode, bool use_custom_tab_width, qreal custom_fnt_size) : QSyntaxHighlighter(parent)
 {
 	if(!parent)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,PGM_FUNC,PGM_FILE,PGM_LINE);
 
 	code_field_txt = parent;
+	pending_blk = -1;
+	first_vis_blk = last_vis_blk = 0;
+	conf_serial = 0;
+	hl_disabled = false;
 
 	this->setDocument(parent->document());
 	this->single_line_mode = single_line_mode;
@@ -88,6 +95,11 @@ SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mo
 				break;
 		}
 	});
+
+	bg_highlight_timer.setSingleShot(true);
+	bg_highlight_timer.setInterval(0);
+	connect(&bg_highlight_timer, &QTimer::timeout, this, &SyntaxHighlighter::highlightPendingBlocks);
+	connect(parent->verticalScrollBar(), &QScrollBar::valueChanged, this, &SyntaxHighlighter::highlightVisibleBlocks);
 }
 
 bool SyntaxHighlighter::eventFilter(QObject *object, QEvent *event)
@@ -127,11 +139,90 @@ void SyntaxHighlighter::configureAttributes()
 }
 
 void SyntaxHighlighter::highlightBlock(const QString &text)
+{
+	TextBlockInfo *blk_info = dynamic_cast<TextBlockInfo *>(currentBlockUserData()),
+			*prev_blk_info = dynamic_cast<TextBlockInfo *>(currentBlock().previous().userData());
+	int prev_blk_state = getPreviousBlockState(),
+			blk_num = currentBlock().blockNumber();
+	size_t checkpoint = 0;
+
+	/* If the document exceeds the size limit we clear any formatting
+	 * info of the block and don't highlight it at all */
+	if(hl_chars_limit > 0 && document()->characterCount() > hl_chars_limit)
+	{
+		if(blk_info)
+			blk_info->reset();
+
+		setCurrentBlockState(SimpleBlock);
+
+		if(!hl_disabled)
+		{
+			hl_disabled = true;
+			pending_blk = -1;
+			bg_highlight_timer.stop();
+		}
+
+		return;
+	}
+
+	/* If the document was shrunk below the size limit we schedule the
+	 * highlighting of the whole document once this pass finishes */
+	if(hl_disabled)
+	{
+		hl_disabled = false;
+		QTimer::singleShot(0, this, &SyntaxHighlighter::rehighlight);
+	}
+
+	if(isDeferredHighlight())
+	{
+		/* The first block highlighted in a pass starts a new time slice, which
+		 * ends when the control returns to the event loop */
+		if(!hl_slice_timer.isValid())
+		{
+			hl_slice_timer.start();
+			updateVisibleBlocks();
+			QTimer::singleShot(0, this, [this](){
+				hl_slice_timer.invalidate();
+			});
+		}
+
+		/* Blocks outside the viewport are postponed when the time slice is over or when the previous
+		 * block is still pending, since the incoming state of the current one is still unknown */
+		if((blk_num < first_vis_blk || blk_num > last_vis_blk) &&
+			 (hl_slice_timer.hasExpired(HlSliceTime) || isBlockPending(currentBlock().previous())))
+		{
+			deferBlockHighlight(blk_info);
+			return;
+		}
+	}
+
+	/* The checkpoint of the block is computed from its text and its incoming state. If it
+	 * is the same as the one registered in the last highlighting there's no need to match
+	 * the groups again, we just restore the formatting and the state previously calculated.
+	 * This way, a cascading rehighlight stops being expensive once the states stabilize */
+	checkpoint = qHashMulti(conf_serial, prev_blk_state,
+													prev_blk_info && prev_blk_state >= OpenExprBlock ? prev_blk_info->getOpenGroup() : QString(),
+													text);
+
+	if(blk_info && !blk_info->isPending() && blk_info->isCheckpoint(checkpoint))
+	{
+		restoreBlockFormat(blk_info);
+		setCurrentBlockState(blk_info->getCheckpointState());
+		return;
+	}
+
+	applyBlockHighlight(text);
+
+	blk_info = dynamic_cast<TextBlockInfo *>(currentBlockUserData());
+	blk_info->setCheckpoint(checkpoint, currentBlockState());
+}
+
+void SyntaxHighlighter::applyBlockHighlight(const QString &text)
 {
 	QString open_group;
 	TextBlockInfo *blk_info = nullptr,
 			*prev_blk_info = dynamic_cast<TextBlockInfo *>(currentBlock().previous().userData());
-	int prev_blk_state = currentBlock().previous().userState();
+	int prev_blk_state = getPreviousBlockState();
 	bool match_final_exp = false;
 
 	/* Creating a text block info so we can register
@@ -296,7 +387,7 @@ bool SyntaxHighlighter::setFormat(const MatchInfo &m_info, const GroupConfig *gr
 	if(!m_info.isValid() || !group_cfg || !blk_info)
 		return false;
 
-	QTextCharFormat fmt = group_cfg ? group_cfg->format : QTextCharFormat();
+	QTextCharFormat fmt = getGroupFormat(group_cfg);
 	int end = m_info.end, len = m_info.getLength();
 
 	/* No formatting will be applied if we found a formatted
@@ -312,8 +403,6 @@ bool SyntaxHighlighter::setFormat(const MatchInfo &m_info, const GroupConfig *gr
 		len = end - m_info.start + 1;
 	}
 
-	fmt.setFontFamilies({ default_font.family() });
-	fmt.setFontPointSize(getCurrentFontSize());
 	QSyntaxHighlighter::setFormat(m_info.start, len, fmt);
 
 	/* If we are highlighting an open expression we need
@@ -363,11 +452,18 @@ bool SyntaxHighlighter::matchGroup(const GroupConfig *group_cfg, const QString &
 
 	match.clear();
 
-	if(!group_cfg || !exprs_map->contains(group_cfg->name))
+	if(!group_cfg)
 		return false;
 
-	for(auto &expr : (*exprs_map)[group_cfg->name])
-		matchExpression(text, txt_pos, expr, match);
+	if(exprs_map->contains(group_cfg->name))
+	{
+		for(auto &expr : (*exprs_map)[group_cfg->name])
+			matchExpression(text, txt_pos, expr, match);
+	}
+
+	// Plain words are never final expressions so they are matched only when searching initial expressions
+	if(!final_expr && word_matchers.contains(group_cfg->name))
+		word_matchers[group_cfg->name].match(text, txt_pos, match);
 
 	return !match.isEmpty();
 }
@@ -422,6 +518,145 @@ const SyntaxHighlighter::GroupConfig *SyntaxHighlighter::getGroupConfig(const QS
 	return &group_confs[group];
 }
 
+QTextCharFormat SyntaxHighlighter::getGroupFormat(const GroupConfig *group_cfg)
+{
+	QTextCharFormat fmt = group_cfg ? group_cfg->format : QTextCharFormat();
+
+	fmt.setFontFamilies({ default_font.family() });
+	fmt.setFontPointSize(getCurrentFontSize());
+
+	return fmt;
+}
+
+void SyntaxHighlighter::restoreBlockFormat(TextBlockInfo *blk_info)
+{
+	const GroupConfig *group_cfg = nullptr;
+
+	if(!blk_info)
+		return;
+
+	for(auto &f_info : blk_info->getFragmentInfos())
+	{
+		group_cfg = getGroupConfig(f_info.getGroup());
+
+		if(group_cfg)
+			QSyntaxHighlighter::setFormat(f_info.getStart(), f_info.getLength(), getGroupFormat(group_cfg));
+	}
+}
+
+void SyntaxHighlighter::deferBlockHighlight(TextBlockInfo *blk_info)
+{
+	int blk_num = currentBlock().blockNumber();
+
+	/* A block never highlighted before is flagged as pending so the next
+	 * ones are postponed as well. Otherwise, we keep its previous state
+	 * and formatting so the current highlighting pass stops here */
+	if(!blk_info)
+	{
+		blk_info = new TextBlockInfo;
+		setCurrentBlockUserData(blk_info);
+		setCurrentBlockState(PendingBlock);
+	}
+	else
+		restoreBlockFormat(blk_info);
+
+	blk_info->setPending(true);
+
+	if(pending_blk < 0 || blk_num < pending_blk)
+		pending_blk = blk_num;
+
+	if(!bg_highlight_timer.isActive())
+		bg_highlight_timer.start();
+}
+
+bool SyntaxHighlighter::isDeferredHighlight()
+{
+	return !single_line_mode && document()->blockCount() > DeferredHlMinBlocks;
+}
+
+bool SyntaxHighlighter::isBlockPending(const QTextBlock &block)
+{
+	if(!block.isValid())
+		return false;
+
+	TextBlockInfo *blk_info = dynamic_cast<TextBlockInfo *>(block.userData());
+	return !blk_info || blk_info->isPending();
+}
+
+void SyntaxHighlighter::updateVisibleBlocks()
+{
+	QScrollBar *vbar = code_field_txt->verticalScrollBar();
+
+	/* The vertical scroll bar of QPlainTextEdit works in terms of lines so
+	 * we need to translate them into the blocks that contain those lines */
+	first_vis_blk = document()->findBlockByLineNumber(vbar->value()).blockNumber();
+	last_vis_blk = document()->findBlockByLineNumber(vbar->value() + vbar->pageStep()).blockNumber();
+
+	if(last_vis_blk < 0)
+		last_vis_blk = document()->blockCount() - 1;
+}
+
+int SyntaxHighlighter::getPreviousBlockState()
+{
+	int prev_blk_state = currentBlock().previous().userState();
+	return prev_blk_state == PendingBlock ? SimpleBlock : prev_blk_state;
+}
+
+void SyntaxHighlighter::highlightPendingBlocks()
+{
+	if(pending_blk < 0)
+		return;
+
+	QTextBlock block = document()->findBlockByNumber(pending_blk);
+
+	/* Since the blocks may have been shifted by edits we make sure
+	 * to resume the highlighting from the first pending block */
+	while(block.isValid() && isBlockPending(block.previous()))
+		block = block.previous();
+
+	pending_blk = -1;
+	hl_slice_timer.start();
+	updateVisibleBlocks();
+
+	/* Rehighlighting a pending block cascades to the next ones while their states
+	 * change or until the time slice is over, when the block where the
+	 * highlighting stopped is flagged as the first pending one */
+	while(block.isValid() && pending_blk < 0)
+	{
+		if(isBlockPending(block))
+			rehighlightBlock(block);
+		else if(hl_slice_timer.hasExpired(HlSliceTime))
+			pending_blk = block.blockNumber();
+
+		block = block.next();
+	}
+
+	hl_slice_timer.invalidate();
+
+	if(pending_blk >= 0)
+		bg_highlight_timer.start();
+}
+
+void SyntaxHighlighter::highlightVisibleBlocks()
+{
+	if(pending_blk < 0)
+		return;
+
+	updateVisibleBlocks();
+
+	for(QTextBlock block = document()->findBlockByNumber(first_vis_blk);
+			block.isValid() && block.blockNumber() <= last_vis_blk; block = block.next())
+	{
+		if(isBlockPending(block))
+			rehighlightBlock(block);
+	}
+}
+
+bool SyntaxHighlighter::hasPendingBlocks()
+{
+	return pending_blk >= 0;
+}
+
 bool SyntaxHighlighter::highlightEnclosingChars(const EnclosingCharsCfg &cfg)
 {
 	QString curr_chr;
@@ -549,6 +784,8 @@ void SyntaxHighlighter::clearConfiguration()
 	group_confs.clear();
 	initial_exprs.clear();
 	final_exprs.clear();
+	word_matchers.clear();
+	conf_serial++;
 	configureAttributes();
 }
 
@@ -678,6 +915,18 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 								if(!group_cfg.multiline && (initial_expr || final_expr))
 									group_cfg.multiline = true;
 
+								/* Plain words that aren't initial/final expressions are inserted in the group's
+								 * word matcher instead of being compiled into a regular expression each. This way
+								 * all the words of a group are matched in a single pass over the text block */
+								if(attribs[Attributes::Type] == Attributes::Word && !initial_expr && !final_expr)
+								{
+									if(!word_matchers.contains(group))
+										word_matchers.insert(group, WordMatcher(case_sensitive));
+
+									word_matchers[group].addWord(attribs[Attributes::Value]);
+									continue;
+								}
+
 								regexp.setPattern(pattern);
 
 								// Regular expression matching
@@ -771,6 +1020,14 @@ QStringList SyntaxHighlighter::getExpressions(const QString &group_name)
 	return exprs;
 }
 
+QStringList SyntaxHighlighter::getWords(const QString &group_name)
+{
+	if(!word_matchers.contains(group_name))
+		return {};
+
+	return word_matchers[group_name].getWords();
+}
+
 QChar SyntaxHighlighter::getCompletionTrigger()
 {
 	return completion_trigger;
@@ -780,3 +1037,8 @@ void SyntaxHighlighter::setDefaultFont(const QFont &fnt)
 {
 	SyntaxHighlighter::default_font = fnt;
 }
+
+void SyntaxHighlighter::setHighlightSizeLimit(unsigned mi_chars)
+{
+	hl_chars_limit = static_cast<qint64>(mi_chars) * HlLimitCharsUnit;
+}
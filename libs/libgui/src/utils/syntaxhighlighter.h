@@ -32,9 +32,11 @@
 #include <QSyntaxHighlighter>
 #include <QRegularExpression>
 #include <QTimer>
+#include <QElapsedTimer>
 #include <QPlainTextEdit>
 #include "xmlparser.h"
 #include "textblockinfo.h"
+#include "wordmatcher.h"
 
 class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 	Q_OBJECT
@@ -78,8 +80,12 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 		//! \brief Default font configuratoin for all instances os syntax highlighter
 		static QFont default_font;
 
+		/*! \brief Indicates that the highlighting of the current block was postponed and it'll
+		 *  be processed later in background (see highlightPendingBlocks()) */
+		static constexpr int PendingBlock = -2,
+
 		//! \brief Indicates that the current block has no special meaning
-		static constexpr int SimpleBlock = -1,
+		SimpleBlock = -1,
 
 		/*! \brief Indicates that the current block was last formatted by a persistent group,
 		 * Indicating that the highlight was applied to the start position of the group
@@ -94,6 +100,20 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 		* be set as OpenExprBlock + 1 */
 		OpenExprBlock = 1;
 
+		/*! \brief Documents with more blocks than this amount are highlighted in time slices:
+		 *  the visible blocks first and the remaining ones in background chunks */
+		static constexpr int DeferredHlMinBlocks = 2000,
+
+		//! \brief The maximum time (in milliseconds) spent in each highlighting time slice
+		HlSliceTime = 25;
+
+		//! \brief The amount of characters in each unit of the highlight size limit setting
+		static constexpr qint64 HlLimitCharsUnit = 1000000;
+
+		/*! \brief The maximum size (in characters) of a document that can be highlighted.
+		 *  Documents bigger than that are not highlighted at all. A zero value means no limit */
+		static qint64 hl_chars_limit;
+
 		//! \brief Stores the order in which the groups must be applied
 		QStringList groups_order, multilines_order;
 
@@ -106,6 +126,11 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 				//! \brief Stores the groups final expressions (only for multiline groups)
 				final_exprs;
 
+		/*! \brief Stores the plain words of each group compiled in a single matcher per group.
+		 *  Word elements that are not initial/final expressions are not converted to regular expressions,
+		 *  instead, they are matched all at once by the group's word matcher */
+		QMap<QString, WordMatcher> word_matchers;
+
 		//! \brief Stores the enclosing characters config read from file
 		QList<EnclosingCharsCfg> enclosing_chrs;
 
@@ -123,7 +148,27 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 		//! \brief Stores the char that triggers the code completion
 		QChar	completion_trigger;
 
-		QTimer highlight_timer;
+		QTimer highlight_timer,
+
+		//! \brief Timer used to highlight the pending blocks in background chunks
+		bg_highlight_timer;
+
+		//! \brief Measures the time spent in the current highlighting slice
+		QElapsedTimer hl_slice_timer;
+
+		/*! \brief Stores the number of the first pending block, the one from which the
+		 *  background highlighting must be resumed. A negative value means no pending blocks */
+		int pending_blk,
+
+		//! \brief Stores the first and last block numbers visible in the parent input
+		first_vis_blk, last_vis_blk;
+
+		/*! \brief Incremented each time the configuration is (re)loaded, being part of
+		 *  the blocks checkpoints so they don't survive a configuration change */
+		unsigned conf_serial;
+
+		//! \brief Indicates that the highlighting was disabled due to the document size limit
+		bool hl_disabled;
 
 		//! \brief Configures the initial attributes of the highlighter
 		void configureAttributes();
@@ -149,6 +194,33 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 		//! \brief Returns a const ref to the named group configuration
 		const GroupConfig *getGroupConfig(const QString &group);
 
+		//! \brief Returns the format of the group configuration using the current font settings
+		QTextCharFormat getGroupFormat(const GroupConfig *group_cfg);
+
+		/*! \brief Performs the actual highlighting of the current block by matching
+		 *  the multiline groups first and then the other groups */
+		void applyBlockHighlight(const QString &text);
+
+		/*! \brief Applies again the formatting registered in the fragments of the block info
+		 *  without matching the groups expressions */
+		void restoreBlockFormat(TextBlockInfo *blk_info);
+
+		/*! \brief Postpones the highlighting of the current block to be done in background.
+		 *  The formatting previously applied to the block, if any, is kept until then */
+		void deferBlockHighlight(TextBlockInfo *blk_info);
+
+		//! \brief Returns true when the document is large enough to be highlighted in time slices
+		bool isDeferredHighlight();
+
+		//! \brief Returns true when the provided block was not highlighted yet or its highlighting was postponed
+		static bool isBlockPending(const QTextBlock &block);
+
+		//! \brief Updates the range of blocks visible in the parent input
+		void updateVisibleBlocks();
+
+		//! \brief Returns the state of the previous block, treating pending blocks as simple ones
+		int getPreviousBlockState();
+
 		/*! \brief Matches the expression in 'group_cfg' in 'text' starting from 'txt_pos', storing the
 		 * matching position(s) in 'matches'. The 'final_expr' forces only final expressions to be used
 		 * in the matching. This method returns true when there's at least one matching */
@@ -186,6 +258,9 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 		that the final expressions must be returned instead of initial expression (default) */
 		QStringList getExpressions(const QString &group_name);
 
+		//! \brief Returns the plain words (elements of type word) of the specified group
+		QStringList getWords(const QString &group_name);
+
 		//! \brief Returns the current configured code completion trigger char
 		QChar getCompletionTrigger();
 
@@ -196,12 +271,26 @@ class __libgui SyntaxHighlighter: public QSyntaxHighlighter {
 		//! \brief Sets the default font for all instances of this class
 		static void setDefaultFont(const QFont &fnt);
 
+		/*! \brief Sets the maximum size, in millions of characters, of the documents that can be highlighted.
+		 *  A zero value disables the limit */
+		static void setHighlightSizeLimit(unsigned mi_chars);
+
+		//! \brief Returns true when there are blocks still waiting to be highlighted in background
+		bool hasPendingBlocks();
+
 	private slots:
 		//! \brief Highlight a line of the text
 		void highlightBlock(const QString &text) override;
 
 		//! \brief Clears the loaded configuration
 		void clearConfiguration();
+
+		/*! \brief Highlights a chunk of pending blocks starting from the first one, during
+		 *  one time slice, rescheduling itself while there are pending blocks left */
+		void highlightPendingBlocks();
+
+		//! \brief Highlights immediately the pending blocks currently visible in the parent input
+		void highlightVisibleBlocks();
 };
 
 #endif
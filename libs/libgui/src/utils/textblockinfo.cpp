@@ -30,6 +30,9 @@ void TextBlockInfo::reset()
 {
 	frag_infos.clear();
 	open_group.clear();
+	checkpoint_hash = 0;
+	checkpoint_state = -1;
+	pending = false;
 }
 
 void TextBlockInfo::addFragmentInfo(const FragmentInfo &f_info)
@@ -62,6 +65,37 @@ QString TextBlockInfo::getOpenGroup()
 	return open_group;
 }
 
+const QList<FragmentInfo> &TextBlockInfo::getFragmentInfos()
+{
+	return frag_infos;
+}
+
+void TextBlockInfo::setCheckpoint(size_t hash, int state)
+{
+	checkpoint_hash = hash;
+	checkpoint_state = state;
+}
+
+bool TextBlockInfo::isCheckpoint(size_t hash)
+{
+	return checkpoint_hash != 0 && checkpoint_hash == hash;
+}
+
+int TextBlockInfo::getCheckpointState()
+{
+	return checkpoint_state;
+}
+
+void TextBlockInfo::setPending(bool value)
+{
+	pending = value;
+}
+
+bool TextBlockInfo::isPending()
+{
+	return pending;
+}
+
 bool TextBlockInfo::isCompletionAllowed(int pos)
 {
 	for(auto &f_info : frag_infos)
@@ -43,10 +43,23 @@ class __libgui TextBlockInfo: public QTextBlockUserData {
 		 *  like this one. See SyntaxHighlighter::highlightBlock() */
 		QString open_group;
 
+		/*! \brief Holds the hash of the text and incoming highlighting state (previous block's state
+		 *  and open group) computed the last time the block was fully highlighted. While the hash
+		 *  matches, the block's formatting can be restored from the fragment infos without parsing
+		 *  the text again. See SyntaxHighlighter::highlightBlock() */
+		size_t checkpoint_hash;
+
+		//! \brief Holds the state the block was left in when the checkpoint was registered
+		int checkpoint_state;
+
+		/*! \brief Indicates that the highlighting of the block was postponed so its current
+		 *  formatting (if any) can be outdated */
+		bool pending;
+
 	public:
 		TextBlockInfo();
 
-		//! \brief Clears the group name and set all flags to false
+		//! \brief Clears the group name, the checkpoint and set all flags to false
 		void reset();
 
 		//! \brief Register a text fragment
@@ -60,6 +73,22 @@ class __libgui TextBlockInfo: public QTextBlockUserData {
 
 		QString getOpenGroup();
 
+		//! \brief Returns all the text fragments registered in the block
+		const QList<FragmentInfo> &getFragmentInfos();
+
+		//! \brief Registers the checkpoint hash of the block and the state resulting from its highlighting
+		void setCheckpoint(size_t hash, int state);
+
+		//! \brief Returns true when the provided hash matches the one registered for the block
+		bool isCheckpoint(size_t hash);
+
+		//! \brief Returns the block state registered with the checkpoint
+		int getCheckpointState();
+
+		void setPending(bool value);
+
+		bool isPending();
+
 		/*! \brief Return true if the position in the text block accepts
 		 *  the code completion widget to be triggered */
 		bool isCompletionAllowed(int pos);
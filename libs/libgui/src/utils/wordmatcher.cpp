@@ -0,0 +1,194 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "wordmatcher.h"
+#include <algorithm>
+
+WordMatcher::WordMatcher(bool case_sensitive)
+{
+	this->case_sensitive = case_sensitive;
+	clear();
+}
+
+void WordMatcher::clear()
+{
+	nodes.clear();
+	nodes.emplace_back();
+	words.clear();
+}
+
+bool WordMatcher::isEmpty() const
+{
+	return words.isEmpty();
+}
+
+bool WordMatcher::isCaseSensitive() const
+{
+	return case_sensitive;
+}
+
+QStringList WordMatcher::getWords() const
+{
+	return words;
+}
+
+char16_t WordMatcher::getKeyChar(QChar chr) const
+{
+	return case_sensitive ? chr.unicode() : chr.toLower().unicode();
+}
+
+int WordMatcher::getChildNode(int node_idx, char16_t chr) const
+{
+	const auto &children = nodes[node_idx].children;
+	auto itr = std::lower_bound(children.begin(), children.end(), chr,
+															[](const std::pair<char16_t, int> &child, char16_t key) {
+																return child.first < key;
+															});
+
+	if(itr == children.end() || itr->first != chr)
+		return -1;
+
+	return itr->second;
+}
+
+void WordMatcher::addWord(const QString &word)
+{
+	if(word.isEmpty())
+		return;
+
+	int node_idx = 0, child_idx = -1;
+	char16_t key;
+
+	for(auto &chr : word)
+	{
+		key = getKeyChar(chr);
+		child_idx = getChildNode(node_idx, key);
+
+		if(child_idx < 0)
+		{
+			auto &children = nodes[node_idx].children;
+
+			child_idx = static_cast<int>(nodes.size());
+			children.insert(std::upper_bound(children.begin(), children.end(), std::make_pair(key, child_idx),
+																			 [](const std::pair<char16_t, int> &a, const std::pair<char16_t, int> &b) {
+																				 return a.first < b.first;
+																			 }),
+											std::make_pair(key, child_idx));
+
+			/* The vector can be reallocated below, so the reference
+			 * to the children vector must not be used after this point */
+			nodes.emplace_back();
+		}
+
+		node_idx = child_idx;
+	}
+
+	if(!nodes[node_idx].is_word)
+	{
+		nodes[node_idx].is_word = true;
+		words.append(word);
+	}
+}
+
+bool WordMatcher::isWordChar(QChar chr)
+{
+	return chr.isLetterOrNumber() || chr.isMark() || chr == QChar('_');
+}
+
+bool WordMatcher::isWordBoundary(const QString &text, int pos)
+{
+	bool prev_word = pos > 0 && pos <= text.size() && isWordChar(text[pos - 1]),
+			next_word = pos >= 0 && pos < text.size() && isWordChar(text[pos]);
+
+	return prev_word != next_word;
+}
+
+int WordMatcher::matchAt(const QString &text, int pos) const
+{
+	int node_idx = 0, end = -1, len = text.size();
+
+	for(int idx = pos; idx < len; idx++)
+	{
+		node_idx = getChildNode(node_idx, getKeyChar(text[idx]));
+
+		if(node_idx < 0)
+			break;
+
+		/* A word is only matched if it's followed by a space or a word boundary.
+		 * This is the same as the lookahead (?=\s|\b) used in word patterns */
+		if(nodes[node_idx].is_word &&
+			 ((idx + 1 < len && text[idx + 1].isSpace()) || isWordBoundary(text, idx + 1)))
+			end = idx + 1;
+	}
+
+	return end;
+}
+
+bool WordMatcher::match(const QString &text, int txt_pos, QList<MatchInfo> &matches) const
+{
+	int len = text.size(), end = -1;
+	bool found = false;
+	MatchInfo m_info;
+
+	if(isEmpty())
+		return false;
+
+	for(int pos = std::max(0, txt_pos); pos < len;)
+	{
+		/* A word is only matched if it's preceded by a space or a word boundary.
+		 * This is the same as the lookbehind (?<=\s|\b) used in word patterns */
+		if(((pos > 0 && text[pos - 1].isSpace()) || isWordBoundary(text, pos)) &&
+			 (end = matchAt(text, pos)) > pos)
+		{
+			m_info = MatchInfo(pos, end - 1);
+
+			if(!matches.contains(m_info))
+				matches.append(m_info);
+
+			found = true;
+			pos = end;
+		}
+		else
+			pos++;
+	}
+
+	return found;
+}
+
+bool WordMatcher::match(const QString &text, int txt_pos, MatchInfo &m_info) const
+{
+	int len = text.size(), end = -1;
+
+	if(isEmpty())
+		return false;
+
+	for(int pos = std::max(0, txt_pos); pos < len; pos++)
+	{
+		if(((pos > 0 && text[pos - 1].isSpace()) || isWordBoundary(text, pos)) &&
+			 (end = matchAt(text, pos)) > pos)
+		{
+			m_info = MatchInfo(pos, end - 1);
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,102 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class WordMatcher
+\brief Auxiliary class used by SyntaxHighlighter that matches a set of plain words in a text using a
+character trie. All the words of a highlighting group are compiled into a single trie so a text block
+is scanned only once, instead of running one regular expression per word. The matching rules are the
+same used by the word patterns in SyntaxHighlighter (see SyntaxHighlighter::loadConfiguration), that is,
+a word only matches when it is delimited by spaces or word boundaries.
+*/
+
+#ifndef WORD_MATCHER_H
+#define WORD_MATCHER_H
+
+#include "guiglobal.h"
+#include "matchinfo.h"
+#include <QStringList>
+#include <QList>
+#include <vector>
+
+class __libgui WordMatcher {
+	private:
+		//! \brief A trie node. The children are kept sorted by their characters so they can be binary searched
+		struct TrieNode {
+			std::vector<std::pair<char16_t, int>> children;
+
+			//! \brief Indicates that the path from the root to this node is a complete word
+			bool is_word = false;
+		};
+
+		//! \brief The trie nodes. The first element is the root node
+		std::vector<TrieNode> nodes;
+
+		//! \brief The words inserted in the matcher, in their original form
+		QStringList words;
+
+		//! \brief Indicates if the words are matched in a case sensitive way
+		bool case_sensitive;
+
+		//! \brief Returns the index of the child node of node_idx associated to chr or -1 if it doesn't exist
+		int getChildNode(int node_idx, char16_t chr) const;
+
+		//! \brief Returns the character in the form used as key in the trie (lowercase when the matching is case insensitive)
+		char16_t getKeyChar(QChar chr) const;
+
+		//! \brief Returns true when the position pos of text is a word boundary (in the same way the regexp \b does)
+		static bool isWordBoundary(const QString &text, int pos);
+
+		//! \brief Returns true when the character is a word character (in the same way the regexp \w does)
+		static bool isWordChar(QChar chr);
+
+		//! \brief Returns the exclusive end position of the longest word starting at pos or -1 when no word is matched
+		int matchAt(const QString &text, int pos) const;
+
+	public:
+		WordMatcher(bool case_sensitive = false);
+
+		//! \brief Inserts a word in the matcher
+		void addWord(const QString &word);
+
+		//! \brief Returns the words inserted in the matcher
+		QStringList getWords() const;
+
+		//! \brief Returns true when no word was inserted in the matcher
+		bool isEmpty() const;
+
+		bool isCaseSensitive() const;
+
+		//! \brief Removes all the words of the matcher
+		void clear();
+
+		/*! \brief Performs a global match of the words in text starting from txt_pos, appending
+		 *  to matches the positions of the words found (the longest word is picked when more than one
+		 *  matches in the same position). Returns true when at least one word was matched */
+		bool match(const QString &text, int txt_pos, QList<MatchInfo> &matches) const;
+
+		/*! \brief Performs a single match of the words in text starting from txt_pos, storing in m_info
+		 *  the position of the first word found. Returns true when a word was matched */
+		bool match(const QString &text, int txt_pos, MatchInfo &m_info) const;
+};
+
+#endif
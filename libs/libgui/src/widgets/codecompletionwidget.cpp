@@ -261,17 +261,8 @@ void CodeCompletionWidget::configureCompletion(DatabaseModel *db_model, SyntaxHi
 
 		if(syntax_hl && keywords.isEmpty())
 		{
-			//Get the keywords from the highlighter
-			QStringList exprs = syntax_hl->getExpressions(keywords_grp);
-			QRegularExpression regexp("\\(\\?\\=.*");
-
-			for(auto &expr : exprs)
-			{
-				/* Since keywords are exact match patterns (see SyntaxHighlighter::loadConfiguration)
-				 * we need to remove from the pattern the regexp operators in order to extract only the
-				 * work itself. */
-				keywords.append(expr.remove("(?<=\\s|\\b)").remove(regexp));
-			}
+			//Get the keywords (plain words) from the highlighter
+			keywords = syntax_hl->getWords(keywords_grp);
 
 			completion_trigger = syntax_hl->getCompletionTrigger();
 		}
@@ -327,7 +318,15 @@ void CodeCompletionWidget::setConnection(Connection conn)
 	// When setting a connection, we disable the lookup in the database model
 	db_model = nullptr;
 	catalog.closeConnection();
+	catalog.setPreparedQueries(true);
 	catalog.setConnection(conn);
+	symbol_index = CatalogSymbolIndex::getSharedIndex(conn);
+}
+
+void CodeCompletionWidget::refreshSymbolIndex()
+{
+	if(symbol_index)
+		symbol_index->refresh();
 }
 
 void CodeCompletionWidget::populateNameList(std::vector<BaseObject *> &objects, QString filter)
@@ -573,7 +572,7 @@ bool CodeCompletionWidget::retrieveColumnNames()
 	QStringList aux_names, aliases;
 	QList<QStringList> split_tab_names;
 	QListWidgetItem *item = nullptr;
-	attribs_map filter, attribs;
+	attribs_map attribs;
 	QString sch_name, tab_name, key, orig_name;
 	bool cols_added = false;
 	int tab_pos = -1;
@@ -614,12 +613,8 @@ bool CodeCompletionWidget::retrieveColumnNames()
 		sch_name = names[0];
 		tab_name = names[1];
 
-		catalog.setQueryFilter(Catalog::ListAllObjects);
-
-		if(!tab_name.isEmpty())
-			filter[Attributes::NameFilter] = QString("^(%1)").arg(curr_word);
-
-		attribs = catalog.getObjectsNames(ObjectType::Column, sch_name, tab_name, filter);
+		attribs = getObjectsNames(ObjectType::Column, sch_name, tab_name,
+															!tab_name.isEmpty() ? curr_word : "");
 
 		for(auto &attr : attribs)
 		{
@@ -659,7 +654,7 @@ bool CodeCompletionWidget::retrieveColumnNames()
 
 bool CodeCompletionWidget::retrieveObjectNames()
 {
-	attribs_map attribs, filter;
+	attribs_map attribs;
 	QListWidgetItem *item = nullptr;
 	QString curr_word = word, obj_name;
 	QTextCursor tc = code_field_txt->textCursor();
@@ -780,12 +775,8 @@ bool CodeCompletionWidget::retrieveObjectNames()
 
 	for(auto &obj_type : obj_types)
 	{
-		catalog.setQueryFilter(Catalog::ListAllObjects);
-
-		if(!obj_name.isEmpty() && obj_name != completion_trigger)
-			filter[Attributes::NameFilter] = QString("^(%1)").arg(obj_name);
-
-		attribs = catalog.getObjectsNames(obj_type, sch_name, tab_name, filter);
+		attribs = getObjectsNames(obj_type, sch_name, tab_name,
+															obj_name != completion_trigger ? obj_name : "");
 
 		for(auto &attr : attribs)
 		{
@@ -832,6 +823,22 @@ bool CodeCompletionWidget::retrieveObjectNames()
 	return retrieved;
 }
 
+attribs_map CodeCompletionWidget::getObjectsNames(ObjectType obj_type, const QString &sch_name, const QString &tab_name, const QString &prefix)
+{
+	attribs_map filter;
+
+	// The index is used whenever it holds the requested type avoiding querying the server at each keystroke
+	if(symbol_index && symbol_index->isLoaded() && CatalogSymbolIndex::isIndexedType(obj_type))
+		return symbol_index->findSymbols(obj_type, sch_name, tab_name, prefix);
+
+	catalog.setQueryFilter(Catalog::ListAllObjects);
+
+	if(!prefix.isEmpty())
+		filter[Attributes::NameFilter] = QString("^(%1)").arg(prefix);
+
+	return catalog.getObjectsNames(obj_type, sch_name, tab_name, filter);
+}
+
 void CodeCompletionWidget::extractTableNames()
 {
 	QTextCursor tc = code_field_txt->textCursor();
@@ -34,6 +34,7 @@ the syntax highlighter installed on it.
 #include "utils/syntaxhighlighter.h"
 #include "databasemodel.h"
 #include "catalog.h"
+#include "catalogsymbolindex.h"
 
 class __libgui CodeCompletionWidget: public QWidget {
 	Q_OBJECT
@@ -121,6 +122,10 @@ class __libgui CodeCompletionWidget: public QWidget {
 		//! \brief Catalog object used to retrieve object names from the database system catalogs
 		Catalog catalog;
 
+		/*! \brief Index of the object names of the database shared by all completion widgets using the same connection.
+		 * While the index is not loaded the object names are retrieved using the catalog object */
+		std::shared_ptr<CatalogSymbolIndex> symbol_index;
+
 		/*! \brief This is used to simulate an history of selected object
 		whenever the user types the completion trigger char. An example of qualifying is access a column
 		of a table by typing the full path to it: public[0].table[1].column[2]. The numbers between brace
@@ -168,6 +173,10 @@ class __libgui CodeCompletionWidget: public QWidget {
 		 *  depending o the current position of the cursor in the typed DML command */
 		bool retrieveObjectNames();
 
+		/*! \brief Returns the names of the objects of the provided type which start with the prefix.
+		 *  The names are retrieved from the symbol index when possible, otherwise, the catalog is queried */
+		attribs_map getObjectsNames(ObjectType obj_type, const QString &sch_name, const QString &tab_name, const QString &prefix);
+
 		//! \brief Parses the entire command in order to extract the table names and aliases
 		void extractTableNames();
 
@@ -207,6 +216,10 @@ class __libgui CodeCompletionWidget: public QWidget {
 
 		//! \brief Sets the connection params used to retrive column names
 		void setConnection(Connection conn);
+
+		/*! \brief Requests the refresh of the object names index of the current connection.
+		 *  This should be called after executing commands that may have changed the database objects */
+		void refreshSymbolIndex();
 		
 	public slots:
 		//! \brief Updates the completion list based upon the typed word
@@ -23,8 +23,6 @@
 #include <QFileDialog>
 #include "exception.h"
 #include <QTextStream>
-#include "csvparser.h"
-#include "messagebox.h"
 #include "guiutilsns.h"
 
 CsvLoadWidget::CsvLoadWidget(QWidget * parent, bool cols_in_first_row) : QWidget(parent)
@@ -48,7 +46,7 @@ CsvLoadWidget::CsvLoadWidget(QWidget * parent, bool cols_in_first_row) : QWidget
 	GuiUtilsNs::configureBuddyWidgets(this);
 
 	connect(txt_delim_chk, &QCheckBox::toggled, txt_delim_edt, &QLineEdit::setEnabled);
-	connect(load_btn, &QPushButton::clicked, this, &CsvLoadWidget::loadCsvFile);
+	connect(load_btn, &QPushButton::clicked, this, &CsvLoadWidget::s_csvFileLoadRequested);
 
 	connect(separator_cmb, &QComboBox::currentTextChanged, this, [this](){
 			separator_edt->setVisible(separator_cmb->currentIndex() == separator_cmb->count()-1);
@@ -57,21 +55,16 @@ CsvLoadWidget::CsvLoadWidget(QWidget * parent, bool cols_in_first_row) : QWidget
 	connect(file_sel, &FileSelectorWidget::s_selectorChanged, load_btn, &QPushButton::setEnabled);
 }
 
-CsvDocument CsvLoadWidget::getCsvDocument()
-{
-	return csv_document;
-}
-
-CsvDocument CsvLoadWidget::loadCsvFromBuffer(const QString &csv_buffer, const QChar &separator, const QChar &text_delim, bool cols_in_first_row)
+int CsvLoadWidget::loadCsvFromBuffer(const QString &csv_buffer, const QChar &separator, const QChar &text_delim,
+																		 bool cols_in_first_row, const CsvParser::RowHandler &row_handler)
 {
 	try
 	{
-		CsvDocument csv_doc;
 		CsvParser csv_parser;
 
 		csv_parser.setSpecialChars(separator, text_delim, CsvDocument::LineBreak);
 		csv_parser.setColumnInFirstRow(cols_in_first_row);
-		return csv_parser.parseBuffer(csv_buffer);
+		return csv_parser.parseBuffer(csv_buffer, row_handler);
 	}
 	catch(Exception &e)
 	{
@@ -79,24 +72,25 @@ CsvDocument CsvLoadWidget::loadCsvFromBuffer(const QString &csv_buffer, const QC
 	}
 }
 
-void CsvLoadWidget::loadCsvFile()
+int CsvLoadWidget::loadCsvFile(const CsvParser::RowHandler &row_handler)
 {
 	try
 	{
 		CsvParser csv_parser;
+		int row_cnt = 0;
 
 		csv_parser.setSpecialChars(getSeparator(),
 															 txt_delim_chk->isChecked() ? txt_delim_edt->text().at(0) : CsvDocument::TextDelimiter,
 															 CsvDocument::LineBreak);
 		csv_parser.setColumnInFirstRow(col_names_chk->isChecked());
-		csv_document = csv_parser.parseFile(file_sel->getSelectedFile());
+		row_cnt = csv_parser.parseFile(file_sel->getSelectedFile(), row_handler);
 		file_sel->clearSelector();
 
-		emit s_csvFileLoaded();
+		return row_cnt;
 	}
 	catch(Exception &e)
 	{
-		Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC, PGM_FILE, PGM_LINE, &e);
 	}
 }
 
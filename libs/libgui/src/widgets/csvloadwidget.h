@@ -30,41 +30,33 @@
 
 #include "ui_csvloadwidget.h"
 #include "fileselectorwidget.h"
-#include "csvdocument.h"
+#include "csvparser.h"
 
 class __libgui CsvLoadWidget : public QWidget, Ui::CsvLoadWidget {
 	Q_OBJECT
 
 	private:
-		//! \brief Holds the names of columns extracted from the csv file
-		QStringList csv_columns;
-
-		//! \brief Holds the rows extracted from the csv file
-		QList<QStringList> csv_rows;
-
 		FileSelectorWidget *file_sel;
 
-		CsvDocument csv_document;
-
 	public:
 		CsvLoadWidget(QWidget * parent = nullptr, bool cols_in_first_row = true);
 
-		CsvDocument getCsvDocument();
+		/*! \brief Parses the selected csv file using the options configured in the widget delivering
+		 *  each row to the handler (see CsvParser::RowHandler). Returns the number of data rows loaded */
+		int loadCsvFile(const CsvParser::RowHandler &row_handler);
 
 		bool isColumnsInFirstRow();
 
 		QChar getSeparator();
 
-		/*! \brief Loads a csv document from a buffer. The user can specify the value separator, text delimiter and an object
-		 *  which will store the column names.In that case, the column names are only extracted from the first
-		 *  row if the cols_in_first_row is true */
-		static CsvDocument loadCsvFromBuffer(const QString &csv_buffer, const QChar &separator, const QChar &text_delim, bool cols_in_first_row);
-
-	private slots:
-		void loadCsvFile();
+		/*! \brief Loads a csv document from a buffer delivering each row to the handler. The user can specify the value separator
+		 *  and text delimiter. The column names are only extracted from the first row if the cols_in_first_row is true */
+		static int loadCsvFromBuffer(const QString &csv_buffer, const QChar &separator, const QChar &text_delim,
+																 bool cols_in_first_row, const CsvParser::RowHandler &row_handler);
 
 	signals:
-		void s_csvFileLoaded();
+		//! \brief Signal emitted when the user requests the loading of the selected file (see loadCsvFile())
+		void s_csvFileLoadRequested();
 };
 
 #endif
@@ -115,6 +115,8 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	scene_moving = blink_new_objs = false;
 	curr_show_grid = curr_show_delim = true;
 	new_obj_type = ObjectType::BaseObject;
+	force_layout = nullptr;
+	layout_thread = nullptr;
 
 	//Generating a temporary file name for the model
 	QTemporaryFile tmp_file;
@@ -165,6 +167,7 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	db_model = new DatabaseModel(this);
 	xmlparser = db_model->getXMLParser();
 	op_list = new OperationList(db_model, this);
+	validation_cache = new ModelValidationCache(db_model, op_list, this);
 
 	scene = new ObjectsScene(this);
 	scene->installEventFilter(this);
@@ -707,6 +710,15 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 
 ModelWidget::~ModelWidget()
 {
+	// The layout can't outlive the table views it positions, so we wait for its interruption
+	if(layout_thread)
+	{
+		force_layout->cancel();
+		layout_thread->quit();
+		layout_thread->wait();
+		delete force_layout;
+	}
+
 	/* Forcing the deletion of db_model only after everything else was destroyed
 	 * to avoid memory leaks */
 	db_model->deleteLater();
@@ -2989,22 +3001,69 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 	BaseTable *orig_parent_tab = nullptr;
 	std::vector<BaseObject *>::iterator itr, itr_end;
 	std::map<BaseObject *, QString> orig_names, orig_fmt_names;
+	std::map<BaseObject *, BaseObject *> cloned_objs;
+	std::map<std::pair<ObjectType, BaseObject *>, QSet<QString>> used_names;
+	QSet<QString> *names = nullptr;
+	QSet<Table *> upd_fk_rels;
 	BaseObject *object = nullptr, *aux_object = nullptr;
 	BaseGraphicObject *graph_obj = nullptr;
 	TableObject *tab_obj = nullptr;
 	Table *sel_table = nullptr, *aux_table = nullptr;
 	View *sel_view = nullptr;
 	BaseTable *parent = nullptr;
-	BaseFunction *func = nullptr;
+	BaseObject *container = nullptr;
 	Constraint *constr = nullptr;
-	Operator *oper = nullptr;
 	QString aux_name, new_name;
 	ObjectType obj_type;
 	std::vector<Exception> errors;
 	unsigned pos = 0;
 	TaskProgressWidget task_prog_wgt(this);
 	ObjectRenameWidget obj_rename_wgt(this);
-	bool discard_input_obj = duplicate_mode || (src_model == this);
+	bool discard_input_obj = duplicate_mode || (src_model == this), own_entry = false;
+
+	/* Returns the names in use by the objects of the provided type in the container (schema or table/view).
+	 * Each set is built once on demand and kept in sync as the copied objects are renamed, this way
+	 * the disambiguation of several objects doesn't need to rescan the model's lists at each conflict */
+	auto getUsedNames = [&used_names](ObjectType type, BaseObject *parent_obj, auto *obj_list, bool comp_sch_names) -> QSet<QString> &
+	{
+		std::pair<ObjectType, BaseObject *> key = std::make_pair(type, parent_obj);
+
+		if(!used_names.count(key) && obj_list)
+		{
+			QSet<QString> &obj_names = used_names[key];
+
+			for(auto &obj : *obj_list)
+			{
+				if(!comp_sch_names || obj->getSchema() == parent_obj)
+					obj_names.insert(obj->getName());
+			}
+		}
+
+		return used_names[key];
+	};
+
+	/* Returns true when the table references an object that was renamed to be pasted along with it.
+	 * In that case the table is recreated from its XML code so the references point to the pasted
+	 * copies instead of the original objects */
+	auto refersRenamedObject = [&orig_names](Table *table)
+	{
+		std::vector<BaseObject *> refs = { table->getSchema(), table->getOwner(), table->getTablespace(), table->getTag() };
+		Column *col = nullptr;
+
+		for(auto &tab_obj : *table->getObjectList(ObjectType::Column))
+		{
+			col = dynamic_cast<Column *>(tab_obj);
+			refs.push_back(col->getSequence());
+			refs.push_back(col->getCollation());
+
+			if(col->getType().isUserType())
+				refs.push_back(col->getType().getObject());
+		}
+
+		return std::any_of(refs.begin(), refs.end(), [&orig_names](BaseObject *ref) {
+			return ref && orig_names.count(ref);
+		});
+	};
 
 	task_prog_wgt.setWindowTitle(tr("Pasting objects..."));
 	task_prog_wgt.show();
@@ -3095,8 +3154,6 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 																															obj_rename_wgt.use_defaults_chk->isChecked() ?
 																															Attributes::True : Attributes::False }});
 
-					func = nullptr; oper = nullptr;
-
 					// Store the orignal object name on a map so we can restore it at the end of pasting operation
 					orig_names[object] = object->getName();
 					orig_fmt_names[object] = object->getName(true);
@@ -3104,47 +3161,43 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 					// Set the name specified in the rename dialog so we can start the disambigation operation
 					object->setName(new_name);
 
-					/* For each object type as follow configures the name and the suffix and store them on the
-						'copy_obj_name' variable. This string is used to check if there are objects with the same name
-						on model. While the 'copy_obj_name' conflicts with other objects (of same type) this validation is made */
-					if(BaseFunction::isBaseFunction(obj_type))
+					/* Retrieving the names in use by the objects of the same type in the receiver table/view (for table objects)
+					 * or in the object's schema (for the other objects). The flag own_entry indicates that the object being
+					 * pasted is itself in that container and so its name is already present in the set */
+					if(tab_obj)
 					{
-						func = dynamic_cast<BaseFunction *>(object);
-						func->setName(CoreUtilsNs::generateUniqueName(func,
-																													*db_model->getObjectList(obj_type),
-																													true, "_cp", true, false));
+						container = sel_table ? dynamic_cast<BaseObject *>(sel_table) : sel_view;
+
+						if(sel_table)
+							names = &getUsedNames(obj_type, container, sel_table->getObjectList(obj_type), false);
+						else
+							names = &getUsedNames(obj_type, container, sel_view->getObjectList(obj_type), false);
+
+						own_entry = (tab_obj->getParentTable() == container);
 					}
-					else if(obj_type == ObjectType::Operator)
+					else
 					{
-						oper = dynamic_cast<Operator *>(object);
-						oper->setName(CoreUtilsNs::generateUniqueName(oper,
-																													*db_model->getObjectList(ObjectType::Operator),
-																													true, "", true, false));
+						names = &getUsedNames(obj_type, object->getSchema(), db_model->getObjectList(obj_type), true);
+						own_entry = (object->getDatabase() == db_model);
 					}
-					else
+
+					/* Functions and operators are always compared to themselves, for the other objects the input object
+					 * is discarded from the comparison when pasting in the same model */
+					if(own_entry)
 					{
-						if(tab_obj)
-						{
-							if(sel_table)
-							{
-								tab_obj->setName(CoreUtilsNs::generateUniqueName(tab_obj,
-																																 *sel_table->getObjectList(tab_obj->getObjectType()),
-																																 false, "_cp", true, discard_input_obj));
-							}
-							else
-							{
-								tab_obj->setName(CoreUtilsNs::generateUniqueName(tab_obj,
-																																 *sel_view->getObjectList(tab_obj->getObjectType()),
-																																 false, "_cp", true, discard_input_obj));
-							}
-						}
+						if(BaseFunction::isBaseFunction(obj_type) || obj_type == ObjectType::Operator || !discard_input_obj)
+							names->insert(new_name);
 						else
-						{
-							object->setName(CoreUtilsNs::generateUniqueName(object,
-																															*db_model->getObjectList(object->getObjectType()),
-																															true, "_cp", true, discard_input_obj));
-						}
+							names->remove(orig_names[object]);
 					}
+
+					/* While the name conflicts with other objects (of same type) in the container a new name is generated.
+					 * Operators don't receive the suffix since their names are disambiguated with a special character */
+					object->setName(CoreUtilsNs::generateUniqueName(object, *names,
+																													obj_type == ObjectType::Operator ? "" : "_cp", true));
+
+					if(own_entry)
+						names->insert(object->getName());
 				}
 			}
 		}
@@ -3174,8 +3227,15 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 		{
 			aux_table =  dynamic_cast<Table *>(object);
 
+			/* Tables are cloned directly together with their columns and constraints, having their references
+			 * remapped to the receiver model. The XML code is only generated when the table can't be cloned
+			 * (e.g. when pasting in another model which lacks some of the objects referenced by the table)
+			 * or when it must reference the copies of other pasted objects */
+			if(aux_table && !refersRenamedObject(aux_table) &&
+				 (aux_object = db_model->cloneTable(aux_table, duplicate_mode)))
+				cloned_objs[object] = aux_object;
 			//Stores the XML definition on a xml buffer map
-			if(duplicate_mode && aux_table)
+			else if(duplicate_mode && aux_table)
 			{
 				xml_objs[object] = aux_table->__getSourceCode(SchemaParser::XmlCode, true);
 			  object->setCodeInvalidated(true);
@@ -3192,10 +3252,21 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 			else
 				parent=sel_view;
 
-			/* Only generates the XML for a table object when the selected receiver object
+			/* Columns pasted on a table of the same model are cloned directly with their new names
+			 * since all the objects they reference (types, sequences) are already in the model,
+			 * avoiding the generation and parsing of their XML code.
+			 *
+			 * For the other cases, only generates the XML for a table object when the selected receiver object
 			 * is a table or is a view and the current object is a trigger, index, or rule (because
 			 * view's only accepts this two types) */
-			if(sel_table ||
+			if(sel_table && src_model == this && tab_obj->getObjectType() == ObjectType::Column)
+			{
+				aux_object = nullptr;
+				CoreUtilsNs::copyObject(&aux_object, tab_obj, ObjectType::Column);
+				dynamic_cast<TableObject *>(aux_object)->setParentTable(sel_table);
+				cloned_objs[object] = aux_object;
+			}
+			else if(sel_table ||
 					(sel_view && (tab_obj->getObjectType()==ObjectType::Trigger ||
 									tab_obj->getObjectType()==ObjectType::Rule ||
 									tab_obj->getObjectType()==ObjectType::Index)))
@@ -3259,11 +3330,8 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 		object = *itr;
 		itr++;
 
-		if(xml_objs.count(object))
+		if(xml_objs.count(object) || cloned_objs.count(object))
 		{
-			xmlparser->restartParser();
-			xmlparser->loadXMLBuffer(xml_objs[object]);
-
 			try
 			{
 				pos++;
@@ -3272,8 +3340,16 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 											 .arg(object->getTypeName()),
 											 enum_t(object->getObjectType()));
 
-				//Creates the object from the XML
-				object = db_model->createObject(BaseObject::getObjectType(xmlparser->getElementName()));
+				if(cloned_objs.count(object))
+					object = cloned_objs[object];
+				else
+				{
+					//Creates the object from the XML
+					xmlparser->restartParser();
+					xmlparser->loadXMLBuffer(xml_objs[object]);
+					object = db_model->createObject(BaseObject::getObjectType(xmlparser->getElementName()));
+				}
+
 				tab_obj = dynamic_cast<TableObject *>(object);
 				constr = dynamic_cast<Constraint *>(tab_obj);
 				graph_obj = dynamic_cast<BaseGraphicObject *>(object);
@@ -3311,9 +3387,9 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 						constr->getParentTable()->setModified(true);
 					}
 
-					//Updates the fk relationships if the constraint is a foreign-key
+					//Flagging the table to have its fk relationships updated if the constraint is a foreign-key
 					if(constr && constr->getConstraintType() == ConstraintType::ForeignKey)
-						db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
+						upd_fk_rels.insert(dynamic_cast<Table *>(tab_obj->getParentTable()));
 
 					op_list->registerObject(tab_obj, Operation::ObjCreated, -1, tab_obj->getParentTable());
 				}
@@ -3322,6 +3398,16 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 			}
 			catch(Exception &e)
 			{
+				//Destroying the cloned column/table in case it could not be added to the table/model
+				if(cloned_objs.count(*(itr - 1)))
+				{
+					aux_object = cloned_objs[*(itr - 1)];
+
+					if((TableObject::isTableObject(aux_object->getObjectType()) && sel_table->getObjectIndex(aux_object) < 0) ||
+						 (!TableObject::isTableObject(aux_object->getObjectType()) && db_model->getObjectIndex(aux_object) < 0))
+						delete aux_object;
+				}
+
 				if(e.getErrorCode() != ErrorCode::AsgDuplicatedObject)
 					errors.push_back(e);
 			}
@@ -3329,6 +3415,20 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 	}
 	op_list->finishOperationChain();
 
+	/* The fk relationships of the tables that received foreign keys are updated only once
+	 * after all objects are pasted instead of being updated for each pasted constraint */
+	for(auto &tab : upd_fk_rels)
+	{
+		try
+		{
+			db_model->updateTableFKRelationships(tab);
+		}
+		catch(Exception &e)
+		{
+			errors.push_back(e);
+		}
+	}
+
 	//Validates the relationships to reflect any modification on the tables structures and not propagated columns
 	db_model->validateRelationships();
 
@@ -4916,6 +5016,11 @@ OperationList *ModelWidget::getOperationList()
 	return op_list;
 }
 
+ModelValidationCache *ModelWidget::getValidationCache()
+{
+	return validation_cache;
+}
+
 std::vector<BaseObject *> ModelWidget::getSelectedObjects()
 {
 	return selected_objects;
@@ -5342,6 +5447,8 @@ void ModelWidget::swapObjectsIds()
 	parent_form.cancel_btn->setText(tr("&Close"));
 
 	connect(swap_ids_wgt, &SwapObjectsIdsWidget::s_objectsIdsSwapped, this, [this](){
+		// Swapping ids changes the creation order of the objects so the validation must check the whole model again
+		validation_cache->invalidate();
 		op_list->removeOperations();
 		setModified(true);
 		emit s_objectManipulated();
@@ -5849,6 +5956,136 @@ void ModelWidget::rearrangeTablesInSchemas()
 	viewport->updateScene({ scene->sceneRect() });
 }
 
+void ModelWidget::rearrangeTablesForceDirected(bool async)
+{
+	if(isForceLayoutRunning())
+		return;
+
+	std::vector<BaseObject *> objects;
+	std::map<BaseTable *, int> node_ids;
+	std::map<BaseObject *, int> sch_ids;
+	BaseTable *tab = nullptr;
+	BaseTableView *tab_view = nullptr;
+	BaseRelationship *rel = nullptr;
+
+	if(!force_layout)
+	{
+		force_layout = new ForceDirectedLayout;
+		layout_thread = new QThread(this);
+		force_layout->moveToThread(layout_thread);
+
+		connect(layout_thread, &QThread::started, force_layout, &ForceDirectedLayout::run);
+		connect(force_layout, &ForceDirectedLayout::s_layoutFinished, layout_thread, &QThread::quit);
+		connect(force_layout, &ForceDirectedLayout::s_positionsUpdated, this, &ModelWidget::applyForceLayoutPositions);
+		connect(force_layout, &ForceDirectedLayout::s_layoutFinished, this, [this](bool canceled) {
+			finishForceLayout();
+			emit s_forceLayoutFinished(canceled);
+		});
+	}
+
+	scene->clearSelection();
+	force_layout->clear();
+	layout_views.clear();
+
+	for(auto type : { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View })
+		objects.insert(objects.end(), db_model->getObjectList(type)->begin(), db_model->getObjectList(type)->end());
+
+	// Each schema is a group in the layout so its tables are kept together inside the schema rectangle
+	for(auto &obj : objects)
+	{
+		tab = dynamic_cast<BaseTable *>(obj);
+		tab_view = dynamic_cast<BaseTableView *>(tab->getOverlyingObject());
+
+		if(!tab_view)
+			continue;
+
+		if(sch_ids.count(tab->getSchema()) == 0)
+		{
+			int sch_id = sch_ids.size();
+			sch_ids[tab->getSchema()] = sch_id;
+		}
+
+		node_ids[tab] = force_layout->addNode(tab_view->boundingRect().size(), tab_view->pos(), sch_ids[tab->getSchema()]);
+		layout_views.append(tab_view);
+	}
+
+	objects.assign(db_model->getObjectList(ObjectType::Relationship)->begin(), db_model->getObjectList(ObjectType::Relationship)->end());
+	objects.insert(objects.end(), db_model->getObjectList(ObjectType::BaseRelationship)->begin(), db_model->getObjectList(ObjectType::BaseRelationship)->end());
+
+	for(auto &obj : objects)
+	{
+		rel = dynamic_cast<BaseRelationship *>(obj);
+
+		// Relationships linking textboxes don't take part in the layout
+		if(node_ids.count(rel->getTable(BaseRelationship::SrcTable)) &&
+			 node_ids.count(rel->getTable(BaseRelationship::DstTable)))
+		{
+			force_layout->addEdge(node_ids[rel->getTable(BaseRelationship::SrcTable)],
+														node_ids[rel->getTable(BaseRelationship::DstTable)]);
+		}
+	}
+
+	for(auto &itr : sch_ids)
+		dynamic_cast<Schema *>(itr.first)->setRectVisible(true);
+
+	if(async)
+	{
+		// The canvas can't be edited while the layout moves the tables
+		viewport->setEnabled(false);
+		layout_thread->start();
+	}
+	else
+		/* Running the layout in the current thread. The signals emitted by the layout
+		 * are delivered directly, so all positions are applied when the method returns */
+		force_layout->run();
+}
+
+bool ModelWidget::isForceLayoutRunning()
+{
+	return layout_thread && layout_thread->isRunning();
+}
+
+void ModelWidget::cancelForceLayout()
+{
+	if(isForceLayoutRunning())
+		force_layout->cancel();
+}
+
+void ModelWidget::applyForceLayoutPositions(const QList<QPointF> &positions)
+{
+	for(int idx = 0; idx < positions.size() && idx < layout_views.size(); idx++)
+	{
+		// The table could be removed while the layout was running
+		if(layout_views[idx])
+			layout_views[idx]->setPos(positions[idx]);
+	}
+}
+
+void ModelWidget::finishForceLayout()
+{
+	std::vector<BaseObject *> rels;
+	BaseRelationship *base_rel = nullptr;
+
+	//Removing all custom points from relationships
+	rels.assign(db_model->getObjectList(ObjectType::Relationship)->begin(), db_model->getObjectList(ObjectType::Relationship)->end());
+	rels.insert(rels.end(), db_model->getObjectList(ObjectType::BaseRelationship)->begin(), db_model->getObjectList(ObjectType::BaseRelationship)->end());
+
+	for(auto &rel : rels)
+	{
+		base_rel = dynamic_cast<BaseRelationship *>(rel);
+		base_rel->setPoints({});
+		base_rel->resetLabelsDistance();
+	}
+
+	layout_views.clear();
+	viewport->setEnabled(true);
+
+	db_model->setObjectsModified({ ObjectType::Table, ObjectType::View, ObjectType::ForeignTable,
+																 ObjectType::Schema, ObjectType::Relationship, ObjectType::BaseRelationship });
+	adjustSceneRect(false);
+	viewport->updateScene({ scene->sceneRect() });
+}
+
 void ModelWidget::updateMagnifierArea()
 {
 	QPoint pos = viewport->mapFromGlobal(QCursor::pos());
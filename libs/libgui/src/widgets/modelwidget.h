@@ -35,6 +35,10 @@
 #include "objectsscene.h"
 #include "newobjectoverlaywidget.h"
 #include "layerswidget.h"
+#include "forcedirectedlayout.h"
+#include "tools/modelvalidationcache.h"
+#include <QThread>
+#include <QPointer>
 
 class PgModelerGuiPlugin;
 
@@ -206,6 +210,9 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Database model handle by the ModelWidget class. All operations are made over this attribute
 		DatabaseModel *db_model;
 
+		//! \brief Validation results of the model's objects reused by the validator to check only the changed objects
+		ModelValidationCache *validation_cache;
+
 		//! \brief Stores the loaded database model filename
 		QString filename,
 
@@ -280,6 +287,21 @@ class __libgui ModelWidget: public QWidget {
 		 * overlaping. This method causes the schema rectangle to be enabled. */
 		void rearrangeTablesInSchema(Schema *schema, QPointF start);
 
+		//! \brief The force-directed layout engine and the thread in which it runs (both created on demand)
+		ForceDirectedLayout *force_layout;
+
+		QThread *layout_thread;
+
+		//! \brief The table views being positioned by the force-directed layout (same order of the layout nodes)
+		QList<QPointer<BaseTableView>> layout_views;
+
+		//! \brief Moves the table views to the positions calculated by the force-directed layout
+		void applyForceLayoutPositions(const QList<QPointF> &positions);
+
+		/*! \brief Finishes the force-directed layout by resetting the relationships points
+		 * and adjusting the schemas and the scene rectangles */
+		void finishForceLayout();
+
 		void updateMagnifierArea();
 
 		/*! \brief Move the selected objects in the Z coordenate either to bottom or top.
@@ -443,6 +465,9 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Returns the operation list used by database model
 		OperationList *getOperationList();
 
+		//! \brief Returns the validation cache of the database model
+		ModelValidationCache *getValidationCache();
+
 		//! \brief Returns the currently selected list of objects
 		std::vector<BaseObject *> getSelectedObjects();
 
@@ -487,6 +512,18 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Arrange all tables it their schemas randomly (scattered)
 		void rearrangeTablesInSchemas();
 
+		/*! \brief Arrange all tables/views using a force-directed layout keeping the tables inside their schemas.
+		 * Connected tables are placed close to each other while the others are spread over the canvas.
+		 * When async is true the layout runs in a separated thread and the canvas is updated incrementally,
+		 * otherwise the method only returns when the layout is complete */
+		void rearrangeTablesForceDirected(bool async = true);
+
+		//! \brief Returns if the force-directed layout is running in background
+		bool isForceLayoutRunning();
+
+		//! \brief Cancels the force-directed layout running in background keeping the tables in their current positions
+		void cancelForceLayout();
+
 		void emitSceneInteracted();
 
 		//! \brief Toggles the protection over the model and display a message indicating the status
@@ -671,6 +708,9 @@ class __libgui ModelWidget: public QWidget {
 		void s_maginifierAreaVisible(bool);
 		void s_modelResized();
 
+		//! \brief Signal emitted when the force-directed layout finishes or is canceled
+		void s_forceLayoutFinished(bool canceled);
+
 		//! \brief Signal emitted whenever the interaction status is changes (see setInteractive)
 		void s_interactiveChanged(bool);
 
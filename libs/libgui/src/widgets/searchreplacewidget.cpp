@@ -207,7 +207,10 @@ bool SearchReplaceWidget::searchText(bool backward, bool cyclic)
 		found = searchText(search_edt->text(), regexp_tb->isChecked(), flags);
 
 		if(!found)
+		{
 			showSearchInfo(tr("No occurrences found!"));
+			emit s_textNotFound(search_edt->text());
+		}
 		else
 			showSearchInfo(tr("The search returned to the starting point!"));
 	}
@@ -67,6 +67,9 @@ class __libgui SearchReplaceWidget: public QWidget, public Ui::SearchReplaceWidg
 
 	signals:
 		void s_hideRequested();
+
+		//! \brief Signal emitted when a cyclic search finds no occurrence of the text
+		void s_textNotFound(const QString &text);
 };
 
 #endif
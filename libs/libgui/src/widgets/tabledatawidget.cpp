@@ -76,20 +76,23 @@ TableDataWidget::TableDataWidget(QWidget *parent): BaseObjectWidget(parent, Obje
 
 	connect(csv_load_tb, &QToolButton::toggled, csv_load_parent, &QWidget::setVisible);
 
-	connect(csv_load_wgt, &CsvLoadWidget::s_csvFileLoaded, this, [this](){
-		populateDataGrid(csv_load_wgt->getCsvDocument());
+	connect(csv_load_wgt, &CsvLoadWidget::s_csvFileLoadRequested, this, [this](){
+		populateDataGrid([this](const CsvParser::RowHandler &row_handler) {
+			csv_load_wgt->loadCsvFile(row_handler);
+		});
 	});
 
 	connect(paste_tb, &QToolButton::clicked, this, [this](){
-		__trycatch(
-			CsvDocument csv_doc = csv_load_wgt->loadCsvFromBuffer(qApp->clipboard()->text(),
-																														CsvDocument::Separator,
-																														CsvDocument::TextDelimiter,
-																														true);
-			populateDataGrid(csv_doc);
+		QString csv_buf = qApp->clipboard()->text();
+
+		if(populateDataGrid([&csv_buf](const CsvParser::RowHandler &row_handler) {
+				CsvLoadWidget::loadCsvFromBuffer(csv_buf, CsvDocument::Separator,
+																				 CsvDocument::TextDelimiter, true, row_handler);
+			}))
+		{
 			qApp->clipboard()->clear();
 			paste_tb->setEnabled(false);
-		)
+		}
 	});
 
 	connect(bulkedit_tb, &QToolButton::clicked, this, [this](){
@@ -335,102 +338,139 @@ void TableDataWidget::setAttributes(DatabaseModel *model, PhysicalTable *table)
 		populateDataGrid();
 }
 
-void TableDataWidget::populateDataGrid(const CsvDocument &csv_doc)
+bool TableDataWidget::populateDataGrid(const CsvLoader &load_csv)
 {
 	PhysicalTable *table = dynamic_cast<PhysicalTable *>(this->object);
 	QTableWidgetItem *item = nullptr;
-	QStringList columns, aux_cols;
+	QStringList columns;
 	QVector<int> invalid_cols;
-	Column *column = nullptr;
-	CsvDocument ini_data_csv;
+	bool header_created = false;
 
 	qApp->setOverrideCursor(Qt::WaitCursor);
 	clearRows(false);
 
-	if(!csv_doc.isEmpty())
-		ini_data_csv = csv_doc;
-	else
-	{
-		try
-		{
-			CsvParser csv_parser;
-			csv_parser.setColumnInFirstRow(true);
-			ini_data_csv = csv_parser.parseBuffer(table->getInitialData());
-		}
-		catch(Exception &e)
-		{
-			//qApp->restoreOverrideCursor();
+	//Creates the header of the grid marking the invalid columns
+	auto create_header = [&](const QStringList &col_names) {
+		QStringList aux_cols;
+		Column *column = nullptr;
+		int col = 0;
+
+		columns = col_names;
+		invalid_cols.clear();
+		data_tbw->setColumnCount(columns.size());
 
-			Messagebox msgbox;
-			msgbox.show(e,
-									tr("Failed to parse the table's initial data, check the stack trace for more detail. Do you want to dump the data into an external file in order to fix and import them back into the table?"),
-									Messagebox::Alert,
-									Messagebox::YesNoButtons);
+		for(auto &col_name : columns)
+		{
+			column = table->getColumn(col_name);
+			item = new QTableWidgetItem(col_name);
 
-			if(msgbox.isAccepted())
+			/* Marking the invalid columns. The ones which aren't present in the table
+				or were already created in a previous iteration */
+			if(!column || aux_cols.contains(col_name))
 			{
-				try
-				{
-					GuiUtilsNs::selectAndSaveFile(table->getInitialData().toUtf8(),
-															 tr("Save CSV to file..."), QFileDialog::AnyFile,
-															 {}, {"text/csv", "application/octet-stream"}, "csv");
-				}
-				catch(Exception &e)
-				{
-					//msgbox.show(e);
-					Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
-				}
+				invalid_cols.push_back(col);
+
+				if(!column)
+					item->setToolTip(tr("Unknown column"));
+				else
+					item->setToolTip(tr("Duplicated column"));
 			}
+			else
+				item->setToolTip(QString("%1 [%2]").arg(col_name).arg(~column->getType()));
+
+			aux_cols.append(col_name);
+			data_tbw->setHorizontalHeaderItem(col++, item);
 		}
-	}
 
-	/* If the initial data buffer is preset the columns
-		there have priority over the current table's columns */
-	if(!ini_data_csv.isEmpty())
-		columns = ini_data_csv.getColumnNames();
-	else
-	{
-		for(auto object : *table->getObjectList(ObjectType::Column))
-			columns.push_back(object->getName());
-	}
+		header_created = true;
+	};
+
+	/* Populating the grid with the data as the rows are parsed so the csv document
+	 * doesn't need to be entirely stored in memory. Since the column names are in the first
+	 * row of the csv data, they have priority over the current table's columns */
+	CsvParser::RowHandler add_csv_row = [&](int csv_row, const QStringList &values) {
+		if(csv_row == CsvParser::HeaderRow)
+		{
+			create_header(values);
+			return true;
+		}
+
+		if(values.size() != columns.size())
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::MalformedCsvInvalidCols)
+											.arg(columns.size()).arg(csv_row + 1).arg(values.size()),
+											ErrorCode::MalformedCsvInvalidCols, PGM_FUNC, PGM_FILE, PGM_LINE);
+		}
 
-	data_tbw->setColumnCount(columns.size());
+		int row = data_tbw->rowCount();
 
-	//Creating the header of the grid
-	int col = 0;
-	for(auto &col_name : columns)
+		addRow();
+
+		for(int col = 0; col < values.size(); col++)
+			data_tbw->item(row, col)->setText(values[col]);
+
+		return true;
+	};
+
+	try
 	{
-		column = table->getColumn(col_name);
-		item = new QTableWidgetItem(col_name);
+		if(load_csv)
+			load_csv(add_csv_row);
+		else
+		{
+			CsvParser csv_parser;
+			csv_parser.setColumnInFirstRow(true);
+			csv_parser.parseBuffer(table->getInitialData(), add_csv_row);
+		}
+	}
+	catch(Exception &e)
+	{
+		qApp->restoreOverrideCursor();
 
-		/* Marking the invalid columns. The ones which aren't present in the table
-			or were already created in a previous iteration */
-		if(!column || aux_cols.contains(col_name))
+		// Restoring the grid with the table's initial data when the loaded csv is malformed
+		if(load_csv)
 		{
-			invalid_cols.push_back(col);
+			populateDataGrid();
+			Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+			return false;
+		}
 
-			if(!column)
-				item->setToolTip(tr("Unknown column"));
-			else
-				item->setToolTip(tr("Duplicated column"));
+		clearRows(false);
+		header_created = false;
+
+		Messagebox msgbox;
+		msgbox.show(e,
+								tr("Failed to parse the table's initial data, check the stack trace for more detail. Do you want to dump the data into an external file in order to fix and import them back into the table?"),
+								Messagebox::Alert,
+								Messagebox::YesNoButtons);
+
+		if(msgbox.isAccepted())
+		{
+			try
+			{
+				GuiUtilsNs::selectAndSaveFile(table->getInitialData().toUtf8(),
+														 tr("Save CSV to file..."), QFileDialog::AnyFile,
+														 {}, {"text/csv", "application/octet-stream"}, "csv");
+			}
+			catch(Exception &e)
+			{
+				//msgbox.show(e);
+				Messagebox::error(e, PGM_FUNC, PGM_FILE, PGM_LINE);
+			}
 		}
-		else
-			item->setToolTip(QString("%1 [%2]").arg(col_name).arg(~column->getType()));
 
-		aux_cols.append(col_name);
-		data_tbw->setHorizontalHeaderItem(col++, item);
+		qApp->setOverrideCursor(Qt::WaitCursor);
 	}
 
-	//Populating the grid with the data
-	for(int row = 0; row < ini_data_csv.getRowCount(); row++)
+	// An empty csv data keeps the grid with the current table's columns
+	if(!header_created)
 	{
-		addRow();
+		QStringList col_names;
 
-		for(col = 0; col < ini_data_csv.getColumnCount(); col++)
-		{
-			//if(col < columns.size())
-			data_tbw->item(row, col)->setText(ini_data_csv.getValue(row, col));
-		}
+		for(auto object : *table->getObjectList(ObjectType::Column))
+			col_names.push_back(object->getName());
+
+		create_header(col_names);
 	}
 
 	//Disabling invalid columns avoiding the user interaction
@@ -456,6 +496,7 @@ void TableDataWidget::populateDataGrid(const CsvDocument &csv_doc)
 	configureColumnNamesMenu();
 	qApp->restoreOverrideCursor();
 
+	return true;
 }
 
 void TableDataWidget::configureColumnNamesMenu()
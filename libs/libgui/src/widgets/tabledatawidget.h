@@ -36,14 +36,20 @@ class __libgui TableDataWidget: public BaseObjectWidget, public Ui::TableDataWid
 	Q_OBJECT
 
 	private:
+		/*! \brief The type of the functions used to load the csv data into the grid.
+		 *  The function must deliver the parsed rows (including the header) to the provided handler */
+		using CsvLoader = std::function<void(const CsvParser::RowHandler &)>;
+
 		CsvLoadWidget *csv_load_wgt;
 
 		/*! \brief Stores the remaining column names not used in the grid.
 		This menu is used either to add new columns and fix invalid columns in the grid */
 		QMenu col_names_menu;
 
-		//! brief Loads the grid with the initial data of the curret table object
-		void populateDataGrid(const CsvDocument &csv_doc = CsvDocument());
+		/*! brief Loads the grid with the initial data of the curret table object or, when a loader is provided,
+		 *  with the rows delivered by it. In case of errors while loading the rows from the loader the grid is
+		 *  restored with the table's initial data and false is returned */
+		bool populateDataGrid(const CsvLoader &load_csv = nullptr);
 
 		//! brief Configures the col_name_menu with the not used columns names
 		void configureColumnNamesMenu();
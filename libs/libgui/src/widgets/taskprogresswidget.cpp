@@ -35,6 +35,14 @@ TaskProgressWidget::TaskProgressWidget(QWidget *parent, Qt::WindowFlags f) : QDi
 
 	for(auto &obj_tp : obj_types)
 		addIcon(enum_t(obj_tp), GuiUtilsNs::getIcon(obj_tp));
+
+	cancel_tb->setVisible(false);
+
+	connect(cancel_tb, &QToolButton::clicked, this, [this](){
+		cancel_tb->setEnabled(false);
+		text_lbl->setText(tr("Cancelling the task..."));
+		emit s_cancelRequested();
+	});
 }
 
 void TaskProgressWidget::addIcon(unsigned id, const QIcon &ico)
@@ -47,6 +55,12 @@ void TaskProgressWidget::setNoProgressState(bool value)
 	progress_pb->setRange(0, 0);
 }
 
+void TaskProgressWidget::setCancelEnabled(bool value)
+{
+	cancel_tb->setVisible(value);
+	cancel_tb->setEnabled(value);
+}
+
 void TaskProgressWidget::show()
 {
 	/* Using a event loop as a workaround to give a little time to task progress
@@ -46,12 +46,19 @@ class __libgui TaskProgressWidget: public QDialog, public Ui::TaskProgressWidget
 
 		void setNoProgressState(bool value);
 
+		/*! \brief Shows a button that allows the user to cancel the running task. When clicked
+		 * the signal s_cancelRequested() is emitted and the task itself is responsible to stop */
+		void setCancelEnabled(bool value);
+
 
 	public slots:
 		void show();
 		void close();
 		void updateProgress(int progress, unsigned icon_id);
 		void updateProgress(int progress, QString text, unsigned icon_id);
+
+	signals:
+		void s_cancelRequested();
 };
 
 #endif
@@ -89,6 +89,7 @@ namespace Attributes {
 	Cascade("cascade"),
 	CaseSensitive("case-sensitive"),
 	CastType("cast-type"),
+	CatalogSnapshot("catalog-snapshot"),
 	Category("category"),
 	Change("change"),
 	Changelog("changelog"),
@@ -100,6 +101,7 @@ namespace Attributes {
 	ClientEncoding("client-encoding"),
 	CloseChar("close-char"),
 	Code("code"),
+	CodeCacheSize("code-cache-size"),
 	CodeCompletion("code-completion"),
 	ColIndexes("col-indexes"),
 	ColIsIdentity("col-is-identity"),
@@ -123,6 +125,7 @@ namespace Attributes {
 	ComparisonType("comparison-type"),
 	CompletionTrigger("completion-trigger"),
 	CompositeType("composite"),
+	CompressCodeCache("compress-code-cache"),
 	Concurrent("concurrent"),
 	Condition("condition"),
 	ConfigFile("config-file"),
@@ -275,6 +278,7 @@ namespace Attributes {
 	Final("final"),
 	FinalExp("final-exp"),
 	FinalFunc("final"),
+	Fingerprint("fingerprint"),
 	FiringType("firing-type"),
 	FirstRun("first-run"),
 	FkColumn("fk-column"),
@@ -330,6 +334,7 @@ namespace Attributes {
 	HighlightedText("highlighted-text"),
 	HighlightLines("highlight-lines"),
 	HighlightOrder("highlight-order"),
+	HighlightSizeLimit("highlight-size-limit"),
 	HistoryMaxLength("history-max-length"),
 	Icon("icon"),
 	IconsSize("icons-size"),
@@ -360,6 +365,7 @@ namespace Attributes {
 	Initial("initial"),
 	InitialCond("initial-cond"),
 	InitialData("initial-data"),
+	InitialDataFormat("initial-data-format"),
 	InitialExp("initial-exp"),
 	InkSaver("inksaver"),
 	InlineFunc("inline"),
@@ -541,6 +547,7 @@ namespace Attributes {
 	Precision("precision"),
 	Predicate("predicate"),
 	Preferred("preferred"),
+	PreparedQueries("prepared-queries"),
 	PrependAtBod("prepend-at-bod"),
 	PrependSchema("prepend-schema"),
 	PrependedSql("prepended-sql"),
@@ -102,6 +102,7 @@ extern __libparsers const QString
 	Cascade,
 	CaseSensitive,
 	CastType,
+	CatalogSnapshot,
 	Category,
 	Change,
 	Changelog,
@@ -113,6 +114,7 @@ extern __libparsers const QString
 	ClientEncoding,
 	CloseChar,
 	Code,
+	CodeCacheSize,
 	CodeCompletion,
 	ColIndexes,
 	ColIsIdentity,
@@ -136,6 +138,7 @@ extern __libparsers const QString
 	ComparisonType,
 	CompletionTrigger,
 	CompositeType,
+	CompressCodeCache,
 	Concurrent,
 	Condition,
 	ConfigFile,
@@ -288,6 +291,7 @@ extern __libparsers const QString
 	Final,
 	FinalExp,
 	FinalFunc,
+	Fingerprint,
 	FiringType,
 	FirstRun,
 	FkColumn,
@@ -343,6 +347,7 @@ extern __libparsers const QString
 	HighlightedText,
 	HighlightLines,
 	HighlightOrder,
+	HighlightSizeLimit,
 	HistoryMaxLength,
 	Icon,
 	IconsSize,
@@ -373,6 +378,7 @@ extern __libparsers const QString
 	Initial,
 	InitialCond,
 	InitialData,
+	InitialDataFormat,
 	InitialExp,
 	InkSaver,
 	InlineFunc,
@@ -554,6 +560,7 @@ extern __libparsers const QString
 	Precision,
 	Predicate,
 	Preferred,
+	PreparedQueries,
 	PrependAtBod,
 	PrependSchema,
 	PrependedSql,
@@ -22,6 +22,18 @@
 #include "csvparser.h"
 #include "utilsns.h"
 #include "exception.h"
+#include <QFile>
+#include <QtAlgorithms>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define CSV_PARSER_SSE2
+	#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+	#define CSV_PARSER_AVX2
+	#include <immintrin.h>
+#endif
 
 CsvParser::CsvParser()
 {
@@ -30,6 +42,7 @@ CsvParser::CsvParser()
 									CsvDocument::LineBreak);
 	cols_in_first_row = false;
 	curr_pos = curr_row = 0;
+	resetStreamState();
 }
 
 void CsvParser::setSpecialChars(const QChar &sep, const QChar &txt_delim, const QChar &ln_break)
@@ -48,7 +61,21 @@ CsvDocument CsvParser::parseFile(const QString &filename)
 {
 	try
 	{
-		return parseBuffer(UtilsNs::loadFile(filename));
+		if(!hasAsciiSpecialChars())
+			return parseBuffer(UtilsNs::loadFile(filename));
+
+		CsvDocument csv_doc(separator, text_delim, line_break);
+
+		parseFile(filename, [&csv_doc](int row, const QStringList &values) {
+			if(row == HeaderRow)
+				csv_doc.setColumns(values);
+			else
+				csv_doc.addRow(values);
+
+			return true;
+		});
+
+		return csv_doc;
 	}
 	catch(Exception &e)
 	{
@@ -63,6 +90,24 @@ CsvDocument CsvParser::parseBuffer(const QString &csv_buf)
 
 	try
 	{
+		if(hasAsciiSpecialChars())
+		{
+			CsvDocument csv_doc(separator, text_delim, line_break);
+
+			parseBuffer(csv_buf, [&csv_doc](int row, const QStringList &values) {
+				if(row == HeaderRow)
+					csv_doc.setColumns(values);
+				else
+					csv_doc.addRow(values);
+
+				return true;
+			});
+
+			return csv_doc;
+		}
+
+		/* Special chars out of the ASCII range can't be searched byte per byte in UTF-8 data
+		 * so in that case the document is parsed char by char in its UTF-16 form */
 		QString win_line_break = QString("%1%2").arg(QChar(QChar::CarriageReturn)).arg(QChar(QChar::LineFeed)),
 						mac_line_break = QString("%1").arg(QChar(QChar::CarriageReturn));
 
@@ -196,3 +241,346 @@ QStringList CsvParser::extractRow()
 
 	return values;
 }
+
+bool CsvParser::hasAsciiSpecialChars()
+{
+	return separator.unicode() < 0x80 && text_delim.unicode() < 0x80 && line_break.unicode() < 0x80;
+}
+
+const char *CsvParser::findSpecialChar(const char *pos, const char *end, const char spec_chrs[4])
+{
+#ifdef CSV_PARSER_AVX2
+	const __m256i chr0 = _mm256_set1_epi8(spec_chrs[0]), chr1 = _mm256_set1_epi8(spec_chrs[1]),
+			chr2 = _mm256_set1_epi8(spec_chrs[2]), chr3 = _mm256_set1_epi8(spec_chrs[3]);
+
+	while(end - pos >= 32)
+	{
+		__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+		__m256i cmp = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, chr0), _mm256_cmpeq_epi8(block, chr1)),
+																	_mm256_or_si256(_mm256_cmpeq_epi8(block, chr2), _mm256_cmpeq_epi8(block, chr3)));
+		unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(cmp));
+
+		if(mask != 0)
+			return pos + qCountTrailingZeroBits(mask);
+
+		pos += 32;
+	}
+#endif
+
+#ifdef CSV_PARSER_SSE2
+	const __m128i chr0_128 = _mm_set1_epi8(spec_chrs[0]), chr1_128 = _mm_set1_epi8(spec_chrs[1]),
+			chr2_128 = _mm_set1_epi8(spec_chrs[2]), chr3_128 = _mm_set1_epi8(spec_chrs[3]);
+
+	while(end - pos >= 16)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+		__m128i cmp = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, chr0_128), _mm_cmpeq_epi8(block, chr1_128)),
+															 _mm_or_si128(_mm_cmpeq_epi8(block, chr2_128), _mm_cmpeq_epi8(block, chr3_128)));
+		unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(cmp));
+
+		if(mask != 0)
+			return pos + qCountTrailingZeroBits(mask);
+
+		pos += 16;
+	}
+#endif
+
+	// Scalar search for the remaining bytes (or the whole range when no SIMD instruction set is available)
+	while(pos < end)
+	{
+		if(*pos == spec_chrs[0] || *pos == spec_chrs[1] ||
+			 *pos == spec_chrs[2] || *pos == spec_chrs[3])
+			return pos;
+
+		pos++;
+	}
+
+	return end;
+}
+
+void CsvParser::resetStreamState()
+{
+	value_buf.clear();
+	row_values.clear();
+	delim_open = delim_closed = skip_lf = false;
+	delim_cnt = 0;
+	curr_pos = curr_row = 0;
+}
+
+void CsvParser::flushDelimiters()
+{
+	if(!delim_open || delim_cnt == 0)
+		return;
+
+	/* Same rules as in extractValue(): an odd amount of contiguous delimiters closes
+	 * the quoted value and each pair of delimiters is translated to a single one */
+	if(delim_cnt % 2 != 0)
+		delim_closed = true;
+
+	value_buf.append(delim_cnt / 2, text_delim.toLatin1());
+	delim_cnt = 0;
+}
+
+bool CsvParser::finishValue(bool end_row, const RowHandler &row_handler)
+{
+	row_values.append(QString::fromUtf8(value_buf));
+	value_buf.clear();
+	delim_open = delim_closed = false;
+	delim_cnt = 0;
+
+	if(!end_row)
+		return true;
+
+	int row = curr_row - (cols_in_first_row ? 1 : 0);
+	bool proceed = true;
+
+	curr_row++;
+	proceed = row_handler(row, row_values);
+	row_values.clear();
+
+	return proceed;
+}
+
+bool CsvParser::feedData(const char *data, qint64 size, const RowHandler &row_handler)
+{
+	const char *pos = data, *end = data + size, *spec_pos = nullptr;
+	const char sep_chr = separator.toLatin1(), delim_chr = text_delim.toLatin1(),
+			lnbreak_chr = line_break.toLatin1(),
+			spec_chrs[4] = { sep_chr, delim_chr, lnbreak_chr, '\r' };
+	char chr = 0;
+
+	while(pos < end)
+	{
+		// Ignoring the line feed of a Windows line break (\r\n) in which the carriage return was already handled
+		if(skip_lf)
+		{
+			skip_lf = false;
+
+			if(*pos == '\n')
+			{
+				pos++;
+				continue;
+			}
+		}
+
+		spec_pos = findSpecialChar(pos, end, spec_chrs);
+
+		// Copying at once all the ordinary bytes before the next special char
+		if(spec_pos > pos)
+		{
+			flushDelimiters();
+			value_buf.append(pos, spec_pos - pos);
+		}
+
+		if(spec_pos == end)
+			break;
+
+		chr = *spec_pos;
+		pos = spec_pos + 1;
+
+		// Carriage returns (Mac and Windows line breaks) are handled as the configured line break char
+		if(chr == '\r')
+		{
+			chr = lnbreak_chr;
+			skip_lf = true;
+		}
+
+		if(chr == delim_chr)
+		{
+			/* A starting text delimiter opens a quoted value, in which separators and line breaks are
+			 * part of the value, the subsequent ones are counted to be handled by flushDelimiters() */
+			if(!delim_open)
+				delim_open = true;
+			else
+				delim_cnt++;
+
+			continue;
+		}
+
+		flushDelimiters();
+
+		// Separators and line breaks outside a quoted value finish the value being extracted
+		if(!delim_open || delim_closed)
+		{
+			if(!finishValue(chr == lnbreak_chr, row_handler))
+				return false;
+		}
+		else
+			value_buf.append(chr);
+	}
+
+	return true;
+}
+
+void CsvParser::finishData(const RowHandler &row_handler)
+{
+	// The last row in a document without an ending line break is delivered as if it had one
+	if(!value_buf.isEmpty() || !row_values.isEmpty() || delim_open)
+	{
+		flushDelimiters();
+
+		if(!delim_open || delim_closed)
+			finishValue(true, row_handler);
+	}
+
+	if(delim_open && !delim_closed)
+	{
+		throw Exception(Exception::getErrorMessage(ErrorCode::MalformedCsvMissingDelim).arg(text_delim).arg(curr_row + 1),
+										ErrorCode::MalformedCsvMissingDelim, PGM_FUNC, PGM_FILE, PGM_LINE);
+	}
+}
+
+int CsvParser::getParsedRowCount()
+{
+	if(cols_in_first_row && curr_row > 0)
+		return curr_row - 1;
+
+	return curr_row;
+}
+
+int CsvParser::deliverRows(const CsvDocument &csv_doc, const RowHandler &row_handler)
+{
+	if(!csv_doc.getColumnNames().isEmpty() && !row_handler(HeaderRow, csv_doc.getColumnNames()))
+		return 0;
+
+	for(int row = 0; row < csv_doc.getRowCount(); row++)
+	{
+		if(!row_handler(row, csv_doc.rows.at(row)))
+			return row + 1;
+	}
+
+	return csv_doc.getRowCount();
+}
+
+int CsvParser::parseBuffer(const QString &csv_buf, const RowHandler &row_handler)
+{
+	try
+	{
+		resetStreamState();
+
+		if(csv_buf.isEmpty())
+			return 0;
+
+		if(!hasAsciiSpecialChars())
+			return deliverRows(parseBuffer(csv_buf), row_handler);
+
+		QStringView buf_view(csv_buf);
+		QByteArray chunk;
+		qsizetype pos = 0, len = 0;
+		bool proceed = true;
+
+		while(proceed && pos < buf_view.size())
+		{
+			len = qMin(BufferChunkSize, buf_view.size() - pos);
+
+			// A surrogate pair can't be split between two chunks otherwise the char is lost in the conversion
+			if(pos + len < buf_view.size() && buf_view.at(pos + len - 1).isHighSurrogate())
+				len--;
+
+			chunk = buf_view.mid(pos, len).toUtf8();
+			proceed = feedData(chunk.constData(), chunk.size(), row_handler);
+			pos += len;
+		}
+
+		if(proceed)
+			finishData(row_handler);
+
+		return getParsedRowCount();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+int CsvParser::parseData(const char *data, qint64 size, const RowHandler &row_handler)
+{
+	try
+	{
+		resetStreamState();
+
+		if(!data || size <= 0)
+			return 0;
+
+		if(!hasAsciiSpecialChars())
+			return deliverRows(parseBuffer(QString::fromUtf8(data, size)), row_handler);
+
+		if(feedData(data, size, row_handler))
+			finishData(row_handler);
+
+		return getParsedRowCount();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+int CsvParser::parseDevice(QIODevice &device, const RowHandler &row_handler)
+{
+	try
+	{
+		if(!hasAsciiSpecialChars())
+		{
+			QByteArray data = device.readAll();
+			return parseData(data.constData(), data.size(), row_handler);
+		}
+
+		QByteArray chunk;
+		bool proceed = true;
+
+		resetStreamState();
+
+		while(proceed && !device.atEnd())
+		{
+			chunk = device.read(ChunkSize);
+
+			if(chunk.isEmpty())
+				break;
+
+			proceed = feedData(chunk.constData(), chunk.size(), row_handler);
+		}
+
+		if(proceed)
+			finishData(row_handler);
+
+		return getParsedRowCount();
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
+
+int CsvParser::parseFile(const QString &filename, const RowHandler &row_handler)
+{
+	try
+	{
+		QFile input(filename);
+		uchar *data = nullptr;
+		int row_cnt = 0;
+
+		if(!input.open(QFile::ReadOnly))
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+											ErrorCode::FileDirectoryNotAccessed, PGM_FUNC, PGM_FILE, PGM_LINE,
+											nullptr, input.errorString());
+		}
+
+		if(input.size() > 0)
+			data = input.map(0, input.size());
+
+		// Files that can't be mapped into memory (e.g. special files) are read in chunks
+		if(!data)
+			return parseDevice(input, row_handler);
+
+		row_cnt = parseData(reinterpret_cast<const char *>(data), input.size(), row_handler);
+		input.unmap(data);
+
+		return row_cnt;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(), PGM_FUNC,PGM_FILE,PGM_LINE, &e);
+	}
+}
@@ -23,6 +23,8 @@
 \ingroup libparsers
 \class CsvParser
 \brief This class implements basic operations to parse CSV documents based upon RFC 4180 (https://www.rfc-editor.org/rfc/rfc4180)
+\note Large documents should be parsed with the methods that accept a RowHandler. Those work directly on UTF-8
+bytes and deliver one row at a time instead of materializing a CsvDocument.
 */
 
 #ifndef CSV_PARSER_H
@@ -30,9 +32,21 @@
 
 #include <QString>
 #include <QList>
+#include <QIODevice>
+#include <functional>
 #include "csvdocument.h"
 
 class __libparsers CsvParser {
+	public:
+		/*! \brief The row index passed to the row handlers when the delivered row
+		 *  holds the column names (see setColumnInFirstRow()) */
+		static constexpr int HeaderRow = -1;
+
+		/*! \brief The type of the functions that receive the rows extracted by the streaming methods.
+		 *  The first argument is the index of the data row (or HeaderRow) and the second one the row's values.
+		 *  The handler must return true to continue the parsing or false to stop it */
+		using RowHandler = std::function<bool(int, const QStringList &)>;
+
 	private:
 		//! \brief Indicates the character used as values separator
 		QChar separator,
@@ -55,12 +69,73 @@ class __libparsers CsvParser {
 		//! \brief Indicates the current row in which the parser is in.
 		curr_row;
 
+		//! \brief The amount of bytes read at once from devices by parseDevice()
+		static constexpr qint64 ChunkSize = 1048576;
+
+		/*! \brief The amount of chars of a string buffer converted to UTF-8 at once by parseBuffer(),
+		 *  this avoids creating a full UTF-8 copy of large buffers */
+		static constexpr qsizetype BufferChunkSize = 262144;
+
+		/*! \brief Stores the (UTF-8) bytes of the value being extracted by the streaming parser.
+		 *  The streaming state is kept in attributes so the data can be fed in chunks (see feedData()) */
+		QByteArray value_buf;
+
+		//! \brief Stores the values of the row being extracted by the streaming parser
+		QStringList row_values;
+
+		//! \brief Indicates that a quoted value was opened in the value being extracted by the streaming parser
+		bool delim_open,
+
+		//! \brief Indicates that a quoted value was closed in the value being extracted by the streaming parser
+		delim_closed,
+
+		/*! \brief Indicates that the last char fed to the streaming parser was a carriage return
+		 *  so a line feed at the start of the next chunk must be ignored (Windows line breaks) */
+		skip_lf;
+
+		//! \brief The amount of contiguous text delimiters found in a quoted value by the streaming parser
+		int delim_cnt;
+
 		//! \brief Extract and returns a single value from a row in the buffer
 		QString extractValue();
 
 		//! \brief Extract and returns a list of values that defines a single row in the buffer
 		QStringList extractRow();
 
+		//! \brief Returns true when the separator, text delimiter and line break are all ASCII chars
+		bool hasAsciiSpecialChars();
+
+		/*! \brief Returns the position of the first byte in the range [pos, end) that is equal to one of the
+		 *  four chars in spec_chrs or end if none is found. The search is done in blocks of 32 (AVX2) or
+		 *  16 (SSE2) bytes when the instruction sets are available in the build, falling back to a byte per
+		 *  byte search otherwise */
+		static const char *findSpecialChar(const char *pos, const char *end, const char spec_chrs[4]);
+
+		//! \brief Resets the state of the streaming parser
+		void resetStreamState();
+
+		//! \brief Handles the text delimiters found so far in a quoted value (see extractValue())
+		void flushDelimiters();
+
+		/*! \brief Finishes the value being extracted by the streaming parser and, if end_row is true,
+		 *  delivers the extracted row to the handler. Returns the handler's result */
+		bool finishValue(bool end_row, const RowHandler &row_handler);
+
+		/*! \brief Parses a chunk of UTF-8 encoded data keeping the state of incomplete rows so the next chunk
+		 *  continues from where this one stopped. Returns false if the row handler requested to stop */
+		bool feedData(const char *data, qint64 size, const RowHandler &row_handler);
+
+		/*! \brief Finishes the streaming parsing delivering the last row (when it has no ending line break)
+		 *  and raising an error if a quoted value was not closed */
+		void finishData(const RowHandler &row_handler);
+
+		//! \brief Returns the number of data rows (excluding the header) delivered by the streaming parser
+		int getParsedRowCount();
+
+		/*! \brief Delivers the column names and rows of a parsed document to the handler. Used when the
+		 *  special chars are out of the ASCII range and the data can't be parsed by the streaming methods */
+		int deliverRows(const CsvDocument &csv_doc, const RowHandler &row_handler);
+
 	public:
 		CsvParser();
 
@@ -73,6 +148,23 @@ class __libparsers CsvParser {
 
 		//! \brief Parses a CSV document defined in a string buffer
 		CsvDocument parseBuffer(const QString &csv_buf);
+
+		/*! \brief Parses an UTF-8 encoded CSV file delivering each row to the handler without storing the
+		 *  whole document in memory. The file is memory-mapped when possible, otherwise it is read in chunks.
+		 *  Returns the number of data rows delivered to the handler */
+		int parseFile(const QString &filename, const RowHandler &row_handler);
+
+		/*! \brief Parses a CSV document defined in a string buffer delivering each row to the handler.
+		 *  The buffer is converted to UTF-8 in chunks. Returns the number of data rows delivered to the handler */
+		int parseBuffer(const QString &csv_buf, const RowHandler &row_handler);
+
+		/*! \brief Parses the UTF-8 encoded CSV data read from the device (in chunks) delivering each row
+		 *  to the handler. Returns the number of data rows delivered to the handler */
+		int parseDevice(QIODevice &device, const RowHandler &row_handler);
+
+		/*! \brief Parses the UTF-8 encoded CSV data in the provided memory range delivering each row
+		 *  to the handler. Returns the number of data rows delivered to the handler */
+		int parseData(const char *data, qint64 size, const RowHandler &row_handler);
 };
 
 #endif
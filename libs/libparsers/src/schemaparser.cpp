@@ -22,6 +22,7 @@
 #include "schemaparser.h"
 #include "attributes.h"
 #include "utilsns.h"
+#include "tracer.h"
 #include "pgsqlversions.h"
 #include "globalattributes.h"
 
@@ -30,6 +31,9 @@ const QRegularExpression SchemaParser::AttribRegExp {
 	QRegularExpression::CaseInsensitiveOption
 };
 
+std::map<QString, SchemaParser::CachedFile> SchemaParser::files_cache;
+QMutex SchemaParser::files_cache_mtx;
+
 const QChar SchemaParser::CharComment {'#'};
 const QChar SchemaParser::CharLineEnd {'\n'};
 const QChar SchemaParser::CharSpace {' '};
@@ -286,7 +290,7 @@ bool SchemaParser::parseInclude(const QString &include_ln, QString &src_buf, qin
 	try
 	{
 		// Load the code of the included file
-		QString incl_buf = UtilsNs::loadFile(fi.absoluteFilePath());
+		QString incl_buf = loadCachedFile(fi.absoluteFilePath());
 
 		/* Appending a line feed char to the loaded include file to avoid
 		 * errors when the loaded include is followed by another @include */
@@ -327,6 +331,26 @@ bool SchemaParser::parseInclude(const QString &include_ln, QString &src_buf, qin
 	}
 }
 
+QString SchemaParser::loadCachedFile(const QString &filename)
+{
+	QFileInfo fi(filename);
+	QString path = fi.absoluteFilePath();
+	QDateTime last_modified = fi.lastModified();
+	QMutexLocker locker(&files_cache_mtx);
+	auto itr = files_cache.find(path);
+
+	if(itr != files_cache.end() &&
+		 itr->second.last_modified == last_modified &&
+		 itr->second.size == fi.size())
+		return itr->second.contents;
+
+	// The file is read while the lock is held so concurrent parsers don't read the same file twice
+	CachedFile cached_file { last_modified, fi.size(), QString(UtilsNs::loadFile(path)) };
+	files_cache[path] = cached_file;
+
+	return cached_file.contents;
+}
+
 void SchemaParser::loadFile(const QString &filename)
 {
 	if(filename.isEmpty())
@@ -334,7 +358,7 @@ void SchemaParser::loadFile(const QString &filename)
 
 	try
 	{
-		QString buf(UtilsNs::loadFile(filename));
+		QString buf(loadCachedFile(filename));
 		setSearchPath(QFileInfo(filename).absolutePath());
 		loadBuffer(buf);
 		SchemaParser::filename = filename;
@@ -1198,6 +1222,8 @@ QString SchemaParser::convertMetaOrEscaped(const QString &token, bool is_escaped
 
 QString SchemaParser::getSourceCode(const QString & obj_name, attribs_map &attribs, CodeType def_type)
 {
+	PGM_TRACE_SCOPE("parser", "SchemaParser::getSourceCode");
+
 	try
 	{
 		QString filename;
@@ -35,9 +35,31 @@
 #include "attribsmap.h"
 #include "exception.h"
 #include <QRegularExpression>
+#include <QDateTime>
+#include <QMutex>
+#include <map>
 
 class __libparsers SchemaParser {
 	private:
+		//! \brief Stores the contents of a schema file and the file info used to detect changes on it
+		struct CachedFile {
+			QDateTime last_modified;
+			qint64 size {0};
+			QString contents;
+		};
+
+		/*! \brief Stores the contents of the schema files loaded so far (indexed by the absolute path).
+		 *  Schema files are read each time an object's code is generated, so keeping them in memory
+		 *  avoids reading and decoding the same files thousands of times in a single process */
+		static std::map<QString, CachedFile> files_cache;
+
+		//! \brief Serializes the access to the files cache since several parsers can run in parallel
+		static QMutex files_cache_mtx;
+
+		/*! \brief Returns the contents of the provided file using the files cache.
+		 *  The file is read again only if it changed (modification date or size) since the last load */
+		static QString loadCachedFile(const QString &filename);
+
 		struct IncludeInfo {
 			QString include_file;
 			int start_line {-1},
@@ -22,6 +22,7 @@
 #include "exception.h"
 #include <QTranslator>
 #include "customuistyle.h"
+#include "tracer.h"
 
 void logMessage(QtMsgType type, const QMessageLogContext &context, const QString &msg)
 {
@@ -51,6 +52,20 @@ Application::Application(int &argc, char **argv) : QApplication(argc,argv)
 	 * via CustomUiStyle so additional UI effects can be applied */
 	if(!arguments().contains(GlobalAttributes::UiStyleOption))
 		setStyle(new CustomUiStyle(GlobalAttributes::DefaultQtStyle));
+
+	Tracer::startFromEnvironment();
+}
+
+Application::~Application()
+{
+	try
+	{
+		Tracer::stop();
+	}
+	catch(Exception &e)
+	{
+		qWarning().noquote() << e.getExceptionsText();
+	}
 }
 
 void Application::loadTranslation(const QString &lang_id, const QString &directory)
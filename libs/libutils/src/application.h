@@ -60,6 +60,9 @@ class __libutils Application: public QApplication {
 	public:
 		Application(int & argc, char ** argv);
 
+		//! \brief Saves the recorded trace events, if tracing is enabled (see Tracer)
+		virtual ~Application();
+
 		//! \brief Loads both UI translations and addition translations provided by plugins (incl_plugins_tr = true)
 		void loadTranslations(const QString &lang_id, bool incl_plugins_tr);
 
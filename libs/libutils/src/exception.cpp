@@ -293,6 +293,9 @@ QString Exception::messages[Exception::ErrorCount][2]={
 	{"InvExprPersistentGroup", QT_TR_NOOP("The group `%1' has been declared as persistent but contains initial and/or final expression(s)! Persistent groups must not declare initial or final expressions.")},
 	{"InvExtensionObject", QT_TR_NOOP("Invalid child object being assigned to extension `%1'!")},
 	{"AsgInvSchemaExtension", QT_TR_NOOP("Assigning the schema `%1' to extension `%2' is not allowed because the schema is a child of the extension!")},
+	{"InvImageTileDimensions", QT_TR_NOOP("The image tile being written to file `%1' has dimensions incompatible with the output image!")},
+	{"InvConnRecordingFile", QT_TR_NOOP("The file `%1' is not a valid connection recording or was created by an incompatible version!")},
+	{"ConnRecordingResultNotFound", QT_TR_NOOP("The command below has no recorded result in the connection recording being replayed! Make sure the recording was captured running the same operation against database `%1'.\n\n%2")},
 };
 
 Exception::Exception()
@@ -317,12 +317,15 @@ enum class ErrorCode: unsigned {
 	InvExprMultilineGroup,
 	InvExprPersistentGroup,
 	InvExtensionObject,
-	AsgInvSchemaExtension
+	AsgInvSchemaExtension,
+	InvImageTileDimensions,
+	InvConnRecordingFile,
+	ConnRecordingResultNotFound
 };
 
 class __libutils Exception {
 	private:
-		static constexpr unsigned ErrorCount=271;
+		static constexpr unsigned ErrorCount=274;
 
 		//! \brief Constants used to access the error details
 		static constexpr unsigned ErrorCodeId=0, ErrorMessage=1;
@@ -0,0 +1,131 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "tracer.h"
+#include "exception.h"
+#include <QFile>
+#include <QTextStream>
+#include <QCoreApplication>
+
+const QString Tracer::TraceEnvVar {"PGMODELER_TRACE"};
+
+std::atomic<bool> Tracer::enabled { false };
+std::atomic<unsigned> Tracer::thread_seq { 0 };
+QMutex Tracer::mutex;
+QElapsedTimer Tracer::clock;
+QString Tracer::output_file;
+std::vector<Tracer::TraceEvent> Tracer::events;
+
+unsigned Tracer::getThreadId()
+{
+	static thread_local unsigned thread_id = ++thread_seq;
+	return thread_id;
+}
+
+void Tracer::addEvent(const TraceEvent &event)
+{
+	QMutexLocker locker(&mutex);
+	events.push_back(event);
+}
+
+void Tracer::start(const QString &filename)
+{
+	QMutexLocker locker(&mutex);
+
+	if(filename.isEmpty())
+		return;
+
+	events.clear();
+	events.reserve(65536);
+	output_file = filename;
+	clock.start();
+	enabled.store(true);
+}
+
+void Tracer::startFromEnvironment()
+{
+	QString filename = qEnvironmentVariable(TraceEnvVar.toStdString().c_str());
+
+	if(!filename.isEmpty() && !isEnabled())
+		start(filename);
+}
+
+void Tracer::stop()
+{
+	QMutexLocker locker(&mutex);
+
+	if(!enabled.load())
+		return;
+
+	enabled.store(false);
+
+	QFile file(output_file);
+	qint64 pid = QCoreApplication::applicationPid();
+
+	if(!file.open(QFile::WriteOnly | QFile::Truncate))
+	{
+		events.clear();
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output_file),
+										ErrorCode::FileDirectoryNotWritten, PGM_FUNC, PGM_FILE, PGM_LINE, nullptr, file.errorString());
+	}
+
+	QTextStream out(&file);
+
+	/* Writing the events in the Chrome trace event format (JSON object form).
+	 * Timestamps and durations are expressed in microseconds */
+	out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+	for(auto itr = events.begin(); itr != events.end(); itr++)
+	{
+		out << "{\"ph\":\"" << itr->phase << "\",\"cat\":\"" << itr->category
+				<< "\",\"name\":\"" << itr->name << "\",\"pid\":" << pid
+				<< ",\"tid\":" << itr->thread_id
+				<< ",\"ts\":" << QString::number(itr->start / 1000.0, 'f', 3);
+
+		if(itr->phase == 'X')
+			out << ",\"dur\":" << QString::number(itr->duration / 1000.0, 'f', 3);
+		else
+			out << ",\"args\":{\"value\":" << QString::number(itr->value, 'g', 15) << "}";
+
+		out << (std::next(itr) == events.end() ? "}\n" : "},\n");
+	}
+
+	out << "]}\n";
+	out.flush();
+	file.close();
+	events.clear();
+	events.shrink_to_fit();
+}
+
+qint64 Tracer::getTimestamp()
+{
+	return clock.nsecsElapsed();
+}
+
+void Tracer::addScope(const char *category, const char *name, qint64 start, qint64 duration)
+{
+	addEvent(TraceEvent { 'X', category, name, getThreadId(), start, duration, 0 });
+}
+
+void Tracer::addCounter(const char *category, const char *name, double value)
+{
+	addEvent(TraceEvent { 'C', category, name, getThreadId(), getTimestamp(), 0, value });
+}
@@ -0,0 +1,150 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class Tracer
+\brief Implements a low overhead tracing facility that records timed scopes and counters of the
+application's hot paths and saves them as a Chrome trace event JSON file, which can be opened in
+chrome://tracing or in the Perfetto UI (ui.perfetto.dev).
+
+The tracing is always compiled in but disabled by default. While disabled, each instrumented
+scope costs a single atomic flag check. It is enabled by setting the environment variable
+PGMODELER_TRACE to the path of the output file (see Application) or, in the CLI, via the --trace option.
+The instrumentation is done with the macros PGM_TRACE_SCOPE and PGM_TRACE_COUNTER.
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include "utilsglobal.h"
+#include <QString>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <atomic>
+#include <vector>
+
+class __libutils Tracer {
+	private:
+		//! \brief Stores a single recorded event
+		struct TraceEvent {
+			//! \brief Indicates the event kind: 'X' (complete event) or 'C' (counter)
+			char phase;
+
+			const char *category, *name;
+
+			//! \brief Identifier of the thread that generated the event
+			unsigned thread_id;
+
+			//! \brief Start time and duration of the event (in nanoseconds)
+			qint64 start, duration;
+
+			//! \brief The counter value (only for counter events)
+			double value;
+		};
+
+		//! \brief Indicates if the events are being recorded
+		static std::atomic<bool> enabled;
+
+		//! \brief Sequence used to assign a small identifier to each thread that records events
+		static std::atomic<unsigned> thread_seq;
+
+		static QMutex mutex;
+
+		//! \brief The clock that provides the events timestamps
+		static QElapsedTimer clock;
+
+		//! \brief The file where the trace is saved when calling stop()
+		static QString output_file;
+
+		static std::vector<TraceEvent> events;
+
+		//! \brief Returns the identifier of the current thread
+		static unsigned getThreadId();
+
+		static void addEvent(const TraceEvent &event);
+
+	public:
+		//! \brief Environment variable that enables tracing (its value is the output file)
+		static const QString TraceEnvVar;
+
+		Tracer() = delete;
+
+		//! \brief Starts recording events. The recorded events are saved in the provided file when stop() is called
+		static void start(const QString &filename);
+
+		//! \brief Starts recording events in case the environment variable PGMODELER_TRACE is set
+		static void startFromEnvironment();
+
+		/*! \brief Stops recording events and writes them to the output file. In case of any failure
+		 *  while writing the file an exception is raised */
+		static void stop();
+
+		static inline bool isEnabled()
+		{
+			return enabled.load(std::memory_order_relaxed);
+		}
+
+		//! \brief Returns the current timestamp (in nanoseconds) relative to the start of the tracing
+		static qint64 getTimestamp();
+
+		//! \brief Records a complete event. The category and name must be string literals
+		static void addScope(const char *category, const char *name, qint64 start, qint64 duration);
+
+		//! \brief Records a value for the counter. The category and name must be string literals
+		static void addCounter(const char *category, const char *name, double value);
+};
+
+/*! \brief Records the time spent in the enclosing scope as a complete event.
+ *  Should be used via the macro PGM_TRACE_SCOPE */
+class ScopedTrace {
+	private:
+		const char *category, *name;
+		qint64 start;
+
+	public:
+		ScopedTrace(const char *category, const char *name) : category(category), name(name)
+		{
+			start = Tracer::isEnabled() ? Tracer::getTimestamp() : -1;
+		}
+
+		~ScopedTrace()
+		{
+			if(start >= 0 && Tracer::isEnabled())
+				Tracer::addScope(category, name, start, Tracer::getTimestamp() - start);
+		}
+
+		ScopedTrace(const ScopedTrace &) = delete;
+		ScopedTrace &operator = (const ScopedTrace &) = delete;
+};
+
+#define PGM_TRACE_CONCAT_IMPL(a, b) a##b
+#define PGM_TRACE_CONCAT(a, b) PGM_TRACE_CONCAT_IMPL(a, b)
+
+//! \brief Traces the time spent in the enclosing scope. Both parameters must be string literals
+#define PGM_TRACE_SCOPE(category, name) \
+	ScopedTrace PGM_TRACE_CONCAT(pgm_trace_scope_, __LINE__)(category, name)
+
+//! \brief Records the value of a counter. Both category and name must be string literals
+#define PGM_TRACE_COUNTER(category, name, value) \
+	do { if(Tracer::isEnabled()) Tracer::addCounter(category, name, value); } while(0)
+
+#endif
@@ -30,6 +30,7 @@ class BaseObjectTest: public QObject {
     void quoteNameIfKeyword();
     void nameIsInvalidIfStartsWithNumber();
 		void dontFormatNameIfAlreadyQuoted();
+		void generateUniqueNameFromUsedNames();
 };
 
 void BaseObjectTest::quoteNameIfKeyword()
@@ -51,5 +52,20 @@ void BaseObjectTest::dontFormatNameIfAlreadyQuoted()
 	QCOMPARE(BaseObject::formatName(name), name);
 }
 
+void BaseObjectTest::generateUniqueNameFromUsedNames()
+{
+	Table tab, tab1, tab2;
+	std::vector<BaseObject *> tables = { &tab1, &tab2 };
+
+	tab.setName("table");
+	tab1.setName("table");
+	tab2.setName("table_cp");
+
+	QCOMPARE(CoreUtilsNs::generateUniqueName(&tab, QSet<QString>{}, "_cp", true), QString("table"));
+	QCOMPARE(CoreUtilsNs::generateUniqueName(&tab, QSet<QString>{ "table", "table_cp" }, "_cp", true), QString("table_cp1"));
+	QCOMPARE(CoreUtilsNs::generateUniqueName(&tab, tables, false, "_cp", true), QString("table_cp1"));
+	QCOMPARE(CoreUtilsNs::generateUniqueName(&tab1, tables, false, "_cp", true, true), QString("table"));
+}
+
 QTEST_MAIN(BaseObjectTest)
 #include "baseobjecttest.moc"
@@ -0,0 +1,119 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "catalog.h"
+
+class CatalogTest: public QObject {
+	Q_OBJECT
+
+	private slots:
+		void parameterizeRepeatedPlaceholders();
+		void parameterizeOidListsAndLiterals();
+		void rejectPlaceholdersInsideQuotedLiterals();
+		void fallbackWhenQueryCantBeParameterized();
+};
+
+void CatalogTest::parameterizeRepeatedPlaceholders()
+{
+	QString sql = "SELECT oid FROM pg_class WHERE relname = '__pgm_param1__' OR relname || '_seq' = '__pgm_param1__'";
+	QStringList param_attrs;
+
+	// All the occurrences of the same value are bound to the same parameter
+	QVERIFY(Catalog::parameterizeQuery(sql, {{ Attributes::Name, "__pgm_param1__" }}, param_attrs));
+	QCOMPARE(sql, QString("SELECT oid FROM pg_class WHERE relname = $1 OR relname || '_seq' = $1"));
+	QCOMPARE(param_attrs, QStringList({ Attributes::Name }));
+
+	sql = "SELECT oid FROM pg_class WHERE oid IN (__pgm_param1__) UNION SELECT oid FROM pg_type WHERE typrelid in ( __pgm_param1__ )";
+	QVERIFY(Catalog::parameterizeQuery(sql, {{ Attributes::FilterOids, "__pgm_param1__" }}, param_attrs));
+	QCOMPARE(sql, QString("SELECT oid FROM pg_class WHERE oid = ANY($1) UNION SELECT oid FROM pg_type WHERE typrelid = ANY($1)"));
+	QCOMPARE(param_attrs, QStringList({ Attributes::FilterOids }));
+}
+
+void CatalogTest::parameterizeOidListsAndLiterals()
+{
+	std::map<QString, QString> placeholders = {{ Attributes::Name, "__pgm_param1__" },
+																						 { Attributes::FilterOids, "__pgm_param2__" }};
+	QString sql = "SELECT oid FROM pg_class WHERE relname = '__pgm_param1__' AND oid IN (__pgm_param2__)",
+			expected = "SELECT oid FROM pg_class WHERE relname = $%1 AND oid = ANY($%2)";
+	QStringList param_attrs;
+
+	QVERIFY(Catalog::parameterizeQuery(sql, placeholders, param_attrs));
+	QCOMPARE(param_attrs.size(), 2);
+
+	// The parameters are numbered in the order their attributes are listed in param_attrs
+	QCOMPARE(sql, expected.arg(param_attrs.indexOf(Attributes::Name) + 1)
+											.arg(param_attrs.indexOf(Attributes::FilterOids) + 1));
+
+	// Placeholders not used by the query don't produce parameters
+	sql = "SELECT oid FROM pg_class WHERE relname = '__pgm_param1__'";
+	QVERIFY(Catalog::parameterizeQuery(sql, placeholders, param_attrs));
+	QCOMPARE(sql, QString("SELECT oid FROM pg_class WHERE relname = $1"));
+	QCOMPARE(param_attrs, QStringList({ Attributes::Name }));
+}
+
+void CatalogTest::rejectPlaceholdersInsideQuotedLiterals()
+{
+	QStringList param_attrs;
+	QStringList queries = {
+		// Part of a pattern
+		"SELECT oid FROM pg_class WHERE relname LIKE '%__pgm_param1__%'",
+		"SELECT oid FROM pg_class WHERE relname ~ '^(__pgm_param1__)'",
+		// Part of a longer literal
+		"SELECT oid FROM pg_class WHERE relname = 'tmp___pgm_param1__'",
+		// Escape string literals
+		"SELECT oid FROM pg_class WHERE relname = E'__pgm_param1__'",
+		// Identifiers quoted with double quotes
+		"SELECT oid FROM pg_class WHERE relname = \"__pgm_param1__\""
+	};
+
+	for(auto &qry : queries)
+	{
+		QString sql = qry;
+		QVERIFY2(!Catalog::parameterizeQuery(sql, {{ Attributes::Name, "__pgm_param1__" }}, param_attrs), qry.toStdString().c_str());
+	}
+}
+
+void CatalogTest::fallbackWhenQueryCantBeParameterized()
+{
+	std::map<QString, QString> placeholders = {{ Attributes::Name, "__pgm_param1__" },
+																						 { Attributes::FilterOids, "__pgm_param2__" }};
+	QStringList param_attrs;
+
+	/* Oid lists are only accepted in IN (...) clauses and a single value used in an unsupported
+	 * way makes the whole query run in the usual way, even if the other values could be parameterized */
+	QString sql = "SELECT oid FROM pg_class WHERE relname = '__pgm_param1__' AND oid = __pgm_param2__";
+	QVERIFY(!Catalog::parameterizeQuery(sql, placeholders, param_attrs));
+
+	sql = "SELECT oid FROM pg_class WHERE relname = '__pgm_param1__' AND oid IN (__pgm_param2__, 0)";
+	QVERIFY(!Catalog::parameterizeQuery(sql, placeholders, param_attrs));
+
+	sql = "SELECT oid FROM pg_class WHERE oid IN (__pgm_param2__) AND relname = __pgm_param1__::name";
+	QVERIFY(!Catalog::parameterizeQuery(sql, placeholders, param_attrs));
+
+	// Once the values are used as expected the same query shape can be parameterized
+	sql = "SELECT oid FROM pg_class WHERE relname = '__pgm_param1__' AND oid IN (__pgm_param2__)";
+	QVERIFY(Catalog::parameterizeQuery(sql, placeholders, param_attrs));
+	QVERIFY(!sql.contains("__pgm_param"));
+}
+
+QTEST_MAIN(CatalogTest)
+#include "catalogtest.moc"
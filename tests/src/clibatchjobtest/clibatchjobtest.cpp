@@ -0,0 +1,173 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "pgmodelercliapp.h"
+#include "exception.h"
+
+class CliBatchJobTest: public QObject {
+	Q_OBJECT
+
+	private:
+		//! \brief Reads the job file returning the ids and the arguments of the jobs in it
+		QList<QPair<QString, QStringList>> readJobFile(const QString &filename);
+
+	private slots:
+		void parseJobFile();
+		void skipEmptyAndCommentLines();
+		void raiseErrorOnInvalidJson();
+		void raiseErrorOnMissingArgs();
+		void raiseErrorOnNonStringArgs();
+};
+
+QList<QPair<QString, QStringList>> CliBatchJobTest::readJobFile(const QString &filename)
+{
+	QList<QPair<QString, QStringList>> jobs;
+	QFile file(filename);
+	QTextStream in;
+	QString line, job_id;
+	QStringList args;
+	unsigned line_num = 0;
+
+	if(!file.open(QFile::ReadOnly | QFile::Text))
+		return jobs;
+
+	in.setDevice(&file);
+
+	while(in.readLineInto(&line))
+	{
+		line_num++;
+		job_id = QString("job-%1").arg(jobs.size() + 1);
+
+		if(PgModelerCliApp::parseBatchJob(line, line_num, job_id, args))
+			jobs.append({ job_id, args });
+	}
+
+	return jobs;
+}
+
+void CliBatchJobTest::parseJobFile()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("jobs.jsonl");
+	QFile file(filename);
+	QList<QPair<QString, QStringList>> jobs;
+
+	QVERIFY(file.open(QFile::WriteOnly | QFile::Text));
+	file.write("# Exports the same model in two formats\n"
+						 "{\"id\": \"sql\", \"args\": [\"--export-to-file\", \"--input\", \"model.dbm\", \"--output\", \"model.sql\"]}\n"
+						 "\n"
+						 "   {\"args\": [\"--export-to-png\", \"-if\", \"model.dbm\", \"-o\", \"model.png\"]}   \n"
+						 "{\"id\": 42, \"args\": [\"--list-conns\"]}\n");
+	file.close();
+
+	try
+	{
+		jobs = readJobFile(filename);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	QVERIFY(jobs.size() == 3);
+
+	QCOMPARE(jobs[0].first, QString("sql"));
+	QCOMPARE(jobs[0].second, QStringList({ "--export-to-file", "--input", "model.dbm", "--output", "model.sql" }));
+
+	// Jobs without id keep the default one provided by the caller
+	QCOMPARE(jobs[1].first, QString("job-2"));
+	QCOMPARE(jobs[1].second, QStringList({ "--export-to-png", "-if", "model.dbm", "-o", "model.png" }));
+
+	// Non-string ids are converted to string
+	QCOMPARE(jobs[2].first, QString("42"));
+	QCOMPARE(jobs[2].second, QStringList({ "--list-conns" }));
+}
+
+void CliBatchJobTest::skipEmptyAndCommentLines()
+{
+	QString job_id = "default";
+	QStringList args;
+
+	QVERIFY(!PgModelerCliApp::parseBatchJob("", 1, job_id, args));
+	QVERIFY(!PgModelerCliApp::parseBatchJob("   \t", 2, job_id, args));
+	QVERIFY(!PgModelerCliApp::parseBatchJob("  # {\"args\": [\"--list-conns\"]}", 3, job_id, args));
+	QCOMPARE(job_id, QString("default"));
+	QVERIFY(args.isEmpty());
+}
+
+void CliBatchJobTest::raiseErrorOnInvalidJson()
+{
+	QString job_id;
+	QStringList args;
+
+	for(auto &line : { QString("{\"args\": [\"--list-conns\"]"), QString("[\"--list-conns\"]") })
+	{
+		try
+		{
+			PgModelerCliApp::parseBatchJob(line, 7, job_id, args);
+			QFAIL("No error raised for an invalid job definition!");
+		}
+		catch(Exception &e)
+		{
+			QVERIFY(e.getErrorMessage().contains("line 7"));
+		}
+	}
+}
+
+void CliBatchJobTest::raiseErrorOnMissingArgs()
+{
+	QString job_id;
+	QStringList args;
+
+	for(auto &line : { QString("{\"id\": \"empty\"}"), QString("{\"id\": \"empty\", \"args\": []}") })
+	{
+		try
+		{
+			PgModelerCliApp::parseBatchJob(line, 1, job_id, args);
+			QFAIL("No error raised for a job without arguments!");
+		}
+		catch(Exception &e)
+		{
+			QVERIFY(e.getErrorCode() == ErrorCode::Custom);
+		}
+	}
+}
+
+void CliBatchJobTest::raiseErrorOnNonStringArgs()
+{
+	QString job_id;
+	QStringList args;
+
+	try
+	{
+		PgModelerCliApp::parseBatchJob("{\"args\": [\"--zoom\", 2]}", 1, job_id, args);
+		QFAIL("No error raised for a non-string argument!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::Custom);
+	}
+}
+
+QTEST_MAIN(CliBatchJobTest)
+#include "clibatchjobtest.moc"
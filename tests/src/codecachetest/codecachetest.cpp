@@ -0,0 +1,192 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "table.h"
+#include "schema.h"
+#include "pgmodelerunittest.h"
+
+class CodeCacheTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		CodeCacheTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void init();
+		void cleanup();
+		void evictLeastRecentlyUsedEntriesWhenBudgetExceeded();
+		void restoreCompressedEntriesOnAccess();
+		void regenerateCodeAfterEviction();
+		void discardEntriesOnInvalidationAndDestruction();
+		void keepCompressionWalkBoundedOverBudget();
+};
+
+void CodeCacheTest::init()
+{
+	CodeCache::clear();
+	CodeCache::resetStatistics();
+	CodeCache::setCompressColdEntries(false);
+	CodeCache::setBudget(0);
+}
+
+void CodeCacheTest::cleanup()
+{
+	init();
+	CodeCache::setBudget(static_cast<qint64>(CodeCache::DefaultBudgetMb) * 1024 * 1024);
+}
+
+void CodeCacheTest::evictLeastRecentlyUsedEntriesWhenBudgetExceeded()
+{
+	Table tab1, tab2, tab3;
+	QString code(1000, 'a');
+	CodeCache::Statistics stats;
+
+	CodeCache::insert(&tab1, CodeCache::SqlCode, code);
+	CodeCache::insert(&tab2, CodeCache::SqlCode, code);
+
+	stats = CodeCache::getStatistics();
+	QVERIFY(stats.entries == 2);
+
+	// Budget for two entries only, so inserting a third one evicts the least recently used
+	CodeCache::setBudget(stats.used_bytes);
+
+	// Accessing tab1 makes tab2 the least recently used entry
+	QCOMPARE(CodeCache::get(&tab1, CodeCache::SqlCode), code);
+	CodeCache::insert(&tab3, CodeCache::SqlCode, code);
+
+	QCOMPARE(CodeCache::get(&tab1, CodeCache::SqlCode), code);
+	QCOMPARE(CodeCache::get(&tab3, CodeCache::SqlCode), code);
+	QVERIFY(CodeCache::get(&tab2, CodeCache::SqlCode).isEmpty());
+
+	stats = CodeCache::getStatistics();
+	QVERIFY(stats.entries == 2);
+	QVERIFY(stats.evictions == 1);
+	QVERIFY(stats.hits == 3);
+	QVERIFY(stats.misses == 1);
+	QVERIFY(stats.used_bytes <= stats.budget);
+}
+
+void CodeCacheTest::restoreCompressedEntriesOnAccess()
+{
+	Table tab1, tab2;
+	QString code = QString("CREATE TABLE public.sample (id integer);\n").repeated(100);
+	CodeCache::Statistics stats;
+
+	CodeCache::setCompressColdEntries(true);
+	CodeCache::insert(&tab1, CodeCache::XmlCode, code);
+
+	// Budget that fits a single plain entry, the cold one must be compressed instead of evicted
+	CodeCache::setBudget(CodeCache::getStatistics().used_bytes + 1024);
+	CodeCache::insert(&tab2, CodeCache::XmlCode, code);
+
+	stats = CodeCache::getStatistics();
+	QVERIFY(stats.entries == 2);
+	QVERIFY(stats.compressions == 1);
+	QVERIFY(stats.evictions == 0);
+
+	QCOMPARE(CodeCache::get(&tab1, CodeCache::XmlCode), code);
+	QCOMPARE(CodeCache::get(&tab2, CodeCache::XmlCode), code);
+}
+
+void CodeCacheTest::regenerateCodeAfterEviction()
+{
+	Schema schema;
+	Table tab;
+	QString code;
+
+	try
+	{
+		schema.setName("public");
+		tab.setName("sample");
+		tab.setSchema(&schema);
+
+		code = tab.getSourceCode(SchemaParser::SqlCode);
+		QCOMPARE(CodeCache::get(&tab, CodeCache::SqlCode), code);
+
+		// Evicting everything must not affect the code returned by the object
+		CodeCache::clear();
+		QCOMPARE(tab.getSourceCode(SchemaParser::SqlCode), code);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CodeCacheTest::discardEntriesOnInvalidationAndDestruction()
+{
+	Table *tab = new Table;
+
+	CodeCache::insert(tab, CodeCache::SqlCode, "sql");
+	CodeCache::insert(tab, CodeCache::XmlCode, "xml");
+	CodeCache::insert(tab, CodeCache::ReducedXmlCode, "reduced");
+	tab->setCodeInvalidated(false);
+	tab->setCodeInvalidated(true);
+	QVERIFY(CodeCache::getStatistics().entries == 0);
+
+	CodeCache::insert(tab, CodeCache::SqlCode, "sql");
+	delete tab;
+	QVERIFY(CodeCache::getStatistics().entries == 0);
+	QVERIFY(CodeCache::getStatistics().used_bytes == 0);
+}
+
+void CodeCacheTest::keepCompressionWalkBoundedOverBudget()
+{
+	std::vector<std::unique_ptr<Table>> tables;
+	QString code = QString("CREATE TABLE public.sample (id integer);\n").repeated(100);
+	CodeCache::Statistics stats;
+	unsigned long long scanned = 0;
+	const unsigned tab_count = 3000;
+
+	for(unsigned i = 0; i < tab_count; i++)
+		tables.push_back(std::make_unique<Table>());
+
+	// Budget that fits a few plain entries, so most of the entries are held compressed
+	CodeCache::setCompressColdEntries(true);
+	CodeCache::insert(tables[0].get(), CodeCache::SqlCode, code);
+	CodeCache::setBudget(CodeCache::getStatistics().used_bytes * 10);
+
+	for(unsigned i = 1; i < tab_count / 2; i++)
+		CodeCache::insert(tables[i].get(), CodeCache::SqlCode, code);
+
+	stats = CodeCache::getStatistics();
+	QVERIFY(stats.evictions > 0);
+	QVERIFY(stats.compressions > 0);
+	scanned = stats.scanned;
+
+	/* Once the cache is over budget each insertion compresses the previous entry and evicts the
+	 * least recently used compressed ones, the already compressed entries must not be walked again */
+	for(unsigned i = tab_count / 2; i < tab_count; i++)
+		CodeCache::insert(tables[i].get(), CodeCache::SqlCode, code);
+
+	stats = CodeCache::getStatistics();
+	QVERIFY(stats.scanned - scanned <= 2 * (tab_count / 2));
+	QVERIFY(stats.used_bytes <= stats.budget);
+	QCOMPARE(CodeCache::get(tables[tab_count - 1].get(), CodeCache::SqlCode), code);
+	QCOMPARE(CodeCache::get(tables[tab_count - 2].get(), CodeCache::SqlCode), code);
+
+	tables.clear();
+	QVERIFY(CodeCache::getStatistics().entries == 0);
+}
+
+QTEST_MAIN(CodeCacheTest)
+#include "codecachetest.moc"
@@ -0,0 +1,291 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "connection.h"
+#include "exception.h"
+
+class ConnectionRecorderTest: public QObject {
+	Q_OBJECT
+
+	private:
+		static const QString DbName;
+
+		//! \brief Creates a tuples result with two columns (oid, name) and the provided names
+		PGresult *createTuplesResult(const QStringList &names);
+
+		//! \brief Records the tuples results and a failed command saving them into the provided file
+		void createRecording(const QString &filename);
+
+		Connection createConnection();
+
+	private slots:
+		void replayRecordedTuplesAndErrors();
+		void replayRepeatedCommandsInRecordedOrder();
+		void raiseErrorOnMissingCommand();
+		void injectLatencyInRoundTrips();
+		void raiseErrorOnInvalidRecordingFile();
+};
+
+const QString ConnectionRecorderTest::DbName {"bench_db"};
+
+PGresult *ConnectionRecorderTest::createTuplesResult(const QStringList &names)
+{
+	PGresult *result = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+	PGresAttDesc attribs[2] = {
+		{ const_cast<char *>("oid"), 0, 0, 0, 26, -1, -1 },
+		{ const_cast<char *>("name"), 0, 0, 0, 19, -1, -1 }
+	};
+	QByteArray value;
+
+	PQsetResultAttrs(result, 2, attribs);
+
+	for(int tup = 0; tup < names.size(); tup++)
+	{
+		value = QByteArray::number(1000 + tup);
+		PQsetvalue(result, tup, 0, value.data(), value.size());
+
+		// Empty names are recorded as null values
+		if(names[tup].isEmpty())
+			PQsetvalue(result, tup, 1, nullptr, -1);
+		else
+		{
+			value = names[tup].toUtf8();
+			PQsetvalue(result, tup, 1, value.data(), value.size());
+		}
+	}
+
+	return result;
+}
+
+void ConnectionRecorderTest::createRecording(const QString &filename)
+{
+	PGresult *result = nullptr;
+
+	ConnectionRecorder::startRecording(filename);
+	ConnectionRecorder::recordServerVersion(170002);
+
+	result = createTuplesResult({ "public", "", "schema_a" });
+	ConnectionRecorder::recordResult(DbName, "SELECT oid, nspname AS name FROM pg_namespace", result, "");
+	PQclear(result);
+
+	result = createTuplesResult({ "first" });
+	ConnectionRecorder::recordResult(DbName, "SELECT 'seq'", result, "");
+	PQclear(result);
+
+	result = createTuplesResult({ "second" });
+	ConnectionRecorder::recordResult(DbName, "SELECT 'seq'", result, "");
+	PQclear(result);
+
+	result = PQmakeEmptyPGresult(nullptr, PGRES_FATAL_ERROR);
+	ConnectionRecorder::recordResult(DbName, "DROP TABLE foo", result, "ERROR:  table \"foo\" does not exist");
+	PQclear(result);
+
+	ConnectionRecorder::stop();
+}
+
+Connection ConnectionRecorderTest::createConnection()
+{
+	Connection conn;
+
+	conn.setConnectionParam(Connection::ParamServerFqdn, "localhost");
+	conn.setConnectionParam(Connection::ParamDbName, DbName);
+
+	return conn;
+}
+
+void ConnectionRecorderTest::replayRecordedTuplesAndErrors()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("catalog.pgmrec");
+
+	try
+	{
+		Connection conn = createConnection();
+		ResultSet res;
+
+		createRecording(filename);
+		QVERIFY(QFileInfo(filename).size() > 0);
+
+		ConnectionRecorder::startReplay(filename);
+		conn.connect();
+
+		QVERIFY(conn.isStablished());
+		QCOMPARE(conn.getPgSQLVersion(), QString("17.2"));
+
+		conn.executeDMLCommand("SELECT oid, nspname AS name FROM pg_namespace", res);
+
+		QCOMPARE(res.getTupleCount(), 3);
+		QCOMPARE(res.getColumnNames(), QStringList({ "oid", "name" }));
+		QVERIFY(res.getColumnTypeId(0) == 26);
+
+		res.accessTuple(ResultSet::FirstTuple);
+		QCOMPARE(QString(res.getColumnValue("oid")), QString("1000"));
+		QCOMPARE(QString(res.getColumnValue("name")), QString("public"));
+
+		res.accessTuple(ResultSet::NextTuple);
+		QVERIFY(res.isColumnValueNull("name"));
+
+		res.accessTuple(ResultSet::NextTuple);
+		QCOMPARE(QString(res.getColumnValue("name")), QString("schema_a"));
+
+		try
+		{
+			conn.executeDDLCommand("DROP TABLE foo");
+			QFAIL("The recorded error was not raised!");
+		}
+		catch(Exception &e)
+		{
+			QVERIFY(e.getErrorCode() == ErrorCode::SQLCommandNotExecuted);
+			QVERIFY(e.getErrorMessage().contains("does not exist"));
+		}
+
+		conn.close();
+		ConnectionRecorder::stop();
+	}
+	catch(Exception &e)
+	{
+		ConnectionRecorder::stop();
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ConnectionRecorderTest::replayRepeatedCommandsInRecordedOrder()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("sequence.pgmrec");
+
+	try
+	{
+		Connection conn = createConnection();
+		QStringList values;
+
+		createRecording(filename);
+		ConnectionRecorder::startReplay(filename);
+		conn.connect();
+
+		// The last recorded result is repeated once the sequence is exhausted
+		for(int i = 0; i < 3; i++)
+		{
+			ResultSet res;
+			conn.executeDMLCommand("SELECT 'seq'", res);
+			res.accessTuple(ResultSet::FirstTuple);
+			values.append(res.getColumnValue("name"));
+		}
+
+		QCOMPARE(values, QStringList({ "first", "second", "second" }));
+		QVERIFY(ConnectionRecorder::getStatistics().round_trips == 3);
+		QVERIFY(ConnectionRecorder::getStatistics().replayed == 3);
+
+		ConnectionRecorder::stop();
+	}
+	catch(Exception &e)
+	{
+		ConnectionRecorder::stop();
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ConnectionRecorderTest::raiseErrorOnMissingCommand()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("missing.pgmrec");
+	Connection conn = createConnection();
+	ResultSet res;
+
+	createRecording(filename);
+	ConnectionRecorder::startReplay(filename);
+	conn.connect();
+
+	try
+	{
+		conn.executeDMLCommand("SELECT * FROM pg_class", res);
+		ConnectionRecorder::stop();
+		QFAIL("No error raised for a command not present in the recording!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::ConnRecordingResultNotFound);
+		QVERIFY(ConnectionRecorder::getStatistics().misses == 1);
+	}
+
+	ConnectionRecorder::stop();
+}
+
+void ConnectionRecorderTest::injectLatencyInRoundTrips()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("latency.pgmrec");
+
+	try
+	{
+		Connection conn = createConnection();
+		QElapsedTimer timer;
+
+		createRecording(filename);
+		ConnectionRecorder::startReplay(filename, 20000);
+		conn.connect();
+
+		timer.start();
+
+		for(int i = 0; i < 5; i++)
+		{
+			ResultSet res;
+			conn.executeDMLCommand("SELECT 'seq'", res);
+		}
+
+		QVERIFY(timer.elapsed() >= 100);
+		QVERIFY(ConnectionRecorder::getStatistics().injected_latency == 100000);
+
+		ConnectionRecorder::stop();
+	}
+	catch(Exception &e)
+	{
+		ConnectionRecorder::stop();
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ConnectionRecorderTest::raiseErrorOnInvalidRecordingFile()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("invalid.pgmrec");
+	QFile file(filename);
+
+	QVERIFY(file.open(QFile::WriteOnly));
+	file.write("this is not a recording");
+	file.close();
+
+	try
+	{
+		ConnectionRecorder::startReplay(filename);
+		QFAIL("No error raised for an invalid recording file!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::InvConnRecordingFile);
+		QVERIFY(!ConnectionRecorder::isReplaying());
+	}
+}
+
+QTEST_MAIN(ConnectionRecorderTest)
+#include "connectionrecordertest.moc"
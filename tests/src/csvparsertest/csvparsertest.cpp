@@ -20,6 +20,7 @@
 */
 
 #include <QtTest/QtTest>
+#include <QBuffer>
 #include "csvparser.h"
 #include "utilsns.h"
 #include "exception.h"
@@ -40,6 +41,10 @@ class CsvParserTest: public QObject {
 		void testTwoRowsWithQuotesInValues();
 		void testSaveParsedDocumentToFile();
 		void testRaiseExceptionOnMissingCloseDelim();
+		void testStreamRowsFromDataWithHeader();
+		void testStreamRowsFromDeviceInChunks();
+		void testStopStreamingWhenHandlerReturnsFalse();
+		void testStreamRowsFromBufferInChunks();
 };
 
 void CsvParserTest::testColumnsInFirstRowAndOneRowUnquotedWithoutLastBreak()
@@ -338,5 +343,135 @@ void CsvParserTest::testSaveParsedDocumentToFile()
 	}
 }
 
+void CsvParserTest::testStreamRowsFromDataWithHeader()
+{
+	try
+	{
+		CsvParser csvparser;
+		QByteArray buffer = "col_1;col_2;\"col_3\"\r\n"
+												"value 1;\"value \"\"2\"\"\";\"value\n3\"\r\n"
+												"value 4;;\"válue 6\"";
+		QStringList cols;
+		QList<QStringList> rows;
+		int row_cnt = 0;
+
+		csvparser.setSpecialChars(';', '"','\n');
+		csvparser.setColumnInFirstRow(true);
+		row_cnt = csvparser.parseData(buffer.constData(), buffer.size(), [&](int row, const QStringList &values) {
+			if(row == CsvParser::HeaderRow)
+				cols = values;
+			else
+				rows.append(values);
+
+			return true;
+		});
+
+		QCOMPARE(row_cnt, 2);
+		QCOMPARE(cols, QStringList({ "col_1", "col_2", "col_3" }));
+		QCOMPARE(rows.size(), 2);
+		QCOMPARE(rows[0], QStringList({ "value 1", "value \"2\"", "value\n3" }));
+		QCOMPARE(rows[1], QStringList({ "value 4", "", "válue 6" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvParserTest::testStreamRowsFromDeviceInChunks()
+{
+	try
+	{
+		CsvParser csvparser;
+		QByteArray data;
+		QBuffer device(&data);
+		QString value;
+		int row_cnt = 0, mismatches = 0;
+
+		/* Generating a document larger than the chunks read from the device
+		 * so quoted values and line breaks are split between two chunks */
+		for(int row = 0; row < 50000; row++)
+		{
+			value = QString("row %1 \"quoted\"; with separator").arg(row);
+			data.append(QString("%1;\"%2\";%3\r\n").arg(row).arg(value.replace("\"", "\"\"")).arg(row * 2).toUtf8());
+		}
+
+		device.open(QIODevice::ReadOnly);
+
+		row_cnt = csvparser.parseDevice(device, [&](int row, const QStringList &values) {
+			if(values.size() != 3 || values[0].toInt() != row ||
+				 values[1] != QString("row %1 \"quoted\"; with separator").arg(row) ||
+				 values[2].toInt() != row * 2)
+				mismatches++;
+
+			return true;
+		});
+
+		QCOMPARE(row_cnt, 50000);
+		QCOMPARE(mismatches, 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvParserTest::testStopStreamingWhenHandlerReturnsFalse()
+{
+	try
+	{
+		CsvParser csvparser;
+		QByteArray buffer = "1;a\n2;b\n3;c\n4;d\n";
+		int last_row = -1, row_cnt = 0;
+
+		row_cnt = csvparser.parseData(buffer.constData(), buffer.size(), [&](int row, const QStringList &) {
+			last_row = row;
+			return row < 1;
+		});
+
+		QCOMPARE(last_row, 1);
+		QCOMPARE(row_cnt, 2);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CsvParserTest::testStreamRowsFromBufferInChunks()
+{
+	try
+	{
+		CsvParser csvparser;
+		QString buffer, long_value(262143, 'a');
+		QList<QStringList> rows;
+		int row_cnt = 0;
+
+		/* The first value ends with a surrogate pair placed exactly at the boundary
+		 * of the first converted chunk, the remaining rows span several chunks */
+		long_value.append(QString::fromUtf8("😀"));
+		buffer.append(QString("\"%1\";1\n").arg(long_value));
+
+		for(int row = 1; row < 30000; row++)
+			buffer.append(QString("válue %1 😀;\"%2\"\r\n").arg(row).arg(row));
+
+		csvparser.setSpecialChars(';', '"','\n');
+		row_cnt = csvparser.parseBuffer(buffer, [&](int, const QStringList &values) {
+			rows.append(values);
+			return true;
+		});
+
+		QCOMPARE(row_cnt, 30000);
+		QCOMPARE(rows.size(), 30000);
+		QCOMPARE(rows[0], QStringList({ long_value, "1" }));
+		QCOMPARE(rows[1], QStringList({ QString::fromUtf8("válue 1 😀"), "1" }));
+		QCOMPARE(rows.last(), QStringList({ QString::fromUtf8("válue 29999 😀"), "29999" }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(CsvParserTest)
 #include "csvparsertest.moc"
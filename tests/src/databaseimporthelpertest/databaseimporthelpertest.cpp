@@ -0,0 +1,314 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "tools/databaseimporthelper.h"
+#include "pgmodelerunittest.h"
+
+class DatabaseImportHelperTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		DatabaseImportHelperTest() : PgModelerUnitTest(SCHEMASDIR) {}
+
+	private:
+		using SnapshotMap = std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>>;
+
+		static constexpr unsigned DbOid = 16384;
+
+		SnapshotMap createSnapshot();
+
+		//! \brief Creates a table with integer columns having the first one as primary key
+		Table *createTable(Schema *schema, const QString &name, const QStringList &col_names);
+
+		//! \brief Creates a foreign key in the table referencing the primary key of the ref_table
+		void createForeignKey(Table *table, const QString &col_name, Table *ref_table);
+
+		/*! \brief Creates the model of a previous import holding the tables customers, orders (referencing customers)
+		 * and items together with the catalog snapshot of the import (see createModelSnapshot()) */
+		void createImportedModel(DatabaseModel &model);
+
+		//! \brief Returns the snapshot of the model created by createImportedModel()
+		SnapshotMap createModelSnapshot();
+
+		//! \brief Returns the fingerprints of all the objects in the snapshot
+		std::map<unsigned, QString> getFingerprints(const SnapshotMap &snapshot);
+
+		//! \brief Returns the oids selected by the import of the model created by createImportedModel()
+		std::map<ObjectType, std::vector<unsigned>> getSelectedOids(const std::map<unsigned, QString> &fingerprints);
+
+	private slots:
+		void diffUnchangedCatalogSnapshot();
+		void diffChangedCatalogSnapshot();
+		void removeDroppedTableWithForeignKeys();
+		void reimportChangedTableIntoModel();
+};
+
+DatabaseImportHelperTest::SnapshotMap DatabaseImportHelperTest::createSnapshot()
+{
+	return {
+		{ 16385, std::make_tuple(ObjectType::Schema, QString("public"), QString(), QString("a1")) },
+		{ 16390, std::make_tuple(ObjectType::Table, QString("public.table_a"), QString(), QString("b2")) },
+		{ 16391, std::make_tuple(ObjectType::Constraint, QString("table_a_pk"), QString("public.table_a"), QString("c3")) },
+		{ 16400, std::make_tuple(ObjectType::View, QString("public.view_a"), QString(), QString("d4")) }
+	};
+}
+
+void DatabaseImportHelperTest::diffUnchangedCatalogSnapshot()
+{
+	SnapshotMap snapshot = createSnapshot();
+	std::map<unsigned, QString> fingerprints;
+	std::vector<unsigned> changed_oids = { 1 }, dropped_oids = { 2 }, added_oids = { 3 };
+
+	for(auto &[oid, entry] : snapshot)
+		fingerprints[oid] = std::get<DatabaseModel::SnapFingerprint>(entry);
+
+	// Nothing changed in the database since the snapshot was captured so nothing is imported again
+	DatabaseImportHelper::diffCatalogSnapshot(snapshot, fingerprints, changed_oids, dropped_oids, added_oids);
+
+	QVERIFY(changed_oids.empty());
+	QVERIFY(dropped_oids.empty());
+	QVERIFY(added_oids.empty());
+}
+
+void DatabaseImportHelperTest::diffChangedCatalogSnapshot()
+{
+	SnapshotMap snapshot = createSnapshot();
+	std::map<unsigned, QString> fingerprints = {
+		{ 16385, "a1" },
+		{ 16390, "b2-changed" },
+		{ 16391, "c3" },
+		{ 16410, "e5" }
+	};
+	std::vector<unsigned> changed_oids, dropped_oids, added_oids;
+
+	DatabaseImportHelper::diffCatalogSnapshot(snapshot, fingerprints, changed_oids, dropped_oids, added_oids);
+
+	QVERIFY(changed_oids == std::vector<unsigned>({ 16390 }));
+	QVERIFY(dropped_oids == std::vector<unsigned>({ 16400 }));
+	QVERIFY(added_oids == std::vector<unsigned>({ 16410 }));
+}
+
+Table *DatabaseImportHelperTest::createTable(Schema *schema, const QString &name, const QStringList &col_names)
+{
+	Table *table = new Table;
+	Constraint *pk = new Constraint;
+	Column *col = nullptr;
+
+	table->setName(name);
+	table->setSchema(schema);
+
+	for(auto &col_name : col_names)
+	{
+		col = new Column;
+		col->setName(col_name);
+		col->setType(PgSqlType("integer"));
+		table->addColumn(col);
+	}
+
+	pk->setName(name + "_pk");
+	pk->setConstraintType(ConstraintType::PrimaryKey);
+	pk->addColumn(table->getColumn(col_names.at(0)), Constraint::SourceCols);
+	table->addConstraint(pk);
+
+	return table;
+}
+
+void DatabaseImportHelperTest::createForeignKey(Table *table, const QString &col_name, Table *ref_table)
+{
+	Constraint *fk = new Constraint;
+
+	fk->setName(QString("%1_%2_fk").arg(table->getName(), ref_table->getName()));
+	fk->setConstraintType(ConstraintType::ForeignKey);
+	fk->setReferencedTable(ref_table);
+	fk->addColumn(table->getColumn(col_name), Constraint::SourceCols);
+	fk->addColumn(ref_table->getPrimaryKey()->getColumn(0, Constraint::SourceCols), Constraint::ReferencedCols);
+	table->addConstraint(fk);
+}
+
+void DatabaseImportHelperTest::createImportedModel(DatabaseModel &model)
+{
+	Schema *public_sch = nullptr;
+	Table *customers = nullptr, *orders = nullptr;
+
+	model.createSystemObjects(true);
+	public_sch = dynamic_cast<Schema *>(model.getObject("public", ObjectType::Schema));
+
+	customers = createTable(public_sch, "customers", { "id" });
+	model.addTable(customers);
+
+	orders = createTable(public_sch, "orders", { "id", "customer_id" });
+	createForeignKey(orders, "customer_id", customers);
+	model.addTable(orders);
+
+	model.addTable(createTable(public_sch, "items", { "id" }));
+	model.updateTableFKRelationships(orders);
+	model.setCatalogSnapshot(DbOid, createModelSnapshot());
+}
+
+DatabaseImportHelperTest::SnapshotMap DatabaseImportHelperTest::createModelSnapshot()
+{
+	return {
+		{ 2200, std::make_tuple(ObjectType::Schema, QString("public"), QString(), QString("s1")) },
+		{ 16390, std::make_tuple(ObjectType::Table, QString("public.customers"), QString(), QString("t1")) },
+		{ 16391, std::make_tuple(ObjectType::Constraint, QString("customers_pk"), QString("public.customers"), QString("c1")) },
+		{ 16400, std::make_tuple(ObjectType::Table, QString("public.orders"), QString(), QString("t2")) },
+		{ 16401, std::make_tuple(ObjectType::Constraint, QString("orders_pk"), QString("public.orders"), QString("c2")) },
+		{ 16402, std::make_tuple(ObjectType::Constraint, QString("orders_customers_fk"), QString("public.orders"), QString("c3")) },
+		{ 16410, std::make_tuple(ObjectType::Table, QString("public.items"), QString(), QString("t3")) },
+		{ 16411, std::make_tuple(ObjectType::Constraint, QString("items_pk"), QString("public.items"), QString("c4")) }
+	};
+}
+
+std::map<unsigned, QString> DatabaseImportHelperTest::getFingerprints(const SnapshotMap &snapshot)
+{
+	std::map<unsigned, QString> fingerprints;
+
+	for(auto &[oid, entry] : snapshot)
+		fingerprints[oid] = std::get<DatabaseModel::SnapFingerprint>(entry);
+
+	return fingerprints;
+}
+
+std::map<ObjectType, std::vector<unsigned>> DatabaseImportHelperTest::getSelectedOids(const std::map<unsigned, QString> &fingerprints)
+{
+	std::map<ObjectType, std::vector<unsigned>> obj_oids;
+	SnapshotMap snapshot = createModelSnapshot();
+
+	// Only the objects that still exist in the database are selected
+	for(auto &[oid, fingerprint] : fingerprints)
+		obj_oids[std::get<DatabaseModel::SnapObjectType>(snapshot.at(oid))].push_back(oid);
+
+	return obj_oids;
+}
+
+void DatabaseImportHelperTest::removeDroppedTableWithForeignKeys()
+{
+	DatabaseModel model;
+	DatabaseImportHelper import_hlp;
+
+	try
+	{
+		std::map<unsigned, QString> fingerprints;
+		Table *orders = nullptr, *items = nullptr;
+
+		createImportedModel(model);
+		orders = model.getTable("public.orders");
+		items = model.getTable("public.items");
+
+		QVERIFY(model.getRelationship(orders, model.getTable("public.customers")) != nullptr);
+
+		// The table customers was dropped in cascade mode so the foreign key in orders is gone too
+		fingerprints = getFingerprints(createModelSnapshot());
+		fingerprints.erase(16390);
+		fingerprints.erase(16391);
+		fingerprints.erase(16402);
+
+		import_hlp.setImportOptions(false, false, true, false, false, false, true, false, true);
+		import_hlp.setIncrementalImport(true);
+		import_hlp.setSelectedOIDs(&model, getSelectedOids(fingerprints), {});
+		import_hlp.selectOutdatedObjects(DbOid, fingerprints);
+
+		// None of the remaining objects changed so nothing is imported again
+		QVERIFY(import_hlp.getSelectedOIDs().empty());
+
+		import_hlp.removeOutdatedObjects();
+
+		QVERIFY(model.getTable("public.customers") == nullptr);
+		QVERIFY(model.getObjectList(ObjectType::BaseRelationship)->empty());
+
+		// The tables that still exist are preserved, only losing the foreign key
+		QVERIFY(model.getTable("public.orders") == orders);
+		QVERIFY(model.getTable("public.items") == items);
+		QVERIFY(orders->getConstraint("orders_customers_fk") == nullptr);
+		QVERIFY(orders->getConstraint("orders_pk") != nullptr);
+		QVERIFY(orders->getColumnCount() == 2);
+		QVERIFY(items->getConstraint("items_pk") != nullptr);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseImportHelperTest::reimportChangedTableIntoModel()
+{
+	DatabaseModel model;
+	DatabaseImportHelper import_hlp;
+
+	try
+	{
+		std::map<unsigned, QString> fingerprints;
+		std::vector<unsigned> selected_oids;
+		Table *customers = nullptr, *items = nullptr, *orders = nullptr;
+		Column *col = nullptr;
+		BaseRelationship *fk_rel = nullptr;
+
+		createImportedModel(model);
+		customers = model.getTable("public.customers");
+		items = model.getTable("public.items");
+
+		// A column was added to orders in the database
+		fingerprints = getFingerprints(createModelSnapshot());
+		fingerprints[16400] = "t2-changed";
+
+		import_hlp.setImportOptions(false, false, true, false, false, false, true, false, true);
+		import_hlp.setIncrementalImport(true);
+		import_hlp.setSelectedOIDs(&model, getSelectedOids(fingerprints), {});
+		import_hlp.selectOutdatedObjects(DbOid, fingerprints);
+
+		// The changed table is imported again together with its constraints
+		selected_oids = import_hlp.getSelectedOIDs();
+		QVERIFY(selected_oids == std::vector<unsigned>({ 16400, 16401, 16402 }));
+
+		import_hlp.removeOutdatedObjects();
+
+		QVERIFY(model.getTable("public.orders") == nullptr);
+		QVERIFY(model.getObjectList(ObjectType::BaseRelationship)->empty());
+		QVERIFY(model.getTable("public.customers") == customers);
+		QVERIFY(model.getTable("public.items") == items);
+
+		/* Importing the new version of the table the same way the import does (creating the table
+		 * and then updating the fk relationships) so it gets merged with the preserved objects */
+		orders = createTable(dynamic_cast<Schema *>(model.getObject("public", ObjectType::Schema)),
+												 "orders", { "id", "customer_id", "shipped_at" });
+		createForeignKey(orders, "customer_id", customers);
+		model.addTable(orders);
+		model.updateTableFKRelationships(orders);
+
+		col = orders->getColumn("shipped_at");
+		fk_rel = model.getRelationship(orders, customers);
+
+		QVERIFY(model.getObjectList(ObjectType::Table)->size() == 3);
+		QVERIFY(col != nullptr);
+		QVERIFY(orders->getConstraint("orders_customers_fk")->getReferencedTable() == customers);
+		QVERIFY(fk_rel != nullptr);
+		QVERIFY(fk_rel->getTable(BaseRelationship::DstTable) == customers);
+		QVERIFY(customers->getPrimaryKey() != nullptr);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(DatabaseImportHelperTest)
+#include "databaseimporthelpertest.moc"
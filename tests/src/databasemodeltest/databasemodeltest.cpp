@@ -33,6 +33,11 @@ class DatabaseModelTest: public QObject, public PgModelerUnitTest {
 		void saveObjectsMetadata();
 		void loadObjectsMetadata();
 		void saveSplitSQLDefinition();
+		void indexPermissionsByObject();
+		void indexRelationshipsAndSchemaChildren();
+		void generateInitialDataCommands();
+		void saveLoadCatalogSnapshot();
+		void cloneTableRemappingReferences();
 };
 
 void DatabaseModelTest::saveObjectsMetadata()
@@ -104,5 +109,330 @@ void DatabaseModelTest::saveSplitSQLDefinition()
 	}
 }
 
+void DatabaseModelTest::indexPermissionsByObject()
+{
+	DatabaseModel dbmodel;
+	Table *table = nullptr, *table_aux = nullptr;
+	Role *role = nullptr, *role_aux = nullptr;
+	Permission *perm = nullptr, *perm_dup = nullptr, *perm_rev = nullptr, *perm_aux = nullptr;
+	std::vector<Permission *> perms;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		for(auto *tab : { &table, &table_aux })
+		{
+			*tab = new Table;
+			(*tab)->setName(tab == &table ? "table" : "table_aux");
+			(*tab)->setSchema(dbmodel.getSchema("public"));
+			dbmodel.addTable(*tab);
+		}
+
+		for(auto *rl : { &role, &role_aux })
+		{
+			*rl = new Role;
+			(*rl)->setName(rl == &role ? "role" : "role_aux");
+			dbmodel.addRole(*rl);
+		}
+
+		perm = new Permission(table);
+		perm->addRole(role);
+		perm->addRole(role_aux);
+		perm->setPrivilege(Permission::PrivSelect, true, false);
+		dbmodel.addPermission(perm);
+
+		// A permission sharing a role with an existing one on the same object is a duplicate
+		perm_dup = new Permission(table);
+		perm_dup->addRole(role_aux);
+		perm_dup->setPrivilege(Permission::PrivInsert, true, false);
+
+		try
+		{
+			dbmodel.addPermission(perm_dup);
+			QFAIL("Expected exception not thrown!");
+		}
+		catch(Exception &e)
+		{
+			QVERIFY(e.getErrorCode() == ErrorCode::AsgDuplicatedPermission);
+		}
+
+		QCOMPARE(dbmodel.getPermissionIndex(perm_dup, false), 0);
+		QCOMPARE(dbmodel.getPermissionIndex(perm_dup, true), -1);
+		delete perm_dup;
+
+		// Revoking privileges and applying them on another object is allowed
+		perm_rev = new Permission(table);
+		perm_rev->addRole(role);
+		perm_rev->setPrivilege(Permission::PrivSelect, true, false);
+		perm_rev->setRevoke(true);
+		dbmodel.addPermission(perm_rev);
+
+		perm_aux = new Permission(table_aux);
+		perm_aux->addRole(role);
+		perm_aux->setPrivilege(Permission::PrivSelect, true, false);
+		dbmodel.addPermission(perm_aux);
+
+		dbmodel.getPermissions(table, perms);
+		QCOMPARE(perms, std::vector<Permission *>({ perm, perm_rev }));
+		QCOMPARE(dbmodel.getPermissionIndex(perm_aux, false), 2);
+
+		dbmodel.removePermission(perm);
+		dbmodel.getPermissions(table, perms);
+		QCOMPARE(perms, std::vector<Permission *>({ perm_rev }));
+		QCOMPARE(dbmodel.getPermissionIndex(perm_aux, true), 1);
+		delete perm;
+
+		dbmodel.removePermissions(table);
+		dbmodel.getPermissions(table, perms);
+		QVERIFY(perms.empty());
+		QCOMPARE(dbmodel.getObjectCount(ObjectType::Permission), 1u);
+
+		dbmodel.getPermissions(table_aux, perms);
+		QCOMPARE(perms, std::vector<Permission *>({ perm_aux }));
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::indexRelationshipsAndSchemaChildren()
+{
+	DatabaseModel dbmodel;
+	Schema *public_sch = nullptr, *schema = new Schema;
+	Table *tables[3] = { nullptr, nullptr, nullptr };
+	BaseRelationship *rel12 = nullptr, *rel23 = nullptr, *rel_dup = nullptr;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		public_sch = dbmodel.getSchema("public");
+
+		schema->setName("schema_aux");
+		dbmodel.addSchema(schema);
+
+		for(unsigned i = 0; i < 3; i++)
+		{
+			tables[i] = new Table;
+			tables[i]->setName(QString("table_%1").arg(i + 1));
+			tables[i]->setSchema(public_sch);
+			dbmodel.addTable(tables[i]);
+		}
+
+		rel12 = new BaseRelationship(BaseRelationship::RelationshipDep, tables[0], tables[1], false, false);
+		rel23 = new BaseRelationship(BaseRelationship::RelationshipDep, tables[1], tables[2], false, false);
+		dbmodel.addRelationship(rel12);
+		dbmodel.addRelationship(rel23);
+
+		QCOMPARE(dbmodel.getRelationships(tables[0]), std::vector<BaseRelationship *>({ rel12 }));
+		QCOMPARE(dbmodel.getRelationships(tables[1]), std::vector<BaseRelationship *>({ rel12, rel23 }));
+		QCOMPARE(dbmodel.getRelationship(tables[1], tables[0]), rel12);
+		QCOMPARE(dbmodel.getRelationship(tables[2], nullptr), rel23);
+		QVERIFY(!dbmodel.getRelationship(tables[0], tables[2]));
+
+		// The duplicated relationship checking uses the relationships index
+		rel_dup = new BaseRelationship(BaseRelationship::RelationshipDep, tables[1], tables[0], false, false);
+
+		try
+		{
+			dbmodel.addRelationship(rel_dup);
+			QFAIL("Expected exception not thrown!");
+		}
+		catch(Exception &e)
+		{
+			QVERIFY(e.getErrorCode() == ErrorCode::InsDuplicatedRelationship);
+		}
+
+		delete rel_dup;
+
+		QCOMPARE(dbmodel.getObjects(ObjectType::Table, public_sch),
+						 std::vector<BaseObject *>({ tables[0], tables[1], tables[2] }));
+
+		// Moving a table to another schema updates the schemas children index
+		tables[2]->setSchema(schema);
+		QCOMPARE(dbmodel.getObjects(ObjectType::Table, public_sch), std::vector<BaseObject *>({ tables[0], tables[1] }));
+		QCOMPARE(dbmodel.getObjects(ObjectType::Table, schema), std::vector<BaseObject *>({ tables[2] }));
+		QCOMPARE(dbmodel.getObjects(ObjectType::BaseRelationship, schema), std::vector<BaseObject *>({ rel23 }));
+		QVERIFY(dbmodel.getObjects(ObjectType::View, schema).empty());
+
+		dbmodel.removeRelationship(rel12);
+		QVERIFY(dbmodel.getRelationships(tables[0]).empty());
+		QCOMPARE(dbmodel.getRelationships(tables[1]), std::vector<BaseRelationship *>({ rel23 }));
+		delete rel12;
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::generateInitialDataCommands()
+{
+	Table table;
+	Column *col = nullptr;
+	QString sig;
+
+	try
+	{
+		table.setName("table_test");
+
+		for(auto &name : { "id", "name" })
+		{
+			col = new Column;
+			col->setName(name);
+			col->setType(PgSqlType(name == QString("id") ? "integer" : "text"));
+			table.addColumn(col);
+		}
+
+		sig = table.getSignature();
+
+		// Unknown and duplicated columns are ignored
+		table.setInitialData("id;name;foo;id\n1;bar;x;3\n2;{upper('baz')};y;4\n");
+
+		PhysicalTable::setInitialDataFormat(PhysicalTable::InsertPerRow);
+		QCOMPARE(table.getInitialDataCommands(),
+						 QString("INSERT INTO %1 (id, name) VALUES (E'1', E'bar');\n-- ddl-end --\n"
+										 "INSERT INTO %1 (id, name) VALUES (E'2', upper('baz'));\n-- ddl-end --").arg(sig));
+
+		PhysicalTable::setInitialDataFormat(PhysicalTable::MultiRowInsert);
+		QCOMPARE(table.getInitialDataCommands(),
+						 QString("INSERT INTO %1 (id, name) VALUES\n(E'1', E'bar'),\n(E'2', upper('baz'));\n-- ddl-end --").arg(sig));
+
+		// Expressions can't be represented in COPY data so multi-row inserts are generated instead
+		PhysicalTable::setInitialDataFormat(PhysicalTable::CopyFromStdin);
+		QCOMPARE(table.getInitialDataCommands(),
+						 QString("INSERT INTO %1 (id, name) VALUES\n(E'1', E'bar'),\n(E'2', upper('baz'));\n-- ddl-end --").arg(sig));
+
+		// Changing the data invalidates the parsed rows
+		table.setInitialData("id;name\n1;\"a--b\"\n2;\"tab\there\"\n");
+		QCOMPARE(table.getInitialDataCommands(),
+						 QString("COPY %1 (id, name) FROM stdin;\n1\ta\\-\\-b\n2\ttab\\there\n\\.\n-- ddl-end --").arg(sig));
+
+		table.setInitialData("id;name\n1;bar;baz\n");
+		QVERIFY(table.getInitialDataCommands().startsWith("/* Failed to create initial data commands!"));
+
+		PhysicalTable::setInitialDataFormat(PhysicalTable::InsertPerRow);
+	}
+	catch(Exception &e)
+	{
+		PhysicalTable::setInitialDataFormat(PhysicalTable::InsertPerRow);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::saveLoadCatalogSnapshot()
+{
+	DatabaseModel dbmodel, loaded_model, reloaded_model;
+	QString input_dbm=SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm"),
+			output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + QString("demo_snapshot.dbm");
+	std::map<unsigned, std::tuple<ObjectType, QString, QString, QString>> snapshot = {
+		{ 16385, std::make_tuple(ObjectType::Schema, QString("public"), QString(), QString("1a2b3c")) },
+		{ 16390, std::make_tuple(ObjectType::Table, QString("public.\"Quoted & <table>\""), QString(), QString("4d5e6f")) },
+		{ 16395, std::make_tuple(ObjectType::Constraint, QString("pk_id"), QString("public.\"Quoted & <table>\""), QString("7a8b9c")) }
+	};
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input_dbm);
+		dbmodel.setCatalogSnapshot(16384, snapshot);
+		dbmodel.saveModel(output, SchemaParser::XmlCode);
+
+		loaded_model.createSystemObjects(false);
+		loaded_model.loadModel(output);
+
+		QVERIFY(loaded_model.getCatalogSnapshotDatabase() == 16384);
+		QVERIFY(loaded_model.getCatalogSnapshot() == snapshot);
+
+		// An empty snapshot isn't written to the file
+		loaded_model.clearCatalogSnapshot();
+		loaded_model.saveModel(output, SchemaParser::XmlCode);
+
+		reloaded_model.createSystemObjects(false);
+		reloaded_model.loadModel(output);
+		QVERIFY(reloaded_model.getCatalogSnapshot().empty());
+		QVERIFY(reloaded_model.getCatalogSnapshotDatabase() == 0);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::cloneTableRemappingReferences()
+{
+	DatabaseModel dbmodel, rcv_model;
+	Schema *schema = new Schema, *rcv_schema = new Schema;
+	Table *table = new Table, *clone = nullptr;
+	Constraint *pk = new Constraint, *fk = new Constraint;
+	Column *col = nullptr;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		schema->setName("sales");
+		dbmodel.addSchema(schema);
+
+		table->setName("orders");
+		table->setSchema(schema);
+
+		for(auto &name : { "id", "customer" })
+		{
+			col = new Column;
+			col->setName(name);
+			col->setType(PgSqlType("integer"));
+			table->addColumn(col);
+		}
+
+		pk->setName("orders_pk");
+		pk->setConstraintType(ConstraintType::PrimaryKey);
+		pk->addColumn(table->getColumn("id"), Constraint::SourceCols);
+		table->addConstraint(pk);
+
+		// Foreign keys are pasted as separated objects so they aren't cloned with the table
+		fk->setName("orders_fk");
+		fk->setConstraintType(ConstraintType::ForeignKey);
+		fk->setReferencedTable(table);
+		fk->addColumn(table->getColumn("customer"), Constraint::SourceCols);
+		fk->addColumn(table->getColumn("id"), Constraint::ReferencedCols);
+		table->addConstraint(fk);
+
+		dbmodel.addTable(table);
+
+		clone = dbmodel.cloneTable(table, false);
+		QVERIFY(clone != nullptr);
+		QVERIFY(clone->getSchema() == schema);
+		QCOMPARE(clone->getColumnCount(), 2u);
+		QCOMPARE(clone->getConstraintCount(), 1u);
+		QVERIFY(clone->getColumn("id") != table->getColumn("id"));
+		QVERIFY(clone->getColumn("id")->getParentTable() == clone);
+		QVERIFY(clone->getPrimaryKey()->getColumn(0, Constraint::SourceCols) == clone->getColumn("id"));
+		QVERIFY(table->getPrimaryKey()->getColumn(0, Constraint::SourceCols) == table->getColumn("id"));
+		QVERIFY(table->getColumn("id")->isNotNull());
+
+		clone->setName("orders_cp");
+		dbmodel.addTable(clone);
+		QVERIFY(dbmodel.getTable("sales.orders_cp") == clone);
+
+		// The table can't be cloned into a model that lacks the referenced schema
+		rcv_model.createSystemObjects(false);
+		QVERIFY(rcv_model.cloneTable(table, false) == nullptr);
+
+		rcv_schema->setName("sales");
+		rcv_model.addSchema(rcv_schema);
+
+		clone = rcv_model.cloneTable(table, false);
+		QVERIFY(clone != nullptr);
+		QVERIFY(clone->getSchema() == rcv_schema);
+		rcv_model.addTable(clone);
+		QVERIFY(rcv_model.getTable("sales.orders") == clone);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
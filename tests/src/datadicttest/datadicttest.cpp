@@ -22,6 +22,8 @@
 #include <QtTest/QtTest>
 #include "databasemodel.h"
 #include "pgmodelerunittest.h"
+#include "utilsns.h"
+#include <QTemporaryDir>
 
 class DataDictTest: public QObject, public PgModelerUnitTest {
 	Q_OBJECT
@@ -32,6 +34,7 @@ class DataDictTest: public QObject, public PgModelerUnitTest {
 	private slots:
 		void generateASimpleDataDict();
 		void generateASplittedDataDictFromSampleModel();
+		void generateAnIncrementalSplittedDataDict();
 };
 
 void DataDictTest::generateASimpleDataDict()
@@ -152,5 +155,53 @@ void DataDictTest::generateASplittedDataDictFromSampleModel()
 	}
 }
 
+void DataDictTest::generateAnIncrementalSplittedDataDict()
+{
+	DatabaseModel dbmodel;
+	QTemporaryDir tmp_dir;
+	QString path = tmp_dir.path(), unchanged_file, changed_file;
+	Table *unchanged_tab = nullptr, *changed_tab = nullptr;
+
+	try
+	{
+		QVERIFY(tmp_dir.isValid());
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(QString(SAMPLESDIR)+ "/demo.dbm");
+		QVERIFY(dbmodel.getObjectCount(ObjectType::Table) >= 2);
+
+		unchanged_tab = dbmodel.getTable(0u);
+		changed_tab = dbmodel.getTable(1u);
+		unchanged_file = path + "/" + unchanged_tab->getSignature().remove('"') + ".html";
+		changed_file = path + "/" + changed_tab->getSignature().remove('"') + ".html";
+
+		dbmodel.saveDataDictionary(path, true, true, false, true);
+		QVERIFY(QFileInfo::exists(path + "/" + DatabaseModel::DataDictManifest));
+		QVERIFY(QFileInfo::exists(unchanged_file));
+		QVERIFY(QFileInfo::exists(changed_file));
+
+		/* Replacing the contents of the files so we can check which
+		 * ones were written again in the incremental generation */
+		UtilsNs::saveFile(unchanged_file, "unchanged");
+		UtilsNs::saveFile(changed_file, "unchanged");
+
+		changed_tab->setComment("A comment that changes the data dictionary");
+		dbmodel.saveDataDictionary(path, true, true, false, true);
+
+		QCOMPARE(UtilsNs::loadFile(unchanged_file), QByteArray("unchanged"));
+		QVERIFY(UtilsNs::loadFile(changed_file).contains("A comment that changes the data dictionary"));
+
+		// Changes in the table's children must also cause the page to be rendered again
+		QVERIFY(unchanged_tab->getColumnCount() > 0);
+		unchanged_tab->getColumn(0)->setComment("A column comment that changes the data dictionary");
+		dbmodel.saveDataDictionary(path, true, true, false, true);
+
+		QVERIFY(UtilsNs::loadFile(unchanged_file).contains("A column comment that changes the data dictionary"));
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DataDictTest)
 #include "datadicttest.moc"
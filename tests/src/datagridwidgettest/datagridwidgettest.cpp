@@ -0,0 +1,56 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "tools/datagridwidget.h"
+
+class DataGridWidgetTest: public QObject {
+	Q_OBJECT
+
+	private slots:
+		void batchUpdatesOnlyPlainValues();
+		void batchInsertsWithoutExpressions();
+};
+
+void DataGridWidgetTest::batchUpdatesOnlyPlainValues()
+{
+	QVERIFY(DataGridWidget::isBatchableValue(DataGridWidget::OpUpdate, DataGridWidget::PlainValue, "foo"));
+	QVERIFY(DataGridWidget::isBatchableValue(DataGridWidget::OpUpdate, DataGridWidget::PlainValue, "foo\\bar"));
+
+	// Rows setting columns to DEFAULT or to expressions are updated one by one
+	QVERIFY(!DataGridWidget::isBatchableValue(DataGridWidget::OpUpdate, DataGridWidget::DefaultValue, ""));
+	QVERIFY(!DataGridWidget::isBatchableValue(DataGridWidget::OpUpdate, DataGridWidget::ExpressionValue, "now()"));
+	QVERIFY(!DataGridWidget::isBatchableValue(DataGridWidget::OpUpdate, DataGridWidget::ExpressionValue, "col_a + 1"));
+}
+
+void DataGridWidgetTest::batchInsertsWithoutExpressions()
+{
+	QVERIFY(DataGridWidget::isBatchableValue(DataGridWidget::OpInsert, DataGridWidget::PlainValue, "foo"));
+
+	// Columns with default values are omitted from the COPY column list
+	QVERIFY(DataGridWidget::isBatchableValue(DataGridWidget::OpInsert, DataGridWidget::DefaultValue, ""));
+
+	QVERIFY(!DataGridWidget::isBatchableValue(DataGridWidget::OpInsert, DataGridWidget::ExpressionValue, "now()"));
+	QVERIFY(!DataGridWidget::isBatchableValue(DataGridWidget::OpInsert, DataGridWidget::PlainValue, "foo\\bar"));
+}
+
+QTEST_MAIN(DataGridWidgetTest)
+#include "datagridwidgettest.moc"
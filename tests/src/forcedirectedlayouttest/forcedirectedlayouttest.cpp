@@ -0,0 +1,173 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "forcedirectedlayout.h"
+#include "exception.h"
+
+class ForceDirectedLayoutTest: public QObject {
+	Q_OBJECT
+
+	private:
+		static QList<QRectF> getRects(ForceDirectedLayout &layout, const QList<QSizeF> &sizes);
+
+		static bool hasOverlaps(const QList<QRectF> &rects);
+
+	private slots:
+		void placeNodesWithoutOverlaps();
+		void keepGroupsSeparated();
+		void rejectInvalidEdges();
+};
+
+QList<QRectF> ForceDirectedLayoutTest::getRects(ForceDirectedLayout &layout, const QList<QSizeF> &sizes)
+{
+	QList<QPointF> positions = layout.getPositions();
+	QList<QRectF> rects;
+
+	for(int idx = 0; idx < positions.size(); idx++)
+		rects.append(QRectF(positions[idx], sizes[idx]));
+
+	return rects;
+}
+
+bool ForceDirectedLayoutTest::hasOverlaps(const QList<QRectF> &rects)
+{
+	for(int idx = 0; idx < rects.size(); idx++)
+	{
+		for(int idx1 = idx + 1; idx1 < rects.size(); idx1++)
+		{
+			QRectF inter = rects[idx].intersected(rects[idx1]);
+
+			if(inter.width() > 0.5 && inter.height() > 0.5)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+void ForceDirectedLayoutTest::placeNodesWithoutOverlaps()
+{
+	try
+	{
+		ForceDirectedLayout layout;
+		QList<QSizeF> sizes;
+		QList<QRectF> rects;
+		QSignalSpy finished_spy(&layout, &ForceDirectedLayout::s_layoutFinished);
+
+		// All nodes start at the same position forcing the layout to spread them
+		for(int idx = 0; idx < 300; idx++)
+		{
+			sizes.append(QSizeF(150 + (idx % 4) * 30, 100 + (idx % 7) * 20));
+			layout.addNode(sizes.last(), QPointF(0, 0));
+
+			if(idx > 0)
+				layout.addEdge(idx, idx / 2);
+		}
+
+		layout.run();
+
+		QCOMPARE(finished_spy.count(), 1);
+		QCOMPARE(finished_spy.at(0).at(0).toBool(), false);
+
+		rects = getRects(layout, sizes);
+		QVERIFY(!hasOverlaps(rects));
+
+		// The layout starts at the default origin
+		QRectF brect;
+
+		for(auto &rect : rects)
+			brect = brect.united(rect);
+
+		QCOMPARE(brect.topLeft(), QPointF(50, 50));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ForceDirectedLayoutTest::keepGroupsSeparated()
+{
+	try
+	{
+		ForceDirectedLayout layout;
+		QList<QSizeF> sizes;
+		QList<QRectF> groups_rects;
+
+		for(int grp = 0; grp < 4; grp++)
+		{
+			for(int idx = 0; idx < 25; idx++)
+			{
+				sizes.append(QSizeF(120, 80));
+				layout.addNode(sizes.last(), QPointF(idx * 10, idx * 10), grp);
+
+				if(idx > 0)
+					layout.addEdge(sizes.size() - 1, sizes.size() - 2);
+			}
+		}
+
+		// Linking the first node of each group to the first one of the first group
+		layout.addEdge(0, 25);
+		layout.addEdge(0, 50);
+		layout.addEdge(0, 75);
+		layout.run();
+
+		QVERIFY(!hasOverlaps(getRects(layout, sizes)));
+
+		for(int grp = 0; grp < 4; grp++)
+		{
+			QVERIFY(layout.getGroupRect(grp).isValid());
+			groups_rects.append(layout.getGroupRect(grp));
+		}
+
+		// The rectangles of the groups (schemas) must not overlap each other
+		QVERIFY(!hasOverlaps(groups_rects));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ForceDirectedLayoutTest::rejectInvalidEdges()
+{
+	ForceDirectedLayout layout;
+
+	layout.addNode(QSizeF(100, 100), QPointF(0, 0));
+	layout.addNode(QSizeF(100, 100), QPointF(0, 0));
+	layout.addEdge(0, 1);
+
+	try
+	{
+		layout.addEdge(0, 2);
+		QFAIL("Expected exception not thrown!");
+	}
+	catch(Exception &e)
+	{
+		QCOMPARE(e.getErrorCode(), ErrorCode::RefElementInvalidIndex);
+	}
+
+	QCOMPARE(layout.getEdgeCount(), 1u);
+}
+
+QTEST_MAIN(ForceDirectedLayoutTest)
+#include "forcedirectedlayouttest.moc"
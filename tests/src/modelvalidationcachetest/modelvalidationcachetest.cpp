@@ -0,0 +1,164 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "tools/modelvalidationcache.h"
+#include "pgmodelerunittest.h"
+
+class ModelValidationCacheTest: public QObject, public PgModelerUnitTest {
+	Q_OBJECT
+
+	public:
+		ModelValidationCacheTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void discardInfosOfChangedObjectsOnly();
+		void trackTableChildrenThroughParentTable();
+		void discardInfosOfRemovedObjects();
+};
+
+void ModelValidationCacheTest::discardInfosOfChangedObjectsOnly()
+{
+	DatabaseModel dbmodel;
+	ModelValidationCache cache(&dbmodel, nullptr);
+	std::vector<Table *> tables;
+	std::vector<ValidationInfo> infos;
+	BaseRelationship *rel = nullptr;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		for(unsigned i = 0; i < 4; i++)
+		{
+			tables.push_back(new Table);
+			tables.back()->setName(QString("table_%1").arg(i));
+			tables.back()->setSchema(dbmodel.getSchema("public"));
+			dbmodel.addTable(tables.back());
+		}
+
+		rel = new BaseRelationship(BaseRelationship::RelationshipDep, tables[1], tables[2], false, false);
+		dbmodel.addRelationship(rel);
+
+		QVERIFY(!cache.getCachedInfos(tables[0], ModelValidationCache::BrokenRefsStep, infos));
+
+		for(auto &tab : tables)
+			cache.storeInfos(tab, ModelValidationCache::BrokenRefsStep, {});
+
+		cache.storeInfos(rel, ModelValidationCache::BrokenRefsStep, {});
+		cache.storeInfos(tables[0], ModelValidationCache::ConstrSemanticsStep,
+										 { ValidationInfo(ValidationInfo::UniqueSameAsPk, tables[0], { tables[3] }) });
+
+		QVERIFY(cache.getCachedInfos(tables[0], ModelValidationCache::ConstrSemanticsStep, infos));
+		QVERIFY(infos.size() == 1);
+		QCOMPARE(infos[0].getReferences(), std::vector<BaseObject *>({ tables[3] }));
+
+		// Changing a table affects the tables connected to it through relationships
+		cache.markObjectChanged(tables[1]);
+		cache.prepareValidation({ ObjectType::Schema, ObjectType::Table, ObjectType::Relationship });
+
+		QVERIFY(!cache.getCachedInfos(tables[1], ModelValidationCache::BrokenRefsStep, infos));
+		QVERIFY(!cache.getCachedInfos(tables[2], ModelValidationCache::BrokenRefsStep, infos));
+		QVERIFY(!cache.getCachedInfos(rel, ModelValidationCache::BrokenRefsStep, infos));
+		QVERIFY(cache.getCachedInfos(tables[0], ModelValidationCache::BrokenRefsStep, infos));
+		QVERIFY(cache.getCachedInfos(tables[0], ModelValidationCache::ConstrSemanticsStep, infos));
+		QVERIFY(cache.getCachedInfos(tables[3], ModelValidationCache::BrokenRefsStep, infos));
+
+		cache.invalidate();
+		QVERIFY(!cache.getCachedInfos(tables[0], ModelValidationCache::BrokenRefsStep, infos));
+		QVERIFY(!cache.getCachedInfos(tables[3], ModelValidationCache::BrokenRefsStep, infos));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelValidationCacheTest::trackTableChildrenThroughParentTable()
+{
+	DatabaseModel dbmodel;
+	ModelValidationCache cache(&dbmodel, nullptr);
+	Table *table = new Table, *table_aux = new Table;
+	Column *col = new Column;
+	std::vector<ValidationInfo> infos;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		for(auto &tab : { table, table_aux })
+		{
+			tab->setName(tab == table ? "table" : "table_aux");
+			tab->setSchema(dbmodel.getSchema("public"));
+			dbmodel.addTable(tab);
+			cache.storeInfos(tab, ModelValidationCache::BrokenRefsStep, {});
+		}
+
+		col->setName("id");
+		col->setType(PgSqlType("integer"));
+		table->addColumn(col);
+
+		cache.markObjectChanged(col);
+		cache.prepareValidation({ ObjectType::Table });
+
+		QVERIFY(!cache.getCachedInfos(table, ModelValidationCache::BrokenRefsStep, infos));
+		QVERIFY(cache.getCachedInfos(table_aux, ModelValidationCache::BrokenRefsStep, infos));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelValidationCacheTest::discardInfosOfRemovedObjects()
+{
+	DatabaseModel dbmodel;
+	ModelValidationCache cache(&dbmodel, nullptr);
+	Table *table = new Table, *table_aux = new Table;
+	std::vector<ValidationInfo> infos;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		for(auto &tab : { table, table_aux })
+		{
+			tab->setName(tab == table ? "table" : "table_aux");
+			tab->setSchema(dbmodel.getSchema("public"));
+			dbmodel.addTable(tab);
+			cache.storeInfos(tab, ModelValidationCache::BrokenRefsStep, {});
+		}
+
+		// The model signals feed the cache
+		dbmodel.removeTable(table);
+		delete table;
+
+		QVERIFY(cache.getCachedInfos(table_aux, ModelValidationCache::BrokenRefsStep, infos));
+		QCOMPARE(cache.getCachedInfos(table, ModelValidationCache::BrokenRefsStep, infos), false);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelValidationCacheTest)
+#include "modelvalidationcachetest.moc"
@@ -0,0 +1,203 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <QRandomGenerator>
+#include "utils/pngstreamwriter.h"
+#include "exception.h"
+
+class PngStreamWriterTest: public QObject {
+	Q_OBJECT
+
+	private:
+		//! \brief Creates a tile filled with pseudo-random (hard to compress) pixels
+		QImage createNoiseTile(int width, int height, quint32 seed);
+
+		//! \brief Writes the provided image in bands of tiles with the specified size
+		void writeInTiles(PngStreamWriter &writer, const QImage &img, int tile_size);
+
+		//! \brief Returns true when all the pixels of both images (ignoring alpha) are the same
+		bool hasSamePixels(const QImage &img1, const QImage &img2);
+
+	private slots:
+		void writeTilesAndReadBackImage();
+		void writeImageInMultipleIdatChunks();
+		void raiseErrorOnMismatchedBandWidth();
+		void removeIncompleteFileOnClose();
+};
+
+QImage PngStreamWriterTest::createNoiseTile(int width, int height, quint32 seed)
+{
+	QRandomGenerator rand_gen(seed);
+	QImage img(width, height, QImage::Format_RGB32);
+
+	for(int y = 0; y < height; y++)
+	{
+		QRgb *line = reinterpret_cast<QRgb *>(img.scanLine(y));
+
+		for(int x = 0; x < width; x++)
+			line[x] = qRgb(rand_gen.bounded(256), rand_gen.bounded(256), rand_gen.bounded(256));
+	}
+
+	return img;
+}
+
+void PngStreamWriterTest::writeInTiles(PngStreamWriter &writer, const QImage &img, int tile_size)
+{
+	QList<QImage> tiles;
+
+	for(int y = 0; y < img.height(); y += tile_size)
+	{
+		tiles.clear();
+
+		for(int x = 0; x < img.width(); x += tile_size)
+			tiles.append(img.copy(x, y, std::min(tile_size, img.width() - x), std::min(tile_size, img.height() - y)));
+
+		writer.writeRows(tiles);
+	}
+}
+
+bool PngStreamWriterTest::hasSamePixels(const QImage &img1, const QImage &img2)
+{
+	if(img1.size() != img2.size())
+		return false;
+
+	for(int y = 0; y < img1.height(); y++)
+	{
+		for(int x = 0; x < img1.width(); x++)
+		{
+			if(qRgb(qRed(img1.pixel(x, y)), qGreen(img1.pixel(x, y)), qBlue(img1.pixel(x, y))) !=
+				 qRgb(qRed(img2.pixel(x, y)), qGreen(img2.pixel(x, y)), qBlue(img2.pixel(x, y))))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void PngStreamWriterTest::writeTilesAndReadBackImage()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("tiles.png");
+	QImage src_img(170, 95, QImage::Format_RGB32), out_img;
+	PngStreamWriter writer;
+
+	// Four colored quadrants, so misplaced tiles or rows are easily detected
+	for(int y = 0; y < src_img.height(); y++)
+	{
+		for(int x = 0; x < src_img.width(); x++)
+		{
+			src_img.setPixel(x, y, x < 85 ? (y < 48 ? qRgb(255, 0, 0) : qRgb(0, 255, 0)) :
+																				(y < 48 ? qRgb(0, 0, 255) : qRgb(x, y, 128)));
+		}
+	}
+
+	try
+	{
+		// Tiles with 64px do not divide the image evenly so the last band and column are partial
+		writer.open(filename, src_img.width(), src_img.height());
+		writeInTiles(writer, src_img, 64);
+		QVERIFY(writer.getRowsWritten() == src_img.height());
+		writer.close();
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	QVERIFY(!writer.isOpen());
+	QVERIFY(out_img.load(filename, "PNG"));
+	QCOMPARE(out_img.size(), src_img.size());
+	QVERIFY(hasSamePixels(out_img, src_img));
+}
+
+void PngStreamWriterTest::writeImageInMultipleIdatChunks()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("noise.png");
+	QImage src_img = createNoiseTile(1024, 700, 42), out_img;
+	PngStreamWriter writer;
+
+	try
+	{
+		// Noise doesn't compress, so the stream exceeds the IDAT chunk size and is split
+		writer.open(filename, src_img.width(), src_img.height());
+		writeInTiles(writer, src_img, 256);
+		writer.close();
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	QVERIFY(QFileInfo(filename).size() > 1048576);
+	QVERIFY(out_img.load(filename, "PNG"));
+	QCOMPARE(out_img.size(), src_img.size());
+	QVERIFY(hasSamePixels(out_img, src_img));
+}
+
+void PngStreamWriterTest::raiseErrorOnMismatchedBandWidth()
+{
+	QTemporaryDir tmp_dir;
+	PngStreamWriter writer;
+
+	writer.open(tmp_dir.filePath("invalid.png"), 100, 50);
+
+	try
+	{
+		writer.writeRows({ createNoiseTile(60, 50, 1) });
+		QFAIL("No error raised for a band narrower than the image!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::InvImageTileDimensions);
+	}
+
+	writer.abort();
+	QVERIFY(!QFileInfo::exists(tmp_dir.filePath("invalid.png")));
+}
+
+void PngStreamWriterTest::removeIncompleteFileOnClose()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("incomplete.png");
+	PngStreamWriter writer;
+
+	writer.open(filename, 80, 80);
+	writer.writeRows({ createNoiseTile(80, 40, 7) });
+
+	try
+	{
+		writer.close();
+		QFAIL("No error raised when closing an image with missing rows!");
+	}
+	catch(Exception &e)
+	{
+		QVERIFY(e.getErrorCode() == ErrorCode::InvImageTileDimensions);
+	}
+
+	QVERIFY(!writer.isOpen());
+	QVERIFY(!QFileInfo::exists(filename));
+}
+
+QTEST_MAIN(PngStreamWriterTest)
+#include "pngstreamwritertest.moc"
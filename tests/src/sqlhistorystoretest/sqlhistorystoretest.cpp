@@ -0,0 +1,222 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "utils/sqlhistorystore.h"
+#include "exception.h"
+
+class SQLHistoryStoreTest: public QObject {
+	Q_OBJECT
+
+	private:
+		static QString getCommand(int id, int lines = 2);
+
+	private slots:
+		void loadOnlyTailOfHistory();
+		void keepSegmentsPerConnection();
+		void searchCommandsByWords();
+		void compactSegmentKeepingMostRecentCommands();
+		void recoverFromInterruptedAppend();
+};
+
+QString SQLHistoryStoreTest::getCommand(int id, int lines)
+{
+	QString cmd = QString("-- command %1 --\n").arg(id);
+
+	for(int ln = 1; ln < lines; ln++)
+		cmd += QString("SELECT %1 FROM table_%2;\n").arg(ln).arg(id);
+
+	return cmd;
+}
+
+void SQLHistoryStoreTest::loadOnlyTailOfHistory()
+{
+	try
+	{
+		QTemporaryDir tmp_dir;
+		SQLHistoryStore store;
+		QStringList tail;
+
+		store.setDirectory(tmp_dir.path());
+		QVERIFY(store.isEmpty());
+
+		for(int id = 0; id < 1000; id++)
+			store.append("conn", getCommand(id));
+
+		QCOMPARE(store.getEntriesCount("conn"), qint64(1000));
+		QCOMPARE(store.getLinesCount("conn"), qint64(2000));
+
+		// Each command has 2 lines, so only the last 5 commands fit in 10 lines
+		tail = store.loadTail("conn", 10);
+		QCOMPARE(tail.size(), 5);
+		QCOMPARE(tail.first(), getCommand(995));
+		QCOMPARE(tail.last(), getCommand(999));
+
+		// The last command is always returned even if it exceeds the limit
+		store.append("conn", getCommand(1000, 20));
+		tail = store.loadTail("conn", 10);
+		QCOMPARE(tail.size(), 1);
+		QCOMPARE(tail.first(), getCommand(1000, 20));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SQLHistoryStoreTest::keepSegmentsPerConnection()
+{
+	try
+	{
+		QTemporaryDir tmp_dir;
+		SQLHistoryStore store;
+		QStringList conns;
+
+		store.setDirectory(tmp_dir.path());
+		store.append("postgres@localhost:5432", getCommand(1));
+		store.append("admin@remote:5433", { getCommand(2), getCommand(3) });
+
+		conns = store.getConnections();
+		conns.sort();
+		QCOMPARE(conns, QStringList({ "admin@remote:5433", "postgres@localhost:5432" }));
+		QCOMPARE(store.loadTail("postgres@localhost:5432", 100), QStringList { getCommand(1) });
+		QCOMPARE(store.loadTail("admin@remote:5433", 100), QStringList({ getCommand(2), getCommand(3) }));
+
+		store.clear("admin@remote:5433");
+		QCOMPARE(store.getConnections(), QStringList { "postgres@localhost:5432" });
+
+		store.clearAll();
+		QVERIFY(store.isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SQLHistoryStoreTest::searchCommandsByWords()
+{
+	try
+	{
+		QTemporaryDir tmp_dir;
+		SQLHistoryStore store;
+		QStringList res;
+
+		store.setDirectory(tmp_dir.path());
+
+		for(int id = 0; id < 500; id++)
+			store.append("conn", getCommand(id));
+
+		// Words are matched as prefixes in a case insensitive way
+		res = store.search("conn", "TABLE_42", 100);
+		QCOMPARE(res.size(), 11);
+		QCOMPARE(res.first(), getCommand(42));
+
+		// All the words must be present in the command
+		res = store.search("conn", "from table_420", 100);
+		QCOMPARE(res, QStringList { getCommand(420) });
+
+		// Only the most recent results are returned
+		res = store.search("conn", "select", 3);
+		QCOMPARE(res, QStringList({ getCommand(497), getCommand(498), getCommand(499) }));
+
+		// Commands appended after the index was built are also searched
+		store.append("conn", "UPDATE accounts SET active = false;\n");
+		QCOMPARE(store.search("conn", "accounts", 10).size(), 1);
+
+		QVERIFY(store.search("conn", "inexistent", 10).isEmpty());
+		QVERIFY(store.search("other_conn", "select", 10).isEmpty());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SQLHistoryStoreTest::compactSegmentKeepingMostRecentCommands()
+{
+	try
+	{
+		QTemporaryDir tmp_dir;
+		SQLHistoryStore store;
+
+		store.setDirectory(tmp_dir.path());
+
+		for(int id = 0; id < 100; id++)
+			store.append("conn", getCommand(id));
+
+		// The segment is not rewritten when it doesn't have twice the lines to keep
+		store.compact("conn", 150);
+		QCOMPARE(store.getEntriesCount("conn"), qint64(100));
+
+		store.search("conn", "select", 1);
+		store.compact("conn", 20);
+		QCOMPARE(store.getEntriesCount("conn"), qint64(10));
+		QCOMPARE(store.loadTail("conn", 1000).first(), getCommand(90));
+		QVERIFY(store.search("conn", "table_10", 10).isEmpty());
+		QCOMPARE(store.search("conn", "table_95", 10).size(), 1);
+
+		store.append("conn", getCommand(100));
+		QCOMPARE(store.loadTail("conn", 4), QStringList({ getCommand(99), getCommand(100) }));
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void SQLHistoryStoreTest::recoverFromInterruptedAppend()
+{
+	try
+	{
+		QTemporaryDir tmp_dir;
+		SQLHistoryStore store;
+		QDir dir(tmp_dir.path());
+		QString log_file, idx_file;
+
+		store.setDirectory(tmp_dir.path());
+
+		for(int id = 0; id < 10; id++)
+			store.append("conn", getCommand(id));
+
+		log_file = dir.absoluteFilePath(dir.entryList({ "*.log" }).first());
+		idx_file = dir.absoluteFilePath(dir.entryList({ "*.idx" }).first());
+
+		// Simulating a crash while writing the last record and a lost offset index
+		QFile log(log_file);
+		QVERIFY(log.resize(log.size() - 5));
+		QVERIFY(QFile::remove(idx_file));
+
+		QCOMPARE(store.getEntriesCount("conn"), qint64(9));
+		QCOMPARE(store.loadTail("conn", 4), QStringList({ getCommand(7), getCommand(8) }));
+
+		store.append("conn", getCommand(10));
+		QCOMPARE(store.loadTail("conn", 2), QStringList { getCommand(10) });
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(SQLHistoryStoreTest)
+#include "sqlhistorystoretest.moc"
@@ -0,0 +1,127 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "catalogsymbolindex.h"
+
+class SymbolTrieTest: public QObject {
+	Q_OBJECT
+
+	private slots:
+		void testFindReturnsMatchesInAlphabeticalOrder();
+		void testFindIsCaseInsensitive();
+		void testFindPrefixEndingInsideEdgeLabel();
+		void testFindUnknownPrefixReturnsNothing();
+		void testEmptyPrefixReturnsAllSymbols();
+		void testFindRespectsLimit();
+		void testDuplicatedKeysKeepInsertionOrder();
+};
+
+void SymbolTrieTest::testFindReturnsMatchesInAlphabeticalOrder()
+{
+	SymbolTrie trie;
+
+	trie.insert("customer_orders", 0);
+	trie.insert("customer", 1);
+	trie.insert("country", 2);
+	trie.insert("customer_address", 3);
+	trie.insert("product", 4);
+
+	QCOMPARE(trie.find("cu"), std::vector<unsigned>({ 1, 3, 0 }));
+	QCOMPARE(trie.find("co"), std::vector<unsigned>({ 2 }));
+	QCOMPARE(trie.find("customer_"), std::vector<unsigned>({ 3, 0 }));
+}
+
+void SymbolTrieTest::testFindIsCaseInsensitive()
+{
+	SymbolTrie trie;
+
+	trie.insert("OrderItems", 0);
+	trie.insert("orders", 1);
+
+	QCOMPARE(trie.find("ORDER"), std::vector<unsigned>({ 0, 1 }));
+	QCOMPARE(trie.find("orderi"), std::vector<unsigned>({ 0 }));
+}
+
+void SymbolTrieTest::testFindPrefixEndingInsideEdgeLabel()
+{
+	SymbolTrie trie;
+
+	trie.insert("information_schema", 0);
+	trie.insert("inventory", 1);
+
+	QCOMPARE(trie.find("infor"), std::vector<unsigned>({ 0 }));
+	QCOMPARE(trie.find("inv"), std::vector<unsigned>({ 1 }));
+	QCOMPARE(trie.find("in"), std::vector<unsigned>({ 0, 1 }));
+}
+
+void SymbolTrieTest::testFindUnknownPrefixReturnsNothing()
+{
+	SymbolTrie trie;
+
+	trie.insert("public", 0);
+
+	QVERIFY(trie.find("publica").empty());
+	QVERIFY(trie.find("pg").empty());
+	QVERIFY(trie.find("x").empty());
+}
+
+void SymbolTrieTest::testEmptyPrefixReturnsAllSymbols()
+{
+	SymbolTrie trie;
+
+	trie.insert("b", 0);
+	trie.insert("a", 1);
+	trie.insert("ab", 2);
+
+	QCOMPARE(trie.find(""), std::vector<unsigned>({ 1, 2, 0 }));
+
+	trie.clear();
+	QVERIFY(trie.find("").empty());
+	QCOMPARE(trie.getNodeCount(), 1u);
+}
+
+void SymbolTrieTest::testFindRespectsLimit()
+{
+	SymbolTrie trie;
+
+	for(unsigned id = 0; id < 100; id++)
+		trie.insert(QString("table_%1").arg(id, 3, 10, QChar('0')), id);
+
+	QCOMPARE(trie.find("table_", 5), std::vector<unsigned>({ 0, 1, 2, 3, 4 }));
+	QCOMPARE(trie.find("table_09", 0).size(), size_t(10));
+}
+
+void SymbolTrieTest::testDuplicatedKeysKeepInsertionOrder()
+{
+	SymbolTrie trie;
+
+	// Overloaded functions share the same key
+	trie.insert("calc", 0);
+	trie.insert("calc", 1);
+	trie.insert("calculate", 2);
+
+	QCOMPARE(trie.find("calc"), std::vector<unsigned>({ 0, 1, 2 }));
+	QCOMPARE(trie.find("calcu"), std::vector<unsigned>({ 2 }));
+}
+
+QTEST_MAIN(SymbolTrieTest)
+#include "symboltrietest.moc"
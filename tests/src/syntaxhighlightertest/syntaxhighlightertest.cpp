@@ -21,9 +21,11 @@
 
 #include <QtTest/QtTest>
 #include "utils/syntaxhighlighter.h"
+#include "utils/wordmatcher.h"
 #include "pgmodelerunittest.h"
 #include <QDialog>
 #include <QHBoxLayout>
+#include <QTextLayout>
 
 class SyntaxHighlighterTest: public QObject, public PgModelerUnitTest {
 	Q_OBJECT
@@ -32,9 +34,100 @@ class SyntaxHighlighterTest: public QObject, public PgModelerUnitTest {
 		SyntaxHighlighterTest() : PgModelerUnitTest(SCHEMASDIR) {}
 
 	private slots:
+		void wordMatcherMatchesOnlyWholeWords();
+		void wordMatcherPicksLongestWord();
+		void highlightLargeScriptInBackground();
+		void skipHighlightAboveSizeLimit();
 		void handleMultiLineComment();
 };
 
+void SyntaxHighlighterTest::wordMatcherMatchesOnlyWholeWords()
+{
+	WordMatcher matcher(false);
+	QList<MatchInfo> matches;
+
+	matcher.addWord("select");
+	matcher.addWord("from");
+	matcher.addWord("\"char\"");
+
+	QVERIFY(matcher.match("SELECT col FROM selection, fromage, \"char\" x", 0, matches));
+	QCOMPARE(matches.size(), 3);
+	QCOMPARE(matches[0], MatchInfo(0, 5));
+	QCOMPARE(matches[1], MatchInfo(11, 14));
+	QCOMPARE(matches[2], MatchInfo(36, 41));
+
+	matches.clear();
+	QVERIFY(!matcher.match("selected_from", 0, matches));
+	QVERIFY(matches.isEmpty());
+}
+
+void SyntaxHighlighterTest::wordMatcherPicksLongestWord()
+{
+	WordMatcher matcher(true);
+	QList<MatchInfo> matches;
+	MatchInfo m_info;
+
+	matcher.addWord("with");
+	matcher.addWord("with time zone");
+
+	QVERIFY(matcher.match("timestamp with time zone", 0, matches));
+	QCOMPARE(matches.size(), 1);
+	QCOMPARE(matches[0], MatchInfo(10, 23));
+
+	// Case sensitive matcher must not match words in other case
+	matches.clear();
+	QVERIFY(!matcher.match("timestamp WITH time zone", 0, matches));
+
+	QVERIFY(matcher.match("a with b", 1, m_info));
+	QCOMPARE(m_info, MatchInfo(2, 5));
+}
+
+void SyntaxHighlighterTest::highlightLargeScriptInBackground()
+{
+	QPlainTextEdit edt;
+	SyntaxHighlighter sql_hl(&edt, false);
+	QStringList lines;
+
+	sql_hl.loadConfiguration(GlobalAttributes::getSQLHighlightConfPath());
+
+	for(int i = 0; i < 50000; i++)
+	{
+		lines.append(QString("SELECT t%1.id, t%1.name FROM public.table_%1 AS t%1 /* multi\nline */ "
+												 "WHERE t%1.value IS NOT NULL; -- line %1").arg(i));
+	}
+
+	edt.setPlainText(lines.join('\n'));
+
+	// The visible blocks are highlighted right away while the remaining ones are postponed
+	QVERIFY(!edt.document()->firstBlock().layout()->formats().isEmpty());
+	QVERIFY(sql_hl.hasPendingBlocks());
+
+	QTRY_VERIFY_WITH_TIMEOUT(!sql_hl.hasPendingBlocks(), 120000);
+	QVERIFY(!edt.document()->lastBlock().layout()->formats().isEmpty());
+}
+
+void SyntaxHighlighterTest::skipHighlightAboveSizeLimit()
+{
+	QPlainTextEdit edt;
+	SyntaxHighlighter sql_hl(&edt, false);
+	QString line = "SELECT * FROM public.table_a WHERE id IS NOT NULL;\n";
+
+	sql_hl.loadConfiguration(GlobalAttributes::getSQLHighlightConfPath());
+	SyntaxHighlighter::setHighlightSizeLimit(1);
+
+	// The limit is counted in characters, so a document just below one million characters is highlighted
+	edt.setPlainText(line.repeated((1000000 / line.size()) - 1));
+	QVERIFY(!edt.document()->firstBlock().layout()->formats().isEmpty());
+
+	edt.setPlainText(line.repeated((1000000 / line.size()) + 1));
+	QVERIFY(edt.document()->firstBlock().layout()->formats().isEmpty());
+	QVERIFY(!sql_hl.hasPendingBlocks());
+
+	SyntaxHighlighter::setHighlightSizeLimit(0);
+	sql_hl.rehighlight();
+	QVERIFY(!edt.document()->firstBlock().layout()->formats().isEmpty());
+}
+
 void SyntaxHighlighterTest::handleMultiLineComment()
 {
 	QDialog *dlg=new QDialog;
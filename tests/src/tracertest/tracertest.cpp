@@ -0,0 +1,112 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# (c) Copyright 2006-2026 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# DEVELOPMENT, MAINTENANCE AND COMMERCIAL DISTRIBUTION BY:
+# Nullptr Labs Software e Tecnologia LTDA <contact@nullptrlabs.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include "tracer.h"
+#include "exception.h"
+
+class TracerTest: public QObject {
+	Q_OBJECT
+
+	private:
+		QJsonArray readEvents(const QString &filename);
+
+	private slots:
+		void dontRecordEventsWhenDisabled();
+		void writeScopesAndCountersAsTraceEvents();
+};
+
+QJsonArray TracerTest::readEvents(const QString &filename)
+{
+	QFile file(filename);
+
+	if(!file.open(QFile::ReadOnly))
+		return QJsonArray();
+
+	return QJsonDocument::fromJson(file.readAll()).object().value("traceEvents").toArray();
+}
+
+void TracerTest::dontRecordEventsWhenDisabled()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("disabled.json");
+
+	QVERIFY(!Tracer::isEnabled());
+
+	{
+		PGM_TRACE_SCOPE("test", "disabled scope");
+		PGM_TRACE_COUNTER("test", "disabled counter", 1);
+	}
+
+	// Stopping a disabled tracer must not create the output file
+	Tracer::stop();
+	QVERIFY(!QFileInfo::exists(filename));
+}
+
+void TracerTest::writeScopesAndCountersAsTraceEvents()
+{
+	QTemporaryDir tmp_dir;
+	QString filename = tmp_dir.filePath("trace.json");
+	QJsonArray events;
+	QJsonObject scope_evnt, counter_evnt;
+
+	try
+	{
+		Tracer::start(filename);
+		QVERIFY(Tracer::isEnabled());
+
+		{
+			PGM_TRACE_SCOPE("test", "outer scope");
+			PGM_TRACE_COUNTER("test", "items", 42);
+		}
+
+		Tracer::stop();
+		QVERIFY(!Tracer::isEnabled());
+
+		events = readEvents(filename);
+		QCOMPARE(events.size(), 2);
+
+		// The counter is recorded first since the scope event is only added when the scope ends
+		counter_evnt = events.at(0).toObject();
+		scope_evnt = events.at(1).toObject();
+
+		QCOMPARE(counter_evnt.value("ph").toString(), QString("C"));
+		QCOMPARE(counter_evnt.value("name").toString(), QString("items"));
+		QCOMPARE(counter_evnt.value("args").toObject().value("value").toDouble(), 42.0);
+
+		QCOMPARE(scope_evnt.value("ph").toString(), QString("X"));
+		QCOMPARE(scope_evnt.value("cat").toString(), QString("test"));
+		QCOMPARE(scope_evnt.value("name").toString(), QString("outer scope"));
+		QVERIFY(scope_evnt.value("dur").toDouble() >= 0);
+		QVERIFY(scope_evnt.value("ts").toDouble() <= counter_evnt.value("ts").toDouble());
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(TracerTest)
+#include "tracertest.moc"